@@ -0,0 +1,227 @@
+//=============================================================================
+// File:		Benchmark.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Benchmark
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "Benchmark.h"
+#include "../Main/DSProfiling/Profiler.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	std::atomic<unsigned long long> sAllocationCount(0);
+	std::vector<DSBenchmark::Result> sResults;
+	std::string sFilter;
+	volatile float sSink = 0.0f;
+}
+
+//=============================================================================
+//Global Allocation Counting
+//=============================================================================
+
+void* operator new(std::size_t size)
+{
+	++sAllocationCount;
+
+	void* pMemory = malloc(size == 0 ? 1 : size);
+	if(pMemory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return pMemory;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* pMemory) throw()
+{
+	free(pMemory);
+}
+
+void operator delete[](void* pMemory) throw()
+{
+	free(pMemory);
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Variables:
+	pGroup = what is being measured (eg. "Quaternion"), used to line engine and glm results up next to each other.
+	pName = the operation, prefixed with "glm " for the reference implementation.
+	elementCount = elements processed per repetition; results are reported per element.
+*/
+void DSBenchmark::Benchmark::Run(const char* pGroup, const char* pName, unsigned int elementCount, DSBenchmark::BenchmarkFunction pFunction, void* pUserData)
+{
+	std::string fullName = std::string(pGroup) + " " + pName;
+	if(sFilter.empty() == false && fullName.find(sFilter) == std::string::npos)
+	{
+		return;
+	}
+
+	//Warm up caches, branch predictors and any lazily allocated state
+	pFunction(pUserData, elementCount);
+
+	unsigned long long fastestTicks = ~0ull;
+	unsigned long long totalTicks = 0;
+	unsigned long long allocationsBefore = sAllocationCount.load();
+	unsigned int repetitions = 0;
+	while
+	(
+		repetitions < kMinRepetitions
+	||	(repetitions < kMaxRepetitions && DSProfiling::Profiler::TicksToMs(totalTicks) < kMinTotalMs)
+	)
+	{
+		unsigned long long start = DSProfiling::Profiler::GetTicks();
+		pFunction(pUserData, elementCount);
+		unsigned long long ticks = DSProfiling::Profiler::GetTicks() - start;
+
+		fastestTicks = ticks < fastestTicks ? ticks : fastestTicks;
+		totalTicks += ticks;
+		++repetitions;
+	}
+	unsigned long long allocations = sAllocationCount.load() - allocationsBefore;
+
+	DSBenchmark::Result result;
+	result.mGroup = pGroup;
+	result.mName = pName;
+	result.mElementCount = elementCount;
+	result.mRepetitions = repetitions;
+	result.mNsPerOperation = DSProfiling::Profiler::TicksToMs(fastestTicks) * 1000000.0 / elementCount;
+	result.mAllocationsPerRepetition = static_cast<double>(allocations) / repetitions;
+	sResults.push_back(result);
+
+	printf("%-12s %-32s %9u %10.3f ns/op %10.1f allocs\n", pGroup, pName, elementCount, result.mNsPerOperation, result.mAllocationsPerRepetition);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Keeps the optimizer from removing work whose results are otherwise never used.
+*/
+void DSBenchmark::Benchmark::Consume(float value)
+{
+	sSink = sSink + value;
+}
+
+//-----------------------------------------------------------------------------
+//  Output
+
+/*
+Description:
+	Prints every result with the engine/glm ratio for results that have a matching "glm " entry at the same element count.
+*/
+void DSBenchmark::Benchmark::PrintResults()
+{
+	printf("\n%-12s %-32s %9s %10s %10s\n", "Group", "Name", "Elements", "ns/op", "vs glm");
+
+	std::vector<DSBenchmark::Result>::const_iterator it;
+	for(it = sResults.begin(); it != sResults.end(); ++it)
+	{
+		//Find the reference
+		double reference = 0.0;
+		std::vector<DSBenchmark::Result>::const_iterator ref;
+		for(ref = sResults.begin(); ref != sResults.end(); ++ref)
+		{
+			if(ref->mGroup == it->mGroup && ref->mElementCount == it->mElementCount && ref->mName.compare(0, 4, "glm ") == 0 && it->mName.compare(0, 4, "glm ") != 0)
+			{
+				reference = ref->mNsPerOperation;
+				break;
+			}
+		}
+
+		if(reference > 0.0)
+		{
+			printf("%-12s %-32s %9u %10.3f %9.2fx\n", it->mGroup.c_str(), it->mName.c_str(), it->mElementCount, it->mNsPerOperation, reference / it->mNsPerOperation);
+		}
+		else
+		{
+			printf("%-12s %-32s %9u %10.3f %10s\n", it->mGroup.c_str(), it->mName.c_str(), it->mElementCount, it->mNsPerOperation, "");
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Writes every result as comma separated values, one line per benchmark and element count,
+	so that runs from different commits can be diffed or charted.
+*/
+bool DSBenchmark::Benchmark::WriteCsv(const char* pFilePath)
+{
+	FILE* pFile = nullptr;
+	if(fopen_s(&pFile, pFilePath, "w") != 0 || pFile == nullptr)
+	{
+		fprintf(stderr, "WARNING: Could not open \"%s\" for writing.\n", pFilePath);
+		return false;
+	}
+
+	fprintf(pFile, "group,name,elements,repetitions,ns_per_op,allocs_per_repetition\n");
+	std::vector<DSBenchmark::Result>::const_iterator it;
+	for(it = sResults.begin(); it != sResults.end(); ++it)
+	{
+		fprintf(pFile, "%s,%s,%u,%u,%.4f,%.2f\n", it->mGroup.c_str(), it->mName.c_str(), it->mElementCount, it->mRepetitions, it->mNsPerOperation, it->mAllocationsPerRepetition);
+	}
+
+	fclose(pFile);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+const std::vector<DSBenchmark::Result>& DSBenchmark::Benchmark::GetResults()
+{
+	return sResults;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned long long DSBenchmark::Benchmark::GetAllocationCount()
+{
+	return sAllocationCount.load();
+}
+
+//-----------------------------------------------------------------------------
+// Setters
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	pFilter = only benchmarks whose "group name" contains this text are run. Empty runs everything.
+*/
+void DSBenchmark::Benchmark::SetFilter(const char* pFilter)
+{
+	sFilter = pFilter;
+}
\ No newline at end of file
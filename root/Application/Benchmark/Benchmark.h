@@ -0,0 +1,105 @@
+//=============================================================================
+// File:		Benchmark.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Benchmark. Times engine hot paths against their glm equivalents, reporting nanoseconds per operation and heap allocations.
+//=============================================================================
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <string>
+#include <vector>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSBenchmark
+{
+
+	//=============================================================================
+	//Typedefs
+	//=============================================================================
+
+	/*
+	Notes:
+		Performs the operation being measured once for every one of elementCount elements.
+		All setup (allocating and filling inputs) happens before, outside the timed region.
+	*/
+	typedef void (*BenchmarkFunction)(void* pUserData, unsigned int elementCount);
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	struct Result
+	{
+		std::string mGroup;
+		std::string mName;
+		unsigned int mElementCount;
+		unsigned int mRepetitions;
+		double mNsPerOperation;//fastest repetition
+		double mAllocationsPerRepetition;
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Usage:
+		Benchmark::Run("Quaternion", "Multiply", elementCount, MultiplyQuaternions, &data);
+	Notes:
+		Each benchmark is repeated until it has run for kMinTotalMs (and at least kMinRepetitions times), and the fastest repetition is kept.
+		The fastest run is the one least disturbed by the rest of the system, which keeps results comparable between commits.
+		Allocations are counted by replacing the global operator new, so they include everything allocated inside the timed function.
+	*/
+	class Benchmark
+	{
+	private:
+		//Constructors
+		Benchmark();
+
+		//Member Functions
+	public:
+		// General
+		static void Run(const char* pGroup, const char* pName, unsigned int elementCount, BenchmarkFunction pFunction, void* pUserData);
+		static void Consume(float value);
+
+		// Output
+		static void PrintResults();
+		static bool WriteCsv(const char* pFilePath);
+
+		// Getters
+		static const std::vector<DSBenchmark::Result>& GetResults();
+		static unsigned long long GetAllocationCount();
+
+		// Setters
+		static void SetFilter(const char* pFilter);
+
+		//Member Variables
+	public:
+		static const unsigned int kMinRepetitions = 3;
+		static const unsigned int kMaxRepetitions = 1000;
+		static const unsigned int kMinTotalMs = 200;
+	};
+
+	//=============================================================================
+	//Function Prototypes
+	//=============================================================================
+
+	// Suites (one file each)
+	void RunQuaternionBenchmarks(unsigned int elementCount);
+	void RunCameraBenchmarks(unsigned int elementCount);
+	void RunModelInstanceBenchmarks(unsigned int elementCount);
+
+}//namespace DSBenchmark
+
+#endif //#ifndef BENCHMARK_H
\ No newline at end of file
@@ -0,0 +1,122 @@
+//=============================================================================
+// File:		BenchmarkCamera.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	DSGraphics::Camera matrices against building them with glm directly.
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLM
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// Standard C++ Libraries
+#include <vector>
+
+// Daniel Schenker
+#include "Benchmark.h"
+#include "../Main/DSGraphics/Camera.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	/*
+	Notes:
+		One camera queried elementCount times, which is how rendering uses it (once per instance per frame).
+	*/
+	struct CameraData
+	{
+		CameraData()
+		:	mCamera(glm::vec3(1.0f, 2.0f, 3.0f), DSMathematics::Quaternion(0.5f, glm::normalize(glm::vec3(1.0f, 1.0f, 0.0f))), 90.0f, 0.01f, 1000.0f, 16.0f / 9.0f)
+		{
+		}
+
+		DSGraphics::Camera mCamera;
+		std::vector<glm::mat4> mOut;
+	};
+
+	//-----------------------------------------------------------------------------
+	//  Unchanged camera
+
+	void GetView(void* pUserData, unsigned int elementCount)
+	{
+		CameraData& data = *static_cast<CameraData*>(pUserData);
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mOut[i] = data.mCamera.GetView();
+		}
+		DSBenchmark::Benchmark::Consume(data.mOut[elementCount / 2][0][0]);
+	}
+
+	void GetProj(void* pUserData, unsigned int elementCount)
+	{
+		CameraData& data = *static_cast<CameraData*>(pUserData);
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mOut[i] = data.mCamera.GetProj();
+		}
+		DSBenchmark::Benchmark::Consume(data.mOut[elementCount / 2][0][0]);
+	}
+
+	void GetMatrix(void* pUserData, unsigned int elementCount)
+	{
+		CameraData& data = *static_cast<CameraData*>(pUserData);
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mOut[i] = data.mCamera.GetMatrix();
+		}
+		DSBenchmark::Benchmark::Consume(data.mOut[elementCount / 2][0][0]);
+	}
+
+	void GlmMatrix(void* pUserData, unsigned int elementCount)
+	{
+		CameraData& data = *static_cast<CameraData*>(pUserData);
+		const DSMathematics::Quaternion& q = data.mCamera.GetOrientation();
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			glm::mat4 view = glm::mat4_cast(glm::inverse(glm::quat(q.mW, q.mV.x, q.mV.y, q.mV.z))) * glm::translate(glm::mat4(1.0f), -data.mCamera.GetPosition());
+			glm::mat4 proj = glm::perspective(glm::radians(data.mCamera.GetFoV()), data.mCamera.GetViewportAspectRatio(), data.mCamera.GetNearPlane(), data.mCamera.GetFarPlane());
+			data.mOut[i] = proj * view;
+		}
+		DSBenchmark::Benchmark::Consume(data.mOut[elementCount / 2][0][0]);
+	}
+
+	//-----------------------------------------------------------------------------
+	//  Moving camera (worst case for anything cached)
+
+	void MoveGetMatrix(void* pUserData, unsigned int elementCount)
+	{
+		CameraData& data = *static_cast<CameraData*>(pUserData);
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mCamera.Move(glm::vec3(0.001f, 0.0f, 0.0f));
+			data.mOut[i] = data.mCamera.GetMatrix();
+		}
+		DSBenchmark::Benchmark::Consume(data.mOut[elementCount / 2][0][0]);
+	}
+}
+
+//=============================================================================
+//Suite
+//=============================================================================
+
+void DSBenchmark::RunCameraBenchmarks(unsigned int elementCount)
+{
+	CameraData data;
+	data.mOut.resize(elementCount);
+
+	DSBenchmark::Benchmark::Run("Camera", "Camera::GetView", elementCount, GetView, &data);
+	DSBenchmark::Benchmark::Run("Camera", "Camera::GetProj", elementCount, GetProj, &data);
+	DSBenchmark::Benchmark::Run("Camera", "Camera::GetMatrix", elementCount, GetMatrix, &data);
+	DSBenchmark::Benchmark::Run("Camera", "Camera::Move+GetMatrix", elementCount, MoveGetMatrix, &data);
+	DSBenchmark::Benchmark::Run("Camera", "glm perspective*view", elementCount, GlmMatrix, &data);
+}
\ No newline at end of file
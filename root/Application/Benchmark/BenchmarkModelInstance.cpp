@@ -0,0 +1,119 @@
+//=============================================================================
+// File:		BenchmarkModelInstance.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Instance transform updates (ModelInstance and TransformStore) against composing translate * rotate * scale with glm.
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLM
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// Standard C++ Libraries
+#include <vector>
+
+// Daniel Schenker
+#include "Benchmark.h"
+#include "../Main/DSGraphics/ModelInstance.h"
+#include "../Main/DSGraphics/TransformStore.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	/*
+	Notes:
+		Every repetition moves every instance, so every transform really is recomputed.
+	*/
+	struct ModelInstanceData
+	{
+		std::vector<DSGraphics::ModelInstance> mInstances;
+		DSGraphics::TransformStore mStore;
+		std::vector<glm::vec3> mPositions;
+		std::vector<glm::quat> mGlmOrientations;
+		std::vector<glm::vec3> mSizes;
+		std::vector<glm::mat4> mGlmOut;
+		float mOffset;
+	};
+
+	//-----------------------------------------------------------------------------
+
+	void UpdateTransform(void* pUserData, unsigned int elementCount)
+	{
+		ModelInstanceData& data = *static_cast<ModelInstanceData*>(pUserData);
+		data.mOffset += 0.001f;
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mInstances[i].SetPosition(data.mPositions[i] + data.mOffset);
+			data.mInstances[i].UpdateTransform();
+		}
+		DSBenchmark::Benchmark::Consume(data.mInstances[elementCount / 2].GetTransform()[3][0]);
+	}
+
+	void UpdateWorldMatrices(void* pUserData, unsigned int elementCount)
+	{
+		ModelInstanceData& data = *static_cast<ModelInstanceData*>(pUserData);
+		data.mOffset += 0.001f;
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mStore.SetPosition(i, data.mPositions[i] + data.mOffset);
+		}
+		data.mStore.UpdateWorldMatrices();
+		DSBenchmark::Benchmark::Consume(data.mStore.GetWorldMatrix(elementCount / 2)[3][0]);
+	}
+
+	void GlmTranslateRotateScale(void* pUserData, unsigned int elementCount)
+	{
+		ModelInstanceData& data = *static_cast<ModelInstanceData*>(pUserData);
+		data.mOffset += 0.001f;
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mGlmOut[i] = glm::translate(glm::mat4(1.0f), data.mPositions[i] + data.mOffset) * glm::mat4_cast(data.mGlmOrientations[i]) * glm::scale(glm::mat4(1.0f), data.mSizes[i]);
+		}
+		DSBenchmark::Benchmark::Consume(data.mGlmOut[elementCount / 2][3][0]);
+	}
+}
+
+//=============================================================================
+//Suite
+//=============================================================================
+
+void DSBenchmark::RunModelInstanceBenchmarks(unsigned int elementCount)
+{
+	ModelInstanceData data;
+	data.mOffset = 0.0f;
+	DSGraphics::ModelHandle noModel;//only the transforms are measured
+	data.mInstances.reserve(elementCount);
+	data.mStore.Reserve(elementCount);
+	for(unsigned int i = 0; i < elementCount; ++i)
+	{
+		glm::vec3 position(static_cast<float>(i % 100), static_cast<float>(i / 100 % 100), static_cast<float>(i / 10000));
+		DSMathematics::Quaternion orientation(i * 0.01f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f)));
+		glm::vec3 size(1.0f + (i % 3));
+
+		DSGraphics::ModelInstance instance(noModel);
+		instance.SetSize(size);
+		instance.SetOrientation(orientation);
+		data.mInstances.push_back(instance);
+
+		data.mStore.Create(position, orientation, size);
+
+		data.mPositions.push_back(position);
+		data.mGlmOrientations.push_back(glm::quat(orientation.mW, orientation.mV.x, orientation.mV.y, orientation.mV.z));
+		data.mSizes.push_back(size);
+	}
+	data.mGlmOut.resize(elementCount);
+
+	DSBenchmark::Benchmark::Run("Transform", "ModelInstance::UpdateTransform", elementCount, UpdateTransform, &data);
+	DSBenchmark::Benchmark::Run("Transform", "TransformStore::Update", elementCount, UpdateWorldMatrices, &data);
+	DSBenchmark::Benchmark::Run("Transform", "glm translate*rotate*scale", elementCount, GlmTranslateRotateScale, &data);
+}
\ No newline at end of file
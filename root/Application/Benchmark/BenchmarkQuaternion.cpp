@@ -0,0 +1,180 @@
+//=============================================================================
+// File:		BenchmarkQuaternion.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	DSMathematics::Quaternion against glm::quat.
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLM
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// Standard C++ Libraries
+#include <cstdlib>
+#include <vector>
+
+// Daniel Schenker
+#include "Benchmark.h"
+#include "../Main/DSMathematics/Quaternion.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	struct QuaternionData
+	{
+		std::vector<DSMathematics::Quaternion> mA;
+		std::vector<DSMathematics::Quaternion> mB;
+		std::vector<DSMathematics::Quaternion> mOut;
+		std::vector<glm::quat> mGlmA;
+		std::vector<glm::quat> mGlmB;
+		std::vector<glm::quat> mGlmOut;
+		std::vector<glm::vec3> mVectors;
+		std::vector<glm::vec3> mVectorsOut;
+		std::vector<float> mT;
+	};
+
+	float RandomFloat()
+	{
+		return static_cast<float>(rand()) / RAND_MAX * 2.0f - 1.0f;
+	}
+
+	//-----------------------------------------------------------------------------
+	//  Multiply
+
+	void Multiply(void* pUserData, unsigned int elementCount)
+	{
+		QuaternionData& data = *static_cast<QuaternionData*>(pUserData);
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mOut[i] = data.mA[i].Multiply(data.mB[i]);
+		}
+		DSBenchmark::Benchmark::Consume(data.mOut[elementCount / 2].mW);
+	}
+
+	void MultiplyArray(void* pUserData, unsigned int elementCount)
+	{
+		QuaternionData& data = *static_cast<QuaternionData*>(pUserData);
+		DSMathematics::Quaternion::MultiplyArray(&data.mA[0], &data.mB[0], &data.mOut[0], elementCount);
+		DSBenchmark::Benchmark::Consume(data.mOut[elementCount / 2].mW);
+	}
+
+	void GlmMultiply(void* pUserData, unsigned int elementCount)
+	{
+		QuaternionData& data = *static_cast<QuaternionData*>(pUserData);
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mGlmOut[i] = data.mGlmB[i] * data.mGlmA[i];
+		}
+		DSBenchmark::Benchmark::Consume(data.mGlmOut[elementCount / 2].w);
+	}
+
+	//-----------------------------------------------------------------------------
+	//  Rotate
+
+	void Rotate(void* pUserData, unsigned int elementCount)
+	{
+		QuaternionData& data = *static_cast<QuaternionData*>(pUserData);
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mVectorsOut[i] = data.mA[i].Rotate(data.mVectors[i]);
+		}
+		DSBenchmark::Benchmark::Consume(data.mVectorsOut[elementCount / 2].x);
+	}
+
+	void RotateArray(void* pUserData, unsigned int elementCount)
+	{
+		QuaternionData& data = *static_cast<QuaternionData*>(pUserData);
+		DSMathematics::Quaternion::RotateArray(&data.mA[0], &data.mVectors[0], &data.mVectorsOut[0], elementCount);
+		DSBenchmark::Benchmark::Consume(data.mVectorsOut[elementCount / 2].x);
+	}
+
+	void GlmRotate(void* pUserData, unsigned int elementCount)
+	{
+		QuaternionData& data = *static_cast<QuaternionData*>(pUserData);
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mVectorsOut[i] = data.mGlmA[i] * data.mVectors[i];
+		}
+		DSBenchmark::Benchmark::Consume(data.mVectorsOut[elementCount / 2].x);
+	}
+
+	//-----------------------------------------------------------------------------
+	//  Interpolation
+
+	void Slerp(void* pUserData, unsigned int elementCount)
+	{
+		QuaternionData& data = *static_cast<QuaternionData*>(pUserData);
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mOut[i] = data.mA[i].Slerp(data.mB[i], data.mT[i]);
+		}
+		DSBenchmark::Benchmark::Consume(data.mOut[elementCount / 2].mW);
+	}
+
+	void Nlerp(void* pUserData, unsigned int elementCount)
+	{
+		QuaternionData& data = *static_cast<QuaternionData*>(pUserData);
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mOut[i] = data.mA[i].Nlerp(data.mB[i], data.mT[i]);
+		}
+		DSBenchmark::Benchmark::Consume(data.mOut[elementCount / 2].mW);
+	}
+
+	void GlmSlerp(void* pUserData, unsigned int elementCount)
+	{
+		QuaternionData& data = *static_cast<QuaternionData*>(pUserData);
+		for(unsigned int i = 0; i < elementCount; ++i)
+		{
+			data.mGlmOut[i] = glm::slerp(data.mGlmA[i], data.mGlmB[i], data.mT[i]);
+		}
+		DSBenchmark::Benchmark::Consume(data.mGlmOut[elementCount / 2].w);
+	}
+}
+
+//=============================================================================
+//Suite
+//=============================================================================
+
+void DSBenchmark::RunQuaternionBenchmarks(unsigned int elementCount)
+{
+	//Same inputs on every run, so that results are comparable between commits
+	srand(1);
+
+	QuaternionData data;
+	for(unsigned int i = 0; i < elementCount; ++i)
+	{
+		DSMathematics::Quaternion a(RandomFloat() * 3.0f, glm::normalize(glm::vec3(RandomFloat(), RandomFloat(), RandomFloat()) + glm::vec3(0.0f, 0.0f, 2.0f)));
+		DSMathematics::Quaternion b(RandomFloat() * 3.0f, glm::normalize(glm::vec3(RandomFloat(), RandomFloat(), RandomFloat()) + glm::vec3(0.0f, 2.0f, 0.0f)));
+		data.mA.push_back(a);
+		data.mB.push_back(b);
+		data.mGlmA.push_back(glm::quat(a.mW, a.mV.x, a.mV.y, a.mV.z));
+		data.mGlmB.push_back(glm::quat(b.mW, b.mV.x, b.mV.y, b.mV.z));
+		data.mVectors.push_back(glm::vec3(RandomFloat(), RandomFloat(), RandomFloat()));
+		data.mT.push_back((RandomFloat() + 1.0f) * 0.5f);
+	}
+	data.mOut.resize(elementCount);
+	data.mGlmOut.resize(elementCount);
+	data.mVectorsOut.resize(elementCount);
+
+	DSBenchmark::Benchmark::Run("Multiply", "Quaternion::Multiply", elementCount, Multiply, &data);
+	DSBenchmark::Benchmark::Run("Multiply", "Quaternion::MultiplyArray", elementCount, MultiplyArray, &data);
+	DSBenchmark::Benchmark::Run("Multiply", "glm quat * quat", elementCount, GlmMultiply, &data);
+
+	DSBenchmark::Benchmark::Run("Rotate", "Quaternion::Rotate", elementCount, Rotate, &data);
+	DSBenchmark::Benchmark::Run("Rotate", "Quaternion::RotateArray", elementCount, RotateArray, &data);
+	DSBenchmark::Benchmark::Run("Rotate", "glm quat * vec3", elementCount, GlmRotate, &data);
+
+	DSBenchmark::Benchmark::Run("Slerp", "Quaternion::Slerp", elementCount, Slerp, &data);
+	DSBenchmark::Benchmark::Run("Slerp", "Quaternion::Nlerp", elementCount, Nlerp, &data);
+	DSBenchmark::Benchmark::Run("Slerp", "glm slerp", elementCount, GlmSlerp, &data);
+}
\ No newline at end of file
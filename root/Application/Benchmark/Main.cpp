@@ -0,0 +1,81 @@
+//=============================================================================
+// File:		Main.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Benchmark entry point.
+//				Usage: Benchmark.exe [--filter text] [--csv file] [--max elements]
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstdlib>
+#include <cstring>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "Benchmark.h"
+#include "../Main/DSProfiling/Profiler.h"
+
+//=============================================================================
+//Main
+//=============================================================================
+
+int main(int argc, char* argv[])
+{
+	const char* pCsvFile = nullptr;
+	unsigned int maxElementCount = 1000000;
+
+	//Arguments
+	for(int i = 1; i + 1 < argc; i += 2)
+	{
+		if(strcmp(argv[i], "--filter") == 0)
+		{
+			DSBenchmark::Benchmark::SetFilter(argv[i + 1]);
+		}
+		else if(strcmp(argv[i], "--csv") == 0)
+		{
+			pCsvFile = argv[i + 1];
+		}
+		else if(strcmp(argv[i], "--max") == 0)
+		{
+			maxElementCount = static_cast<unsigned int>(atoi(argv[i + 1]));
+		}
+		else
+		{
+			fprintf(stderr, "WARNING: Unknown argument \"%s\".\n", argv[i]);
+		}
+	}
+
+	//The profiler provides the timer; its zones stay disabled so they don't add to the measurements
+	DSProfiling::Profiler::Initialize();
+	DSProfiling::Profiler::SetIsEnabled(false);
+
+	//1k elements fit in L1, 1M elements do not fit in any cache
+	const unsigned int kElementCounts[] = { 1000, 10000, 100000, 1000000 };
+	for(unsigned int i = 0; i < sizeof(kElementCounts) / sizeof(kElementCounts[0]); ++i)
+	{
+		if(kElementCounts[i] > maxElementCount)
+		{
+			break;
+		}
+
+		DSBenchmark::RunQuaternionBenchmarks(kElementCounts[i]);
+		DSBenchmark::RunCameraBenchmarks(kElementCounts[i]);
+		DSBenchmark::RunModelInstanceBenchmarks(kElementCounts[i]);
+	}
+
+	DSBenchmark::Benchmark::PrintResults();
+
+	if(pCsvFile != nullptr)
+	{
+		DSBenchmark::Benchmark::WriteCsv(pCsvFile);
+	}
+
+	DSProfiling::Profiler::Terminate();
+
+	return 0;
+}
\ No newline at end of file
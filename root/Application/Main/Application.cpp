@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		Application.cpp
 // Created:		2015/02/10
-// Last Edited:	2015/04/10
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	Application
 //=============================================================================
@@ -11,6 +11,8 @@
 //=============================================================================
 
 // Standard C++ Libraries
+#include <chrono>
+#include <cmath>
 #include <iostream>//check
 #include <stdio.h>//check
 #include <time.h>
@@ -18,6 +20,9 @@
 
 // Daniel Schenker
 #include "Application.h"
+#include "DSEntity/CommandBuffer.h"
+#include "DSGraphics/MeshFile.h"
+#include "DSGraphics/VertexStream.h"
 #include "DSMathematics/Quaternion.h"
 
 //=============================================================================
@@ -30,6 +35,79 @@ void OnError(int errorCode, const char* msg);
 //Statics
 //=============================================================================
 
+namespace
+{
+	//Chunk functions for the systems and PublishSnapshot
+
+	void StorePreviousStatesChunk(const DSEntity::Chunk& chunk, void* pUserData)
+	{
+		DSGraphics::ModelInstance* pInstances = chunk.Get<DSGraphics::ModelInstance>();
+		for(unsigned int i = 0; i < chunk.GetCount(); ++i)
+		{
+			pInstances[i].StorePreviousState();
+		}
+	}
+
+	/*
+	Variables:
+		pUserData = the DSPhysics::RigidBodyWorld the chunk's bodies are in.
+	*/
+	void WriteBackRigidBodiesChunk(const DSEntity::Chunk& chunk, void* pUserData)
+	{
+		const DSPhysics::RigidBodyWorld* pRigidBodies = static_cast<const DSPhysics::RigidBodyWorld*>(pUserData);
+		pRigidBodies->WriteBack(chunk.Get<DSPhysics::RigidBody>(), chunk.Get<DSGraphics::ModelInstance>(), chunk.GetCount());
+	}
+
+	/*
+	Variables:
+		pUserData = the std::vector<DSGraphics::ModelInstance> to append to.
+	*/
+	void AppendInstancesChunk(const DSEntity::Chunk& chunk, void* pUserData)
+	{
+		std::vector<DSGraphics::ModelInstance>& instances = *static_cast<std::vector<DSGraphics::ModelInstance>*>(pUserData);
+
+		const DSGraphics::ModelInstance* pInstances = chunk.Get<DSGraphics::ModelInstance>();
+		instances.insert(instances.end(), pInstances, pInstances + chunk.GetCount());
+	}
+}
+
+//=============================================================================
+//Structs
+//=============================================================================
+
+/*
+Description:
+	What one load task produces for another: read or cooked on a worker, then uploaded or applied on the context thread.
+*/
+struct Application::LoadData
+{
+	LoadData()
+	:	mpWallMesh(nullptr)
+	,	mpSpaceshipStarterMesh(nullptr)
+	{
+	}
+
+	~LoadData()
+	{
+		delete mpWallMesh;
+		delete mpSpaceshipStarterMesh;
+	}
+
+	// Textures (PrepareTextures -> LoadTextures)
+	DSGraphics::PreparedTexture mTextureSpaceship;
+
+	// Meshes (PrepareObjects -> LoadObjects)
+	DSGraphics::MeshFile* mpWallMesh;
+	DSGraphics::MeshFile* mpSpaceshipStarterMesh;
+
+	// Instances (CreateInitialInstances* -> CreateInitialInstances), a buffer per category since they are recorded at the same time
+	DSEntity::CommandBuffer mAbstracts;
+	DSEntity::CommandBuffer mAesthetics;
+	DSEntity::CommandBuffer mEnvironmentals;
+	DSEntity::CommandBuffer mPlayers;
+	DSEntity::CommandBuffer mUnits;
+};
+
 //=============================================================================
 //Class Definitions
 //=============================================================================
@@ -41,6 +119,9 @@ void OnError(int errorCode, const char* msg);
 Application::Application()
 //General
 :	mQuit(false)
+,	mStartupTicks(0)
+//Loading
+,	mpLoadData(nullptr)
 //Window
 ,	mpWindow(nullptr)
 ,	mWindowSize(1280, 720)
@@ -49,14 +130,24 @@ Application::Application()
 ,	mLastTime(0.0)
 ,	mThisTime(0.0)
 ,	mElapsedTime(0.0)
+//Simulation
+,	mpSimulationException()
+,	mSimulationTimeStep(1.0 / 60.0)
+,	mMaxSimulationStepsPerFrame(5)
+,	mSimulationAccumulator(0.0)
+,	mSimulationStepIndex(0)
+//Profiler
+,	mpGpuProfiler(nullptr)
+,	mIsProfileKeyDown(false)
+,	mIsGpuMemoryKeyDown(false)
 //Camera
 ,	mpCamera(nullptr)
 ,	mUniformCamera(0)
 //Shader Programs
-,	mpProgramColorOnly(nullptr)
-,	mpProgramTexAndColor(nullptr)
+,	mProgramColorOnly()
+,	mProgramTexAndColor()
 //Textures
-,	mpTextureSpaceship(nullptr)
+,	mTextureSpaceship()
 //Objects
 // Abstracts
 // Aesthetics
@@ -65,8 +156,25 @@ Application::Application()
 // Player
 ,	mpSpaceshipStarter(nullptr)
 // Units
-//Individual Objects
-,	mDegreesRotated(0.0f)
+//Entities
+,	mpWorld(nullptr)
+,	mpSystems(nullptr)
+,	mpQueryInstances(nullptr)
+,	mpQueryRigidBodies(nullptr)
+,	mpQueryAbstracts(nullptr)
+,	mpQueryAesthetics(nullptr)
+,	mpQueryEnvironmentals(nullptr)
+,	mpQueryPlayers(nullptr)
+,	mpQueryUnits(nullptr)
+//Rigid Bodies
+,	mpRigidBodies(nullptr)
+//Soft Bodies
+,	mpSoftBodies(nullptr)
+,	mpSpaceshipStarterShape(nullptr)
+,	mpPlayer1Mesh(nullptr)
+,	mPlayer1Body(0)
+,	mImpactCount(0)
+,	mIsImpactKeyDown(false)
 {
 	Initialize();
 	Run();
@@ -93,12 +201,19 @@ Application::~Application()
 //   1. Game initalization
 void Application::Initialize()
 {
+	mStartupTicks = DSProfiling::Profiler::GetTicks();
+
+	InitializeMemory();
+
 	if(InitializeGLFW() == true)
 	{
 		if(InitializeGLEW() == true)
 		{
+			InitializeProfiler();
+			DSThreading::JobSystem::Initialize();
+			DSGraphics::AssetManager::Initialize();
+			DSGraphics::VertexStream::Initialize();
 			Load();
-			CreateInitialInstances();
 		}
 	}
 }
@@ -106,10 +221,19 @@ void Application::Initialize()
 //-----------------------------------------------------------------------------
 
 //   2. Main game loop
+/*
+Notes:
+	The simulation (AI, Physics) runs on its own thread, while this thread keeps the GL context, polls input and renders.
+	With both busy, a frame costs roughly the slower of the two instead of their sum.
+*/
 void Application::Run()
 {
 	mLastTime = glfwGetTime();
 
+	StartSimulation();
+
+	bool isFirstFrame = true;
+
 	//[Closed] Event Loop
 	while(mQuit == false)//while(glfwWindowShouldClose(mpWindow) == false)
 	{
@@ -117,16 +241,36 @@ void Application::Run()
 		mThisTime = glfwGetTime();
 		mElapsedTime = mThisTime - mLastTime;
 
+		DSProfiling::Profiler::BeginFrame();
+		mpGpuProfiler->BeginFrame();
+		DSMemory::MemoryManager::BeginFrame();
+		DSGraphics::GpuMemory::BeginFrame();
+		DSGraphics::VertexStream::BeginFrame();
+
 		Input();
-		AI();
-		Physics();
 		Render();
+		DSGraphics::AssetManager::CollectGarbage();
+
+		DSProfiling::Profiler::EndFrame();
+
+		if(isFirstFrame == true)
+		{
+			printf("Time to first frame: %.2f ms\n", DSProfiling::Profiler::TicksToMs(DSProfiling::Profiler::GetTicks() - mStartupTicks));
+			isFirstFrame = false;
+		}
 
 		mLastTime = mThisTime;
 	}
 
+	StopSimulation();
+
 	//Close the window
 	glfwSetWindowShouldClose(mpWindow, GL_TRUE);
+
+	if(mpSimulationException != nullptr)
+	{
+		std::rethrow_exception(mpSimulationException);
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -135,7 +279,43 @@ void Application::Run()
 void Application::Terminate()
 {
 	CleanUp();
+	DSThreading::JobSystem::Terminate();
+	TerminateProfiler();
 	TerminateGLFW();
+	TerminateMemory();
+}
+
+//-----------------------------------------------------------------------------
+//  Memory
+
+/*
+Notes:
+	Budgets only warn; they are there to notice growth, so set them comfortably above what the content currently needs.
+*/
+void Application::InitializeMemory()
+{
+	DSMemory::MemoryManager::Initialize();
+
+	DSMemory::MemoryTracker::SetBudget(DSMemory::kMemoryTagEntities, 16 * 1024 * 1024);
+	DSMemory::MemoryTracker::SetBudget(DSMemory::kMemoryTagRendering, 8 * 1024 * 1024);
+	DSMemory::MemoryTracker::SetBudget(DSMemory::kMemoryTagMeshes, 32 * 1024 * 1024);
+	DSMemory::MemoryTracker::SetBudget(DSMemory::kMemoryTagTextures, 64 * 1024 * 1024);
+	DSMemory::MemoryTracker::SetBudget(DSMemory::kMemoryTagShaders, 1024 * 1024);
+	DSMemory::MemoryTracker::SetBudget(DSMemory::kMemoryTagLoading, 32 * 1024 * 1024);
+
+	DSGraphics::GpuMemory::SetBudget(256 * 1024 * 1024);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Last to run, so whatever the report shows as still live was leaked, or belongs to statics (eg. the component registry) that outlive the application.
+*/
+void Application::TerminateMemory()
+{
+	DSMemory::MemoryManager::Terminate();
+	DSMemory::MemoryTracker::PrintReport();
 }
 
 //-----------------------------------------------------------------------------
@@ -231,16 +411,121 @@ bool Application::InitializeGLEW()
 	}
 }
 
+//-----------------------------------------------------------------------------
+//  Profiler
+
+void Application::InitializeProfiler()
+{
+	DSProfiling::Profiler::Initialize();
+
+	//Requires the GL context, hence created after GLEW
+	if(mpGpuProfiler == nullptr)
+	{
+		mpGpuProfiler = new DSProfiling::GpuProfiler();
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void Application::TerminateProfiler()
+{
+	DSProfiling::Profiler::PrintReport();
+
+	if(mpGpuProfiler != nullptr)
+	{
+		delete mpGpuProfiler;
+		mpGpuProfiler = nullptr;
+	}
+
+	DSProfiling::Profiler::Terminate();
+}
+
 //-----------------------------------------------------------------------------
 // Initialize Sub-Functions
 //-----------------------------------------------------------------------------
 
+/*
+Description:
+	Loads everything as a graph of tasks, each starting as soon as what it needs is done, then prints how long each took and the critical path.
+	Reading, decoding and cooking happen on the job system's workers; the steps that make GL objects run here, on the context thread, while the workers carry on:
+
+		LoadResourcePack -+-> PrepareTextures -> LoadTextures* -+
+		                  +-> PrepareObjects ---------------------+-> LoadObjects* -+
+		LoadShaders* ---------------------------------------------+                 +-> CreateInitialInstances* (one task per category) -> CreateInitialInstances
+		LoadCamera, LoadWorld ------------------------------------------------------+
+
+		* on the context thread
+Notes:
+	A step that throws stops the steps that haven't started, and the exception is rethrown here once the running ones finish.
+*/
 void Application::Load()
 {
-		LoadCamera();
-		LoadShaders();
-		LoadTextures();
-		LoadObjects();
+	LoadData loadData;
+	mpLoadData = &loadData;
+
+	DSThreading::TaskGraph graph;
+	unsigned int resourcePack = graph.Add("Load Resource Pack", LoadStep<&Application::LoadResourcePack>, this);
+	unsigned int camera = graph.Add("Load Camera", LoadStep<&Application::LoadCamera>, this);
+	unsigned int shaders = graph.Add("Load Shaders", LoadStep<&Application::LoadShaders>, this, DSThreading::kTaskContextThread);
+	unsigned int prepareTextures = graph.Add("Prepare Textures", LoadStep<&Application::PrepareTextures>, this);
+	unsigned int textures = graph.Add("Load Textures", LoadStep<&Application::LoadTextures>, this, DSThreading::kTaskContextThread);
+	unsigned int prepareObjects = graph.Add("Prepare Objects", LoadStep<&Application::PrepareObjects>, this);
+	unsigned int objects = graph.Add("Load Objects", LoadStep<&Application::LoadObjects>, this, DSThreading::kTaskContextThread);
+	unsigned int world = graph.Add("Load World", LoadStep<&Application::LoadWorld>, this);
+	unsigned int instances = graph.Add("Create Initial Instances", LoadStep<&Application::CreateInitialInstances>, this);
+
+	graph.AddDependency(prepareTextures, resourcePack);
+	graph.AddDependency(textures, prepareTextures);
+	graph.AddDependency(prepareObjects, resourcePack);
+	graph.AddDependency(objects, prepareObjects);
+	graph.AddDependency(objects, shaders);
+	graph.AddDependency(objects, textures);
+
+	//Each category records its instances into its own command buffer, so they can all run at once
+	unsigned int categories[] =
+	{
+		graph.Add("Create Initial Abstracts", LoadStep<&Application::CreateInitialInstancesAbstracts>, this),
+		graph.Add("Create Initial Aesthetics", LoadStep<&Application::CreateInitialInstancesAesthetics>, this),
+		graph.Add("Create Initial Environmentals", LoadStep<&Application::CreateInitialInstancesEnvironmentals>, this),
+		graph.Add("Create Initial Players", LoadStep<&Application::CreateInitialInstancesPlayers>, this),
+		graph.Add("Create Initial Units", LoadStep<&Application::CreateInitialInstancesUnits>, this)
+	};
+	for(unsigned int i = 0; i < sizeof(categories) / sizeof(categories[0]); ++i)
+	{
+		graph.AddDependency(categories[i], objects);
+		graph.AddDependency(categories[i], world);
+		graph.AddDependency(categories[i], camera);
+		graph.AddDependency(instances, categories[i]);
+	}
+
+	try
+	{
+		graph.Run();
+	}
+	catch(...)
+	{
+		//loadData is about to go out of scope
+		mpLoadData = nullptr;
+		throw;
+	}
+	mpLoadData = nullptr;
+
+	graph.PrintReport("Startup");
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	With Resources.dspack built (see the Packer tool), every texture and mesh under Resources is read from that one file.
+	Without it, or for anything added since it was built, they are read from the loose files.
+*/
+void Application::LoadResourcePack()
+{
+	if(DSSystem::ResourceFile::Mount("../../Resources/Resources.dspack", "../../Resources/") == false)
+	{
+		printf("No resource pack, reading loose resource files.\n");
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -273,35 +558,33 @@ void Application::LoadCamera()
 
 void Application::LoadShaders()
 {
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagShaders);
+
 	// Wall
-	if(mpProgramColorOnly == nullptr)
-	{
-		mpProgramColorOnly = CreateProgram("Shaders/ColorOnly.VertexShader", "Shaders/ColorOnly.FragmentShader");
-	}
-	else
-	{
-		fprintf(stderr, "WARNING: mpProgramColorOnly is being used due to it not having a default value of nullptr. Attempting to continue regardless. Incorrect rendering may occur unless this is intentional.\n");
-	}
+	mProgramColorOnly = DSGraphics::AssetManager::LoadProgram("Shaders/ColorOnly.VertexShader", "Shaders/ColorOnly.FragmentShader");
 
 	//Tex and Color
-	if(mpProgramTexAndColor == nullptr)
-	{
-		mpProgramTexAndColor = CreateProgram("Shaders/TexAndColor.VertexShader", "Shaders/TexAndColor.FragmentShader");
-	}
-	else
-	{
-		fprintf(stderr, "WARNING: mpProgramTexAndColor is being used due to it not having a default value of nullptr. Attempting to continue regardless. Incorrect rendering may occur unless this is intentional.\n");
-	}
+	mProgramTexAndColor = DSGraphics::AssetManager::LoadProgram("Shaders/TexAndColor.VertexShader", "Shaders/TexAndColor.FragmentShader");
 }
 
 //-----------------------------------------------------------------------------
 
-DSGraphics::Program* Application::CreateProgram(const char* vertexShaderFile, const char* fragmentShaderFile)
+/*
+Description:
+	Reads and cooks (or finds in the cache) every texture, ready for LoadTextures to upload.
+Notes:
+	Textures are cooked into ../../Cache/ the first time they are loaded, and after that uploaded straight from there (see DSGraphics::TextureCache).
+	Delete the directory to have everything cooked again.
+*/
+void Application::PrepareTextures()
 {
-	std::vector<DSGraphics::Shader> shaders;
-	shaders.push_back(DSGraphics::Shader::CreateShaderFromFile(vertexShaderFile, GL_VERTEX_SHADER));
-	shaders.push_back(DSGraphics::Shader::CreateShaderFromFile(fragmentShaderFile, GL_FRAGMENT_SHADER));
-	return new DSGraphics::Program(shaders);
+	//Texture cache
+	DSGraphics::TextureCache::SetDirectory("../../Cache/");
+
+	//Textures
+	DSGraphics::TextureOptions spaceshipOptions;
+	spaceshipOptions.mHasMipmaps = true;
+	DSGraphics::Texture::Prepare("../../Resources/Textures/stripes.png", spaceshipOptions, mpLoadData->mTextureSpaceship);
 }
 
 //-----------------------------------------------------------------------------
@@ -309,20 +592,32 @@ DSGraphics::Program* Application::CreateProgram(const char* vertexShaderFile, co
 void Application::LoadTextures()
 {
 	//Textures
-	if(mpTextureSpaceship == nullptr)
-	{
-		mpTextureSpaceship = new DSGraphics::Texture("../../Resources/Textures/stripes.png");
-	}
-	else
-	{
-		fprintf(stderr, "WARNING: mpTextureSpaceship is being used due to it not having a default value of nullptr. Attempting to continue regardless. Incorrect texture may appear unless this is intentional.\n");
-	}
+	mTextureSpaceship = DSGraphics::AssetManager::LoadTexture(mpLoadData->mTextureSpaceship);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Reads every object's mesh, ready for LoadObjects to upload. From a compressed resource pack, this is where the meshes are inflated.
+*/
+void Application::PrepareObjects()
+{
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagMeshes);
+
+	//Environmentals
+	mpLoadData->mpWallMesh = new DSGraphics::MeshFile(Wall::GetMeshFile());
+
+	//Players
+	mpLoadData->mpSpaceshipStarterMesh = new DSGraphics::MeshFile(SpaceshipStarter::GetMeshFile());
 }
 
 //-----------------------------------------------------------------------------
 
 void Application::LoadObjects()
 {
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagMeshes);
+
 	LoadObjectsAbstracts();
 	LoadObjectsAesthetics();
 	LoadObjectsEnvironmentals();
@@ -350,7 +645,7 @@ void Application::LoadObjectsEnvironmentals()
 	if(mpWall == nullptr)
 	{
 		mpWall = new Wall();
-		mpWall->LoadAsset(mpProgramColorOnly, nullptr);
+		mpWall->LoadAsset(mProgramColorOnly, DSGraphics::TextureHandle(), mpLoadData->mpWallMesh);
 	}
 }
 
@@ -362,7 +657,14 @@ void Application::LoadObjectsPlayers()
 	if(mpSpaceshipStarter == nullptr)
 	{
 		mpSpaceshipStarter = new SpaceshipStarter();
-		mpSpaceshipStarter->LoadAsset(mpProgramTexAndColor, mpTextureSpaceship);
+		mpSpaceshipStarter->LoadAsset(mProgramTexAndColor, mTextureSpaceship, mpLoadData->mpSpaceshipStarterMesh);
+	}
+
+	//SpaceshipStarter's soft body (reads the mesh back from the GPU, hence here on the context thread)
+	if(mpSpaceshipStarterShape == nullptr && mpSpaceshipStarter->GetIsModelAssetLoaded() == true)
+	{
+		mpSpaceshipStarterShape = new DSPhysics::SoftBodyShape();
+		mpSpaceshipStarterShape->Build(*DSGraphics::AssetManager::Get(mpSpaceshipStarter->GetModelAsset()));
 	}
 }
 
@@ -374,13 +676,59 @@ void Application::LoadObjectsUnits()
 
 //-----------------------------------------------------------------------------
 
-void Application::CreateInitialInstances()
+/*
+Description:
+	Registers the component types, creates the world with the queries the systems and PublishSnapshot use, and adds the systems in the order they run.
+*/
+void Application::LoadWorld()
 {
-	CreateInitialInstancesAbstracts();
-	CreateInitialInstancesAesthetics();
-	CreateInitialInstancesEnvironmentals();
-	CreateInitialInstancesPlayers();
-	CreateInitialInstancesUnits();
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagEntities);
+
+	//Components
+	DSEntity::ComponentRegistry::Register<DSGraphics::ModelInstance>("ModelInstance");
+	DSEntity::ComponentRegistry::Register<DSPhysics::RigidBody>("RigidBody");
+	DSEntity::ComponentRegistry::Register<AbstractTag>("AbstractTag");
+	DSEntity::ComponentRegistry::Register<AestheticTag>("AestheticTag");
+	DSEntity::ComponentRegistry::Register<EnvironmentalTag>("EnvironmentalTag");
+	DSEntity::ComponentRegistry::Register<PlayerTag>("PlayerTag");
+	DSEntity::ComponentRegistry::Register<UnitTag>("UnitTag");
+	DSEntity::ComponentMask instance = DSEntity::ComponentRegistry::GetMask<DSGraphics::ModelInstance>();
+	DSEntity::ComponentMask rigidBody = DSEntity::ComponentRegistry::GetMask<DSPhysics::RigidBody>();
+
+	//World
+	if(mpWorld == nullptr)
+	{
+		mpWorld = new DSEntity::World();
+
+		mpQueryInstances = mpWorld->CreateQuery(instance);
+		mpQueryRigidBodies = mpWorld->CreateQuery(instance | rigidBody);
+		mpQueryAbstracts = mpWorld->CreateQuery(instance | DSEntity::ComponentRegistry::GetMask<AbstractTag>());
+		mpQueryAesthetics = mpWorld->CreateQuery(instance | DSEntity::ComponentRegistry::GetMask<AestheticTag>());
+		mpQueryEnvironmentals = mpWorld->CreateQuery(instance | DSEntity::ComponentRegistry::GetMask<EnvironmentalTag>());
+		mpQueryPlayers = mpWorld->CreateQuery(instance | DSEntity::ComponentRegistry::GetMask<PlayerTag>());
+		mpQueryUnits = mpWorld->CreateQuery(instance | DSEntity::ComponentRegistry::GetMask<UnitTag>());
+	}
+
+	//Systems
+	if(mpSystems == nullptr)
+	{
+		mpSystems = new DSEntity::SystemScheduler();
+		mpSystems->Add("StorePreviousStates", 0, instance, StorePreviousStates, this);
+		mpSystems->Add("AI", 0, 0, AI, this);
+		mpSystems->Add("Physics", 0, instance | rigidBody, Physics, this);
+	}
+
+	//Rigid Bodies
+	if(mpRigidBodies == nullptr)
+	{
+		mpRigidBodies = new DSPhysics::RigidBodyWorld();
+	}
+
+	//Soft Bodies
+	if(mpSoftBodies == nullptr)
+	{
+		mpSoftBodies = new DSPhysics::SoftBodySolver();
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -399,6 +747,9 @@ void Application::CreateInitialInstancesAesthetics()
 
 void Application::CreateInitialInstancesEnvironmentals()
 {
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagEntities);
+	DSEntity::CommandBuffer& commands = mpLoadData->mEnvironmentals;
+
 	//Wall
 	if(mpWall != nullptr)
 	{
@@ -407,18 +758,21 @@ void Application::CreateInitialInstancesEnvironmentals()
 			//Left
 			DSGraphics::ModelInstance wallLeft(mpWall->GetModelAsset(), mpCamera);
 			wallLeft.SetSize(glm::vec3(100.0f, 6.0f, 1.0f));//multiplies size by scaling, hence no need for multiplying by the scale ratio (device coordinates per meter), since the ModelAsset is already constructed using the scale.
-			wallLeft.SetOrientationAxis(glm::vec3(0.0f, 1.0f, 0.0f));//TODO: Change this to new DSGraphics::Quaternion based rotation.
-			wallLeft.SetOrientationAngle(glm::radians(270.0f));
+			wallLeft.SetOrientation(DSMathematics::Quaternion(glm::radians(270.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
 			wallLeft.Move(glm::vec3(-15.0f, 0.0f, -15.0f), Object::sDCPerM);
 			wallLeft.UpdateTransform();
-			mEnvironmentalsInstanceList.push_back(wallLeft);
+			DSEntity::Entity wallLeftEntity = commands.CreateEntity();
+			commands.AddComponent(wallLeftEntity, wallLeft);
+			commands.AddComponent(wallLeftEntity, EnvironmentalTag());
 
 			//Top
 			DSGraphics::ModelInstance wallTop(mpWall->GetModelAsset(), mpCamera);
 			wallTop.SetSize(glm::vec3(100.0f, 6.0f, 1.0f));//multiplies size by scaling, hence no need for multiplying by the scale ratio (device coordinates per meter), since the ModelAsset is already constructed using the scale.
 			wallTop.Move(glm::vec3(-15.0f, 0.0f, -15.0f), Object::sDCPerM);
 			wallTop.UpdateTransform();
-			mEnvironmentalsInstanceList.push_back(wallTop);
+			DSEntity::Entity wallTopEntity = commands.CreateEntity();
+			commands.AddComponent(wallTopEntity, wallTop);
+			commands.AddComponent(wallTopEntity, EnvironmentalTag());
 		}
 	}
 }
@@ -427,6 +781,9 @@ void Application::CreateInitialInstancesEnvironmentals()
 
 void Application::CreateInitialInstancesPlayers()
 {
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagEntities);
+	DSEntity::CommandBuffer& commands = mpLoadData->mPlayers;
+
 	//SpaceshipStarter
 	if(mpSpaceshipStarter != nullptr)
 	{
@@ -434,7 +791,22 @@ void Application::CreateInitialInstancesPlayers()
 		{
 			//Player1
 			DSGraphics::ModelInstance player1(mpSpaceshipStarter->GetModelAsset(), mpCamera);
-			mPlayersInstanceList.push_back(player1);
+			if(mpSpaceshipStarterShape != nullptr && mpSpaceshipStarterShape->GetIsBuilt() == true)
+			{
+				mpPlayer1Mesh = new DSGraphics::DeformableMesh(mpSpaceshipStarter->GetModelAsset());
+				mPlayer1Body = mpSoftBodies->AddBody(*mpSpaceshipStarterShape, mpPlayer1Mesh);
+				player1.SetDeformableMesh(mpPlayer1Mesh);
+			}
+			//  Spinning about y (only this task creates rigid bodies, since RigidBodyWorld isn't thread safe)
+			const DSGraphics::ModelAsset* pModel = DSGraphics::AssetManager::Get(mpSpaceshipStarter->GetModelAsset());
+			glm::vec3 size = (pModel->GetBoundsMax() - pModel->GetBoundsMin()) * player1.GetSize();
+			DSPhysics::RigidBody player1Body;
+			player1Body.mBody = mpRigidBodies->Create(player1.GetPosition(), player1.GetOrientation(), 1.0f, DSPhysics::RigidBodyWorld::GetBoxInertia(1.0f, size));
+			mpRigidBodies->SetAngularVelocity(player1Body.mBody, glm::vec3(0.0f, glm::radians(-20.0f), 0.0f));
+			DSEntity::Entity player1Entity = commands.CreateEntity();
+			commands.AddComponent(player1Entity, player1);
+			commands.AddComponent(player1Entity, player1Body);
+			commands.AddComponent(player1Entity, PlayerTag());
 		}
 	}
 }
@@ -445,12 +817,31 @@ void Application::CreateInitialInstancesUnits()
 {
 }
 
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Creates the instances every category recorded, in category order, so entities are created in the same order however the recording tasks ran.
+*/
+void Application::CreateInitialInstances()
+{
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagEntities);
+
+	mpLoadData->mAbstracts.Playback(*mpWorld);
+	mpLoadData->mAesthetics.Playback(*mpWorld);
+	mpLoadData->mEnvironmentals.Playback(*mpWorld);
+	mpLoadData->mPlayers.Playback(*mpWorld);
+	mpLoadData->mUnits.Playback(*mpWorld);
+}
+
 //-----------------------------------------------------------------------------
 // Run Sub-Functions
 //-----------------------------------------------------------------------------
 
 void Application::Input()
 {
+	DS_PROFILE_SCOPE("Input");
+
 	//Retrieve
 	glfwPollEvents();
 
@@ -609,6 +1000,58 @@ void Application::Input()
 
 
 	//Individual Objects
+	// Hit Player1 somewhere new
+	if(glfwGetKey(mpWindow, GLFW_KEY_F8) == GLFW_PRESS)
+	{
+		if(mIsImpactKeyDown == false && mpPlayer1Mesh != nullptr)
+		{
+			ImpactPlayer1();
+		}
+		mIsImpactKeyDown = true;
+	}
+	else
+	{
+		mIsImpactKeyDown = false;
+	}
+
+
+	//Profiler
+	// Toggle a Chrome trace capture (written when the capture stops)
+	if(glfwGetKey(mpWindow, GLFW_KEY_F9) == GLFW_PRESS)
+	{
+		if(mIsProfileKeyDown == false)
+		{
+			if(DSProfiling::Profiler::GetIsCapturing() == false)
+			{
+				DSProfiling::Profiler::BeginCapture();
+			}
+			else
+			{
+				DSProfiling::Profiler::EndCapture();
+				DSProfiling::Profiler::WriteChromeTrace("Profile.json");
+			}
+		}
+		mIsProfileKeyDown = true;
+	}
+	else
+	{
+		mIsProfileKeyDown = false;
+	}
+	// Print video memory usage, in total and by its largest owners
+	if(glfwGetKey(mpWindow, GLFW_KEY_F10) == GLFW_PRESS)
+	{
+		if(mIsGpuMemoryKeyDown == false)
+		{
+			DSGraphics::GpuMemory::PrintSummary();
+			DSGraphics::GpuMemory::PrintTopConsumers(10);
+			DSGraphics::VertexStream::PrintSummary();
+		}
+		mIsGpuMemoryKeyDown = true;
+	}
+	else
+	{
+		mIsGpuMemoryKeyDown = false;
+	}
 
 
 	//If key pressed: escape
@@ -620,73 +1063,234 @@ void Application::Input()
 
 //-----------------------------------------------------------------------------
 
-void Application::AI()
+/*
+Description:
+	Hits Player1's soft body at a point on the sphere around its model, heading for the middle. Each hit is somewhere new,
+	the points spiralling around the sphere by the golden angle.
+*/
+void Application::ImpactPlayer1()
 {
+	const DSGraphics::ModelAsset* pModel = DSGraphics::AssetManager::Get(mpPlayer1Mesh->GetMaster());
+	if(pModel == nullptr)
+	{
+		return;
+	}
+
+	const float kGoldenAngle = 2.39996323f;
+	const float kSpeed = 2.0f;//model sizes per second
+	const unsigned int kPointCount = 64;//before the spiral repeats
+
+	glm::vec3 centre = (pModel->GetBoundsMin() + pModel->GetBoundsMax()) * 0.5f;
+	float radius = glm::length(pModel->GetBoundsMax() - pModel->GetBoundsMin()) * 0.5f;
+
+	unsigned int point = mImpactCount++ % kPointCount;
+	float y = 1.0f - 2.0f * (point + 0.5f) / kPointCount;
+	float ring = std::sqrt(1.0f - y * y);
+	float angle = kGoldenAngle * point;
+	glm::vec3 direction(ring * std::cos(angle), y, ring * std::sin(angle));
+
+	mpSoftBodies->ApplyImpact(mPlayer1Body, centre + direction * radius, -direction * (kSpeed * 2.0f * radius), radius * 0.5f);
 }
 
 //-----------------------------------------------------------------------------
 
-void Application::Physics()
+void Application::Render()
 {
-	//Individual Objects
-	// Spaceship
-	const float kDegreesPerSecond = -20.0f;
-	mDegreesRotated += static_cast<float>(mElapsedTime) * kDegreesPerSecond;
-	while(mDegreesRotated > 360.0f)
+	DS_PROFILE_SCOPE("Render");
+
+	//Latest simulation step
+	const DSGraphics::RenderSnapshot& snapshot = mSnapshots.Acquire();
+	//  Interpolate from the step before it to it over the course of one step, which keeps motion smooth at any frame rate at the cost of one step of latency.
+	float interpolation = static_cast<float>((glfwGetTime() - snapshot.mStepTime) / mSimulationTimeStep);
+	interpolation = glm::clamp(interpolation, 0.0f, 1.0f);
+
+	//Deformed meshes, as of the latest simulation step
+	mpSoftBodies->UpdateMeshes();
+
+	//Draw (timed on the GPU as well)
 	{
-		mDegreesRotated -= 360.0f;
+		DS_PROFILE_GPU_SCOPE(mpGpuProfiler, "Render");
+
+		//Background
+		// Clear the screen to black
+		glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+		//Camera
+		//glm::vec4 posToLookAt = mListModelInstancesBackground.begin()->GetTranslate() * glm::vec4(1.0f);
+		//mpCamera->LookAt(glm::vec3(posToLookAt));
+		//mpCamera->LookAt(glm::vec3(0.0f, 0.0f, 0.0f));
+
+		//Instances
+		std::vector<DSGraphics::ModelInstance>::const_iterator it;
+		for(it = snapshot.mInstances.begin(); it != snapshot.mInstances.end(); ++it)
+		{
+			it->Render(interpolation);
+		}
 	}
-	//TODO: Add static ID to instances in order to keep track of which is which, so that I don't do the following risky business
-	mPlayersInstanceList.front().SetOrientationAxis(glm::vec3(0.0f, 1.0f, 0.0f));
-	mPlayersInstanceList.front().SetOrientationAngle(glm::radians(mDegreesRotated));
-	mPlayersInstanceList.front().UpdateTransform();
+
+	//Swap the back buffer and the front buffer
+	DS_PROFILE_SCOPE("SwapBuffers");
+	glfwSwapBuffers(mpWindow);
 }
 
+//-----------------------------------------------------------------------------
+// Simulation Thread
 //-----------------------------------------------------------------------------
 
-void Application::Render()
+void Application::StartSimulation()
 {
-	//Background
-	// Clear the screen to black
-	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	//Give Render something to draw before the first step completes
+	PublishSnapshot(glfwGetTime());
 
-	//Camera
-	//glm::vec4 posToLookAt = mListModelInstancesBackground.begin()->GetTranslate() * glm::vec4(1.0f);
-	//mpCamera->LookAt(glm::vec3(posToLookAt));
-	//mpCamera->LookAt(glm::vec3(0.0f, 0.0f, 0.0f));
+	mSimulationThread = std::thread(&Application::SimulationThread, this);
+}
+
+//-----------------------------------------------------------------------------
 
-	//Instance Lists
-	std::vector<DSGraphics::ModelInstance>::iterator it;
-	// Abstracts
-	for(it = mAbstractsInstanceList.begin(); it != mAbstractsInstanceList.end(); ++it)
+void Application::StopSimulation()
+{
+	mQuit = true;
+	if(mSimulationThread.joinable() == true)
 	{
-		it->Render();
+		mSimulationThread.join();
 	}
-	// Aesthetics
-	for(it = mAestheticsInstanceList.begin(); it != mAestheticsInstanceList.end(); ++it)
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	An exception (including one rethrown from a system's job) stops the application, and Run rethrows it on the main thread.
+*/
+void Application::SimulationThread()
+{
+	//Lets the simulation create and wait on jobs (and names its profiler track)
+	DSThreading::JobSystem::RegisterThread("Simulation");
+
+	try
 	{
-		it->Render();
+		double lastTime = glfwGetTime();
+		while(mQuit == false)
+		{
+			double thisTime = glfwGetTime();
+			unsigned int steps = Simulate(thisTime - lastTime);
+			lastTime = thisTime;
+
+			if(steps > 0)
+			{
+				PublishSnapshot(thisTime);
+			}
+
+			//Sleep until the next step is due
+			double untilNextStep = mSimulationTimeStep - mSimulationAccumulator;
+			if(untilNextStep > 0.001)
+			{
+				std::this_thread::sleep_for(std::chrono::microseconds(static_cast<long long>(untilNextStep * 1000000.0) - 500));
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
 	}
-	// Environmentals
-	for(it = mEnvironmentalsInstanceList.begin(); it != mEnvironmentalsInstanceList.end(); ++it)
+	catch(...)
 	{
-		it->Render();
+		//Read by Run once StopSimulation has joined this thread
+		mpSimulationException = std::current_exception();
+		mQuit = true;
 	}
-	// Player
-	for(it = mPlayersInstanceList.begin(); it != mPlayersInstanceList.end(); ++it)
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Runs as many fixed simulation steps as the elapsed time calls for, so that simulation results do not depend on the frame rate.
+	Returns the number of steps taken.
+*/
+unsigned int Application::Simulate(double elapsedTime)
+{
+	DS_PROFILE_SCOPE("Simulate");
+
+	mSimulationAccumulator += elapsedTime;
+
+	unsigned int steps = 0;
+	while(mSimulationAccumulator >= mSimulationTimeStep)
 	{
-		it->Render();
+		if(steps == mMaxSimulationStepsPerFrame)
+		{
+			//Too far behind (slow step, debugger break, window drag); drop the backlog rather than trying to catch up.
+			mSimulationAccumulator = 0.0;
+			break;
+		}
+
+		mpSystems->Run(*mpWorld);
+
+		mSimulationAccumulator -= mSimulationTimeStep;
+		++mSimulationStepIndex;
+		++steps;
 	}
-	// Units
-	for(it = mUnitsInstanceList.begin(); it != mUnitsInstanceList.end(); ++it)
+
+	return steps;
+}
+
+//-----------------------------------------------------------------------------
+
+void Application::StorePreviousStates(DSEntity::World& world, DSEntity::CommandBuffer& commands, void* pUserData)
+{
+	Application* pApplication = static_cast<Application*>(pUserData);
+	pApplication->mpQueryInstances->ForEachChunk(StorePreviousStatesChunk, nullptr);
+}
+
+//-----------------------------------------------------------------------------
+
+void Application::AI(DSEntity::World& world, DSEntity::CommandBuffer& commands, void* pUserData)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void Application::Physics(DSEntity::World& world, DSEntity::CommandBuffer& commands, void* pUserData)
+{
+	Application* pApplication = static_cast<Application*>(pUserData);
+
+	float timeStep = static_cast<float>(pApplication->mSimulationTimeStep);
+
+	//Rigid bodies (the player's spaceship), copied into their instances; skipped entirely while they are all asleep
+	pApplication->mpRigidBodies->Step(timeStep);
+	if(pApplication->mpRigidBodies->GetMovedCount() > 0)
 	{
-		it->Render();
+		pApplication->mpQueryRigidBodies->ForEachChunk(WriteBackRigidBodiesChunk, pApplication->mpRigidBodies);
 	}
-	
 
-	//Swap the back buffer and the front buffer
-	glfwSwapBuffers(mpWindow);
+	//Soft bodies (dents)
+	pApplication->mpSoftBodies->Step(timeStep);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Copies every instance into the snapshot being written and hands it to the render thread.
+	Instances are copied category by category, so the draw order matches the old per-category render loop.
+*/
+void Application::PublishSnapshot(double stepTime)
+{
+	DS_PROFILE_SCOPE("PublishSnapshot");
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagRendering);
+
+	DSGraphics::RenderSnapshot& snapshot = mSnapshots.GetWriteBuffer();
+	snapshot.mInstances.clear();
+	mpQueryAbstracts->ForEachChunk(AppendInstancesChunk, &snapshot.mInstances);
+	mpQueryAesthetics->ForEachChunk(AppendInstancesChunk, &snapshot.mInstances);
+	mpQueryEnvironmentals->ForEachChunk(AppendInstancesChunk, &snapshot.mInstances);
+	mpQueryPlayers->ForEachChunk(AppendInstancesChunk, &snapshot.mInstances);
+	mpQueryUnits->ForEachChunk(AppendInstancesChunk, &snapshot.mInstances);
+	snapshot.mStepTime = stepTime;
+	snapshot.mStepIndex = mSimulationStepIndex;
+
+	mSnapshots.Publish();
 }
 
 //-----------------------------------------------------------------------------
@@ -703,31 +1307,33 @@ void Application::CleanUp()
 	}
 
 	//Shaders
-	// Color Only
-	if(mpProgramColorOnly != nullptr)
-	{
-		delete mpProgramColorOnly;
-		mpProgramColorOnly = nullptr;
-	}
-	// Tex and Color
-	if(mpProgramTexAndColor != nullptr)
-	{
-		delete mpProgramTexAndColor;
-		mpProgramTexAndColor = nullptr;
-	}
+	DSGraphics::AssetManager::Release(mProgramColorOnly);
+	DSGraphics::AssetManager::Release(mProgramTexAndColor);
 
 	//Textures
-	if(mpTextureSpaceship != nullptr)
-	{
-		delete mpTextureSpaceship;
-		mpTextureSpaceship = nullptr;
-	}
+	DSGraphics::AssetManager::Release(mTextureSpaceship);
 
 	//Objects
 	CleanUpObjects();
 
 	//Instances
 	CleanUpInstances();
+
+	//Deformed vertices (every DeformableMesh went with its object)
+	DSGraphics::VertexStream::Terminate();
+
+	//Assets (everything above has released its references, so anything left is reported)
+	DSGraphics::AssetManager::Terminate();
+
+	//Resource Pack
+	DSSystem::ResourceFile::Unmount();
+
+	//Everything on the GPU should be gone by now
+	if(DSGraphics::GpuMemory::GetTotalBytes() != 0)
+	{
+		fprintf(stderr, "WARNING: %.1f KB of GPU memory was not released by CleanUp.\n", DSGraphics::GpuMemory::GetTotalBytes() / 1024.0);
+		DSGraphics::GpuMemory::PrintTopConsumers(10);
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -767,11 +1373,50 @@ void Application::CleanUpObjects()
 
 void Application::CleanUpInstances()
 {
-	mAbstractsInstanceList.clear();
-	mAestheticsInstanceList.clear();
-	mEnvironmentalsInstanceList.clear();
-	mPlayersInstanceList.clear();
-	mUnitsInstanceList.clear();
+	//Systems
+	if(mpSystems != nullptr)
+	{
+		delete mpSystems;
+		mpSystems = nullptr;
+	}
+
+	//World (deletes its queries and every entity's components)
+	if(mpWorld != nullptr)
+	{
+		delete mpWorld;
+		mpWorld = nullptr;
+	}
+	mpQueryInstances = nullptr;
+	mpQueryRigidBodies = nullptr;
+	mpQueryAbstracts = nullptr;
+	mpQueryAesthetics = nullptr;
+	mpQueryEnvironmentals = nullptr;
+	mpQueryPlayers = nullptr;
+	mpQueryUnits = nullptr;
+
+	//Rigid Bodies
+	if(mpRigidBodies != nullptr)
+	{
+		delete mpRigidBodies;
+		mpRigidBodies = nullptr;
+	}
+
+	//Soft Bodies (before VertexStream::Terminate, since the meshes hold regions of it)
+	if(mpSoftBodies != nullptr)
+	{
+		delete mpSoftBodies;
+		mpSoftBodies = nullptr;
+	}
+	if(mpPlayer1Mesh != nullptr)
+	{
+		delete mpPlayer1Mesh;
+		mpPlayer1Mesh = nullptr;
+	}
+	if(mpSpaceshipStarterShape != nullptr)
+	{
+		delete mpSpaceshipStarterShape;
+		mpSpaceshipStarterShape = nullptr;
+	}
 }
 
 //-----------------------------------------------------------------------------
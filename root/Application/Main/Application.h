@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		Application.h
 // Created:		2015/02/10
-// Last Edited:	2015/02/27
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	Application
 //=============================================================================
@@ -27,16 +27,43 @@
 #include <glm/gtc/type_ptr.hpp>
 
 // Standard C++ Libraries
+#include <atomic>
+#include <exception>
 #include <list>
+#include <thread>
 
 // Daniel Schenker
+//  DSEntity
+#include "DSEntity/SystemScheduler.h"
+#include "DSEntity/World.h"
 //  DSGraphics
+#include "DSGraphics/AssetManager.h"
 #include "DSGraphics/Camera.h"
+#include "DSGraphics/DeformableMesh.h"
+#include "DSGraphics/GpuMemory.h"
 #include "DSGraphics/ModelAsset.h"
 #include "DSGraphics/ModelInstance.h"
 #include "DSGraphics/Program.h"
+#include "DSGraphics/RenderSnapshot.h"
 #include "DSGraphics/Texture.h"
+#include "DSGraphics/TextureCache.h"
+//  DSMemory
+#include "DSMemory/MemoryManager.h"
+#include "DSMemory/MemoryTracker.h"
+//  DSPhysics
+#include "DSPhysics/RigidBodyWorld.h"
+#include "DSPhysics/SoftBodySolver.h"
+//  DSProfiling
+#include "DSProfiling/GpuProfiler.h"
+#include "DSProfiling/Profiler.h"
+//  DSSystem
+#include "DSSystem/ResourceFile.h"
+//  DSThreading
+#include "DSThreading/JobSystem.h"
+#include "DSThreading/TaskGraph.h"
+#include "DSThreading/TripleBuffer.h"
 //  Object
+#include "Object/Components.h"
 //   Abstracts
 //   Aesthetics
 //   Environmentals
@@ -73,6 +100,10 @@ private:
 	void Terminate();
 
 
+	// Memory
+	void InitializeMemory();
+	void TerminateMemory();
+
 	// GLFW
 	bool InitializeGLFW();
 	void TerminateGLFW();
@@ -80,33 +111,57 @@ private:
 	// GLEW
 	bool InitializeGLEW();
 
+	// Profiler
+	void InitializeProfiler();
+	void TerminateProfiler();
+
 
-	// Initialize Sub-Functions
+	// Initialize Sub-Functions (run as a DSThreading::TaskGraph, see Load)
 	void Load();
+		void LoadResourcePack();
 		void LoadCamera();
 		void LoadShaders();
-			DSGraphics::Program* CreateProgram(const char* vertexShaderFile, const char* fragmentShaderFile);
+		void PrepareTextures();
 		void LoadTextures();
+		void PrepareObjects();
 		void LoadObjects();
 			void LoadObjectsAbstracts();
 			void LoadObjectsAesthetics();
 			void LoadObjectsEnvironmentals();
 			void LoadObjectsPlayers();
 			void LoadObjectsUnits();
-	void CreateInitialInstances();
+		void LoadWorld();
 		void CreateInitialInstancesAbstracts();
 		void CreateInitialInstancesAesthetics();
 		void CreateInitialInstancesEnvironmentals();
 		void CreateInitialInstancesPlayers();
 		void CreateInitialInstancesUnits();
+		void CreateInitialInstances();
+
+		//Task function for each of the above
+		template<void (Application::*Step)()>
+		static void LoadStep(void* pUserData)
+		{
+			(static_cast<Application*>(pUserData)->*Step)();
+		}
 
 
 	// Run Sub-Functions
 	void Input();
-	void AI();
-	void Physics();
+		void ImpactPlayer1();
 	void Render();
 
+	// Simulation Thread
+	void StartSimulation();
+	void StopSimulation();
+	void SimulationThread();
+		unsigned int Simulate(double elapsedTime);
+			// Systems (see LoadWorld)
+			static void StorePreviousStates(DSEntity::World& world, DSEntity::CommandBuffer& commands, void* pUserData);
+			static void AI(DSEntity::World& world, DSEntity::CommandBuffer& commands, void* pUserData);
+			static void Physics(DSEntity::World& world, DSEntity::CommandBuffer& commands, void* pUserData);
+		void PublishSnapshot(double stepTime);
+
 
 	// Terminate Sub-Functions
 	void CleanUp();
@@ -119,7 +174,13 @@ private:
 	//create a variable that holds the default data path of "../../Resources/"
 	
 	// General
-	bool mQuit;
+	std::atomic<bool> mQuit;
+	unsigned long long mStartupTicks;//when Initialize started, for the time to the first frame
+
+	// Loading
+	//  What the load tasks hand each other (see Load), only alive during Load.
+	struct LoadData;
+	LoadData* mpLoadData;
 	
 	// Window
 	GLFWwindow* mpWindow;
@@ -131,16 +192,32 @@ private:
 	double mThisTime;
 	double mElapsedTime;
 
+	// Simulation
+	//  AI and Physics run on their own thread and advance in fixed steps of mSimulationTimeStep.
+	//  The world below belongs to that thread once it has started. After every step it publishes a copy of its instances (a snapshot) for Render.
+	std::thread mSimulationThread;
+	std::exception_ptr mpSimulationException;//whatever stopped the simulation thread, rethrown on the main thread by Run
+	double mSimulationTimeStep;
+	unsigned int mMaxSimulationStepsPerFrame;//caps catch-up after a slow step, dropping the rest of the backlog instead of spiralling
+	double mSimulationAccumulator;
+	unsigned long long mSimulationStepIndex;
+	DSThreading::TripleBuffer<DSGraphics::RenderSnapshot> mSnapshots;
+
+	// Profiler
+	DSProfiling::GpuProfiler* mpGpuProfiler;
+	bool mIsProfileKeyDown;
+	bool mIsGpuMemoryKeyDown;
+
 	// Camera
 	DSGraphics::Camera* mpCamera;
 	GLuint mUniformCamera;
 
-	// Shader Programs
-	DSGraphics::Program* mpProgramColorOnly;
-	DSGraphics::Program* mpProgramTexAndColor;
+	// Shader Programs (references held through DSGraphics::AssetManager)
+	DSGraphics::ProgramHandle mProgramColorOnly;
+	DSGraphics::ProgramHandle mProgramTexAndColor;
 
-	// Textures
-	DSGraphics::Texture* mpTextureSpaceship;
+	// Textures (references held through DSGraphics::AssetManager)
+	DSGraphics::TextureHandle mTextureSpaceship;
 
 	// Objects
 	//  Abstracts
@@ -151,16 +228,31 @@ private:
 	SpaceshipStarter* mpSpaceshipStarter;
 	//  Units
 	
-	// Instance Lists
-	std::vector<DSGraphics::ModelInstance> mAbstractsInstanceList;
-	std::vector<DSGraphics::ModelInstance> mAestheticsInstanceList;
-	std::vector<DSGraphics::ModelInstance> mEnvironmentalsInstanceList;
-	std::vector<DSGraphics::ModelInstance> mPlayersInstanceList;
-	std::vector<DSGraphics::ModelInstance> mUnitsInstanceList;
-
-	// Individual Objects
-	//  Spaceship
-	float mDegreesRotated;
+	// Entities
+	//  Every instance is an entity with a DSGraphics::ModelInstance and a tag for its category (see Object/Components.h).
+	DSEntity::World* mpWorld;
+	DSEntity::SystemScheduler* mpSystems;
+	//  Queries (owned by mpWorld)
+	DSEntity::Query* mpQueryInstances;
+	DSEntity::Query* mpQueryRigidBodies;
+	DSEntity::Query* mpQueryAbstracts;
+	DSEntity::Query* mpQueryAesthetics;
+	DSEntity::Query* mpQueryEnvironmentals;
+	DSEntity::Query* mpQueryPlayers;
+	DSEntity::Query* mpQueryUnits;
+
+	// Rigid Bodies
+	//  Stepped by Physics on the simulation thread, which then writes the moved ones back into their entities' instances.
+	DSPhysics::RigidBodyWorld* mpRigidBodies;
+
+	// Soft Bodies
+	//  Stepped by Physics on the simulation thread, and handed to their meshes by Render (see DSPhysics::SoftBodySolver).
+	DSPhysics::SoftBodySolver* mpSoftBodies;
+	DSPhysics::SoftBodyShape* mpSpaceshipStarterShape;
+	DSGraphics::DeformableMesh* mpPlayer1Mesh;
+	unsigned int mPlayer1Body;
+	unsigned int mImpactCount;
+	bool mIsImpactKeyDown;
 };
 
 #endif //#ifndef APPLICATION_H
\ No newline at end of file
@@ -0,0 +1,283 @@
+//=============================================================================
+// File:		SlotMap.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	SlotMap. Densely stored values referred to by stable 32 bit handles that detect when their value has been removed.
+//=============================================================================
+
+#ifndef SLOTMAP_H
+#define SLOTMAP_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSContainers
+{
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	/*
+	Notes:
+		The low kIndexBits bits pick a slot, and the rest hold the generation the slot had when the value was inserted.
+		Removing a value bumps its slot's generation, so every handle to it stops resolving, even after the slot is reused.
+		Generations wrap after kMaxGeneration removals from the same slot; the free list is first in first out to make that as unlikely as possible.
+		kMaxGeneration itself is never handed out, so owners may use it for placeholder handles of their own.
+	*/
+	struct SlotMapHandle
+	{
+		SlotMapHandle()
+		:	mId(kNull)
+		{
+		}
+
+		SlotMapHandle(unsigned int index, unsigned int generation)
+		:	mId((generation << kIndexBits) | (index & kIndexMask))
+		{
+		}
+
+		unsigned int GetIndex() const
+		{
+			return mId & kIndexMask;
+		}
+
+		unsigned int GetGeneration() const
+		{
+			return mId >> kIndexBits;
+		}
+
+		bool GetIsNull() const
+		{
+			return mId == kNull;
+		}
+
+		bool operator==(const SlotMapHandle& other) const
+		{
+			return mId == other.mId;
+		}
+
+		bool operator!=(const SlotMapHandle& other) const
+		{
+			return mId != other.mId;
+		}
+
+		static const unsigned int kIndexBits = 20;//up to about a million values at once
+		static const unsigned int kIndexMask = (1u << kIndexBits) - 1;
+		static const unsigned int kMaxGeneration = (1u << (32 - kIndexBits)) - 1;
+		static const unsigned int kNull = 0xFFFFFFFF;
+
+		unsigned int mId;
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Values live packed in one array, in no particular order, so iterating them (GetData(), GetCount()) never meets a hole.
+		A handle goes through its slot to the value's current position, so lookup, insertion and removal are all O(1),
+		and removing a value (which moves the last value into its place) never invalidates handles to other values.
+	Usage:
+		DSContainers::SlotMap<Unit> units;
+		DSContainers::SlotMapHandle target = units.Insert(unit);
+		...
+		Unit* pTarget = units.Get(target);//nullptr once the unit has been removed
+	Notes:
+		Pointers returned by Get are only valid until the next insertion or removal; keep the handle, not the pointer.
+		Not thread safe.
+		Defined in the header since it is a template.
+	*/
+	template<typename T>
+	class SlotMap
+	{
+	public:
+		//Constructors
+		SlotMap()
+		:	mFreeHead(kNoSlot)
+		,	mFreeTail(kNoSlot)
+		{
+		}
+
+		//Member Functions
+	public:
+		// General
+		SlotMapHandle Insert(const T& value)
+		{
+			unsigned int slotIndex = mFreeHead;
+			if(slotIndex != kNoSlot)
+			{
+				mFreeHead = mSlots[slotIndex].mNext;
+				if(mFreeHead == kNoSlot)
+				{
+					mFreeTail = kNoSlot;
+				}
+			}
+			else
+			{
+				if(mSlots.size() > SlotMapHandle::kIndexMask)
+				{
+					throw std::runtime_error("ERROR: SlotMap is full. Handles only have room for 2^20 values at once.");
+				}
+
+				Slot slot;
+				slot.mNext = kNoSlot;
+				slot.mGeneration = 0;
+				mSlots.push_back(slot);
+
+				slotIndex = static_cast<unsigned int>(mSlots.size() - 1);
+			}
+
+			Slot& slot = mSlots[slotIndex];
+			slot.mNext = static_cast<unsigned int>(mValues.size());
+			mValues.push_back(value);
+			mValueSlots.push_back(slotIndex);
+
+			return SlotMapHandle(slotIndex, slot.mGeneration);
+		}
+
+		/*
+		Description:
+			Removes the value, moving the last value into its place. Returns false (and does nothing) if the handle is stale or null.
+		*/
+		bool Remove(SlotMapHandle handle)
+		{
+			if(GetIsValid(handle) == false)
+			{
+				return false;
+			}
+
+			Slot& slot = mSlots[handle.GetIndex()];
+			unsigned int valueIndex = slot.mNext;
+			unsigned int lastIndex = static_cast<unsigned int>(mValues.size() - 1);
+			if(valueIndex != lastIndex)
+			{
+				mValues[valueIndex] = std::move(mValues[lastIndex]);
+				mValueSlots[valueIndex] = mValueSlots[lastIndex];
+				mSlots[mValueSlots[valueIndex]].mNext = valueIndex;
+			}
+			mValues.pop_back();
+			mValueSlots.pop_back();
+
+			//Retire this generation, skipping kMaxGeneration, and queue the slot for reuse
+			slot.mGeneration = (slot.mGeneration + 1) % SlotMapHandle::kMaxGeneration;
+			slot.mNext = kNoSlot;
+			if(mFreeTail != kNoSlot)
+			{
+				mSlots[mFreeTail].mNext = handle.GetIndex();
+			}
+			else
+			{
+				mFreeHead = handle.GetIndex();
+			}
+			mFreeTail = handle.GetIndex();
+
+			return true;
+		}
+
+		/*
+		Description:
+			Removes every value. Outstanding handles all become stale, since every slot's generation moves on.
+		*/
+		void Clear()
+		{
+			while(mValues.empty() == false)
+			{
+				Remove(GetHandle(static_cast<unsigned int>(mValues.size() - 1)));
+			}
+		}
+
+		void Reserve(unsigned int count)
+		{
+			mValues.reserve(count);
+			mValueSlots.reserve(count);
+			mSlots.reserve(count);
+		}
+
+		// Getters
+		bool GetIsValid(SlotMapHandle handle) const
+		{
+			unsigned int slotIndex = handle.GetIndex();
+			return slotIndex < mSlots.size() && mSlots[slotIndex].mGeneration == handle.GetGeneration() && handle.GetGeneration() != SlotMapHandle::kMaxGeneration
+				&& mSlots[slotIndex].mNext < mValues.size() && mValueSlots[mSlots[slotIndex].mNext] == slotIndex;
+		}
+
+		/*
+		Notes:
+			nullptr if the handle is stale or null.
+		*/
+		T* Get(SlotMapHandle handle)
+		{
+			return GetIsValid(handle) == true ? &mValues[mSlots[handle.GetIndex()].mNext] : nullptr;
+		}
+
+		const T* Get(SlotMapHandle handle) const
+		{
+			return GetIsValid(handle) == true ? &mValues[mSlots[handle.GetIndex()].mNext] : nullptr;
+		}
+
+		unsigned int GetCount() const
+		{
+			return static_cast<unsigned int>(mValues.size());
+		}
+
+		/*
+		Notes:
+			GetCount() packed values, for iterating. Their order changes whenever a value is removed.
+		*/
+		T* GetData()
+		{
+			return mValues.empty() == true ? nullptr : &mValues[0];
+		}
+
+		const T* GetData() const
+		{
+			return mValues.empty() == true ? nullptr : &mValues[0];
+		}
+
+		/*
+		Notes:
+			The handle of the value at position valueIndex in GetData().
+		*/
+		SlotMapHandle GetHandle(unsigned int valueIndex) const
+		{
+			unsigned int slotIndex = mValueSlots[valueIndex];
+			return SlotMapHandle(slotIndex, mSlots[slotIndex].mGeneration);
+		}
+
+		//Member Variables
+	private:
+		/*
+		Notes:
+			mNext is the position of the slot's value in mValues while the slot is in use, and the next free slot while it is free.
+		*/
+		struct Slot
+		{
+			unsigned int mNext;
+			unsigned int mGeneration;
+		};
+
+		static const unsigned int kNoSlot = 0xFFFFFFFF;
+
+		std::vector<T> mValues;
+		std::vector<unsigned int> mValueSlots;//slot of each value, parallel to mValues
+		std::vector<Slot> mSlots;
+		unsigned int mFreeHead;//next slot to reuse
+		unsigned int mFreeTail;//most recently freed slot
+	};
+
+}//namespace DSContainers
+
+#endif //#ifndef SLOTMAP_H
\ No newline at end of file
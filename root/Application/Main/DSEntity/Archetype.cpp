@@ -0,0 +1,267 @@
+//=============================================================================
+// File:		Archetype.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Archetype
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstring>
+
+// Daniel Schenker
+#include "Archetype.h"
+#include "../DSMemory/MemoryManager.h"
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Lays out a chunk for the components in mask: as many rows as fit in kChunkSize, entities first, then each component's array.
+Variables:
+	chunkPool = allocator of kChunkSize blocks aligned to at least DSEntity::ComponentRegistry::kMaxAlignment. Must outlive the archetype.
+*/
+DSEntity::Archetype::Archetype(DSEntity::ComponentMask mask, DSMemory::Allocator& chunkPool)
+:	mMask(mask)
+,	mCapacity(0)
+,	mChunkBytes(0)
+,	mCount(0)
+,	mpChunkAllocator(&chunkPool)
+{
+	unsigned int rowBytes = sizeof(DSEntity::Entity);
+	unsigned int worstPadding = 0;
+	for(unsigned int id = 0; id < DSEntity::ComponentRegistry::kMaxComponents; ++id)
+	{
+		mOffsets[id] = kNoOffset;
+
+		const DSEntity::ComponentInfo* pInfo = ((mask >> id) & 1ull) != 0 ? &DSEntity::ComponentRegistry::GetInfo(id) : nullptr;
+		if(pInfo != nullptr && pInfo->mSize > 0)
+		{
+			mComponentIds.push_back(id);
+			rowBytes += pInfo->mSize;
+			worstPadding += pInfo->mAlignment - 1;
+		}
+	}
+
+	//At least one row, even if a single row is bigger than kChunkSize
+	mCapacity = (kChunkSize - worstPadding) / rowBytes;
+	if(mCapacity == 0)
+	{
+		mCapacity = 1;
+	}
+
+	unsigned int offset = mCapacity * sizeof(DSEntity::Entity);
+	std::vector<unsigned int>::const_iterator it;
+	for(it = mComponentIds.begin(); it != mComponentIds.end(); ++it)
+	{
+		const DSEntity::ComponentInfo& info = DSEntity::ComponentRegistry::GetInfo(*it);
+		offset = (offset + info.mAlignment - 1) / info.mAlignment * info.mAlignment;
+		mOffsets[*it] = offset;
+		offset += mCapacity * info.mSize;
+	}
+	mChunkBytes = offset;
+
+	if(mChunkBytes > kChunkSize)
+	{
+		mpChunkAllocator = &DSMemory::MemoryManager::GetHeap();
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSEntity::Archetype::~Archetype()
+{
+	for(unsigned int row = 0; row < mCount; ++row)
+	{
+		DestroyRow(row);
+	}
+
+	std::vector<unsigned char*>::iterator it;
+	for(it = mChunks.begin(); it != mChunks.end(); ++it)
+	{
+		mpChunkAllocator->Free(*it);
+	}
+	mChunks.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  Rows
+
+/*
+Description:
+	Appends a row for entity and returns it. The row's components are left unconstructed.
+*/
+unsigned int DSEntity::Archetype::AddRow(DSEntity::Entity entity)
+{
+	if(mCount == mChunks.size() * mCapacity)
+	{
+		mChunks.push_back(static_cast<unsigned char*>(mpChunkAllocator->Allocate(mChunkBytes, DSEntity::ComponentRegistry::kMaxAlignment)));
+	}
+
+	unsigned int row = mCount++;
+	reinterpret_cast<DSEntity::Entity*>(mChunks[row / mCapacity])[row % mCapacity] = entity;
+
+	return row;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Destroys row's components, then moves the last row into it to keep the rows packed.
+	Returns the entity that moved into row, which the caller must point at its new row, or a null entity if row was the last row.
+*/
+DSEntity::Entity DSEntity::Archetype::RemoveRow(unsigned int row)
+{
+	DestroyRow(row);
+
+	unsigned int last = mCount - 1;
+	DSEntity::Entity moved;
+	if(row != last)
+	{
+		std::vector<unsigned int>::const_iterator it;
+		for(it = mComponentIds.begin(); it != mComponentIds.end(); ++it)
+		{
+			const DSEntity::ComponentInfo& info = DSEntity::ComponentRegistry::GetInfo(*it);
+			void* pDestination = GetComponent(row, *it);
+			void* pSource = GetComponent(last, *it);
+			if(info.mIsTriviallyCopyable == true)
+			{
+				memcpy(pDestination, pSource, info.mSize);
+			}
+			else
+			{
+				info.mpCopyConstruct(pDestination, pSource);
+				info.mpDestruct(pSource);
+			}
+		}
+
+		moved = GetEntity(last);
+		reinterpret_cast<DSEntity::Entity*>(mChunks[row / mCapacity])[row % mCapacity] = moved;
+	}
+	--mCount;
+
+	//Free the last chunk once the one before it is empty too, so an entity moving back and forth across a chunk boundary doesn't allocate every time
+	if(mChunks.size() >= 2 && mCount <= (mChunks.size() - 2) * mCapacity)
+	{
+		mpChunkAllocator->Free(mChunks.back());
+		mChunks.pop_back();
+	}
+
+	return moved;
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+DSEntity::ComponentMask DSEntity::Archetype::GetMask() const
+{
+	return mMask;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSEntity::Archetype::GetCount() const
+{
+	return mCount;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSEntity::Archetype::GetCapacity() const
+{
+	return mCapacity;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Only chunks holding at least one row; a spare empty chunk kept around by RemoveRow is not counted.
+*/
+unsigned int DSEntity::Archetype::GetChunkCount() const
+{
+	return (mCount + mCapacity - 1) / mCapacity;
+}
+
+//-----------------------------------------------------------------------------
+
+DSEntity::Chunk DSEntity::Archetype::GetChunk(unsigned int chunkIndex) const
+{
+	DSEntity::Chunk chunk;
+	chunk.mpArchetype = this;
+	chunk.mpData = mChunks[chunkIndex];
+	chunk.mCount = (chunkIndex + 1) * mCapacity <= mCount ? mCapacity : mCount - chunkIndex * mCapacity;
+
+	return chunk;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSEntity::Archetype::GetOffset(unsigned int componentId) const
+{
+	return mOffsets[componentId];
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	nullptr if this archetype does not have the component, or the component is a tag.
+*/
+void* DSEntity::Archetype::GetComponent(unsigned int row, unsigned int componentId) const
+{
+	if(mOffsets[componentId] == kNoOffset)
+	{
+		return nullptr;
+	}
+
+	return mChunks[row / mCapacity] + mOffsets[componentId] + (row % mCapacity) * DSEntity::ComponentRegistry::GetInfo(componentId).mSize;
+}
+
+//-----------------------------------------------------------------------------
+
+DSEntity::Entity DSEntity::Archetype::GetEntity(unsigned int row) const
+{
+	return reinterpret_cast<const DSEntity::Entity*>(mChunks[row / mCapacity])[row % mCapacity];
+}
+
+//-----------------------------------------------------------------------------
+
+const std::vector<unsigned int>& DSEntity::Archetype::GetComponentIds() const
+{
+	return mComponentIds;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helper Functions
+
+void DSEntity::Archetype::DestroyRow(unsigned int row)
+{
+	std::vector<unsigned int>::const_iterator it;
+	for(it = mComponentIds.begin(); it != mComponentIds.end(); ++it)
+	{
+		const DSEntity::ComponentInfo& info = DSEntity::ComponentRegistry::GetInfo(*it);
+		if(info.mIsTriviallyCopyable == false)
+		{
+			info.mpDestruct(GetComponent(row, *it));
+		}
+	}
+}
\ No newline at end of file
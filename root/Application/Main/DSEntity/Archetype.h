@@ -0,0 +1,149 @@
+//=============================================================================
+// File:		Archetype.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Archetype. Storage for every entity made of exactly the same set of components, one array per component in fixed size chunks.
+//=============================================================================
+
+#ifndef ARCHETYPE_H
+#define ARCHETYPE_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <vector>
+
+// Daniel Schenker
+#include "Component.h"
+#include "Entity.h"
+#include "../DSMemory/Allocator.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSEntity
+{
+
+	//=============================================================================
+	//Forward Declarations
+	//=============================================================================
+
+	class Archetype;
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	/*
+	Description:
+		View of one chunk: GetCount() entities, with each component in its own tightly packed array.
+	Usage:
+		DSGraphics::ModelInstance* pInstances = chunk.Get<DSGraphics::ModelInstance>();
+		for(unsigned int i = 0; i < chunk.GetCount(); ++i) { pInstances[i]... }
+	*/
+	struct Chunk
+	{
+		template<typename T>
+		T* Get() const;
+
+		const DSEntity::Entity* GetEntities() const
+		{
+			return reinterpret_cast<const DSEntity::Entity*>(mpData);
+		}
+
+		unsigned int GetCount() const
+		{
+			return mCount;
+		}
+
+		const DSEntity::Archetype* mpArchetype;
+		unsigned char* mpData;
+		unsigned int mCount;
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Rows are numbered across chunks (row / capacity is the chunk, row % capacity the slot in it), and are always packed:
+		removing a row moves the last row into the hole, so every chunk but the last is full and iteration never meets a gap.
+	Notes:
+		Each chunk holds the entity handles first, then one array per component with a size, each aligned for its type.
+		kChunkSize is small enough that a chunk being processed stays in the L1/L2 cache, and large enough to hold a useful number of rows.
+		AddRow leaves the new row's components unconstructed; the caller (World) constructs them straight away.
+		Chunks come from the owning world's pool of kChunkSize blocks, so creating and emptying chunks never reaches the heap once the pool has grown.
+	*/
+	class Archetype
+	{
+	public:
+		//Constructors
+		Archetype(DSEntity::ComponentMask mask, DSMemory::Allocator& chunkPool);
+		//Destructor
+		~Archetype();
+
+	private:
+		//Disable Copy Constructor
+		Archetype(const Archetype&);
+		const Archetype& operator=(const Archetype&);
+
+		//Member Functions
+	public:
+		// Rows
+		unsigned int AddRow(DSEntity::Entity entity);
+		DSEntity::Entity RemoveRow(unsigned int row);
+
+		// Getters
+		DSEntity::ComponentMask GetMask() const;
+		unsigned int GetCount() const;
+		unsigned int GetCapacity() const;
+		unsigned int GetChunkCount() const;
+		DSEntity::Chunk GetChunk(unsigned int chunkIndex) const;
+		unsigned int GetOffset(unsigned int componentId) const;
+		void* GetComponent(unsigned int row, unsigned int componentId) const;
+		DSEntity::Entity GetEntity(unsigned int row) const;
+		const std::vector<unsigned int>& GetComponentIds() const;
+
+	private:
+		// Helper Functions
+		void DestroyRow(unsigned int row);
+
+		//Member Variables
+	public:
+		static const unsigned int kChunkSize = 16 * 1024;
+		static const unsigned int kNoOffset = 0xFFFFFFFF;
+
+	private:
+		DSEntity::ComponentMask mMask;
+		std::vector<unsigned int> mComponentIds;//components with a size, in id order
+		unsigned int mOffsets[DSEntity::ComponentRegistry::kMaxComponents];//start of each component's array within a chunk, or kNoOffset
+		unsigned int mCapacity;//rows per chunk
+		unsigned int mChunkBytes;
+		unsigned int mCount;
+		std::vector<unsigned char*> mChunks;
+		DSMemory::Allocator* mpChunkAllocator;//the chunk pool, or the heap for the rare archetype whose single row is bigger than a pool block
+	};
+
+	//=============================================================================
+	//Template Definitions
+	//=============================================================================
+
+	/*
+	Notes:
+		nullptr if the chunk's archetype does not have T, or T is a tag.
+	*/
+	template<typename T>
+	T* Chunk::Get() const
+	{
+		unsigned int offset = mpArchetype->GetOffset(DSEntity::ComponentRegistry::GetId<T>());
+		return offset == DSEntity::Archetype::kNoOffset ? nullptr : reinterpret_cast<T*>(mpData + offset);
+	}
+
+}//namespace DSEntity
+
+#endif //#ifndef ARCHETYPE_H
\ No newline at end of file
@@ -0,0 +1,253 @@
+//=============================================================================
+// File:		CommandBuffer.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	CommandBuffer
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstring>
+
+// Daniel Schenker
+#include "CommandBuffer.h"
+#include "World.h"
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSEntity::CommandBuffer::CommandBuffer()
+:	mPage(0)
+,	mPageOffset(0)
+,	mPendingCount(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSEntity::CommandBuffer::~CommandBuffer()
+{
+	Clear();
+
+	std::vector<unsigned char*>::iterator it;
+	for(it = mPages.begin(); it != mPages.end(); ++it)
+	{
+		delete[] *it;
+	}
+	mPages.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  Recording
+
+/*
+Description:
+	Returns a placeholder for an entity that will be created on playback. It can be passed to this buffer's other commands, but not to a World.
+*/
+DSEntity::Entity DSEntity::CommandBuffer::CreateEntity()
+{
+	Command command;
+	command.mType = kCreateEntity;
+	command.mEntity = DSEntity::Entity(mPendingCount++, DSEntity::Entity::kPendingGeneration);
+	command.mComponentId = DSEntity::ComponentRegistry::kInvalidComponent;
+	command.mpComponent = nullptr;
+	mCommands.push_back(command);
+
+	return command.mEntity;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSEntity::CommandBuffer::DestroyEntity(DSEntity::Entity entity)
+{
+	Command command;
+	command.mType = kDestroyEntity;
+	command.mEntity = entity;
+	command.mComponentId = DSEntity::ComponentRegistry::kInvalidComponent;
+	command.mpComponent = nullptr;
+	mCommands.push_back(command);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	pComponent = copied straight away, so it may be a temporary.
+*/
+void DSEntity::CommandBuffer::AddComponent(DSEntity::Entity entity, unsigned int componentId, const void* pComponent)
+{
+	const DSEntity::ComponentInfo& info = DSEntity::ComponentRegistry::GetInfo(componentId);
+
+	Command command;
+	command.mType = kAddComponent;
+	command.mEntity = entity;
+	command.mComponentId = componentId;
+	command.mpComponent = nullptr;
+	if(info.mSize > 0)
+	{
+		command.mpComponent = Allocate(info.mSize, info.mAlignment);
+		if(info.mIsTriviallyCopyable == true)
+		{
+			memcpy(command.mpComponent, pComponent, info.mSize);
+		}
+		else
+		{
+			info.mpCopyConstruct(command.mpComponent, pComponent);
+		}
+	}
+	mCommands.push_back(command);
+}
+
+//-----------------------------------------------------------------------------
+
+void DSEntity::CommandBuffer::RemoveComponent(DSEntity::Entity entity, unsigned int componentId)
+{
+	Command command;
+	command.mType = kRemoveComponent;
+	command.mEntity = entity;
+	command.mComponentId = componentId;
+	command.mpComponent = nullptr;
+	mCommands.push_back(command);
+}
+
+//-----------------------------------------------------------------------------
+//  Playback
+
+/*
+Description:
+	Applies every command to world in the order they were recorded, then clears the buffer.
+*/
+void DSEntity::CommandBuffer::Playback(DSEntity::World& world)
+{
+	mCreated.assign(mPendingCount, DSEntity::Entity());
+
+	std::vector<Command>::const_iterator it;
+	for(it = mCommands.begin(); it != mCommands.end(); ++it)
+	{
+		DSEntity::Entity entity = it->mEntity;
+		if(it->mType != kCreateEntity && entity.GetIsNull() == false && entity.GetGeneration() == DSEntity::Entity::kPendingGeneration)
+		{
+			entity = mCreated[entity.GetIndex()];
+		}
+
+		switch(it->mType)
+		{
+		case kCreateEntity:
+			mCreated[entity.GetIndex()] = world.CreateEntity();
+			break;
+		case kDestroyEntity:
+			if(world.GetIsAlive(entity) == true)
+			{
+				world.DestroyEntity(entity);
+			}
+			break;
+		case kAddComponent:
+			if(world.GetIsAlive(entity) == true)
+			{
+				world.AddComponent(entity, it->mComponentId, it->mpComponent);
+			}
+			break;
+		case kRemoveComponent:
+			if(world.GetIsAlive(entity) == true)
+			{
+				world.RemoveComponent(entity, it->mComponentId);
+			}
+			break;
+		}
+	}
+
+	Clear();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Discards every command without applying it. The pages are kept for reuse.
+*/
+void DSEntity::CommandBuffer::Clear()
+{
+	std::vector<Command>::const_iterator it;
+	for(it = mCommands.begin(); it != mCommands.end(); ++it)
+	{
+		if(it->mpComponent != nullptr)
+		{
+			const DSEntity::ComponentInfo& info = DSEntity::ComponentRegistry::GetInfo(it->mComponentId);
+			if(info.mIsTriviallyCopyable == false)
+			{
+				info.mpDestruct(it->mpComponent);
+			}
+		}
+	}
+	mCommands.clear();
+
+	std::vector<unsigned char*>::iterator large;
+	for(large = mLargeAllocations.begin(); large != mLargeAllocations.end(); ++large)
+	{
+		delete[] *large;
+	}
+	mLargeAllocations.clear();
+
+	mPage = 0;
+	mPageOffset = 0;
+	mPendingCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helper Functions
+
+/*
+Description:
+	Returns room for size bytes from the current page, moving on to the next page (allocating it the first time) when it doesn't fit.
+*/
+void* DSEntity::CommandBuffer::Allocate(unsigned int size, unsigned int alignment)
+{
+	if(size > kPageSize)
+	{
+		mLargeAllocations.push_back(new unsigned char[size]);
+		return mLargeAllocations.back();
+	}
+
+	if(mPages.empty() == true)
+	{
+		mPages.push_back(new unsigned char[kPageSize]);
+	}
+
+	unsigned int offset = (mPageOffset + alignment - 1) / alignment * alignment;
+	if(offset + size > kPageSize)
+	{
+		++mPage;
+		if(mPage == mPages.size())
+		{
+			mPages.push_back(new unsigned char[kPageSize]);
+		}
+		offset = 0;
+	}
+	mPageOffset = offset + size;
+
+	return mPages[mPage] + offset;
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+bool DSEntity::CommandBuffer::GetIsEmpty() const
+{
+	return mCommands.empty();
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+//=============================================================================
+// File:		CommandBuffer.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	CommandBuffer. Records structural changes (creating and destroying entities, adding and removing components) to apply to a World later.
+//=============================================================================
+
+#ifndef COMMANDBUFFER_H
+#define COMMANDBUFFER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <vector>
+
+// Daniel Schenker
+#include "Component.h"
+#include "Entity.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSEntity
+{
+
+	//=============================================================================
+	//Forward Declarations
+	//=============================================================================
+
+	class World;
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Structural changes move entities between chunks, so they cannot happen while a query is iterating those chunks.
+		Systems record them here instead, and the buffer is played back once iteration is over, in the order the commands were recorded.
+	Usage:
+		DSEntity::Entity bullet = commands.CreateEntity();//not created yet, but usable in later commands of this buffer
+		commands.AddComponent(bullet, Velocity(...));
+		commands.DestroyEntity(target);
+		...
+		commands.Playback(world);
+	Notes:
+		Not thread safe: give each thread (or system) its own buffer.
+		Commands for entities that are no longer alive when the buffer is played back are skipped, so two systems may both destroy the same entity.
+		Component values are copied into pages that never move, so recording does not allocate once the buffer has been used a few times.
+	*/
+	class CommandBuffer
+	{
+	public:
+		//Constructors
+		CommandBuffer();
+		//Destructor
+		~CommandBuffer();
+
+	private:
+		//Disable Copy Constructor
+		CommandBuffer(const CommandBuffer&);
+		const CommandBuffer& operator=(const CommandBuffer&);
+
+		//Member Functions
+	public:
+		// Recording
+		DSEntity::Entity CreateEntity();
+		void DestroyEntity(DSEntity::Entity entity);
+		void AddComponent(DSEntity::Entity entity, unsigned int componentId, const void* pComponent);
+		void RemoveComponent(DSEntity::Entity entity, unsigned int componentId);
+
+		template<typename T>
+		void AddComponent(DSEntity::Entity entity, const T& component)
+		{
+			AddComponent(entity, DSEntity::ComponentRegistry::GetId<T>(), &component);
+		}
+
+		template<typename T>
+		void RemoveComponent(DSEntity::Entity entity)
+		{
+			RemoveComponent(entity, DSEntity::ComponentRegistry::GetId<T>());
+		}
+
+		// Playback
+		void Playback(DSEntity::World& world);
+		void Clear();
+
+	private:
+		// Helper Functions
+		void* Allocate(unsigned int size, unsigned int alignment);
+
+	public:
+		// Getters
+		bool GetIsEmpty() const;
+
+		//Member Variables
+	private:
+		enum CommandType
+		{
+			kCreateEntity,
+			kDestroyEntity,
+			kAddComponent,
+			kRemoveComponent
+		};
+
+		struct Command
+		{
+			CommandType mType;
+			DSEntity::Entity mEntity;
+			unsigned int mComponentId;
+			void* mpComponent;//copy of the component, in one of mPages
+		};
+
+		static const unsigned int kPageSize = 4096;
+
+		std::vector<Command> mCommands;
+		std::vector<unsigned char*> mPages;
+		std::vector<unsigned char*> mLargeAllocations;//components bigger than a page, freed by Clear
+		unsigned int mPage;//page being filled
+		unsigned int mPageOffset;
+		unsigned int mPendingCount;//entities created by this buffer
+		std::vector<DSEntity::Entity> mCreated;//pending entity number -> created entity, filled during playback
+	};
+
+}//namespace DSEntity
+
+#endif //#ifndef COMMANDBUFFER_H
\ No newline at end of file
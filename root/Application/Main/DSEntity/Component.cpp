@@ -0,0 +1,57 @@
+//=============================================================================
+// File:		Component.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Component
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Daniel Schenker
+#include "Component.h"
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSEntity::ComponentRegistry::ComponentRegistry()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+const DSEntity::ComponentInfo& DSEntity::ComponentRegistry::GetInfo(unsigned int id)
+{
+	return GetComponents()[id];
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSEntity::ComponentRegistry::GetCount()
+{
+	return static_cast<unsigned int>(GetComponents().size());
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helper Functions
+
+/*
+Notes:
+	A function local static rather than a static member, so that it exists no matter which translation unit registers first.
+*/
+std::vector<DSEntity::ComponentInfo>& DSEntity::ComponentRegistry::GetComponents()
+{
+	static std::vector<DSEntity::ComponentInfo> sComponents;
+	return sComponents;
+}
\ No newline at end of file
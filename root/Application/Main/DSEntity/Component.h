@@ -0,0 +1,159 @@
+//=============================================================================
+// File:		Component.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Component. Registry of the types that entities can be made of, and the type erased operations needed to store them in chunks.
+//=============================================================================
+
+#ifndef COMPONENT_H
+#define COMPONENT_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSEntity
+{
+
+	//=============================================================================
+	//Typedefs
+	//=============================================================================
+
+	typedef unsigned long long ComponentMask;//one bit per registered component type
+	typedef void (*CopyConstructFunction)(void* pDestination, const void* pSource);
+	typedef void (*DestructFunction)(void* pComponent);
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	struct ComponentInfo
+	{
+		const char* mpName;
+		unsigned int mSize;//0 for tags (empty types), which only take part in the mask and take no space in chunks
+		unsigned int mAlignment;
+		bool mIsTriviallyCopyable;//copied with memcpy and never destructed
+		CopyConstructFunction mpCopyConstruct;
+		DestructFunction mpDestruct;
+	};
+
+	/*
+	Notes:
+		Holds the id handed out by ComponentRegistry::Register<T>, plus the type erased copy and destroy operations for T.
+	*/
+	template<typename T>
+	struct ComponentType
+	{
+		static void CopyConstruct(void* pDestination, const void* pSource)
+		{
+			new(pDestination) T(*static_cast<const T*>(pSource));
+		}
+
+		static void Destruct(void* pComponent)
+		{
+			static_cast<T*>(pComponent)->~T();
+		}
+
+		static unsigned int sId;
+	};
+
+	template<typename T>
+	unsigned int ComponentType<T>::sId = 0xFFFFFFFF;
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Usage:
+		At startup, before any world uses them:	ComponentRegistry::Register<DSGraphics::ModelInstance>("ModelInstance");
+		Afterwards:								ComponentRegistry::GetMask<DSGraphics::ModelInstance>() | ComponentRegistry::GetMask<DSPhysics::RigidBody>()
+	Notes:
+		Registration is explicit, and must happen on one thread before any other thread uses the registry,
+		since Visual Studio 2013 does not make function local statics thread safe.
+		Any copyable type can be a component. Components are copy constructed when an entity moves between archetypes, so keep them cheap to copy.
+		Chunks are only 8 byte aligned (the alignment of the 32 bit heap), so types needing more than that are rejected.
+	*/
+	class ComponentRegistry
+	{
+	private:
+		//Constructors
+		ComponentRegistry();
+
+		//Member Functions
+	public:
+		// General
+		template<typename T>
+		static unsigned int Register(const char* pName)
+		{
+			if(ComponentType<T>::sId != kInvalidComponent)
+			{
+				return ComponentType<T>::sId;
+			}
+			if(GetComponents().size() == kMaxComponents)
+			{
+				throw std::runtime_error("ERROR: Too many component types. A ComponentMask only has room for 64.");
+			}
+			if(std::alignment_of<T>::value > kMaxAlignment)
+			{
+				throw std::runtime_error("ERROR: Component types cannot need more than 8 byte alignment.");
+			}
+
+			DSEntity::ComponentInfo info;
+			info.mpName = pName;
+			info.mSize = std::is_empty<T>::value == true ? 0 : sizeof(T);
+			info.mAlignment = std::alignment_of<T>::value;
+			info.mIsTriviallyCopyable = std::is_trivially_copyable<T>::value;
+			info.mpCopyConstruct = ComponentType<T>::CopyConstruct;
+			info.mpDestruct = ComponentType<T>::Destruct;
+			GetComponents().push_back(info);
+
+			ComponentType<T>::sId = static_cast<unsigned int>(GetComponents().size() - 1);
+			return ComponentType<T>::sId;
+		}
+
+		// Getters
+		template<typename T>
+		static unsigned int GetId()
+		{
+			if(ComponentType<T>::sId == kInvalidComponent)
+			{
+				throw std::runtime_error("ERROR: A component type was used before being registered with ComponentRegistry::Register.");
+			}
+			return ComponentType<T>::sId;
+		}
+
+		template<typename T>
+		static ComponentMask GetMask()
+		{
+			return 1ull << GetId<T>();
+		}
+
+		static const DSEntity::ComponentInfo& GetInfo(unsigned int id);
+		static unsigned int GetCount();
+
+	private:
+		// Helper Functions
+		static std::vector<DSEntity::ComponentInfo>& GetComponents();
+
+		//Member Variables
+	public:
+		static const unsigned int kMaxComponents = 64;
+		static const unsigned int kMaxAlignment = 8;
+		static const unsigned int kInvalidComponent = 0xFFFFFFFF;
+	};
+
+}//namespace DSEntity
+
+#endif //#ifndef COMPONENT_H
\ No newline at end of file
@@ -0,0 +1,78 @@
+//=============================================================================
+// File:		Entity.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Entity. 32 bit handle to an entity in a DSEntity::World.
+//=============================================================================
+
+#ifndef ENTITY_H
+#define ENTITY_H
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSEntity
+{
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	/*
+	Notes:
+		The low kIndexBits bits index the world's entity records, and the rest hold the generation of that record.
+		Destroying an entity bumps its record's generation, so old handles to it stop matching instead of silently referring to whatever reuses the record.
+		The highest generation (kPendingGeneration) is never handed out by a world. CommandBuffer uses it for entities it has not created yet.
+		Same layout as DSContainers::SlotMapHandle, which is what a world keeps its entity records in.
+	*/
+	struct Entity
+	{
+		Entity()
+		:	mId(kNull)
+		{
+		}
+
+		Entity(unsigned int index, unsigned int generation)
+		:	mId((generation << kIndexBits) | (index & kIndexMask))
+		{
+		}
+
+		unsigned int GetIndex() const
+		{
+			return mId & kIndexMask;
+		}
+
+		unsigned int GetGeneration() const
+		{
+			return mId >> kIndexBits;
+		}
+
+		bool GetIsNull() const
+		{
+			return mId == kNull;
+		}
+
+		bool operator==(const Entity& other) const
+		{
+			return mId == other.mId;
+		}
+
+		bool operator!=(const Entity& other) const
+		{
+			return mId != other.mId;
+		}
+
+		static const unsigned int kIndexBits = 20;//up to about a million entities alive at once
+		static const unsigned int kIndexMask = (1u << kIndexBits) - 1;
+		static const unsigned int kMaxGeneration = (1u << (32 - kIndexBits)) - 1;
+		static const unsigned int kPendingGeneration = kMaxGeneration;
+		static const unsigned int kNull = 0xFFFFFFFF;
+
+		unsigned int mId;
+	};
+
+}//namespace DSEntity
+
+#endif //#ifndef ENTITY_H
\ No newline at end of file
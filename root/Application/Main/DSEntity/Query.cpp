@@ -0,0 +1,211 @@
+//=============================================================================
+// File:		Query.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Query
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Daniel Schenker
+#include "Query.h"
+#include "World.h"
+#include "../DSThreading/JobSystem.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	struct ForEachChunkData
+	{
+		const DSEntity::Query* mpQuery;
+		DSEntity::ChunkFunction mpFunction;
+		void* mpUserData;
+	};
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	all = components an entity must have to match.
+	none = components an entity must not have to match.
+*/
+DSEntity::Query::Query(DSEntity::World* pWorld, DSEntity::ComponentMask all, DSEntity::ComponentMask none)
+:	mpWorld(pWorld)
+,	mAll(all)
+,	mNone(none)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSEntity::Query::~Query()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+bool DSEntity::Query::GetIsMatch(DSEntity::ComponentMask mask) const
+{
+	return (mask & mAll) == mAll && (mask & mNone) == 0;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Called by the world for every archetype that matches, when either of them is created.
+*/
+void DSEntity::Query::AddArchetype(const DSEntity::Archetype* pArchetype)
+{
+	mArchetypes.push_back(pArchetype);
+}
+
+//-----------------------------------------------------------------------------
+//  Iteration
+
+/*
+Description:
+	Calls pFunction once for every non-empty chunk of every matching archetype, on the calling thread.
+*/
+void DSEntity::Query::ForEachChunk(DSEntity::ChunkFunction pFunction, void* pUserData) const
+{
+	mpWorld->Lock();
+
+	try
+	{
+		std::vector<const DSEntity::Archetype*>::const_iterator it;
+		for(it = mArchetypes.begin(); it != mArchetypes.end(); ++it)
+		{
+			unsigned int chunkCount = (*it)->GetChunkCount();
+			for(unsigned int chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+			{
+				pFunction((*it)->GetChunk(chunkIndex), pUserData);
+			}
+		}
+	}
+	catch(...)
+	{
+		//Don't leave the world locked against structural changes
+		mpWorld->Unlock();
+		throw;
+	}
+
+	mpWorld->Unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Same as ForEachChunk, but spreads the chunks across the job system, a few pieces of work per thread.
+Notes:
+	pFunction runs on several threads at once, so it may only write to the chunk it was given (or to thread safe state of its own).
+	Must be called from a thread registered with DSThreading::JobSystem.
+*/
+void DSEntity::Query::ForEachChunkParallel(const char* pName, DSEntity::ChunkFunction pFunction, void* pUserData) const
+{
+	ForEachChunkData data;
+	data.mpQuery = this;
+	data.mpFunction = pFunction;
+	data.mpUserData = pUserData;
+
+	unsigned int chunkCount = GetChunkCount();
+
+	mpWorld->Lock();
+	try
+	{
+		DSThreading::JobSystem::ParallelFor(pName, 0, chunkCount, DSThreading::JobSystem::GetGrainSize(chunkCount), ForEachChunkRange, &data);
+	}
+	catch(...)
+	{
+		mpWorld->Unlock();
+		throw;
+	}
+	mpWorld->Unlock();
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  ForEachChunkParallel Sub-Functions
+
+/*
+Variables:
+	begin, end = range of chunks, numbered across all matching archetypes in order.
+	pUserData = ForEachChunkData.
+*/
+void DSEntity::Query::ForEachChunkRange(unsigned int begin, unsigned int end, void* pUserData)
+{
+	const ForEachChunkData& data = *static_cast<const ForEachChunkData*>(pUserData);
+
+	//Find the archetype holding chunk begin, then walk forwards
+	unsigned int first = 0;
+	std::vector<const DSEntity::Archetype*>::const_iterator it;
+	for(it = data.mpQuery->mArchetypes.begin(); it != data.mpQuery->mArchetypes.end() && begin < end; ++it)
+	{
+		unsigned int chunkCount = (*it)->GetChunkCount();
+		while(begin < end && begin - first < chunkCount)
+		{
+			data.mpFunction((*it)->GetChunk(begin - first), data.mpUserData);
+			++begin;
+		}
+		first += chunkCount;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+unsigned int DSEntity::Query::GetEntityCount() const
+{
+	unsigned int count = 0;
+
+	std::vector<const DSEntity::Archetype*>::const_iterator it;
+	for(it = mArchetypes.begin(); it != mArchetypes.end(); ++it)
+	{
+		count += (*it)->GetCount();
+	}
+
+	return count;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSEntity::Query::GetChunkCount() const
+{
+	unsigned int count = 0;
+
+	std::vector<const DSEntity::Archetype*>::const_iterator it;
+	for(it = mArchetypes.begin(); it != mArchetypes.end(); ++it)
+	{
+		count += (*it)->GetChunkCount();
+	}
+
+	return count;
+}
+
+//-----------------------------------------------------------------------------
+
+const std::vector<const DSEntity::Archetype*>& DSEntity::Query::GetArchetypes() const
+{
+	return mArchetypes;
+}
\ No newline at end of file
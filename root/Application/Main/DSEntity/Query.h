@@ -0,0 +1,98 @@
+//=============================================================================
+// File:		Query.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Query. Cached list of the archetypes that have (and lack) a given set of components.
+//=============================================================================
+
+#ifndef QUERY_H
+#define QUERY_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <vector>
+
+// Daniel Schenker
+#include "Archetype.h"
+#include "Component.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSEntity
+{
+
+	//=============================================================================
+	//Forward Declarations
+	//=============================================================================
+
+	class World;
+
+	//=============================================================================
+	//Typedefs
+	//=============================================================================
+
+	typedef void (*ChunkFunction)(const DSEntity::Chunk& chunk, void* pUserData);
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Matches every archetype whose mask contains all of mAll and none of mNone.
+		The match is worked out once per archetype, when the world creates the archetype (or the query), so iterating never searches.
+	Notes:
+		Created and owned by a World (World::CreateQuery).
+		Iterating locks the world, so structural changes made during it (adding or removing entities or components) throw instead of corrupting the chunks.
+		Changing component values in place is fine. Record structural changes in a CommandBuffer and play it back afterwards.
+	*/
+	class Query
+	{
+	public:
+		//Constructors
+		Query(DSEntity::World* pWorld, DSEntity::ComponentMask all, DSEntity::ComponentMask none);
+		//Destructor
+		~Query();
+
+	private:
+		//Disable Copy Constructor
+		Query(const Query&);
+		const Query& operator=(const Query&);
+
+		//Member Functions
+	public:
+		// General
+		bool GetIsMatch(DSEntity::ComponentMask mask) const;
+		void AddArchetype(const DSEntity::Archetype* pArchetype);
+
+		// Iteration
+		void ForEachChunk(DSEntity::ChunkFunction pFunction, void* pUserData) const;
+		void ForEachChunkParallel(const char* pName, DSEntity::ChunkFunction pFunction, void* pUserData) const;
+
+	private:
+		// ForEachChunkParallel Sub-Functions
+		static void ForEachChunkRange(unsigned int begin, unsigned int end, void* pUserData);
+
+	public:
+		// Getters
+		unsigned int GetEntityCount() const;
+		unsigned int GetChunkCount() const;
+		const std::vector<const DSEntity::Archetype*>& GetArchetypes() const;
+
+		//Member Variables
+	private:
+		DSEntity::World* mpWorld;
+		DSEntity::ComponentMask mAll;
+		DSEntity::ComponentMask mNone;
+		std::vector<const DSEntity::Archetype*> mArchetypes;
+	};
+
+}//namespace DSEntity
+
+#endif //#ifndef QUERY_H
\ No newline at end of file
@@ -0,0 +1,248 @@
+//=============================================================================
+// File:		SystemScheduler.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	SystemScheduler
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Daniel Schenker
+#include "SystemScheduler.h"
+#include "World.h"
+#include "../DSProfiling/Profiler.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	struct StageData
+	{
+		DSEntity::SystemScheduler* mpScheduler;
+		DSEntity::World* mpWorld;
+		const std::vector<unsigned int>* mpStage;
+	};
+
+	struct SystemData
+	{
+		DSEntity::SystemScheduler* mpScheduler;
+		DSEntity::World* mpWorld;
+		unsigned int mSystemIndex;
+	};
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSEntity::SystemScheduler::SystemScheduler()
+:	mStagesOutdated(false)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSEntity::SystemScheduler::~SystemScheduler()
+{
+	std::vector<System>::iterator it;
+	for(it = mSystems.begin(); it != mSystems.end(); ++it)
+	{
+		delete it->mpCommands;
+	}
+	mSystems.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Variables:
+	pName = shown in the profiler. Must outlive the scheduler (normally a string literal).
+	reads = components the system only reads.
+	writes = components the system writes (and may read).
+*/
+void DSEntity::SystemScheduler::Add(const char* pName, DSEntity::ComponentMask reads, DSEntity::ComponentMask writes, DSEntity::SystemFunction pFunction, void* pUserData)
+{
+	System system;
+	system.mpName = pName;
+	system.mReads = reads;
+	system.mWrites = writes;
+	system.mpFunction = pFunction;
+	system.mpUserData = pUserData;
+	system.mpCommands = new DSEntity::CommandBuffer();
+	mSystems.push_back(system);
+
+	mStagesOutdated = true;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Runs every system once, stage by stage, then plays back their command buffers.
+*/
+void DSEntity::SystemScheduler::Run(DSEntity::World& world)
+{
+	if(mStagesOutdated == true)
+	{
+		BuildStages();
+	}
+
+	world.Lock();
+	try
+	{
+		std::vector<std::vector<unsigned int> >::const_iterator stage;
+		for(stage = mStages.begin(); stage != mStages.end(); ++stage)
+		{
+			//Not worth a job
+			if(stage->size() == 1)
+			{
+				RunSystem(stage->front(), world);
+				continue;
+			}
+
+			StageData data;
+			data.mpScheduler = this;
+			data.mpWorld = &world;
+			data.mpStage = &(*stage);
+
+			//Rethrows whatever a system in the stage threw
+			DSThreading::Job* pRoot = DSThreading::JobSystem::CreateJob("SystemStage", StageJob, &data, sizeof(data));
+			DSThreading::JobSystem::Run(pRoot);
+			DSThreading::JobSystem::Wait(pRoot);
+		}
+	}
+	catch(...)
+	{
+		//Don't leave the world locked against structural changes
+		world.Unlock();
+		throw;
+	}
+	world.Unlock();
+
+	//Structural changes, in registration order
+	std::vector<System>::iterator it;
+	for(it = mSystems.begin(); it != mSystems.end(); ++it)
+	{
+		if(it->mpCommands->GetIsEmpty() == false)
+		{
+			it->mpCommands->Playback(world);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Run Sub-Functions
+
+/*
+Description:
+	Puts each system in the stage after the last stage holding a system it conflicts with.
+*/
+void DSEntity::SystemScheduler::BuildStages()
+{
+	mStages.clear();
+
+	std::vector<unsigned int> systemStages(mSystems.size(), 0);
+	for(unsigned int i = 0; i < mSystems.size(); ++i)
+	{
+		unsigned int stage = 0;
+		for(unsigned int earlier = 0; earlier < i; ++earlier)
+		{
+			bool conflicts =
+				(mSystems[i].mWrites & (mSystems[earlier].mReads | mSystems[earlier].mWrites)) != 0
+			||	(mSystems[earlier].mWrites & mSystems[i].mReads) != 0;
+			if(conflicts == true && systemStages[earlier] + 1 > stage)
+			{
+				stage = systemStages[earlier] + 1;
+			}
+		}
+		systemStages[i] = stage;
+
+		if(stage == mStages.size())
+		{
+			mStages.push_back(std::vector<unsigned int>());
+		}
+		mStages[stage].push_back(i);
+	}
+
+	mStagesOutdated = false;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Spawns one child job per system in the stage. The stage's job (and so Run's Wait) only finishes once they all have.
+*/
+void DSEntity::SystemScheduler::StageJob(DSThreading::Job* pJob, const void* pData)
+{
+	const StageData& stageData = *static_cast<const StageData*>(pData);
+
+	std::vector<unsigned int>::const_iterator it;
+	for(it = stageData.mpStage->begin(); it != stageData.mpStage->end(); ++it)
+	{
+		SystemData systemData;
+		systemData.mpScheduler = stageData.mpScheduler;
+		systemData.mpWorld = stageData.mpWorld;
+		systemData.mSystemIndex = *it;
+
+		DSThreading::Job* pChild = DSThreading::JobSystem::CreateChildJob(pJob, stageData.mpScheduler->mSystems[*it].mpName, SystemJob, &systemData, sizeof(systemData));
+		DSThreading::JobSystem::Run(pChild);
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void DSEntity::SystemScheduler::SystemJob(DSThreading::Job* /*pJob*/, const void* pData)
+{
+	const SystemData& systemData = *static_cast<const SystemData*>(pData);
+	const System& system = systemData.mpScheduler->mSystems[systemData.mSystemIndex];
+
+	system.mpFunction(*systemData.mpWorld, *system.mpCommands, system.mpUserData);
+}
+
+//-----------------------------------------------------------------------------
+
+void DSEntity::SystemScheduler::RunSystem(unsigned int systemIndex, DSEntity::World& world)
+{
+	const System& system = mSystems[systemIndex];
+
+	DSProfiling::ScopedZone zone(system.mpName);
+	system.mpFunction(world, *system.mpCommands, system.mpUserData);
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+unsigned int DSEntity::SystemScheduler::GetSystemCount() const
+{
+	return static_cast<unsigned int>(mSystems.size());
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSEntity::SystemScheduler::GetStageCount()
+{
+	if(mStagesOutdated == true)
+	{
+		BuildStages();
+	}
+
+	return static_cast<unsigned int>(mStages.size());
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+//=============================================================================
+// File:		SystemScheduler.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	SystemScheduler. Runs systems in registration order, in parallel where the components they read and write do not conflict.
+//=============================================================================
+
+#ifndef SYSTEMSCHEDULER_H
+#define SYSTEMSCHEDULER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <vector>
+
+// Daniel Schenker
+#include "CommandBuffer.h"
+#include "Component.h"
+#include "../DSThreading/JobSystem.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSEntity
+{
+
+	//=============================================================================
+	//Forward Declarations
+	//=============================================================================
+
+	class World;
+
+	//=============================================================================
+	//Typedefs
+	//=============================================================================
+
+	typedef void (*SystemFunction)(DSEntity::World& world, DSEntity::CommandBuffer& commands, void* pUserData);
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Each system declares the components it reads and the components it writes.
+		Two systems conflict when one writes a component the other reads or writes, and conflicting systems always run in the order they were added.
+		Systems are grouped into stages: a system goes in the stage after the last stage holding a system it conflicts with.
+		The systems in a stage run at the same time as jobs, and each stage waits for the one before it.
+	Notes:
+		The world is locked while the systems run, so each system records its structural changes in the CommandBuffer it is given.
+		Once every stage has finished, the buffers are played back in the order the systems were added, so the result does not depend on timing.
+		State shared between systems other than components (eg. members of whoever registered them) is invisible to the scheduler;
+		declare a component for it, or keep such systems in one function.
+		Run must be called from a thread registered with DSThreading::JobSystem.
+	*/
+	class SystemScheduler
+	{
+	public:
+		//Constructors
+		SystemScheduler();
+		//Destructor
+		~SystemScheduler();
+
+	private:
+		//Disable Copy Constructor
+		SystemScheduler(const SystemScheduler&);
+		const SystemScheduler& operator=(const SystemScheduler&);
+
+		//Member Functions
+	public:
+		// General
+		void Add(const char* pName, DSEntity::ComponentMask reads, DSEntity::ComponentMask writes, DSEntity::SystemFunction pFunction, void* pUserData);
+		void Run(DSEntity::World& world);
+
+	private:
+		// Run Sub-Functions
+		void BuildStages();
+		static void StageJob(DSThreading::Job* pJob, const void* pData);
+		static void SystemJob(DSThreading::Job* pJob, const void* pData);
+		void RunSystem(unsigned int systemIndex, DSEntity::World& world);
+
+	public:
+		// Getters
+		unsigned int GetSystemCount() const;
+		unsigned int GetStageCount();
+
+		//Member Variables
+	private:
+		struct System
+		{
+			const char* mpName;
+			DSEntity::ComponentMask mReads;
+			DSEntity::ComponentMask mWrites;
+			DSEntity::SystemFunction mpFunction;
+			void* mpUserData;
+			DSEntity::CommandBuffer* mpCommands;
+		};
+
+		std::vector<System> mSystems;
+		std::vector<std::vector<unsigned int> > mStages;//system indices, in registration order within each stage
+		bool mStagesOutdated;
+	};
+
+}//namespace DSEntity
+
+#endif //#ifndef SYSTEMSCHEDULER_H
\ No newline at end of file
@@ -0,0 +1,379 @@
+//=============================================================================
+// File:		World.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	World
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstring>
+#include <stdexcept>
+
+// Daniel Schenker
+#include "World.h"
+#include "../DSMemory/MemoryManager.h"
+#include "../DSSystem/Platform.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	DSContainers::SlotMapHandle ToHandle(DSEntity::Entity entity)
+	{
+		return DSContainers::SlotMapHandle(entity.GetIndex(), entity.GetGeneration());
+	}
+
+	DSEntity::Entity ToEntity(DSContainers::SlotMapHandle handle)
+	{
+		return DSEntity::Entity(handle.GetIndex(), handle.GetGeneration());
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSEntity::World::World()
+:	mChunkPool(DSEntity::Archetype::kChunkSize, kChunksPerPage, DS_CACHE_LINE_SIZE, DSMemory::MemoryManager::GetHeap(), DSMemory::kMemoryTagEntities)
+,	mLockCount(0)
+{
+	static_assert(DSEntity::Entity::kIndexBits == DSContainers::SlotMapHandle::kIndexBits, "Entity handles must have the same layout as SlotMapHandle.");
+	static_assert(DSEntity::Entity::kPendingGeneration == DSContainers::SlotMapHandle::kMaxGeneration, "SlotMap must never hand out CommandBuffer's placeholder generation.");
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSEntity::World::~World()
+{
+	std::vector<DSEntity::Query*>::iterator query;
+	for(query = mQueries.begin(); query != mQueries.end(); ++query)
+	{
+		delete *query;
+	}
+	mQueries.clear();
+
+	//Destroys every remaining entity's components
+	std::map<DSEntity::ComponentMask, DSEntity::Archetype*>::iterator archetype;
+	for(archetype = mArchetypes.begin(); archetype != mArchetypes.end(); ++archetype)
+	{
+		delete archetype->second;
+	}
+	mArchetypes.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  Entities
+
+/*
+Description:
+	Creates an entity without any components.
+*/
+DSEntity::Entity DSEntity::World::CreateEntity()
+{
+	CheckIsUnlocked();
+
+	EntityRecord record;
+	record.mpArchetype = GetArchetype(0);
+	record.mRow = 0;
+	DSEntity::Entity entity = ToEntity(mEntities.Insert(record));
+	mEntities.Get(ToHandle(entity))->mRow = record.mpArchetype->AddRow(entity);
+
+	return entity;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Destroys the entity's components and frees its handle. Any other copies of the handle stop being alive.
+*/
+void DSEntity::World::DestroyEntity(DSEntity::Entity entity)
+{
+	CheckIsUnlocked();
+	CheckIsAlive(entity);
+
+	const EntityRecord& record = *mEntities.Get(ToHandle(entity));
+	RemoveRow(record.mpArchetype, record.mRow);
+	mEntities.Remove(ToHandle(entity));
+}
+
+//-----------------------------------------------------------------------------
+//  Components
+
+/*
+Description:
+	Copies pComponent into the entity, moving the entity to the archetype with the component added.
+	If the entity already has the component, its value is replaced instead, which is not a structural change.
+Variables:
+	pComponent = an object of the registered type with id componentId. Ignored for tags.
+*/
+void DSEntity::World::AddComponent(DSEntity::Entity entity, unsigned int componentId, const void* pComponent)
+{
+	CheckIsAlive(entity);
+
+	const EntityRecord& record = *mEntities.Get(ToHandle(entity));
+	DSEntity::ComponentMask bit = 1ull << componentId;
+	if((record.mpArchetype->GetMask() & bit) != 0)
+	{
+		const DSEntity::ComponentInfo& info = DSEntity::ComponentRegistry::GetInfo(componentId);
+		if(info.mSize > 0)
+		{
+			void* pDestination = record.mpArchetype->GetComponent(record.mRow, componentId);
+			if(info.mIsTriviallyCopyable == true)
+			{
+				memcpy(pDestination, pComponent, info.mSize);
+			}
+			else
+			{
+				info.mpDestruct(pDestination);
+				info.mpCopyConstruct(pDestination, pComponent);
+			}
+		}
+		return;
+	}
+
+	CheckIsUnlocked();
+	MoveEntity(entity, GetArchetype(record.mpArchetype->GetMask() | bit), componentId, pComponent);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Destroys the component and moves the entity to the archetype without it. Does nothing if the entity does not have it.
+*/
+void DSEntity::World::RemoveComponent(DSEntity::Entity entity, unsigned int componentId)
+{
+	CheckIsAlive(entity);
+
+	const EntityRecord& record = *mEntities.Get(ToHandle(entity));
+	DSEntity::ComponentMask bit = 1ull << componentId;
+	if((record.mpArchetype->GetMask() & bit) == 0)
+	{
+		return;
+	}
+
+	CheckIsUnlocked();
+	MoveEntity(entity, GetArchetype(record.mpArchetype->GetMask() & ~bit), DSEntity::ComponentRegistry::kInvalidComponent, nullptr);
+}
+
+//-----------------------------------------------------------------------------
+//  Queries
+
+/*
+Description:
+	Creates a query over every entity that has all of the components in all and none of the components in none.
+Notes:
+	The world owns the query, and keeps it up to date as archetypes are created. Create queries once (at load) and keep them.
+*/
+DSEntity::Query* DSEntity::World::CreateQuery(DSEntity::ComponentMask all, DSEntity::ComponentMask none)
+{
+	DSEntity::Query* pQuery = new DSEntity::Query(this, all, none);
+
+	std::map<DSEntity::ComponentMask, DSEntity::Archetype*>::const_iterator it;
+	for(it = mArchetypes.begin(); it != mArchetypes.end(); ++it)
+	{
+		if(pQuery->GetIsMatch(it->first) == true)
+		{
+			pQuery->AddArchetype(it->second);
+		}
+	}
+
+	mQueries.push_back(pQuery);
+	return pQuery;
+}
+
+//-----------------------------------------------------------------------------
+//  Iteration Lock
+
+/*
+Description:
+	While locked, structural changes throw. Queries lock the world while iterating, and so does SystemScheduler while its systems run.
+	Locks nest and may be taken from several threads at once.
+*/
+void DSEntity::World::Lock()
+{
+	++mLockCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSEntity::World::Unlock()
+{
+	--mLockCount;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helper Functions
+
+/*
+Description:
+	Finds the archetype for mask, creating it (and adding it to every query it matches) if this is the first entity with exactly these components.
+*/
+DSEntity::Archetype* DSEntity::World::GetArchetype(DSEntity::ComponentMask mask)
+{
+	std::map<DSEntity::ComponentMask, DSEntity::Archetype*>::const_iterator it = mArchetypes.find(mask);
+	if(it != mArchetypes.end())
+	{
+		return it->second;
+	}
+
+	DSEntity::Archetype* pArchetype = new DSEntity::Archetype(mask, mChunkPool);
+	mArchetypes[mask] = pArchetype;
+
+	std::vector<DSEntity::Query*>::iterator query;
+	for(query = mQueries.begin(); query != mQueries.end(); ++query)
+	{
+		if((*query)->GetIsMatch(mask) == true)
+		{
+			(*query)->AddArchetype(pArchetype);
+		}
+	}
+
+	return pArchetype;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Moves entity into pDestination, copying every component the two archetypes share, and copying pNewComponent in as component newComponentId.
+	Components the destination lacks are destroyed with the old row.
+*/
+void DSEntity::World::MoveEntity(DSEntity::Entity entity, DSEntity::Archetype* pDestination, unsigned int newComponentId, const void* pNewComponent)
+{
+	EntityRecord& record = *mEntities.Get(ToHandle(entity));
+	DSEntity::Archetype* pSource = record.mpArchetype;
+	unsigned int sourceRow = record.mRow;
+	unsigned int destinationRow = pDestination->AddRow(entity);
+
+	const std::vector<unsigned int>& componentIds = pDestination->GetComponentIds();
+	std::vector<unsigned int>::const_iterator it;
+	for(it = componentIds.begin(); it != componentIds.end(); ++it)
+	{
+		const DSEntity::ComponentInfo& info = DSEntity::ComponentRegistry::GetInfo(*it);
+		void* pTo = pDestination->GetComponent(destinationRow, *it);
+		const void* pFrom = (*it == newComponentId) ? pNewComponent : pSource->GetComponent(sourceRow, *it);
+		if(info.mIsTriviallyCopyable == true)
+		{
+			memcpy(pTo, pFrom, info.mSize);
+		}
+		else
+		{
+			info.mpCopyConstruct(pTo, pFrom);
+		}
+	}
+
+	RemoveRow(pSource, sourceRow);
+	record.mpArchetype = pDestination;
+	record.mRow = destinationRow;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Removes a row, pointing the entity that the archetype moved into the hole at its new row.
+*/
+void DSEntity::World::RemoveRow(DSEntity::Archetype* pArchetype, unsigned int row)
+{
+	DSEntity::Entity moved = pArchetype->RemoveRow(row);
+	if(moved.GetIsNull() == false)
+	{
+		mEntities.Get(ToHandle(moved))->mRow = row;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void DSEntity::World::CheckIsAlive(DSEntity::Entity entity) const
+{
+	if(GetIsAlive(entity) == false)
+	{
+		throw std::runtime_error("ERROR: The entity has been destroyed, or the handle is null.");
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void DSEntity::World::CheckIsUnlocked() const
+{
+	if(mLockCount.load() != 0)
+	{
+		throw std::runtime_error("ERROR: Structural change while the world is being iterated. Record it in a DSEntity::CommandBuffer instead.");
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	False for null handles, and for handles to destroyed entities even once their record has been reused.
+*/
+bool DSEntity::World::GetIsAlive(DSEntity::Entity entity) const
+{
+	return mEntities.GetIsValid(ToHandle(entity));
+}
+
+//-----------------------------------------------------------------------------
+
+DSEntity::ComponentMask DSEntity::World::GetMask(DSEntity::Entity entity) const
+{
+	if(GetIsAlive(entity) == false)
+	{
+		return 0;
+	}
+
+	return mEntities.Get(ToHandle(entity))->mpArchetype->GetMask();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	nullptr if the entity is not alive, does not have the component, or the component is a tag.
+	The pointer is only valid until the next structural change, which may move the entity.
+*/
+void* DSEntity::World::GetComponent(DSEntity::Entity entity, unsigned int componentId) const
+{
+	if(GetIsAlive(entity) == false)
+	{
+		return nullptr;
+	}
+
+	const EntityRecord& record = *mEntities.Get(ToHandle(entity));
+	return record.mpArchetype->GetComponent(record.mRow, componentId);
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSEntity::World::GetEntityCount() const
+{
+	return mEntities.GetCount();
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSEntity::World::GetArchetypeCount() const
+{
+	return static_cast<unsigned int>(mArchetypes.size());
+}
\ No newline at end of file
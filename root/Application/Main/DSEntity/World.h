@@ -0,0 +1,145 @@
+//=============================================================================
+// File:		World.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	World. Owns every entity, the archetypes storing their components, and the queries over them.
+//=============================================================================
+
+#ifndef WORLD_H
+#define WORLD_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <atomic>
+#include <map>
+#include <vector>
+
+// Daniel Schenker
+#include "../DSContainers/SlotMap.h"
+#include "../DSMemory/PoolAllocator.h"
+#include "Archetype.h"
+#include "Component.h"
+#include "Entity.h"
+#include "Query.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSEntity
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		An entity is nothing but a handle. Its components live in the archetype for its exact set of components,
+		so adding or removing a component moves the entity (copying its other components) to another archetype.
+		That makes structural changes relatively expensive, and iterating everything with some set of components a linear scan over packed arrays.
+	Usage:
+		DSEntity::Entity ship = world.CreateEntity();
+		world.AddComponent(ship, DSGraphics::ModelInstance(model, pCamera));
+		world.AddComponent(ship, PlayerTag());
+		DSEntity::Query* pShips = world.CreateQuery(DSEntity::ComponentRegistry::GetMask<PlayerTag>());
+	Notes:
+		Not thread safe for structural changes: create and destroy entities and add and remove components from one thread,
+		and never while a query is iterating (that throws). Reading and writing component values from several threads is fine as long as they don't share entities.
+	*/
+	class World
+	{
+	public:
+		//Constructors
+		World();
+		//Destructor
+		~World();
+
+	private:
+		//Disable Copy Constructor
+		World(const World&);
+		const World& operator=(const World&);
+
+		//Member Functions
+	public:
+		// Entities
+		DSEntity::Entity CreateEntity();
+		void DestroyEntity(DSEntity::Entity entity);
+
+		// Components
+		void AddComponent(DSEntity::Entity entity, unsigned int componentId, const void* pComponent);
+		void RemoveComponent(DSEntity::Entity entity, unsigned int componentId);
+
+		template<typename T>
+		void AddComponent(DSEntity::Entity entity, const T& component)
+		{
+			AddComponent(entity, DSEntity::ComponentRegistry::GetId<T>(), &component);
+		}
+
+		template<typename T>
+		void RemoveComponent(DSEntity::Entity entity)
+		{
+			RemoveComponent(entity, DSEntity::ComponentRegistry::GetId<T>());
+		}
+
+		// Queries
+		DSEntity::Query* CreateQuery(DSEntity::ComponentMask all, DSEntity::ComponentMask none = 0);
+
+		// Iteration Lock
+		void Lock();
+		void Unlock();
+
+	private:
+		// Helper Functions
+		DSEntity::Archetype* GetArchetype(DSEntity::ComponentMask mask);
+		void MoveEntity(DSEntity::Entity entity, DSEntity::Archetype* pDestination, unsigned int newComponentId, const void* pNewComponent);
+		void RemoveRow(DSEntity::Archetype* pArchetype, unsigned int row);
+		void CheckIsAlive(DSEntity::Entity entity) const;
+		void CheckIsUnlocked() const;
+
+	public:
+		// Getters
+		bool GetIsAlive(DSEntity::Entity entity) const;
+		DSEntity::ComponentMask GetMask(DSEntity::Entity entity) const;
+		void* GetComponent(DSEntity::Entity entity, unsigned int componentId) const;
+		unsigned int GetEntityCount() const;
+		unsigned int GetArchetypeCount() const;
+
+		template<typename T>
+		T* GetComponent(DSEntity::Entity entity) const
+		{
+			return static_cast<T*>(GetComponent(entity, DSEntity::ComponentRegistry::GetId<T>()));
+		}
+
+		template<typename T>
+		bool GetHasComponent(DSEntity::Entity entity) const
+		{
+			return (GetMask(entity) & DSEntity::ComponentRegistry::GetMask<T>()) != 0;
+		}
+
+		//Member Variables
+	private:
+		struct EntityRecord
+		{
+			DSEntity::Archetype* mpArchetype;
+			unsigned int mRow;
+		};
+
+		static const unsigned int kChunksPerPage = 16;
+
+		DSMemory::PoolAllocator mChunkPool;//every archetype's chunks; declared before the archetypes so it outlives them
+		DSContainers::SlotMap<EntityRecord> mEntities;//an entity's handle is its record's slot map handle
+
+		std::map<DSEntity::ComponentMask, DSEntity::Archetype*> mArchetypes;
+		std::vector<DSEntity::Query*> mQueries;
+
+		std::atomic<int> mLockCount;//number of iterations in progress, on any thread
+	};
+
+}//namespace DSEntity
+
+#endif //#ifndef WORLD_H
\ No newline at end of file
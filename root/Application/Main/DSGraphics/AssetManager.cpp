@@ -0,0 +1,563 @@
+//=============================================================================
+// File:		AssetManager.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	AssetManager
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <stdio.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Daniel Schenker
+#include "AssetManager.h"
+#include "MeshFile.h"
+#include "ModelAsset.h"
+#include "Program.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "../DSSystem/PackFile.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	struct Slot
+	{
+		//Read without the lock by Find
+		std::atomic<void*> mpAsset;//nullptr while the slot is free
+		std::atomic<unsigned int> mGeneration;//of the asset in the slot, or of the next one if it is free
+		std::atomic<int> mReferences;
+		DSGraphics::AssetType mType;
+
+		//Only touched with sMutex held
+		uint64_t mKey;
+		std::string mName;
+		unsigned int mUnreferencedFrames;
+		DSContainers::SlotMapHandle mProgram;//models only
+		DSContainers::SlotMapHandle mTexture;//models only, and only if they have one
+	};
+
+	const char* const kTypeNames[DSGraphics::kAssetTypeCount] =
+	{
+		"Texture",
+		"Program",
+		"Model"
+	};
+
+	Slot* spSlots = nullptr;
+	std::deque<unsigned int> sFreeSlots;//first in first out, so a slot's generation wraps as late as possible
+	std::unordered_map<uint64_t, unsigned int> sIndices;//key to slot
+	std::mutex sMutex;
+
+	uint64_t Combine(uint64_t key, uint64_t value)
+	{
+		return (key ^ value) * 1099511628211ull;//FNV-1a prime
+	}
+
+	uint64_t MakeTextureKey(const char* pImageFile, const DSGraphics::TextureOptions& options)
+	{
+		uint64_t key = Combine(Combine(Combine(Combine(DSSystem::PackFile::Hash(pImageFile), DSGraphics::kAssetTexture), static_cast<uint64_t>(options.mFilter)), static_cast<uint64_t>(options.mWrapMode)), options.mPremultiplyAlpha == true ? 1 : 0);
+		return Combine(Combine(key, options.mHasMipmaps == true ? 1 : 0), options.mIsCompressed == true ? 1 : 0);
+	}
+
+	void DeleteAsset(DSGraphics::AssetType type, void* pAsset)
+	{
+		switch(type)
+		{
+		case DSGraphics::kAssetTexture:
+			delete static_cast<DSGraphics::Texture*>(pAsset);
+			break;
+		case DSGraphics::kAssetProgram:
+			delete static_cast<DSGraphics::Program*>(pAsset);
+			break;
+		case DSGraphics::kAssetModel:
+			delete static_cast<DSGraphics::ModelAsset*>(pAsset);
+			break;
+		default:
+			break;
+		}
+	}
+
+	//Returns nullptr unless the handle still refers to the asset it was created for
+	Slot* GetSlot(DSContainers::SlotMapHandle handle, DSGraphics::AssetType type)
+	{
+		const unsigned int kMaxAssets = DSGraphics::AssetManager::kMaxAssets;
+		if(spSlots == nullptr || handle.GetIsNull() == true || handle.GetIndex() >= kMaxAssets)
+		{
+			return nullptr;
+		}
+
+		Slot& slot = spSlots[handle.GetIndex()];
+		if(slot.mpAsset.load(std::memory_order_acquire) == nullptr || slot.mGeneration.load(std::memory_order_acquire) != handle.GetGeneration() || slot.mType != type)
+		{
+			return nullptr;
+		}
+
+		return &slot;
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+void DSGraphics::AssetManager::Initialize()
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+
+	if(spSlots != nullptr)
+	{
+		fprintf(stderr, "WARNING: AssetManager is already initialized.\n");
+		return;
+	}
+
+	spSlots = new Slot[kMaxAssets];
+	for(unsigned int i = 0; i < kMaxAssets; ++i)
+	{
+		spSlots[i].mpAsset.store(nullptr, std::memory_order_relaxed);
+		spSlots[i].mGeneration.store(0, std::memory_order_relaxed);
+		spSlots[i].mReferences.store(0, std::memory_order_relaxed);
+		spSlots[i].mType = DSGraphics::kAssetTypeCount;
+		spSlots[i].mKey = 0;
+		spSlots[i].mUnreferencedFrames = 0;
+		sFreeSlots.push_back(i);
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Unloads everything, models first so that the programs and textures they use are still alive while they go.
+	Anything still referenced is reported, since whoever holds it is about to be left with a handle that resolves to nullptr.
+*/
+void DSGraphics::AssetManager::Terminate()
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+
+	if(spSlots == nullptr)
+	{
+		return;
+	}
+
+	//Models, then everything else
+	for(unsigned int pass = 0; pass < 2; ++pass)
+	{
+		for(unsigned int i = 0; i < kMaxAssets; ++i)
+		{
+			Slot& slot = spSlots[i];
+			if(slot.mpAsset.load(std::memory_order_relaxed) == nullptr || (pass == 0) != (slot.mType == DSGraphics::kAssetModel))
+			{
+				continue;
+			}
+
+			int references = slot.mReferences.load(std::memory_order_relaxed);
+			if(references != 0)
+			{
+				fprintf(stderr, "WARNING: %s \"%s\" still has %d references at AssetManager::Terminate.\n", kTypeNames[slot.mType], slot.mName.c_str(), references);
+			}
+			Unload(i);
+		}
+	}
+
+	delete[] spSlots;
+	spSlots = nullptr;
+	sFreeSlots.clear();
+	sIndices.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Unloads up to kMaxUnloadsPerFrame assets that have gone unreferenced for kUnloadDelayFrames calls. Call once per frame, after rendering.
+Notes:
+	Unloading a model releases its program and texture, which then wait out their own delay.
+*/
+void DSGraphics::AssetManager::CollectGarbage()
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+
+	if(spSlots == nullptr)
+	{
+		return;
+	}
+
+	unsigned int unloads[kMaxUnloadsPerFrame];
+	unsigned int unloadCount = 0;
+	std::unordered_map<uint64_t, unsigned int>::const_iterator it;
+	for(it = sIndices.begin(); it != sIndices.end(); ++it)
+	{
+		Slot& slot = spSlots[it->second];
+		if(slot.mReferences.load(std::memory_order_acquire) > 0)
+		{
+			slot.mUnreferencedFrames = 0;
+			continue;
+		}
+
+		++slot.mUnreferencedFrames;
+		if(slot.mUnreferencedFrames >= kUnloadDelayFrames && unloadCount < kMaxUnloadsPerFrame)
+		{
+			unloads[unloadCount++] = it->second;
+		}
+	}
+
+	for(unsigned int i = 0; i < unloadCount; ++i)
+	{
+		Unload(unloads[i]);
+	}
+}
+
+//-----------------------------------------------------------------------------
+//  Loading
+
+/*
+Description:
+	Loads the PNG as a texture, or adds a reference to it if it is already loaded with the same filtering and alpha.
+	Returns a null handle, with a warning, if the image could not be loaded.
+*/
+DSGraphics::TextureHandle DSGraphics::AssetManager::LoadTexture(const char* pImageFile, const DSGraphics::TextureOptions& options)
+{
+	uint64_t key = MakeTextureKey(pImageFile, options);
+	DSContainers::SlotMapHandle handle = Acquire(key, DSGraphics::kAssetTexture);
+	if(handle.GetIsNull() == false)
+	{
+		return DSGraphics::TextureHandle(handle);
+	}
+
+	return PublishTexture(key, new DSGraphics::Texture(pImageFile, options), pImageFile);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Uploads a texture prepared by DSGraphics::Texture::Prepare (on any thread), or adds a reference to it if it is already loaded with the same options.
+	Returns a null handle, with a warning, if the image could not be prepared.
+*/
+DSGraphics::TextureHandle DSGraphics::AssetManager::LoadTexture(const DSGraphics::PreparedTexture& prepared)
+{
+	uint64_t key = MakeTextureKey(prepared.GetImageFile().c_str(), prepared.GetOptions());
+	DSContainers::SlotMapHandle handle = Acquire(key, DSGraphics::kAssetTexture);
+	if(handle.GetIsNull() == false)
+	{
+		return DSGraphics::TextureHandle(handle);
+	}
+
+	return PublishTexture(key, new DSGraphics::Texture(prepared), prepared.GetImageFile().c_str());
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Compiles and links the two shaders, or adds a reference to the program if that pair is already loaded.
+*/
+DSGraphics::ProgramHandle DSGraphics::AssetManager::LoadProgram(const char* pVertexShaderFile, const char* pFragmentShaderFile)
+{
+	uint64_t key = Combine(Combine(DSSystem::PackFile::Hash(pVertexShaderFile), DSGraphics::kAssetProgram), DSSystem::PackFile::Hash(pFragmentShaderFile));
+	DSContainers::SlotMapHandle handle = Acquire(key, DSGraphics::kAssetProgram);
+	if(handle.GetIsNull() == false)
+	{
+		return DSGraphics::ProgramHandle(handle);
+	}
+
+	std::vector<DSGraphics::Shader> shaders;
+	shaders.push_back(DSGraphics::Shader::CreateShaderFromFile(pVertexShaderFile, GL_VERTEX_SHADER));
+	shaders.push_back(DSGraphics::Shader::CreateShaderFromFile(pFragmentShaderFile, GL_FRAGMENT_SHADER));
+	DSGraphics::Program* pProgram = new DSGraphics::Program(shaders);
+
+	std::string name = std::string(pVertexShaderFile) + " + " + pFragmentShaderFile;
+	return DSGraphics::ProgramHandle(Publish(key, DSGraphics::kAssetProgram, pProgram, name.c_str(), DSContainers::SlotMapHandle(), DSContainers::SlotMapHandle()));
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Uploads the .dsmesh drawn with program and texture (which may be null), or adds a reference to the model if that combination is already loaded.
+	Returns a null handle, with a warning, if the mesh could not be loaded or program is not loaded.
+Variables:
+	pName = what GpuMemory accounts the model's buffers to.
+	pMesh = pMeshFile, if it has already been read (eg. on a worker thread while the context thread did something else). Read here otherwise.
+*/
+DSGraphics::ModelHandle DSGraphics::AssetManager::LoadModel(const char* pMeshFile, DSGraphics::ProgramHandle program, DSGraphics::TextureHandle texture, const char* pName, const DSGraphics::MeshFile* pMesh)
+{
+	DSGraphics::Program* pProgram = Get(program);
+	DSGraphics::Texture* pTexture = Get(texture);
+	if(pProgram == nullptr || (texture.GetIsNull() == false && pTexture == nullptr))
+	{
+		fprintf(stderr, "WARNING: AssetManager can not load the model %s, as its program or texture is not loaded.\n", pName);
+		return DSGraphics::ModelHandle();
+	}
+
+	uint64_t key = Combine(Combine(Combine(DSSystem::PackFile::Hash(pMeshFile), DSGraphics::kAssetModel), program.mHandle.mId), texture.mHandle.mId);
+	DSContainers::SlotMapHandle handle = Acquire(key, DSGraphics::kAssetModel);
+	if(handle.GetIsNull() == false)
+	{
+		return DSGraphics::ModelHandle(handle);
+	}
+
+	if(pMesh != nullptr)
+	{
+		return PublishModel(key, *pMesh, program, texture, pMeshFile, pName);
+	}
+
+	//Note: Mapped rather than read, and uploaded straight from the mapping; nothing is kept once the mesh file goes out of scope.
+	DSGraphics::MeshFile mesh(pMeshFile);
+	return PublishModel(key, mesh, program, texture, pMeshFile, pName);
+}
+
+//-----------------------------------------------------------------------------
+//  Reports
+
+void DSGraphics::AssetManager::PrintSummary()
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+
+	printf("Assets (%u loaded):\n", static_cast<unsigned int>(sIndices.size()));
+	std::unordered_map<uint64_t, unsigned int>::const_iterator it;
+	for(it = sIndices.begin(); it != sIndices.end(); ++it)
+	{
+		const Slot& slot = spSlots[it->second];
+		printf("  %-8s %4d refs  %s\n", kTypeNames[slot.mType], slot.mReferences.load(std::memory_order_relaxed), slot.mName.c_str());
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helpers
+
+/*
+Description:
+	The lock free lookup behind Get.
+*/
+void* DSGraphics::AssetManager::Find(DSContainers::SlotMapHandle handle, DSGraphics::AssetType type)
+{
+	Slot* pSlot = GetSlot(handle, type);
+	return pSlot != nullptr ? pSlot->mpAsset.load(std::memory_order_acquire) : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Only for handles the caller already holds a reference through, so the asset can not be unloaded underneath it.
+*/
+void DSGraphics::AssetManager::AddReference(DSContainers::SlotMapHandle handle, DSGraphics::AssetType type)
+{
+	Slot* pSlot = GetSlot(handle, type);
+	if(pSlot == nullptr)
+	{
+		fprintf(stderr, "WARNING: AssetManager::AddReference was given a handle to an asset that is not loaded.\n");
+		return;
+	}
+
+	pSlot->mReferences.fetch_add(1, std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+
+void DSGraphics::AssetManager::Release(DSContainers::SlotMapHandle handle, DSGraphics::AssetType type)
+{
+	if(handle.GetIsNull() == true || spSlots == nullptr)
+	{
+		return;
+	}
+
+	Slot* pSlot = GetSlot(handle, type);
+	if(pSlot == nullptr)
+	{
+		fprintf(stderr, "WARNING: AssetManager::Release was given a handle to an asset that is not loaded.\n");
+		return;
+	}
+
+	if(pSlot->mReferences.fetch_sub(1, std::memory_order_release) <= 0)
+	{
+		pSlot->mReferences.fetch_add(1, std::memory_order_relaxed);
+		fprintf(stderr, "WARNING: %s \"%s\" was released more times than it was referenced.\n", kTypeNames[type], pSlot->mName.c_str());
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Adds a reference to the asset with key, if it is loaded, and returns its handle. Otherwise returns a null handle.
+Notes:
+	An asset waiting to be unloaded is simply referenced again.
+*/
+DSContainers::SlotMapHandle DSGraphics::AssetManager::Acquire(uint64_t key, DSGraphics::AssetType type)
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+
+	if(spSlots == nullptr)
+	{
+		throw std::runtime_error("ERROR: AssetManager is used before AssetManager::Initialize.");
+	}
+
+	std::unordered_map<uint64_t, unsigned int>::const_iterator it = sIndices.find(key);
+	if(it == sIndices.end() || spSlots[it->second].mType != type)
+	{
+		return DSContainers::SlotMapHandle();
+	}
+
+	Slot& slot = spSlots[it->second];
+	slot.mReferences.fetch_add(1, std::memory_order_relaxed);
+	slot.mUnreferencedFrames = 0;
+	return DSContainers::SlotMapHandle(it->second, slot.mGeneration.load(std::memory_order_relaxed));
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Puts a newly loaded asset in a free slot with one reference, and returns its handle.
+	If the same key was published in the meantime, the new asset is deleted and the existing one is referenced instead.
+Variables:
+	program, texture = the references a model holds, given up when it is unloaded. Null for other types.
+*/
+DSContainers::SlotMapHandle DSGraphics::AssetManager::Publish(uint64_t key, DSGraphics::AssetType type, void* pAsset, const char* pName, DSContainers::SlotMapHandle program, DSContainers::SlotMapHandle texture)
+{
+	std::unique_lock<std::mutex> lock(sMutex);
+
+	std::unordered_map<uint64_t, unsigned int>::const_iterator it = sIndices.find(key);
+	if(it != sIndices.end())
+	{
+		Slot& slot = spSlots[it->second];
+		slot.mReferences.fetch_add(1, std::memory_order_relaxed);
+		slot.mUnreferencedFrames = 0;
+		DSContainers::SlotMapHandle existing(it->second, slot.mGeneration.load(std::memory_order_relaxed));
+		lock.unlock();
+
+		DeleteAsset(type, pAsset);
+		Release(program, DSGraphics::kAssetProgram);
+		Release(texture, DSGraphics::kAssetTexture);
+		return existing;
+	}
+
+	if(sFreeSlots.empty() == true)
+	{
+		throw std::runtime_error("ERROR: AssetManager is full. Raise AssetManager::kMaxAssets.");
+	}
+
+	unsigned int index = sFreeSlots.front();
+	sFreeSlots.pop_front();
+
+	Slot& slot = spSlots[index];
+	slot.mType = type;
+	slot.mKey = key;
+	slot.mName = pName;
+	slot.mUnreferencedFrames = 0;
+	slot.mProgram = program;
+	slot.mTexture = texture;
+	slot.mReferences.store(1, std::memory_order_relaxed);
+	slot.mpAsset.store(pAsset, std::memory_order_release);
+	sIndices[key] = index;
+
+	return DSContainers::SlotMapHandle(index, slot.mGeneration.load(std::memory_order_relaxed));
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Publishes a newly created texture, or deletes it and returns a null handle, with a warning, if it failed to load.
+*/
+DSGraphics::TextureHandle DSGraphics::AssetManager::PublishTexture(uint64_t key, DSGraphics::Texture* pTexture, const char* pImageFile)
+{
+	if(pTexture->GetIsTextureLoaded() == false)
+	{
+		fprintf(stderr, "WARNING: AssetManager could not load the texture %s.\n", pImageFile);
+		delete pTexture;
+		return DSGraphics::TextureHandle();
+	}
+
+	return DSGraphics::TextureHandle(Publish(key, DSGraphics::kAssetTexture, pTexture, pImageFile, DSContainers::SlotMapHandle(), DSContainers::SlotMapHandle()));
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Uploads mesh as a model referencing program and texture, and publishes it. Returns a null handle, with a warning, if the mesh failed to load.
+*/
+DSGraphics::ModelHandle DSGraphics::AssetManager::PublishModel(uint64_t key, const DSGraphics::MeshFile& mesh, DSGraphics::ProgramHandle program, DSGraphics::TextureHandle texture, const char* pMeshFile, const char* pName)
+{
+	if(mesh.GetIsLoaded() == false)
+	{
+		fprintf(stderr, "WARNING: AssetManager could not load the mesh %s for %s.\n", pMeshFile, pName);
+		return DSGraphics::ModelHandle();
+	}
+
+	DSGraphics::Program* pProgram = Get(program);
+	DSGraphics::Texture* pTexture = Get(texture);
+	AddReference(program);
+	if(pTexture != nullptr)
+	{
+		AddReference(texture);
+	}
+
+	DSGraphics::ModelAsset* pModel = new DSGraphics::ModelAsset(pProgram, pTexture, mesh, pName);
+	return DSGraphics::ModelHandle(Publish(key, DSGraphics::kAssetModel, pModel, pName, program.mHandle, pTexture != nullptr ? texture.mHandle : DSContainers::SlotMapHandle()));
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Deletes the asset in the slot and frees the slot. Handles to it stop resolving before the asset is deleted.
+Notes:
+	sMutex must be held.
+*/
+void DSGraphics::AssetManager::Unload(unsigned int index)
+{
+	Slot& slot = spSlots[index];
+	void* pAsset = slot.mpAsset.load(std::memory_order_relaxed);
+
+	unsigned int generation = slot.mGeneration.load(std::memory_order_relaxed) + 1;
+	slot.mGeneration.store(generation < DSContainers::SlotMapHandle::kMaxGeneration ? generation : 0, std::memory_order_release);
+	slot.mpAsset.store(nullptr, std::memory_order_release);
+	sIndices.erase(slot.mKey);
+
+	DeleteAsset(slot.mType, pAsset);
+	Release(slot.mProgram, DSGraphics::kAssetProgram);
+	Release(slot.mTexture, DSGraphics::kAssetTexture);
+
+	slot.mName.clear();
+	slot.mProgram = DSContainers::SlotMapHandle();
+	slot.mTexture = DSContainers::SlotMapHandle();
+	slot.mReferences.store(0, std::memory_order_relaxed);
+	sFreeSlots.push_back(index);
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+unsigned int DSGraphics::AssetManager::GetLoadedCount()
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+
+	return static_cast<unsigned int>(sIndices.size());
+}
\ No newline at end of file
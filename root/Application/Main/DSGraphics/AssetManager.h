@@ -0,0 +1,217 @@
+//=============================================================================
+// File:		AssetManager.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	AssetManager. Loads textures, shader programs and models once per name, hands out typed handles to them, and unloads them when nothing references them anymore.
+//=============================================================================
+
+#ifndef ASSETMANAGER_H
+#define ASSETMANAGER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLEW
+#include <GL/glew.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// Daniel Schenker
+#include "Texture.h"
+#include "../DSContainers/SlotMap.h"
+
+//=============================================================================
+//Forward Declarations
+//=============================================================================
+
+namespace DSGraphics
+{
+	class MeshFile;
+	class ModelAsset;
+	class Program;
+}
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSGraphics
+{
+
+	//=============================================================================
+	//Enums
+	//=============================================================================
+
+	enum AssetType
+	{
+		kAssetTexture,
+		kAssetProgram,
+		kAssetModel,
+		kAssetTypeCount
+	};
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	template<typename T>
+	struct AssetTraits;
+
+	template<>
+	struct AssetTraits<DSGraphics::Texture>
+	{
+		static const DSGraphics::AssetType kType = DSGraphics::kAssetTexture;
+	};
+
+	template<>
+	struct AssetTraits<DSGraphics::Program>
+	{
+		static const DSGraphics::AssetType kType = DSGraphics::kAssetProgram;
+	};
+
+	template<>
+	struct AssetTraits<DSGraphics::ModelAsset>
+	{
+		static const DSGraphics::AssetType kType = DSGraphics::kAssetModel;
+	};
+
+	/*
+	Notes:
+		A slot index and generation (see DSContainers::SlotMapHandle), typed so that a texture handle can not be passed where a model is expected.
+		Copying a handle does not add a reference; only AssetManager::Load* and AddReference do, and each needs a matching Release.
+	*/
+	template<typename T>
+	struct AssetHandle
+	{
+		AssetHandle()
+		{
+		}
+
+		explicit AssetHandle(DSContainers::SlotMapHandle handle)
+		:	mHandle(handle)
+		{
+		}
+
+		bool GetIsNull() const
+		{
+			return mHandle.GetIsNull();
+		}
+
+		bool operator==(const AssetHandle& other) const
+		{
+			return mHandle == other.mHandle;
+		}
+
+		bool operator!=(const AssetHandle& other) const
+		{
+			return mHandle != other.mHandle;
+		}
+
+		DSContainers::SlotMapHandle mHandle;
+	};
+
+	typedef DSGraphics::AssetHandle<DSGraphics::Texture> TextureHandle;
+	typedef DSGraphics::AssetHandle<DSGraphics::Program> ProgramHandle;
+	typedef DSGraphics::AssetHandle<DSGraphics::ModelAsset> ModelHandle;
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Every asset is keyed by the hash of the name it was loaded from (DSSystem::PackFile::Hash, so case and slashes don't matter),
+		plus whatever else changes the result (a texture's options, a model's program and texture).
+		Loading something already loaded returns the same handle and only adds a reference, so the same PNG is never uploaded twice.
+		Assets live in a fixed table of slots, so Get is a couple of atomic loads with no lock, and a handle to an asset that has been unloaded resolves to nullptr instead of freed memory.
+		An asset whose references drop to 0 is unloaded by CollectGarbage kUnloadDelayFrames frames later, at most kMaxUnloadsPerFrame at a time,
+		which lets a level release and reload the same assets without churning the GPU, and spreads a large unload over several frames.
+	Usage:
+		DSGraphics::AssetManager::Initialize();
+		DSGraphics::ProgramHandle program = DSGraphics::AssetManager::LoadProgram("Shaders/ColorOnly.VertexShader", "Shaders/ColorOnly.FragmentShader");
+		DSGraphics::ModelHandle model = DSGraphics::AssetManager::LoadModel("../../Resources/Meshes/Wall.dsmesh", program, DSGraphics::TextureHandle(), "Wall");
+		...
+		const DSGraphics::ModelAsset* pModel = DSGraphics::AssetManager::Get(model);//nullptr once the model has been unloaded
+		...
+		DSGraphics::AssetManager::Release(model);
+		DSGraphics::AssetManager::Release(program);
+		DSGraphics::AssetManager::CollectGarbage();//once per frame
+		...
+		DSGraphics::AssetManager::Terminate();
+	Notes:
+		Load*, CollectGarbage and Terminate create and delete GL objects, so they must be called on the thread that owns the GL context.
+		What doesn't need the context can be done beforehand on any thread: DSGraphics::Texture::Prepare for a texture, reading the DSGraphics::MeshFile for a model.
+		Get, AddReference and Release may be called from any thread. A pointer from Get stays valid until the next CollectGarbage.
+		A model holds a reference to its program and texture for as long as it is loaded.
+	*/
+	class AssetManager
+	{
+	private:
+		//Constructors
+		AssetManager();
+
+		//Member Functions
+	public:
+		// General
+		static void Initialize();
+		static void Terminate();
+		static void CollectGarbage();
+
+		// Loading
+		static DSGraphics::TextureHandle LoadTexture(const char* pImageFile, const DSGraphics::TextureOptions& options = DSGraphics::TextureOptions());
+		static DSGraphics::TextureHandle LoadTexture(const DSGraphics::PreparedTexture& prepared);
+		static DSGraphics::ProgramHandle LoadProgram(const char* pVertexShaderFile, const char* pFragmentShaderFile);
+		static DSGraphics::ModelHandle LoadModel(const char* pMeshFile, DSGraphics::ProgramHandle program, DSGraphics::TextureHandle texture, const char* pName, const DSGraphics::MeshFile* pMesh = nullptr);
+
+		// References
+		template<typename T>
+		static void AddReference(DSGraphics::AssetHandle<T> handle)
+		{
+			AddReference(handle.mHandle, DSGraphics::AssetTraits<T>::kType);
+		}
+
+		template<typename T>
+		static void Release(DSGraphics::AssetHandle<T>& handle)
+		{
+			Release(handle.mHandle, DSGraphics::AssetTraits<T>::kType);
+			handle = DSGraphics::AssetHandle<T>();
+		}
+
+		// Lookup
+		template<typename T>
+		static T* Get(DSGraphics::AssetHandle<T> handle)
+		{
+			return static_cast<T*>(Find(handle.mHandle, DSGraphics::AssetTraits<T>::kType));
+		}
+
+		// Reports
+		static void PrintSummary();
+
+		// Getters
+		static unsigned int GetLoadedCount();
+
+	private:
+		// Helpers
+		static void* Find(DSContainers::SlotMapHandle handle, DSGraphics::AssetType type);
+		static void AddReference(DSContainers::SlotMapHandle handle, DSGraphics::AssetType type);
+		static void Release(DSContainers::SlotMapHandle handle, DSGraphics::AssetType type);
+		static DSContainers::SlotMapHandle Acquire(uint64_t key, DSGraphics::AssetType type);
+		static DSContainers::SlotMapHandle Publish(uint64_t key, DSGraphics::AssetType type, void* pAsset, const char* pName, DSContainers::SlotMapHandle program, DSContainers::SlotMapHandle texture);
+		static DSGraphics::TextureHandle PublishTexture(uint64_t key, DSGraphics::Texture* pTexture, const char* pImageFile);
+		static DSGraphics::ModelHandle PublishModel(uint64_t key, const DSGraphics::MeshFile& mesh, DSGraphics::ProgramHandle program, DSGraphics::TextureHandle texture, const char* pMeshFile, const char* pName);
+		static void Unload(unsigned int index);
+
+		//Member Variables
+	public:
+		static const unsigned int kMaxAssets = 4096;
+		static const unsigned int kUnloadDelayFrames = 3;
+		static const unsigned int kMaxUnloadsPerFrame = 8;
+	};
+
+}//namespace DSGraphics
+
+#endif //#ifndef ASSETMANAGER_H
\ No newline at end of file
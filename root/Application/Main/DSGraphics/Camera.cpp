@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		Camera.cpp
 // Created:		2015/02/12
-// Last Edited:	2015/04/10
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	Camera
 //=============================================================================
@@ -54,6 +54,14 @@ DSGraphics::Camera::Camera
 ,	mNearPlane(nearPlane)
 ,	mFarPlane(farPlane)
 ,	mViewportAspectRatio(viewportAspectRatio)
+,	mView(1.0f)
+,	mProj(1.0f)
+,	mViewProj(1.0f)
+,	mViewOutdated(true)
+,	mProjOutdated(true)
+,	mViewProjOutdated(true)
+,	mFrustumOutdated(true)
+,	mVersion(0)
 {
 }
 
@@ -87,6 +95,8 @@ void DSGraphics::Camera::SetPosition(glm::vec3 pos, bool moveLocally)
 	{
 		mPosition = pos;
 	}
+
+	InvalidateView();
 }
 
 //-----------------------------------------------------------------------------
@@ -106,6 +116,8 @@ void DSGraphics::Camera::Move(glm::vec3 pos)
 {
 	glm::vec3 relativeDirection = GetOrientation().Rotate(pos);
 	mPosition += relativeDirection;
+
+	InvalidateView();
 }
 
 //-----------------------------------------------------------------------------
@@ -116,18 +128,21 @@ Description:
 	Snaps the camera to the specified orientation. Interpolation implementation is left to the user of this function.
 	Can set the orientation both relative to the current orientation, as well as absolutely to the specified orientation.
 */
-void DSGraphics::Camera::SetOrientation(DSMathematics::Quaternion orientation, bool relative)
+void DSGraphics::Camera::SetOrientation(const DSMathematics::Quaternion& orientation, bool relative)
 {
 	//Relative
 	if(relative == true)
 	{
-		mOrientation = mOrientation.Multiply(orientation);
+		//Renormalized, since thousands of small relative turns would otherwise drift away from unit length and skew the view
+		mOrientation = mOrientation.Multiply(orientation).Normalize();
 	}
 	//Absolute
 	else
 	{
 		mOrientation = orientation;
 	}
+
+	InvalidateView();
 }
 
 //-----------------------------------------------------------------------------
@@ -188,7 +203,7 @@ glm::vec3 DSGraphics::Camera::GetDirectionBackward() const
 //-----------------------------------------------------------------------------
 //  Model View Matrices
 
-glm::mat4 DSGraphics::Camera::GetView() const
+const glm::mat4& DSGraphics::Camera::GetView() const
 {
 	/*
 	The purpose of the view transform is to place the camera at the origin and
@@ -280,28 +295,106 @@ glm::mat4 DSGraphics::Camera::GetView() const
 
 	//I believe it should be done in this order (reverse order), because we are undoing the effects (namely rotation followed by translation) applied to the camera.
 	//Since they were applied rotation first, translation second, we must undo the operations in the correct order (namely translation first, rotation second).
-	return glm::mat4_cast(glm::quat(mOrientation.Invert().mW, mOrientation.Invert().mV.x, mOrientation.Invert().mV.y, mOrientation.Invert().mV.z)) * glm::translate(glm::mat4(), -mPosition);
+	//return glm::mat4_cast(glm::quat(mOrientation.Invert().mW, mOrientation.Invert().mV.x, mOrientation.Invert().mV.y, mOrientation.Invert().mV.z)) * glm::translate(glm::mat4(), -mPosition);
+
+	//Same as the line above (R^t.T^-1), but written out directly: R^t is the rotation of the inverted orientation, and the translation column is R^t * -position.
+	if(mViewOutdated == true)
+	{
+		glm::mat4 inverseRotation = glm::mat4_cast(glm::quat(mOrientation.mW, -mOrientation.mV.x, -mOrientation.mV.y, -mOrientation.mV.z));
+		inverseRotation[3] = glm::vec4(-(glm::mat3(inverseRotation) * mPosition), 1.0f);
+		mView = inverseRotation;
+
+		mViewOutdated = false;
+	}
+
+	return mView;
 }
 
 //-----------------------------------------------------------------------------
 
-glm::mat4 DSGraphics::Camera::GetProj() const
+const glm::mat4& DSGraphics::Camera::GetProj() const
 {
-	return
-		glm::perspective
-		(
-			glm::radians(mFov),		//Vertical Field of View (FoV) in degrees
-			mViewportAspectRatio,	//aspect ratio
-			mNearPlane,				//near plane
-			mFarPlane				//far plane
-		);
+	if(mProjOutdated == true)
+	{
+		mProj =
+			glm::perspective
+			(
+				glm::radians(mFov),		//Vertical Field of View (FoV) in degrees
+				mViewportAspectRatio,	//aspect ratio
+				mNearPlane,				//near plane
+				mFarPlane				//far plane
+			);
+
+		mProjOutdated = false;
+	}
+
+	return mProj;
 }
 
 //-----------------------------------------------------------------------------
 
-glm::mat4 DSGraphics::Camera::GetMatrix() const
+/*
+Notes:
+	Called once per instance per frame, so it only multiplies when the camera actually changed.
+*/
+const glm::mat4& DSGraphics::Camera::GetMatrix() const
 {
-	return GetProj() * GetView();
+	if(mViewProjOutdated == true)
+	{
+		mViewProj = GetProj() * GetView();
+
+		mViewProjOutdated = false;
+	}
+
+	return mViewProj;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Returns the six planes bounding what the camera can see, as (normal, distance) with normals pointing inwards,
+	so that a point p is inside a plane when dot(plane, vec4(p, 1)) >= 0.
+Notes:
+	Extracted from the rows of the view-projection matrix (Gribb and Hartmann), and normalized so distances are in world units.
+*/
+const glm::vec4* DSGraphics::Camera::GetFrustumPlanes() const
+{
+	if(mFrustumOutdated == true)
+	{
+		const glm::mat4& m = GetMatrix();
+		glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+		glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+		glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+		glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+		mFrustumPlanes[0] = row3 + row0;//left
+		mFrustumPlanes[1] = row3 - row0;//right
+		mFrustumPlanes[2] = row3 + row1;//bottom
+		mFrustumPlanes[3] = row3 - row1;//top
+		mFrustumPlanes[4] = row3 + row2;//near
+		mFrustumPlanes[5] = row3 - row2;//far
+		for(unsigned int i = 0; i < 6; ++i)
+		{
+			mFrustumPlanes[i] /= glm::length(glm::vec3(mFrustumPlanes[i]));
+		}
+
+		mFrustumOutdated = false;
+	}
+
+	return mFrustumPlanes;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Changes every time the view or projection changes.
+	Anything derived from the camera (eg. culling results, uniforms already uploaded this frame) can store the version it was built from and skip rebuilding while it still matches.
+*/
+unsigned int DSGraphics::Camera::GetVersion() const
+{
+	return mVersion;
 }
 
 //-----------------------------------------------------------------------------
@@ -340,36 +433,52 @@ float DSGraphics::Camera::GetViewportAspectRatio() const
 
 void DSGraphics::Camera::SetFoV(float fov)
 {
-	mFov = fov;
+	if(mFov != fov)
+	{
+		mFov = fov;
+		InvalidateProj();
+	}
 }
 
 //-----------------------------------------------------------------------------
 
 void DSGraphics::Camera::SetNearPlane(float nearPlane)
 {
-	mNearPlane = nearPlane;
+	if(mNearPlane != nearPlane)
+	{
+		mNearPlane = nearPlane;
+		InvalidateProj();
+	}
 }
 
 //-----------------------------------------------------------------------------
 
 void DSGraphics::Camera::SetFarPlane(float farPlane)
 {
-	mFarPlane = farPlane;
+	if(mFarPlane != farPlane)
+	{
+		mFarPlane = farPlane;
+		InvalidateProj();
+	}
 }
 
 //-----------------------------------------------------------------------------
 
 void DSGraphics::Camera::SetPlanes(float nearPlane, float farPlane)
 {
-	mNearPlane = nearPlane;
-	mFarPlane = farPlane;
+	SetNearPlane(nearPlane);
+	SetFarPlane(farPlane);
 }
 
 //-----------------------------------------------------------------------------
 
 void DSGraphics::Camera::SetViewportAspectRatio(float viewportAspectRatio)
 {
-	mViewportAspectRatio = viewportAspectRatio;
+	if(mViewportAspectRatio != viewportAspectRatio)
+	{
+		mViewportAspectRatio = viewportAspectRatio;
+		InvalidateProj();
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -407,4 +516,27 @@ glm::mat4 DSGraphics::Camera::QuaternionToMatrix() const
 	//return glm::mat4_cast(mOrientation);
 
 	return glm::mat4_cast(glm::quat(mOrientation.mW, mOrientation.mV.x, mOrientation.mV.y, mOrientation.mV.z));
+}
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	The projection doesn't depend on the position or orientation, so it stays cached.
+*/
+void DSGraphics::Camera::InvalidateView()
+{
+	mViewOutdated = true;
+	mViewProjOutdated = true;
+	mFrustumOutdated = true;
+	++mVersion;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSGraphics::Camera::InvalidateProj()
+{
+	mProjOutdated = true;
+	mViewProjOutdated = true;
+	mFrustumOutdated = true;
+	++mVersion;
 }
\ No newline at end of file
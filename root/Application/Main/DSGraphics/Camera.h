@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		Camera.h
 // Created:		2015/02/12
-// Last Edited:	2015/04/10
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	Camera
 //=============================================================================
@@ -62,7 +62,7 @@ namespace DSGraphics
 		// Usage
 		void SetPosition(glm::vec3 pos, bool moveLocally = true);
 		void Move(glm::vec3 pos);
-		void SetOrientation(DSMathematics::Quaternion orientation, bool relative = true);
+		void SetOrientation(const DSMathematics::Quaternion& orientation, bool relative = true);
 	
 		// Getters
 		//  Camera Rigid Body Displacement
@@ -76,9 +76,11 @@ namespace DSGraphics
 		glm::vec3 GetDirectionBackward() const;
 
 		//  Model View Matrices
-		glm::mat4 GetView() const;
-		glm::mat4 GetProj() const;
-		glm::mat4 GetMatrix() const;
+		const glm::mat4& GetView() const;
+		const glm::mat4& GetProj() const;
+		const glm::mat4& GetMatrix() const;
+		const glm::vec4* GetFrustumPlanes() const;
+		unsigned int GetVersion() const;
 
 		//  Camera Settings
 		float GetFoV() const;
@@ -97,6 +99,8 @@ namespace DSGraphics
 	private:
 		// Helper
 		glm::mat4 QuaternionToMatrix() const;
+		void InvalidateView();
+		void InvalidateProj();
 
 
 		//Member Variables
@@ -107,6 +111,19 @@ namespace DSGraphics
 		float mNearPlane;
 		float mFarPlane;
 		float mViewportAspectRatio;
+
+		// Cache
+		//  Rebuilt on first use after whatever they depend on changed. Mutable since building them on demand doesn't change the camera.
+		//  Not thread safe: the camera is only used from the thread that renders.
+		mutable glm::mat4 mView;
+		mutable glm::mat4 mProj;
+		mutable glm::mat4 mViewProj;
+		mutable glm::vec4 mFrustumPlanes[6];//left, right, bottom, top, near, far; normals point inwards
+		mutable bool mViewOutdated;
+		mutable bool mProjOutdated;
+		mutable bool mViewProjOutdated;
+		mutable bool mFrustumOutdated;
+		unsigned int mVersion;//changes whenever any of the cached matrices would
 	};
 
 }//namespace DSGraphics
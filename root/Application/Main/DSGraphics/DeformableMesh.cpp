@@ -0,0 +1,360 @@
+//=============================================================================
+// File:		DeformableMesh.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	DeformableMesh
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstring>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "DeformableMesh.h"
+#include "ModelAsset.h"
+#include "../DSMemory/MemoryManager.h"
+#include "../DSMemory/MemoryTracker.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	const unsigned int kBitsPerWord = 32;
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	master must be loaded, since its vertex count and layout are read here.
+*/
+DSGraphics::DeformableMesh::DeformableMesh(DSGraphics::ModelHandle master)
+:	mMaster(master)
+,	mVertexCount(0)
+,	mFloatsPerVertex(0)
+,	mPositionDimensions(0)
+,	mpVertices(nullptr)
+,	mRegion()
+,	mVao(0)
+,	mIsDirty(false)
+{
+	const DSGraphics::ModelAsset* pMaster = DSGraphics::AssetManager::Get(mMaster);
+	if(pMaster == nullptr)
+	{
+		fprintf(stderr, "WARNING: DeformableMesh was given a model that isn't loaded, so it will never deform.\n");
+		mMaster = DSGraphics::ModelHandle();
+		return;
+	}
+
+	DSGraphics::AssetManager::AddReference(mMaster);
+	mVertexCount = pMaster->GetVertexCount();
+	mFloatsPerVertex = pMaster->GetFloatsPerVertex();
+	mPositionDimensions = pMaster->GetPositionDimensions();
+
+	unsigned int blockCount = (mVertexCount + kVerticesPerBlock - 1) / kVerticesPerBlock;
+	mDirtyBlocks.resize((blockCount + kBitsPerWord - 1) / kBitsPerWord, 0);
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSGraphics::DeformableMesh::~DeformableMesh()
+{
+	Reset();
+	DSGraphics::AssetManager::Release(mMaster);
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	This mesh's vertices, GetFloatsPerVertex floats each, to change in place. Copies the master's first if this mesh hasn't deformed yet.
+	Returns nullptr if the master isn't loaded.
+Notes:
+	Changes aren't uploaded unless MarkDirty is told which vertices changed.
+	Copying the first time uses the GL context.
+*/
+GLfloat* DSGraphics::DeformableMesh::GetWritableVertices()
+{
+	if(mpVertices == nullptr && Copy() == false)
+	{
+		return nullptr;
+	}
+
+	return mpVertices;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Marks count vertices from firstVertex to be uploaded by the next Upload.
+*/
+void DSGraphics::DeformableMesh::MarkDirty(unsigned int firstVertex, unsigned int count)
+{
+	if(mpVertices == nullptr || count == 0 || firstVertex >= mVertexCount)
+	{
+		return;
+	}
+
+	unsigned int lastVertex = firstVertex + count > mVertexCount ? mVertexCount - 1 : firstVertex + count - 1;
+	for(unsigned int block = firstVertex / kVerticesPerBlock; block <= lastVertex / kVerticesPerBlock; ++block)
+	{
+		mDirtyBlocks[block / kBitsPerWord] |= 1u << (block % kBitsPerWord);
+	}
+	mIsDirty = true;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Moves count vertices from firstVertex to pPositions, leaving their texture coordinates and colours alone.
+	Only the vertices that actually move are marked dirty, so a whole mesh's positions can be set every step and only what changed is uploaded.
+Notes:
+	A 2D mesh takes the x and y of each position.
+*/
+void DSGraphics::DeformableMesh::SetPositions(unsigned int firstVertex, unsigned int count, const glm::vec3* pPositions)
+{
+	GLfloat* pVertices = GetWritableVertices();
+	if(pVertices == nullptr || firstVertex >= mVertexCount)
+	{
+		return;
+	}
+	if(firstVertex + count > mVertexCount)
+	{
+		count = mVertexCount - firstVertex;
+	}
+
+	GLfloat* pVertex = pVertices + firstVertex * mFloatsPerVertex;
+	for(unsigned int i = 0; i < count; ++i, pVertex += mFloatsPerVertex)
+	{
+		const glm::vec3& position = pPositions[i];
+		if(pVertex[0] == position.x && pVertex[1] == position.y && (mPositionDimensions < 3 || pVertex[2] == position.z))
+		{
+			continue;
+		}
+
+		pVertex[0] = position.x;
+		pVertex[1] = position.y;
+		if(mPositionDimensions > 2)
+		{
+			pVertex[2] = position.z;
+		}
+
+		unsigned int block = (firstVertex + i) / kVerticesPerBlock;
+		mDirtyBlocks[block / kBitsPerWord] |= 1u << (block % kBitsPerWord);
+		mIsDirty = true;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Uploads the dirty blocks, one VertexStream::Write per run of them. Call once per frame before rendering.
+*/
+void DSGraphics::DeformableMesh::Upload()
+{
+	if(mIsDirty == false)
+	{
+		return;
+	}
+
+	const GLsizeiptr kBytesPerVertex = mFloatsPerVertex * sizeof(GLfloat);
+	unsigned int blockCount = (mVertexCount + kVerticesPerBlock - 1) / kVerticesPerBlock;
+	unsigned int block = 0;
+	while(block < blockCount)
+	{
+		//Skip clean blocks, a whole word at a time where possible
+		uint32_t word = mDirtyBlocks[block / kBitsPerWord];
+		if(word == 0)
+		{
+			block = (block / kBitsPerWord + 1) * kBitsPerWord;
+			continue;
+		}
+		if((word & (1u << (block % kBitsPerWord))) == 0)
+		{
+			++block;
+			continue;
+		}
+
+		//A run of dirty blocks
+		unsigned int firstBlock = block;
+		while(block < blockCount && (mDirtyBlocks[block / kBitsPerWord] & (1u << (block % kBitsPerWord))) != 0)
+		{
+			++block;
+		}
+
+		unsigned int firstVertex = firstBlock * kVerticesPerBlock;
+		unsigned int endVertex = block * kVerticesPerBlock < mVertexCount ? block * kVerticesPerBlock : mVertexCount;
+		DSGraphics::VertexStream::Write(mRegion, firstVertex * kBytesPerVertex, (endVertex - firstVertex) * kBytesPerVertex, mpVertices + firstVertex * mFloatsPerVertex);
+	}
+
+	memset(&mDirtyBlocks[0], 0, mDirtyBlocks.size() * sizeof(mDirtyBlocks[0]));
+	mIsDirty = false;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Throws the deformation away: frees the copy, and goes back to drawing the master's vertices.
+*/
+void DSGraphics::DeformableMesh::Reset()
+{
+	if(mpVertices == nullptr)
+	{
+		return;
+	}
+
+	glDeleteVertexArrays(1, &mVao);
+	mVao = 0;
+	DSGraphics::VertexStream::Free(mRegion);
+	DSMemory::MemoryManager::GetHeap().Free(mpVertices);
+	mpVertices = nullptr;
+
+	if(mDirtyBlocks.empty() == false)
+	{
+		memset(&mDirtyBlocks[0], 0, mDirtyBlocks.size() * sizeof(mDirtyBlocks[0]));
+	}
+	mIsDirty = false;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helpers
+
+/*
+Description:
+	Copies the master's vertices: on the GPU into a VertexStream region, with a VAO that draws them with the master's layout and indices,
+	and on the CPU for deforming. Returns false if the master isn't loaded (anymore) or VertexStream has no room.
+*/
+bool DSGraphics::DeformableMesh::Copy()
+{
+	DSGraphics::ModelAsset* pMaster = DSGraphics::AssetManager::Get(mMaster);
+	if(pMaster == nullptr)
+	{
+		return false;
+	}
+
+	GLsizeiptr bytes = mVertexCount * mFloatsPerVertex * sizeof(GLfloat);
+	if(DSGraphics::VertexStream::Allocate(bytes, mRegion) == false)
+	{
+		return false;
+	}
+	DSGraphics::VertexStream::Copy(pMaster->GetVbo(), 0, mRegion, bytes);
+
+	{
+		DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagMeshes);
+		mpVertices = static_cast<GLfloat*>(DSMemory::MemoryManager::GetHeap().Allocate(bytes));
+	}
+	memcpy(mpVertices, pMaster->GetVertices(), bytes);
+
+	//The VAO records the region as its vertex buffer and the master's EBO as its element buffer
+	glGenVertexArrays(1, &mVao);
+	glBindVertexArray(mVao);
+	glBindBuffer(GL_ARRAY_BUFFER, mRegion.mBuffer);
+	pMaster->DescribeVertexLayout(mRegion.mOffset);
+	if(pMaster->GetHasElements() == true)
+	{
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, pMaster->GetEbo());
+	}
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Whether this mesh has its own vertices (has deformed since it was made or last Reset), and so draws with GetVao rather than the master's.
+*/
+bool DSGraphics::DeformableMesh::GetIsCopied() const
+{
+	return mpVertices != nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	0 until copied.
+*/
+GLuint DSGraphics::DeformableMesh::GetVao() const
+{
+	return mVao;
+}
+
+//-----------------------------------------------------------------------------
+
+DSGraphics::ModelHandle DSGraphics::DeformableMesh::GetMaster() const
+{
+	return mMaster;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSGraphics::DeformableMesh::GetVertexCount() const
+{
+	return mVertexCount;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSGraphics::DeformableMesh::GetFloatsPerVertex() const
+{
+	return mFloatsPerVertex;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	nullptr until copied.
+*/
+const GLfloat* DSGraphics::DeformableMesh::GetVertices() const
+{
+	return mpVertices;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	How many blocks the next Upload will write.
+*/
+unsigned int DSGraphics::DeformableMesh::GetDirtyBlockCount() const
+{
+	unsigned int count = 0;
+	for(size_t i = 0; i < mDirtyBlocks.size(); ++i)
+	{
+		for(uint32_t word = mDirtyBlocks[i]; word != 0; word &= word - 1)
+		{
+			++count;
+		}
+	}
+	return count;
+}
\ No newline at end of file
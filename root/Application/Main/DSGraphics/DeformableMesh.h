@@ -0,0 +1,121 @@
+//=============================================================================
+// File:		DeformableMesh.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	DeformableMesh. One instance's own copy of a model's vertices, made the first time it deforms, and streamed to the GPU a changed block at a time.
+//=============================================================================
+
+#ifndef DEFORMABLEMESH_H
+#define DEFORMABLEMESH_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLEW
+#include <GL/glew.h>
+
+//  GLM
+#include <glm/glm.hpp>
+
+// Standard C++ Libraries
+#include <cstdint>
+#include <vector>
+
+// Daniel Schenker
+#include "AssetManager.h"
+#include "VertexStream.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSGraphics
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Until it deforms, an instance draws its master model's vertices, shared with every other instance of it.
+		The first change copies the master's vertices (copy-on-write): on the GPU into a VertexStream region, and on the CPU into an array to deform.
+		Changes only mark the blocks of kVerticesPerBlock vertices they touch, and Upload writes each run of marked blocks with a single VertexStream::Write,
+		so a dent re-uploads the few blocks around it rather than the whole mesh, and no buffer is ever reallocated.
+	Usage:
+		DSGraphics::DeformableMesh crate(crateModel);
+		pInstance->SetDeformableMesh(&crate);
+		...
+		crate.SetPositions(firstVertex, count, pSimulatedPositions);//or GetWritableVertices, change them, then MarkDirty
+		crate.Upload();//once per frame, before rendering
+		...
+		crate.Reset();//back to drawing the master, and the copy is freed
+	Notes:
+		Not thread safe. Everything must be called on the thread that owns the GL context, except that once copied (GetIsCopied),
+		GetWritableVertices, MarkDirty and SetPositions may be called from another thread between uploads, as long as nothing else touches the mesh meanwhile.
+		Holds a reference to the master, so it stays loaded while any copy of it does.
+		Only the vertices are copied: indices, program and texture are still the master's, as are the bounds used for culling.
+	*/
+	class DeformableMesh
+	{
+	public:
+		//Constructors
+		explicit DeformableMesh(DSGraphics::ModelHandle master);
+		//Destructor
+		~DeformableMesh();
+
+	private:
+		//Disable Copy Constructor
+		DeformableMesh(const DeformableMesh&);
+		const DeformableMesh& operator=(const DeformableMesh&);
+
+		//Member Functions
+	public:
+		// General
+		GLfloat* GetWritableVertices();
+		void MarkDirty(unsigned int firstVertex, unsigned int count);
+		void SetPositions(unsigned int firstVertex, unsigned int count, const glm::vec3* pPositions);
+		void Upload();
+		void Reset();
+
+	private:
+		// Helpers
+		bool Copy();
+
+	public:
+		// Getters
+		bool GetIsCopied() const;
+		GLuint GetVao() const;
+		DSGraphics::ModelHandle GetMaster() const;
+		unsigned int GetVertexCount() const;
+		unsigned int GetFloatsPerVertex() const;
+		const GLfloat* GetVertices() const;
+		unsigned int GetDirtyBlockCount() const;
+
+		//Member Variables
+	public:
+		static const unsigned int kVerticesPerBlock = 32;//the smallest amount uploaded
+
+	private:
+		DSGraphics::ModelHandle mMaster;
+		unsigned int mVertexCount;
+		unsigned int mFloatsPerVertex;
+		unsigned int mPositionDimensions;
+
+		// Copy (once deformed)
+		GLfloat* mpVertices;//nullptr until copied
+		DSGraphics::VertexStreamRegion mRegion;
+		GLuint mVao;
+
+		// Dirty Blocks
+		//  One bit per block of kVerticesPerBlock vertices.
+		std::vector<uint32_t> mDirtyBlocks;
+		bool mIsDirty;
+	};
+
+}//namespace DSGraphics
+
+#endif //#ifndef DEFORMABLEMESH_H
\ No newline at end of file
@@ -0,0 +1,406 @@
+//=============================================================================
+// File:		GpuMemory.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	GpuMemory
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <algorithm>
+#include <map>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+// Daniel Schenker
+#include "GpuMemory.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	//Keys are the object's kind, GL name and (for textures) mip level, so every level of a texture sorts together
+	enum ObjectKind
+	{
+		kObjectBuffer,
+		kObjectTexture,
+		kObjectRenderbuffer
+	};
+
+	unsigned long long MakeKey(ObjectKind kind, GLuint name, GLint level)
+	{
+		return (static_cast<unsigned long long>(kind) << 40) | (static_cast<unsigned long long>(name) << 8) | static_cast<unsigned long long>(level & 0xFF);
+	}
+
+	struct Allocation
+	{
+		size_t mBytes;
+		DSGraphics::GpuMemoryCategory mCategory;
+		std::string mOwner;
+	};
+
+	const char* const kCategoryNames[DSGraphics::kGpuMemoryCategoryCount] =
+	{
+		"Vertex",
+		"Index",
+		"Texture",
+		"Render Target"
+	};
+
+	std::map<unsigned long long, Allocation> sAllocations;
+	size_t sBytes[DSGraphics::kGpuMemoryCategoryCount] = {};
+	size_t sFrameStartBytes[DSGraphics::kGpuMemoryCategoryCount] = {};
+	long long sFrameDelta[DSGraphics::kGpuMemoryCategoryCount] = {};
+	size_t sBudget = 0;
+
+	double ToMB(size_t bytes)
+	{
+		return bytes / (1024.0 * 1024.0);
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  Buffers
+
+/*
+Description:
+	glBufferData on the buffer bound to target, which must be buffer.
+Variables:
+	pOwner = the asset the buffer belongs to, for PrintTopConsumers.
+*/
+void DSGraphics::GpuMemory::BufferData(GLenum target, GLuint buffer, GLsizeiptr size, const GLvoid* pData, GLenum usage, DSGraphics::GpuMemoryCategory category, const char* pOwner)
+{
+	glBufferData(target, size, pData, usage);
+	Record(MakeKey(kObjectBuffer, buffer, 0), static_cast<size_t>(size), category, pOwner);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Deletes the buffer and sets it to 0.
+*/
+void DSGraphics::GpuMemory::DeleteBuffer(GLuint& buffer)
+{
+	if(buffer == 0)
+	{
+		return;
+	}
+
+	glDeleteBuffers(1, &buffer);
+	Release(MakeKey(kObjectBuffer, buffer, 0), MakeKey(kObjectBuffer, buffer, 0));
+	buffer = 0;
+}
+
+//-----------------------------------------------------------------------------
+//  Textures
+
+/*
+Description:
+	glTexImage2D on the texture bound to target, which must be texture.
+Variables:
+	category = kGpuMemoryTexture, or kGpuMemoryRenderTarget for textures that are rendered to.
+*/
+void DSGraphics::GpuMemory::TexImage2D(GLenum target, GLuint texture, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* pData, DSGraphics::GpuMemoryCategory category, const char* pOwner)
+{
+	glTexImage2D(target, level, internalFormat, width, height, 0, format, type, pData);
+
+	size_t bytes = static_cast<size_t>(width) * static_cast<size_t>(height) * GetBytesPerPixel(static_cast<GLenum>(internalFormat));
+	Record(MakeKey(kObjectTexture, texture, level), bytes, category, pOwner);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	glCompressedTexImage2D on the texture bound to target, which must be texture. Counted as imageSize, the size of the compressed blocks.
+*/
+void DSGraphics::GpuMemory::CompressedTexImage2D(GLenum target, GLuint texture, GLint level, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei imageSize, const GLvoid* pData, DSGraphics::GpuMemoryCategory category, const char* pOwner)
+{
+	glCompressedTexImage2D(target, level, internalFormat, width, height, 0, imageSize, pData);
+
+	Record(MakeKey(kObjectTexture, texture, level), static_cast<size_t>(imageSize), category, pOwner);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Deletes the texture (every level of it) and sets it to 0.
+*/
+void DSGraphics::GpuMemory::DeleteTexture(GLuint& texture)
+{
+	if(texture == 0)
+	{
+		return;
+	}
+
+	glDeleteTextures(1, &texture);
+	Release(MakeKey(kObjectTexture, texture, 0), MakeKey(kObjectTexture, texture, 0xFF));
+	texture = 0;
+}
+
+//-----------------------------------------------------------------------------
+//  Renderbuffers
+
+/*
+Description:
+	glRenderbufferStorage on the bound renderbuffer, which must be renderbuffer. Always counted as kGpuMemoryRenderTarget.
+*/
+void DSGraphics::GpuMemory::RenderbufferStorage(GLuint renderbuffer, GLenum internalFormat, GLsizei width, GLsizei height, const char* pOwner)
+{
+	glRenderbufferStorage(GL_RENDERBUFFER, internalFormat, width, height);
+
+	size_t bytes = static_cast<size_t>(width) * static_cast<size_t>(height) * GetBytesPerPixel(internalFormat);
+	Record(MakeKey(kObjectRenderbuffer, renderbuffer, 0), bytes, DSGraphics::kGpuMemoryRenderTarget, pOwner);
+}
+
+//-----------------------------------------------------------------------------
+
+void DSGraphics::GpuMemory::DeleteRenderbuffer(GLuint& renderbuffer)
+{
+	if(renderbuffer == 0)
+	{
+		return;
+	}
+
+	glDeleteRenderbuffers(1, &renderbuffer);
+	Release(MakeKey(kObjectRenderbuffer, renderbuffer, 0), MakeKey(kObjectRenderbuffer, renderbuffer, 0));
+	renderbuffer = 0;
+}
+
+//-----------------------------------------------------------------------------
+//  Frames
+
+/*
+Description:
+	Ends the frame delta measurement for the previous frame and starts it for this one. Call once at the start of every frame.
+*/
+void DSGraphics::GpuMemory::BeginFrame()
+{
+	for(unsigned int i = 0; i < kGpuMemoryCategoryCount; ++i)
+	{
+		sFrameDelta[i] = static_cast<long long>(sBytes[i]) - static_cast<long long>(sFrameStartBytes[i]);
+		sFrameStartBytes[i] = sBytes[i];
+	}
+}
+
+//-----------------------------------------------------------------------------
+//  Budget
+
+/*
+Description:
+	Warns (on stderr) whenever the total rises above bytes, eg. the video memory of the smallest GPU the game should run on. 0 removes the budget.
+*/
+void DSGraphics::GpuMemory::SetBudget(size_t bytes)
+{
+	sBudget = bytes;
+}
+
+//-----------------------------------------------------------------------------
+//  Reports
+
+void DSGraphics::GpuMemory::PrintSummary()
+{
+	printf("GPU memory (MB):\n");
+	for(unsigned int i = 0; i < kGpuMemoryCategoryCount; ++i)
+	{
+		printf("  %-14s %9.2f (%+.2f last frame)\n", kCategoryNames[i], ToMB(sBytes[i]), sFrameDelta[i] / (1024.0 * 1024.0));
+	}
+
+	if(sBudget != 0)
+	{
+		printf("  %-14s %9.2f of %.2f budget\n", "Total", ToMB(GetTotalBytes()), ToMB(sBudget));
+	}
+	else
+	{
+		printf("  %-14s %9.2f\n", "Total", ToMB(GetTotalBytes()));
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Prints the count owners using the most video memory, with how their usage splits across the categories.
+*/
+void DSGraphics::GpuMemory::PrintTopConsumers(unsigned int count)
+{
+	//Sum each owner's allocations
+	std::map<std::string, std::vector<size_t> > owners;
+	std::map<unsigned long long, Allocation>::const_iterator it;
+	for(it = sAllocations.begin(); it != sAllocations.end(); ++it)
+	{
+		std::vector<size_t>& bytes = owners[it->second.mOwner];
+		bytes.resize(kGpuMemoryCategoryCount + 1, 0);
+		bytes[it->second.mCategory] += it->second.mBytes;
+		bytes[kGpuMemoryCategoryCount] += it->second.mBytes;//total
+	}
+
+	std::vector<std::pair<size_t, std::string> > order;
+	std::map<std::string, std::vector<size_t> >::const_iterator owner;
+	for(owner = owners.begin(); owner != owners.end(); ++owner)
+	{
+		order.push_back(std::make_pair(owner->second[kGpuMemoryCategoryCount], owner->first));
+	}
+	std::sort(order.rbegin(), order.rend());
+
+	printf("Top GPU memory consumers (MB):\n");
+	printf("  %-40s %9s %9s %9s %9s %9s\n", "Owner", "Total", "Vertex", "Index", "Texture", "Target");
+	for(unsigned int i = 0; i < order.size() && i < count; ++i)
+	{
+		const std::vector<size_t>& bytes = owners[order[i].second];
+		printf("  %-40s %9.2f %9.2f %9.2f %9.2f %9.2f\n", order[i].second.c_str(), ToMB(bytes[kGpuMemoryCategoryCount]),
+			ToMB(bytes[kGpuMemoryVertex]), ToMB(bytes[kGpuMemoryIndex]), ToMB(bytes[kGpuMemoryTexture]), ToMB(bytes[kGpuMemoryRenderTarget]));
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+size_t DSGraphics::GpuMemory::GetBytes(DSGraphics::GpuMemoryCategory category)
+{
+	return sBytes[category];
+}
+
+//-----------------------------------------------------------------------------
+
+size_t DSGraphics::GpuMemory::GetTotalBytes()
+{
+	size_t total = 0;
+	for(unsigned int i = 0; i < kGpuMemoryCategoryCount; ++i)
+	{
+		total += sBytes[i];
+	}
+
+	return total;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	How much the category grew (or shrank, if negative) over the last complete frame.
+*/
+long long DSGraphics::GpuMemory::GetFrameDelta(DSGraphics::GpuMemoryCategory category)
+{
+	return sFrameDelta[category];
+}
+
+//-----------------------------------------------------------------------------
+
+long long DSGraphics::GpuMemory::GetTotalFrameDelta()
+{
+	long long total = 0;
+	for(unsigned int i = 0; i < kGpuMemoryCategoryCount; ++i)
+	{
+		total += sFrameDelta[i];
+	}
+
+	return total;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* DSGraphics::GpuMemory::GetCategoryName(DSGraphics::GpuMemoryCategory category)
+{
+	return kCategoryNames[category];
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Unknown formats count as 4 bytes, with a warning.
+*/
+unsigned int DSGraphics::GpuMemory::GetBytesPerPixel(GLenum internalFormat)
+{
+	switch(internalFormat)
+	{
+	case GL_RED:
+	case GL_R8:
+		return 1;
+	case GL_RG:
+	case GL_RG8:
+	case GL_R16F:
+	case GL_DEPTH_COMPONENT16:
+		return 2;
+	case GL_RGB://stored padded to 4 bytes by practically every driver
+	case GL_RGB8:
+	case GL_SRGB8:
+	case GL_RGBA:
+	case GL_RGBA8:
+	case GL_SRGB8_ALPHA8:
+	case GL_RG16F:
+	case GL_R32F:
+	case GL_R11F_G11F_B10F:
+	case GL_DEPTH_COMPONENT:
+	case GL_DEPTH_COMPONENT24:
+	case GL_DEPTH_COMPONENT32:
+	case GL_DEPTH_COMPONENT32F:
+	case GL_DEPTH24_STENCIL8:
+		return 4;
+	case GL_RGBA16F:
+	case GL_RG32F:
+	case GL_DEPTH32F_STENCIL8:
+		return 8;
+	case GL_RGBA32F:
+		return 16;
+	default:
+		fprintf(stderr, "WARNING: GpuMemory does not know the size of internal format 0x%X. Counting it as 4 bytes per pixel.\n", internalFormat);
+		return 4;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helpers
+
+void DSGraphics::GpuMemory::Record(unsigned long long key, size_t bytes, DSGraphics::GpuMemoryCategory category, const char* pOwner)
+{
+	//Redefining an object's storage replaces it
+	Release(key, key);
+
+	Allocation& allocation = sAllocations[key];
+	allocation.mBytes = bytes;
+	allocation.mCategory = category;
+	allocation.mOwner = pOwner != nullptr ? pOwner : "(unknown)";
+
+	size_t before = GetTotalBytes();
+	sBytes[category] += bytes;
+	if(sBudget != 0 && before <= sBudget && GetTotalBytes() > sBudget)
+	{
+		fprintf(stderr, "WARNING: GPU memory is over its budget: %.2f MB of %.2f MB, after \"%s\" allocated %.2f MB.\n", ToMB(GetTotalBytes()), ToMB(sBudget), allocation.mOwner.c_str(), ToMB(bytes));
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Forgets every allocation with a key in [firstKey, lastKey].
+*/
+void DSGraphics::GpuMemory::Release(unsigned long long firstKey, unsigned long long lastKey)
+{
+	std::map<unsigned long long, Allocation>::iterator it = sAllocations.lower_bound(firstKey);
+	while(it != sAllocations.end() && it->first <= lastKey)
+	{
+		sBytes[it->second.mCategory] -= it->second.mBytes;
+		it = sAllocations.erase(it);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+//=============================================================================
+// File:		GpuMemory.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	GpuMemory. Creates and deletes GL buffers, textures and renderbuffers while accounting for the video memory they use, by category and owning asset.
+//=============================================================================
+
+#ifndef GPUMEMORY_H
+#define GPUMEMORY_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLEW
+#include <GL/glew.h>
+
+// Standard C++ Libraries
+#include <cstddef>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSGraphics
+{
+
+	//=============================================================================
+	//Enums
+	//=============================================================================
+
+	enum GpuMemoryCategory
+	{
+		kGpuMemoryVertex,
+		kGpuMemoryIndex,
+		kGpuMemoryTexture,
+		kGpuMemoryRenderTarget,
+		kGpuMemoryCategoryCount
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Every glBufferData, glTexImage2D, glCompressedTexImage2D and glRenderbufferStorage in DSGraphics goes through here instead, along with the matching delete,
+		so that the total, the amount per category, and the amount per owner (eg. "Wall" or "../../Resources/Textures/stripes.png") are always known.
+	Usage:
+		glBindBuffer(GL_ARRAY_BUFFER, vbo);
+		DSGraphics::GpuMemory::BufferData(GL_ARRAY_BUFFER, vbo, bytes, pVertices, GL_STATIC_DRAW, DSGraphics::kGpuMemoryVertex, "Wall");
+		...
+		DSGraphics::GpuMemory::DeleteBuffer(vbo);
+	Notes:
+		Sizes are what was asked for. Drivers add their own alignment and padding (eg. RGB textures are usually stored as RGBA, which is how they are counted here),
+		so treat the numbers as a close lower bound.
+		Redefining the storage of a buffer or texture level replaces its old size.
+		Must only be used on the thread that owns the GL context.
+	*/
+	class GpuMemory
+	{
+	private:
+		//Constructors
+		GpuMemory();
+
+		//Member Functions
+	public:
+		// Buffers
+		static void BufferData(GLenum target, GLuint buffer, GLsizeiptr size, const GLvoid* pData, GLenum usage, DSGraphics::GpuMemoryCategory category, const char* pOwner);
+		static void DeleteBuffer(GLuint& buffer);
+
+		// Textures
+		static void TexImage2D(GLenum target, GLuint texture, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* pData, DSGraphics::GpuMemoryCategory category, const char* pOwner);
+		static void CompressedTexImage2D(GLenum target, GLuint texture, GLint level, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei imageSize, const GLvoid* pData, DSGraphics::GpuMemoryCategory category, const char* pOwner);
+		static void DeleteTexture(GLuint& texture);
+
+		// Renderbuffers
+		static void RenderbufferStorage(GLuint renderbuffer, GLenum internalFormat, GLsizei width, GLsizei height, const char* pOwner);
+		static void DeleteRenderbuffer(GLuint& renderbuffer);
+
+		// Frames
+		static void BeginFrame();
+
+		// Budget
+		static void SetBudget(size_t bytes);
+
+		// Reports
+		static void PrintSummary();
+		static void PrintTopConsumers(unsigned int count);
+
+		// Getters
+		static size_t GetBytes(DSGraphics::GpuMemoryCategory category);
+		static size_t GetTotalBytes();
+		static long long GetFrameDelta(DSGraphics::GpuMemoryCategory category);
+		static long long GetTotalFrameDelta();
+		static const char* GetCategoryName(DSGraphics::GpuMemoryCategory category);
+		static unsigned int GetBytesPerPixel(GLenum internalFormat);
+
+	private:
+		// Helpers
+		static void Record(unsigned long long key, size_t bytes, DSGraphics::GpuMemoryCategory category, const char* pOwner);
+		static void Release(unsigned long long firstKey, unsigned long long lastKey);
+	};
+
+}//namespace DSGraphics
+
+#endif //#ifndef GPUMEMORY_H
\ No newline at end of file
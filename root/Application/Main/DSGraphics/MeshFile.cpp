@@ -0,0 +1,309 @@
+//=============================================================================
+// File:		MeshFile.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	MeshFile
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstring>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "MeshFile.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	unsigned long long AlignUp(unsigned long long value)
+	{
+		return (value + DSGraphics::MeshFile::kAlignment - 1) & ~static_cast<unsigned long long>(DSGraphics::MeshFile::kAlignment - 1);
+	}
+
+	//Zeros up to the next kAlignment boundary
+	bool WritePadding(FILE* pFile, unsigned long long& written)
+	{
+		static const unsigned char kZeros[DSGraphics::MeshFile::kAlignment] = {};
+		size_t padding = static_cast<size_t>(AlignUp(written) - written);
+		written += padding;
+		return padding == 0 || fwrite(kZeros, 1, padding, pFile) == padding;
+	}
+
+	bool WriteBytes(FILE* pFile, const void* pData, size_t bytes, unsigned long long& written)
+	{
+		written += bytes;
+		return bytes == 0 || fwrite(pData, 1, bytes, pFile) == bytes;
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	A file that is missing or fails validation prints a warning and leaves GetIsLoaded() false.
+*/
+DSGraphics::MeshFile::MeshFile(const char* pPath)
+:	mFile(pPath)
+,	mpHeader(nullptr)
+{
+	if(mFile.GetIsLoaded() == true && Validate(pPath) == true)
+	{
+		mpHeader = reinterpret_cast<const DSGraphics::MeshFileHeader*>(mFile.GetData());
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSGraphics::MeshFile::~MeshFile()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  Writing
+
+/*
+Description:
+	Writes data to pPath in the current version of the format, computing the layout and bounds. Returns false (with a warning) on failure.
+*/
+bool DSGraphics::MeshFile::Write(const char* pPath, const DSGraphics::MeshData& data)
+{
+	DSGraphics::MeshFileLod wholeMesh = {0, data.mIndexCount, 0.0f, 0};
+	const DSGraphics::MeshFileLod* pLods = data.mpLods != nullptr ? data.mpLods : &wholeMesh;
+	uint32_t lodCount = data.mpLods != nullptr ? data.mLodCount : 1;
+
+	DSGraphics::MeshFileHeader header;
+	memset(&header, 0, sizeof(header));
+	header.mMagic = kMagic;
+	header.mVersion = kVersion;
+	header.mDrawType = data.mDrawType;
+	header.mVertexCount = data.mVertexCount;
+	header.mIndexCount = data.mIndexCount;
+	header.mLodCount = lodCount;
+
+	// Vertex layout
+	uint32_t floatsPerVertex = 0;
+	for(unsigned int i = 0; i < kMeshAttributeCount; ++i)
+	{
+		header.mAttributes[i].mComponents = data.mComponents[i];
+		header.mAttributes[i].mOffset = floatsPerVertex * sizeof(GLfloat);
+		floatsPerVertex += data.mComponents[i];
+	}
+	header.mVertexStride = floatsPerVertex * sizeof(GLfloat);
+
+	// Bounds
+	uint32_t positionComponents = data.mComponents[kMeshAttributePosition];
+	for(unsigned int axis = 0; axis < 3; ++axis)
+	{
+		header.mBoundsMin[axis] = 0.0f;
+		header.mBoundsMax[axis] = 0.0f;
+	}
+	for(uint32_t vertex = 0; vertex < data.mVertexCount; ++vertex)
+	{
+		const GLfloat* pPosition = data.mpVertices + vertex * floatsPerVertex;
+		for(unsigned int axis = 0; axis < 3 && axis < positionComponents; ++axis)
+		{
+			if(vertex == 0 || pPosition[axis] < header.mBoundsMin[axis])
+			{
+				header.mBoundsMin[axis] = pPosition[axis];
+			}
+			if(vertex == 0 || pPosition[axis] > header.mBoundsMax[axis])
+			{
+				header.mBoundsMax[axis] = pPosition[axis];
+			}
+		}
+	}
+
+	// Layout
+	unsigned long long lodOffset = AlignUp(sizeof(DSGraphics::MeshFileHeader));
+	unsigned long long vertexOffset = AlignUp(lodOffset + lodCount * sizeof(DSGraphics::MeshFileLod));
+	unsigned long long indexOffset = AlignUp(vertexOffset + static_cast<unsigned long long>(data.mVertexCount) * header.mVertexStride);
+	unsigned long long fileSize = indexOffset + static_cast<unsigned long long>(data.mIndexCount) * sizeof(GLuint);
+	if(fileSize > 0xFFFFFFFFull)
+	{
+		fprintf(stderr, "WARNING: MeshFile could not write \"%s\": meshes are limited to 4 GB.\n", pPath);
+		return false;
+	}
+	header.mLodOffset = static_cast<uint32_t>(lodOffset);
+	header.mVertexOffset = static_cast<uint32_t>(vertexOffset);
+	header.mIndexOffset = static_cast<uint32_t>(indexOffset);
+	header.mFileSize = static_cast<uint32_t>(fileSize);
+
+	FILE* pFile = nullptr;
+	if(fopen_s(&pFile, pPath, "wb") != 0 || pFile == nullptr)
+	{
+		fprintf(stderr, "WARNING: MeshFile could not open \"%s\" for writing.\n", pPath);
+		return false;
+	}
+
+	unsigned long long written = 0;
+	bool isWritten = WriteBytes(pFile, &header, sizeof(header), written)
+		&& WritePadding(pFile, written)
+		&& WriteBytes(pFile, pLods, lodCount * sizeof(DSGraphics::MeshFileLod), written)
+		&& WritePadding(pFile, written)
+		&& WriteBytes(pFile, data.mpVertices, static_cast<size_t>(data.mVertexCount) * header.mVertexStride, written)
+		&& WritePadding(pFile, written)
+		&& WriteBytes(pFile, data.mpIndices, static_cast<size_t>(data.mIndexCount) * sizeof(GLuint), written);
+
+	if(fclose(pFile) != 0 || isWritten == false)
+	{
+		fprintf(stderr, "WARNING: MeshFile failed while writing \"%s\".\n", pPath);
+		return false;
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helpers
+
+/*
+Description:
+	Checks that everything the header describes lies within the file, so the getters can be trusted. Only looks at the header and LOD table.
+*/
+bool DSGraphics::MeshFile::Validate(const char* pPath) const
+{
+	size_t size = mFile.GetSize();
+	if(size < sizeof(DSGraphics::MeshFileHeader))
+	{
+		fprintf(stderr, "WARNING: \"%s\" is too small to be a mesh file.\n", pPath);
+		return false;
+	}
+
+	const DSGraphics::MeshFileHeader& header = *reinterpret_cast<const DSGraphics::MeshFileHeader*>(mFile.GetData());
+	if(header.mMagic != kMagic)
+	{
+		fprintf(stderr, "WARNING: \"%s\" is not a mesh file.\n", pPath);
+		return false;
+	}
+	if(header.mVersion != kVersion)
+	{
+		fprintf(stderr, "WARNING: \"%s\" is mesh file version %u, but only version %u is supported. Re-export it.\n", pPath, header.mVersion, kVersion);
+		return false;
+	}
+	if(header.mFileSize != size)
+	{
+		fprintf(stderr, "WARNING: \"%s\" is %u bytes according to its header, but is %u bytes. It is probably truncated.\n", pPath, header.mFileSize, static_cast<unsigned int>(size));
+		return false;
+	}
+
+	// Vertex layout
+	uint32_t floatsPerVertex = 0;
+	for(unsigned int i = 0; i < kMeshAttributeCount; ++i)
+	{
+		if(header.mAttributes[i].mComponents > 4 || header.mAttributes[i].mOffset != floatsPerVertex * sizeof(GLfloat))
+		{
+			fprintf(stderr, "WARNING: \"%s\" has an invalid vertex layout.\n", pPath);
+			return false;
+		}
+		floatsPerVertex += header.mAttributes[i].mComponents;
+	}
+	if(header.mAttributes[kMeshAttributePosition].mComponents < 2 || header.mVertexStride != floatsPerVertex * sizeof(GLfloat))
+	{
+		fprintf(stderr, "WARNING: \"%s\" has an invalid vertex layout.\n", pPath);
+		return false;
+	}
+
+	// Sections
+	if(header.mLodOffset % kAlignment != 0 || header.mVertexOffset % kAlignment != 0 || header.mIndexOffset % kAlignment != 0
+		|| header.mLodOffset < sizeof(DSGraphics::MeshFileHeader)
+		|| header.mLodOffset + static_cast<unsigned long long>(header.mLodCount) * sizeof(DSGraphics::MeshFileLod) > size
+		|| header.mVertexOffset + static_cast<unsigned long long>(header.mVertexCount) * header.mVertexStride > size
+		|| header.mIndexOffset + static_cast<unsigned long long>(header.mIndexCount) * sizeof(GLuint) > size)
+	{
+		fprintf(stderr, "WARNING: \"%s\" has sections outside of the file.\n", pPath);
+		return false;
+	}
+
+	// LODs
+	if(header.mLodCount == 0)
+	{
+		fprintf(stderr, "WARNING: \"%s\" has no LODs.\n", pPath);
+		return false;
+	}
+	const DSGraphics::MeshFileLod* pLods = reinterpret_cast<const DSGraphics::MeshFileLod*>(mFile.GetData() + header.mLodOffset);
+	for(uint32_t i = 0; i < header.mLodCount; ++i)
+	{
+		if(static_cast<unsigned long long>(pLods[i].mIndexStart) + pLods[i].mIndexCount > header.mIndexCount)
+		{
+			fprintf(stderr, "WARNING: \"%s\" has a LOD outside of its indices.\n", pPath);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+bool DSGraphics::MeshFile::GetIsLoaded() const
+{
+	return mpHeader != nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+const DSGraphics::MeshFileHeader& DSGraphics::MeshFile::GetHeader() const
+{
+	return *mpHeader;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Points into the loaded file, so it is only valid while the MeshFile is.
+*/
+const GLvoid* DSGraphics::MeshFile::GetVertices() const
+{
+	return mFile.GetData() + mpHeader->mVertexOffset;
+}
+
+//-----------------------------------------------------------------------------
+
+size_t DSGraphics::MeshFile::GetVertexBytes() const
+{
+	return static_cast<size_t>(mpHeader->mVertexCount) * mpHeader->mVertexStride;
+}
+
+//-----------------------------------------------------------------------------
+
+const GLuint* DSGraphics::MeshFile::GetIndices() const
+{
+	return reinterpret_cast<const GLuint*>(mFile.GetData() + mpHeader->mIndexOffset);
+}
+
+//-----------------------------------------------------------------------------
+
+size_t DSGraphics::MeshFile::GetIndexBytes() const
+{
+	return static_cast<size_t>(mpHeader->mIndexCount) * sizeof(GLuint);
+}
+
+//-----------------------------------------------------------------------------
+
+const DSGraphics::MeshFileLod& DSGraphics::MeshFile::GetLod(unsigned int lod) const
+{
+	return reinterpret_cast<const DSGraphics::MeshFileLod*>(mFile.GetData() + mpHeader->mLodOffset)[lod];
+}
\ No newline at end of file
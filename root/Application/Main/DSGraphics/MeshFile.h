@@ -0,0 +1,165 @@
+//=============================================================================
+// File:		MeshFile.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	MeshFile. The versioned binary mesh format (.dsmesh), laid out so that a memory mapped file can be handed straight to OpenGL.
+//=============================================================================
+
+#ifndef MESHFILE_H
+#define MESHFILE_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLEW
+#include <GL/glew.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// Daniel Schenker
+#include "../DSSystem/ResourceFile.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSGraphics
+{
+
+	//=============================================================================
+	//Enums
+	//=============================================================================
+
+	//Stored in this order within each vertex
+	enum MeshAttribute
+	{
+		kMeshAttributePosition,
+		kMeshAttributeTexCoord,
+		kMeshAttributeColor,
+		kMeshAttributeCount
+	};
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	//Note: These are the on disk layout. Only add members at the end and bump MeshFile::kVersion.
+
+	struct MeshFileAttribute
+	{
+		uint32_t mComponents;//GLfloats per vertex, 0 if the mesh does not have the attribute
+		uint32_t mOffset;//bytes from the start of the vertex
+	};
+
+	struct MeshFileLod
+	{
+		uint32_t mIndexStart;//first index in the index blob
+		uint32_t mIndexCount;
+		float mMaxDistance;//in device coordinates, the furthest this LOD should be drawn at. The last LOD ignores it.
+		uint32_t mReserved;
+	};
+
+	struct MeshFileHeader
+	{
+		uint32_t mMagic;
+		uint32_t mVersion;
+		uint32_t mFileSize;
+		uint32_t mDrawType;//GLenum, eg. GL_TRIANGLES
+		// Vertices
+		uint32_t mVertexCount;
+		uint32_t mVertexStride;//bytes
+		MeshFileAttribute mAttributes[kMeshAttributeCount];
+		// Indices (GLuint)
+		uint32_t mIndexCount;
+		// LODs, most detailed first
+		uint32_t mLodCount;
+		// Section offsets in bytes from the start of the file, each a multiple of MeshFile::kAlignment
+		uint32_t mLodOffset;
+		uint32_t mVertexOffset;
+		uint32_t mIndexOffset;
+		// Bounds of the positions
+		float mBoundsMin[3];
+		float mBoundsMax[3];
+	};
+
+	/*
+	Description:
+		Everything MeshFile::Write needs. Vertices are interleaved GLfloats, with the attributes in MeshAttribute order.
+		mpLods may be nullptr, for a single LOD covering every index.
+	*/
+	struct MeshData
+	{
+		GLenum mDrawType;
+		uint32_t mComponents[kMeshAttributeCount];
+		uint32_t mVertexCount;
+		const GLfloat* mpVertices;
+		uint32_t mIndexCount;
+		const GLuint* mpIndices;
+		uint32_t mLodCount;
+		const DSGraphics::MeshFileLod* mpLods;
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		A .dsmesh file, mapped and validated.
+		The file is: MeshFileHeader, MeshFileLod[mLodCount], the vertex blob, the index blob; each section starting on a kAlignment boundary.
+		Loading is mapping the file and checking the header against its size, so the cost is the I/O, not parsing, and GetVertices/GetIndices
+		point into the mapping itself, ready for glBufferData.
+		The file is opened as a ResourceFile, so it comes from the mounted resource pack when that has it.
+	Notes:
+		Files are little endian, as written by Write.
+		Index values are not checked against the vertex count; the files are expected to come from Write.
+	*/
+	class MeshFile
+	{
+	public:
+		//Constructors
+		explicit MeshFile(const char* pPath);
+		//Destructor
+		~MeshFile();
+
+	private:
+		//Disable Copy Constructor
+		MeshFile(const MeshFile&);
+		const MeshFile& operator=(const MeshFile&);
+
+		//Member Functions
+	public:
+		// Writing
+		static bool Write(const char* pPath, const DSGraphics::MeshData& data);
+
+		// Getters
+		bool GetIsLoaded() const;
+		const DSGraphics::MeshFileHeader& GetHeader() const;
+		const GLvoid* GetVertices() const;
+		size_t GetVertexBytes() const;
+		const GLuint* GetIndices() const;
+		size_t GetIndexBytes() const;
+		const DSGraphics::MeshFileLod& GetLod(unsigned int lod) const;
+
+	private:
+		// Helpers
+		bool Validate(const char* pPath) const;
+
+		//Member Variables
+	public:
+		static const uint32_t kMagic = 0x484D5344;//"DSMH"
+		static const uint32_t kVersion = 1;
+		static const uint32_t kAlignment = 16;
+
+	private:
+		DSSystem::ResourceFile mFile;
+		const DSGraphics::MeshFileHeader* mpHeader;//nullptr if the file did not load
+	};
+
+}//namespace DSGraphics
+
+#endif //#ifndef MESHFILE_H
\ No newline at end of file
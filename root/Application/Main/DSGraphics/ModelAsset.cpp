@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		ModelAsset.cpp
 // Created:		2015/02/15
-// Last Edited:	2015/05/07
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	ModelAsset
 //=============================================================================
@@ -10,8 +10,14 @@
 //Includes
 //=============================================================================
 
+// Standard C++ Libraries
+#include <cstring>
+
 // Daniel Schenker
 #include "ModelAsset.h"
+#include "GpuMemory.h"
+#include "../DSMemory/MemoryManager.h"
+#include "../DSMemory/MemoryTracker.h"
 
 //=============================================================================
 //Statics
@@ -42,7 +48,8 @@ DSGraphics::ModelAsset::ModelAsset
 	unsigned int elementCountTotal,
 	GLuint* pElements,
 	GLenum drawType,
-	unsigned int elementCountPerDrawType
+	unsigned int elementCountPerDrawType,
+	const char* pName
 )
 :	mpProgram(pProgram)
 ,	mkTextureCount(textureCount)
@@ -66,68 +73,134 @@ DSGraphics::ModelAsset::ModelAsset
 ,	mElementCountPerDrawType(elementCountPerDrawType)
 ,	mDrawStart(0)
 {
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagMeshes);
+
 	//Deep Copy Data
 	//Note:	Deep copying because eventually data will be retrieved from a file, and not be hard coded.
 	//		This way the original data (namely the file) will not be modified if any changes to the ModelAsset are made during runtime.
 	
 	// Vertex
-	mpVertices = new GLfloat[mkVertexCount * mkDataBitsPerVertex];
-	for(unsigned int i = 0; i < mkVertexCount * mkDataBitsPerVertex; ++i)
-	{
-		mpVertices[i] = pVertices[i];
-	}
+	mpVertices = static_cast<GLfloat*>(DSMemory::MemoryManager::GetHeap().Allocate(sizeof(GLfloat) * mkVertexCount * mkDataBitsPerVertex));
+	memcpy(mpVertices, pVertices, sizeof(GLfloat) * mkVertexCount * mkDataBitsPerVertex);
 
 	// Element
 	if(mkHasElements == true)
 	{
-		mpElements = new GLuint[mkElementCountTotal];
-		for(unsigned int i = 0; i < mkElementCountTotal; ++i)
-		{
-			mpElements[i] = pElements[i];
-		}
+		mpElements = static_cast<GLuint*>(DSMemory::MemoryManager::GetHeap().Allocate(sizeof(GLuint) * mkElementCountTotal));
+		memcpy(mpElements, pElements, sizeof(GLuint) * mkElementCountTotal);
 	}
 
-	//Vertex Array Object (VAO)
-	//Note:	VAOs store all of the links between attributes and their corresponding VBOs with raw vertex data.
-	// Creation
-	glGenVertexArrays(1, &mVao);
-	// Enable Usage (by binding)
-	glBindVertexArray(mVao);
+	//Bounds
+	mBoundsMin = glm::vec3(mpVertices[0], mpVertices[1], mkPositionDimensions > 2 ? mpVertices[2] : 0.0f);
+	mBoundsMax = mBoundsMin;
+	for(unsigned int i = 1; i < mkVertexCount; ++i)
+	{
+		const GLfloat* pPosition = mpVertices + i * mkDataBitsPerVertex;
+		glm::vec3 position(pPosition[0], pPosition[1], mkPositionDimensions > 2 ? pPosition[2] : 0.0f);
+		mBoundsMin = glm::min(mBoundsMin, position);
+		mBoundsMax = glm::max(mBoundsMax, position);
+	}
 
+	//A single LOD of everything
+	DSGraphics::MeshFileLod lod = {0, mkElementCountTotal, 0.0f, 0};
+	mLods.push_back(lod);
 
-	//Vertex Buffer Object (VBO)
-	//Note:	Since OpenGL manages memory, GLuint vboTriangle is a positive number reference to the memory that the VBO will occupy.
-	// Creation
-	glGenBuffers(1, &mVbo);
-	// Set a specific VBO as the active object in the array buffer
-	glBindBuffer(GL_ARRAY_BUFFER, mVbo);
-	// Copy vertex data to the active object previously specified to the array buffer
-	glBufferData
+	CreateBuffers
 	(
-		GL_ARRAY_BUFFER,												//currently active array buffer
-		sizeof(mpVertices[0]) * mkVertexCount * mkDataBitsPerVertex,	//size of vertices data in bytes
-		mpVertices,														//actual vertices data
-		GL_STATIC_DRAW													//usage of vertex data
+		mpVertices,
+		sizeof(mpVertices[0]) * mkVertexCount * mkDataBitsPerVertex,
+		mpElements,
+		sizeof(GLuint) * mkElementCountTotal,
+		pName
 	);
+}
 
+//-----------------------------------------------------------------------------
 
-	//Element  Buffer Objects (EBO)
+/*
+Description:
+	Uploads the mesh straight from the mapped file, without a CPU copy; the MeshFile can be destroyed afterwards.
+Notes:
+	mesh must be loaded (GetIsLoaded()).
+	Draws the most detailed LOD.
+*/
+DSGraphics::ModelAsset::ModelAsset
+(
+	DSGraphics::Program* pProgram,
+	DSGraphics::Texture* pTexture,
+	const DSGraphics::MeshFile& mesh,
+	const char* pName
+)
+:	mpProgram(pProgram)
+,	mkTextureCount(pTexture != nullptr && mesh.GetHeader().mAttributes[DSGraphics::kMeshAttributeTexCoord].mComponents > 0 ? 1 : 0)
+,	mpTexture(pTexture)
+,	mkTextureCoordsOffset(mesh.GetHeader().mAttributes[DSGraphics::kMeshAttributeTexCoord].mOffset / sizeof(GLfloat))
+,	mkHasColors(mesh.GetHeader().mAttributes[DSGraphics::kMeshAttributeColor].mComponents > 0)
+,	mkRgbaOffset(mesh.GetHeader().mAttributes[DSGraphics::kMeshAttributeColor].mOffset / sizeof(GLfloat))
+,	mVao(0)
+,	mkVertexCount(mesh.GetHeader().mVertexCount)
+,	mkDataBitsPerVertex(mesh.GetHeader().mVertexStride / sizeof(GLfloat))
+,	mkPositionDimensions(mesh.GetHeader().mAttributes[DSGraphics::kMeshAttributePosition].mComponents)
+,	mkTextureDimensions(mesh.GetHeader().mAttributes[DSGraphics::kMeshAttributeTexCoord].mComponents)
+,	mkColorDimensions(mesh.GetHeader().mAttributes[DSGraphics::kMeshAttributeColor].mComponents)
+,	mpVertices(nullptr)
+,	mVbo(0)
+,	mkHasElements(mesh.GetHeader().mIndexCount > 0)
+,	mEbo(0)
+,	mkElementCountTotal(mesh.GetLod(0).mIndexCount)
+,	mpElements(nullptr)
+,	mDrawType(mesh.GetHeader().mDrawType)
+,	mElementCountPerDrawType(0)
+,	mDrawStart(mesh.GetLod(0).mIndexStart)
+,	mBoundsMin(mesh.GetHeader().mBoundsMin[0], mesh.GetHeader().mBoundsMin[1], mesh.GetHeader().mBoundsMin[2])
+,	mBoundsMax(mesh.GetHeader().mBoundsMax[0], mesh.GetHeader().mBoundsMax[1], mesh.GetHeader().mBoundsMax[2])
+{
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagMeshes);
+
+	for(unsigned int i = 0; i < mesh.GetHeader().mLodCount; ++i)
+	{
+		mLods.push_back(mesh.GetLod(i));
+	}
+
+	CreateBuffers(mesh.GetVertices(), mesh.GetVertexBytes(), mesh.GetIndices(), mesh.GetIndexBytes(), pName);
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSGraphics::ModelAsset::~ModelAsset()
+{
+	if(mpVertices != nullptr)
+	{
+		DSMemory::MemoryManager::GetHeap().Free(mpVertices);
+		mpVertices = nullptr;
+	}
 	if(mkHasElements == true)
 	{
-		glGenBuffers(1, &mEbo);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mEbo);
-		glBufferData
-		(
-			GL_ELEMENT_ARRAY_BUFFER,
-			sizeof(mpElements[0]) * mkElementCountTotal,
-			mpElements,
-			GL_STATIC_DRAW
-		);
+		DSGraphics::GpuMemory::DeleteBuffer(mEbo);
+		if(mpElements != nullptr)
+		{
+			DSMemory::MemoryManager::GetHeap().Free(mpElements);
+			mpElements = nullptr;
+		}
 	}
+	DSGraphics::GpuMemory::DeleteBuffer(mVbo);
+	glDeleteVertexArrays(1, &mVao);
+}
 
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+// General
 
-	//Specify the layout of the vertex data
-	
+/*
+Description:
+	Describes the vertex layout to the program, for vertices starting offset bytes into the buffer bound to GL_ARRAY_BUFFER.
+	Records into whichever VAO is bound, so another VAO (eg. a DeformableMesh's) can draw a copy of the vertices with this asset's layout.
+*/
+void DSGraphics::ModelAsset::DescribeVertexLayout(GLintptr offset) const
+{
 	// Position
 	GLint posAttrib = glGetAttribLocation(mpProgram->GetProgramID(), "inPosition");
 	glEnableVertexAttribArray(posAttrib);
@@ -138,11 +211,11 @@ DSGraphics::ModelAsset::ModelAsset
 		GL_FLOAT,								//type of each component
 		GL_FALSE,								//should attribute (input) values be normalized?
 		mkDataBitsPerVertex * sizeof(GLfloat),	//stride (how many bytes between each position attribute in the array)
-		0										//array buffer offset
+		(void*)offset							//array buffer offset
 	);
 
 	//  Texture
-	if(mkHasTexture == true)
+	if(mkTextureCount > 0)
 	{
 		GLint texAttrib = glGetAttribLocation(mpProgram->GetProgramID(), "inTexCoord");
 		glEnableVertexAttribArray(texAttrib);
@@ -153,7 +226,7 @@ DSGraphics::ModelAsset::ModelAsset
 			GL_FLOAT,											//type of each component
 			GL_FALSE,											//should attribute (input) values be normalized?
 			mkDataBitsPerVertex * sizeof(GLfloat),				//stride (how many bytes between each position attribute in the array)
-			(void*)(mkTextureCoordsOffset * sizeof(GLfloat))	//array buffer offset
+			(void*)(offset + mkTextureCoordsOffset * sizeof(GLfloat))	//array buffer offset
 		);
 	}
 
@@ -169,43 +242,64 @@ DSGraphics::ModelAsset::ModelAsset
 			GL_FLOAT,								//type of each component
 			GL_FALSE,								//should attribute (input) values be normalized?
 			mkDataBitsPerVertex * sizeof(float),	//stride (how many bytes between each position attribute in the array)
-			(void*)(mkRgbaOffset * sizeof(GLfloat))	//array buffer offset
+			(void*)(offset + mkRgbaOffset * sizeof(GLfloat))	//array buffer offset
 		);
 	}
-
-	//Unbind the VBO and VAO
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindVertexArray(0);
 }
 
 //-----------------------------------------------------------------------------
-// Destructor
+
+/*
+Description:
+	The vertices as they were uploaded, mkDataBitsPerVertex floats each.
+	An asset loaded from a MeshFile keeps no CPU copy, so the first call reads one back from the VBO (once, and kept until the asset is destroyed).
+Notes:
+	Reading back stalls until the GPU has the VBO, so do it while loading or on first use, not every frame.
+*/
+const GLfloat* DSGraphics::ModelAsset::GetVertices()
+{
+	if(mpVertices == nullptr)
+	{
+		DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagMeshes);
+
+		GLsizeiptr bytes = sizeof(GLfloat) * mkVertexCount * mkDataBitsPerVertex;
+		mpVertices = static_cast<GLfloat*>(DSMemory::MemoryManager::GetHeap().Allocate(bytes));
+		glBindBuffer(GL_COPY_READ_BUFFER, mVbo);
+		glGetBufferSubData(GL_COPY_READ_BUFFER, 0, bytes, mpVertices);
+		glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	}
+
+	return mpVertices;
+}
+
 //-----------------------------------------------------------------------------
 
-DSGraphics::ModelAsset::~ModelAsset()
+/*
+Description:
+	The elements drawn (GetElementCountTotal of them, from GetDrawStart), or nullptr if the asset has none.
+	Like GetVertices, an asset loaded from a MeshFile reads them back from the EBO the first time.
+*/
+const GLuint* DSGraphics::ModelAsset::GetElements()
 {
-	if(mpVertices != nullptr)
+	if(mkHasElements == false)
 	{
-		delete[] mpVertices;
-		mpVertices = nullptr;
+		return nullptr;
 	}
-	if(mkHasElements == true)
+
+	if(mpElements == nullptr)
 	{
-		glDeleteBuffers(1, &mEbo);
-		if(mpElements != nullptr)
-		{
-			delete[] mpElements;
-			mpElements = nullptr;
-		}
+		DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagMeshes);
+
+		//Only the drawn LOD's elements, so mpElements always starts at the draw start
+		GLsizeiptr bytes = sizeof(GLuint) * mkElementCountTotal;
+		mpElements = static_cast<GLuint*>(DSMemory::MemoryManager::GetHeap().Allocate(bytes));
+		glBindBuffer(GL_COPY_READ_BUFFER, mEbo);
+		glGetBufferSubData(GL_COPY_READ_BUFFER, mDrawStart * sizeof(GLuint), bytes, mpElements);
+		glBindBuffer(GL_COPY_READ_BUFFER, 0);
 	}
-	glDeleteBuffers(1, &mVbo);
-	glDeleteVertexArrays(1, &mVao);
-}
 
-//-----------------------------------------------------------------------------
-// Public Member Functions
-//-----------------------------------------------------------------------------
-// General
+	return mpElements;
+}
 
 //-----------------------------------------------------------------------------
 // Private Member Functions
@@ -215,6 +309,65 @@ DSGraphics::ModelAsset::~ModelAsset()
 // Helper Functions
 //-----------------------------------------------------------------------------
 
+/*
+Description:
+	Creates the VAO, VBO and (if the asset has elements) EBO, and describes the vertex layout to the program.
+*/
+void DSGraphics::ModelAsset::CreateBuffers(const GLvoid* pVertices, size_t vertexBytes, const GLvoid* pElements, size_t elementBytes, const char* pName)
+{
+	//Vertex Array Object (VAO)
+	//Note:	VAOs store all of the links between attributes and their corresponding VBOs with raw vertex data.
+	// Creation
+	glGenVertexArrays(1, &mVao);
+	// Enable Usage (by binding)
+	glBindVertexArray(mVao);
+
+
+	//Vertex Buffer Object (VBO)
+	//Note:	Since OpenGL manages memory, GLuint vboTriangle is a positive number reference to the memory that the VBO will occupy.
+	// Creation
+	glGenBuffers(1, &mVbo);
+	// Set a specific VBO as the active object in the array buffer
+	glBindBuffer(GL_ARRAY_BUFFER, mVbo);
+	// Copy vertex data to the active object previously specified to the array buffer
+	DSGraphics::GpuMemory::BufferData
+	(
+		GL_ARRAY_BUFFER,												//currently active array buffer
+		mVbo,															//the buffer bound to it
+		vertexBytes,													//size of vertices data in bytes
+		pVertices,														//actual vertices data
+		GL_STATIC_DRAW,													//usage of vertex data
+		DSGraphics::kGpuMemoryVertex,									//accounted as
+		pName															//accounted to
+	);
+
+
+	//Element  Buffer Objects (EBO)
+	if(mkHasElements == true)
+	{
+		glGenBuffers(1, &mEbo);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mEbo);
+		DSGraphics::GpuMemory::BufferData
+		(
+			GL_ELEMENT_ARRAY_BUFFER,
+			mEbo,
+			elementBytes,
+			pElements,
+			GL_STATIC_DRAW,
+			DSGraphics::kGpuMemoryIndex,
+			pName
+		);
+	}
+
+
+	//Specify the layout of the vertex data
+	DescribeVertexLayout(0);
+
+	//Unbind the VBO and VAO
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
+}
+
 //-----------------------------------------------------------------------------
 // Getters
 //-----------------------------------------------------------------------------
@@ -228,7 +381,7 @@ GLuint DSGraphics::ModelAsset::GetProgramID() const
 
 bool DSGraphics::ModelAsset::GetHasTexture() const
 {
-	return mkHasTexture;
+	return mkTextureCount > 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -247,6 +400,24 @@ GLuint DSGraphics::ModelAsset::GetVao() const
 
 //-----------------------------------------------------------------------------
 
+GLuint DSGraphics::ModelAsset::GetVbo() const
+{
+	return mVbo;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	0 if the asset has no elements.
+*/
+GLuint DSGraphics::ModelAsset::GetEbo() const
+{
+	return mEbo;
+}
+
+//-----------------------------------------------------------------------------
+
 unsigned int DSGraphics::ModelAsset::GetVertexCount() const
 {
 	return mkVertexCount;
@@ -254,6 +425,20 @@ unsigned int DSGraphics::ModelAsset::GetVertexCount() const
 
 //-----------------------------------------------------------------------------
 
+unsigned int DSGraphics::ModelAsset::GetFloatsPerVertex() const
+{
+	return mkDataBitsPerVertex;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSGraphics::ModelAsset::GetPositionDimensions() const
+{
+	return mkPositionDimensions;
+}
+
+//-----------------------------------------------------------------------------
+
 bool DSGraphics::ModelAsset::GetHasElements() const
 {
 	return mkHasElements;
@@ -280,6 +465,45 @@ unsigned int DSGraphics::ModelAsset::GetElementCountPerDrawType() const
 	return mElementCountPerDrawType;
 }
 
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Offset, in elements, of the first element to draw.
+*/
+GLint DSGraphics::ModelAsset::GetDrawStart() const
+{
+	return mDrawStart;
+}
+
+//-----------------------------------------------------------------------------
+
+const glm::vec3& DSGraphics::ModelAsset::GetBoundsMin() const
+{
+	return mBoundsMin;
+}
+
+//-----------------------------------------------------------------------------
+
+const glm::vec3& DSGraphics::ModelAsset::GetBoundsMax() const
+{
+	return mBoundsMax;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSGraphics::ModelAsset::GetLodCount() const
+{
+	return static_cast<unsigned int>(mLods.size());
+}
+
+//-----------------------------------------------------------------------------
+
+const DSGraphics::MeshFileLod& DSGraphics::ModelAsset::GetLod(unsigned int lod) const
+{
+	return mLods[lod];
+}
+
 //-----------------------------------------------------------------------------
 // Setters
 //-----------------------------------------------------------------------------
\ No newline at end of file
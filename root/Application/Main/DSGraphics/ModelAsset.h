@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		ModelAsset.h
 // Created:		2015/02/15
-// Last Edited:	2015/05/07
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	ModelAsset
 //=============================================================================
@@ -17,7 +17,14 @@
 //  GLEW
 #include <GL/glew.h>
 
+//  GLM
+#include <glm/glm.hpp>
+
+// Standard C++ Libraries
+#include <vector>
+
 // Daniel Schenker
+#include "MeshFile.h"
 #include "Program.h"
 #include "Texture.h"
 
@@ -62,23 +69,49 @@ namespace DSGraphics
 			unsigned int elementCountTotal,
 			GLuint* pElements,
 			GLenum drawType,
-			unsigned int elementCountPerDrawType
+			unsigned int elementCountPerDrawType,
+			const char* pName//what GpuMemory accounts the buffers to
+		);
+		ModelAsset
+		(
+			DSGraphics::Program* pProgram,
+			DSGraphics::Texture* pTexture,
+			const DSGraphics::MeshFile& mesh,
+			const char* pName
 		);
 		//Destructor
 		~ModelAsset();
 
 		//Member Functions
+	private:
+		// Helpers
+		void CreateBuffers(const GLvoid* pVertices, size_t vertexBytes, const GLvoid* pElements, size_t elementBytes, const char* pName);
+
 	public:
+		// General
+		void DescribeVertexLayout(GLintptr offset) const;
+		const GLfloat* GetVertices();
+		const GLuint* GetElements();
+
 		// Getters
 		GLuint GetProgramID() const;
 		bool GetHasTexture() const;
 		GLuint GetTextureObjectID() const;
 		GLuint GetVao() const;
+		GLuint GetVbo() const;
+		GLuint GetEbo() const;
 		unsigned int GetVertexCount() const;
+		unsigned int GetFloatsPerVertex() const;
+		unsigned int GetPositionDimensions() const;
 		bool GetHasElements() const;
 		unsigned int GetElementCountTotal() const;
 		GLenum GetDrawType() const;
 		unsigned int GetElementCountPerDrawType() const;
+		GLint GetDrawStart() const;
+		const glm::vec3& GetBoundsMin() const;
+		const glm::vec3& GetBoundsMax() const;
+		unsigned int GetLodCount() const;
+		const DSGraphics::MeshFileLod& GetLod(unsigned int lod) const;
 		// Setters
 
 		//Member Variables
@@ -100,18 +133,23 @@ namespace DSGraphics
 		const unsigned int mkPositionDimensions;
 		const unsigned int mkTextureDimensions;
 		const unsigned int mkColorDimensions;
-		GLfloat* mpVertices;//TODO: change this to be a vector or something that knows the length of the array
+		GLfloat* mpVertices;//TODO: change this to be a vector or something that knows the length of the array. nullptr when loaded from a MeshFile, which has no CPU copy, until GetVertices reads one back.
 		// VBO
 		GLuint mVbo;
 		// Elements
 		const bool mkHasElements;
 		GLuint mEbo;
 		const unsigned int mkElementCountTotal;
-		GLuint* mpElements;//TODO: make same change as with mpVertices
+		GLuint* mpElements;//TODO: make same change as with mpVertices. Only the drawn LOD's, once GetElements reads them back.
 		// Draw Info
 		GLenum mDrawType;
 		unsigned int mElementCountPerDrawType;//CHECK: is this safe for all type? eg, I doubt it's safe for line segments created from rectangles that are not square
-		GLint mDrawStart;
+		GLint mDrawStart;//first element drawn (of the most detailed LOD)
+		// Bounds
+		glm::vec3 mBoundsMin;
+		glm::vec3 mBoundsMax;
+		// LODs
+		std::vector<DSGraphics::MeshFileLod> mLods;
 	};
 
 }//namespace DSGraphics
@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		ModelInstance.cpp
 // Created:		2015/02/15
-// Last Edited:	2015/02/23
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	ModelInstance
 //=============================================================================
@@ -12,11 +12,11 @@
 
 // Third-Party Libraries
 //  GLM
-#include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
 // Daniel Schenker
 #include "ModelInstance.h"
+#include "DeformableMesh.h"
 #include "Program.h"
 
 //#define BUFFER_OFFSET(i) ((unsigned int*)NULL + (i))
@@ -33,26 +33,21 @@
 // Constuctors
 //-----------------------------------------------------------------------------
 
-DSGraphics::ModelInstance::ModelInstance(DSGraphics::ModelAsset* pAsset, DSGraphics::Camera* pCamera)
+DSGraphics::ModelInstance::ModelInstance(DSGraphics::ModelHandle model, DSGraphics::Camera* pCamera)
 //Externally Accessible (not encapsulated)
-:	mpAsset(pAsset)
+:	mModel(model)
 ,	mSize(1.0f)
-,	mOrientationAngle(0.0f)
-,	mOrientationAxis(0.0f, 1.0f, 0.0f)
-//,	mOrientation(0.0f)
+,	mOrientation()
 ,	mPosition(0.0f)
+,	mHasPreviousState(false)
+,	mPreviousSize(1.0f)
+,	mPreviousOrientation()
+,	mPreviousPosition(0.0f)
 ,	mpCamera(pCamera)
+,	mpDeformableMesh(nullptr)
 //Externally Inaccessible (encapsulated)
 ,	mTransform(1.0f)
-,	mScale(1.0f)
-,	mSizeUpdated(false)
-,	mRotate(1.0f)
-//,	mRotationAxis(0.0f)
-,	mOrientationUpdated(false)
-,	mTranslate(1.0f)
-,	mPositionUpdated(false)
-,	mUniformModel(0)
-,	mUniformCamera(0)
+,	mTransformOutdated(false)
 {
 }
 
@@ -71,43 +66,77 @@ DSGraphics::ModelInstance::~ModelInstance()
 
 void DSGraphics::ModelInstance::UpdateTransform()
 {
-	UpdateScale();
-	UpdateRotate();
-	UpdateTranslate();
+	if(mTransformOutdated == true)
+	{
+		mTransform = ComposeTransform(mSize, mOrientation, mPosition);
 
-	mTransform = mTranslate * mRotate * mScale;
+		mTransformOutdated = false;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Remembers the current size, orientation and position as the previous simulation step.
+	Called at the start of every fixed simulation step, before anything moves.
+*/
+void DSGraphics::ModelInstance::StorePreviousState()
+{
+	mPreviousSize = mSize;
+	mPreviousOrientation = mOrientation;
+	mPreviousPosition = mPosition;
+	mHasPreviousState = true;
 }
 
 //-----------------------------------------------------------------------------
 
-void DSGraphics::ModelInstance::Render()
+/*
+Variables:
+	interpolation = how far between the previous and the latest simulation step to draw the instance, where 1 is the latest.
+*/
+void DSGraphics::ModelInstance::Render(float interpolation) const
 {
+	const DSGraphics::ModelAsset* pAsset = DSGraphics::AssetManager::Get(mModel);
+	if(pAsset == nullptr)
+	{
+		return;
+	}
+
 	//Bind the shaders
-	glUseProgram(mpAsset->GetProgramID());
+	glUseProgram(pAsset->GetProgramID());
 
 	//Set the Shader Uniforms
 	if(mpCamera != nullptr)
 	{
 		//Camera
-		mUniformCamera = glGetUniformLocation(mpAsset->GetProgramID(), "camera");
-		glUniformMatrix4fv(mUniformCamera, 1, GL_FALSE, glm::value_ptr(mpCamera->GetMatrix()));
+		GLint uniformCamera = glGetUniformLocation(pAsset->GetProgramID(), "camera");
+		glUniformMatrix4fv(uniformCamera, 1, GL_FALSE, glm::value_ptr(mpCamera->GetMatrix()));
 		//Model
-		mUniformModel = glGetUniformLocation(mpAsset->GetProgramID(), "model");
-		glUniformMatrix4fv(mUniformModel, 1, GL_FALSE, glm::value_ptr(mTransform));
+		GLint uniformModel = glGetUniformLocation(pAsset->GetProgramID(), "model");
+		//  The shader takes a full mat4, so the implicit bottom row (0, 0, 0, 1) is added back here.
+		if(interpolation < 1.0f)
+		{
+			glUniformMatrix4fv(uniformModel, 1, GL_FALSE, glm::value_ptr(glm::mat4(GetInterpolatedTransform(interpolation))));
+		}
+		else
+		{
+			glUniformMatrix4fv(uniformModel, 1, GL_FALSE, glm::value_ptr(glm::mat4(mTransform)));
+		}
 	}
 	//  Texture
-	if(mpAsset->GetHasTexture() == true)
+	if(pAsset->GetHasTexture() == true)
 	{
-		glUniform1i(glGetUniformLocation(mpAsset->GetProgramID(), "tex"), 0);
+		glUniform1i(glGetUniformLocation(pAsset->GetProgramID(), "tex"), 0);
 
 	//Bind
 		// Texture
 		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, mpAsset->GetTextureObjectID());
+		glBindTexture(GL_TEXTURE_2D, pAsset->GetTextureObjectID());
 		//TODO:	The above line is where I specify which texture to use when drawing.
-		//		Currently mpAsset only holds one texture, so the GetTexture function chooses the only one.
+		//		Currently pAsset only holds one texture, so the GetTexture function chooses the only one.
 		//		Instead the GetTexture function should ask the instance which texture to use based on the state of the instance.
-		//		This means that the mpAsset holds a list of textures for every possible state of the instance, and can choose whichever one is necessary based on the passed in texture number.
+		//		This means that the pAsset holds a list of textures for every possible state of the instance, and can choose whichever one is necessary based on the passed in texture number.
 		//		This also means that animation is done by swapping out which texture is used. This means that all textures must use the same texture coordinates, which causes problems in two ways:
 		//			1.	Texture sheets with multiple textures crammed into one sheet for efficiency (eg. numbers 0-9 all squeezed into one image for scoreboard usage) can not be used
 		//				since that requires being able to specify texture coordinates on the fly.
@@ -122,38 +151,47 @@ void DSGraphics::ModelInstance::Render()
 		//		This is because every "instance" in a soft body physics system is its own asset, since no two instances are alike, compared to rigid body physics where two objects (eg. a coffee mug) are identical, with the exception of SRT (scale, rotation and translation), because their model and texture/colour are the same.
 	}
 	// VAO
-	glBindVertexArray(mpAsset->GetVao());
+	//  A deformed instance's own vertices, laid out like the model's
+	if(mpDeformableMesh != nullptr && mpDeformableMesh->GetIsCopied() == true)
+	{
+		glBindVertexArray(mpDeformableMesh->GetVao());
+	}
+	else
+	{
+		glBindVertexArray(pAsset->GetVao());
+	}
 
 	//Draw
 	// Elements
-	if(mpAsset->GetHasElements() == true)
+	if(pAsset->GetHasElements() == true)
 	{
-		unsigned int elementCountPerDrawType = mpAsset->GetElementCountPerDrawType();
-		unsigned int elementCountTotal = mpAsset->GetElementCountTotal();
+		unsigned int elementCountPerDrawType = pAsset->GetElementCountPerDrawType();
+		unsigned int elementCountTotal = pAsset->GetElementCountTotal();
+		unsigned int drawStart = static_cast<unsigned int>(pAsset->GetDrawStart());
 
 		if(elementCountPerDrawType == 0)
 		{
-			glDrawElements(mpAsset->GetDrawType(), mpAsset->GetElementCountTotal(), GL_UNSIGNED_INT, 0);
+			glDrawElements(pAsset->GetDrawType(), pAsset->GetElementCountTotal(), GL_UNSIGNED_INT, reinterpret_cast<void*>(drawStart * sizeof(GLuint)));
 		}
 		else
 		{
 			for(unsigned int drawn = 0; drawn < elementCountTotal; drawn += elementCountPerDrawType)
 			{
-				//glDrawElements(mpAsset->GetDrawType(), elementCountPerDrawType, GL_UNSIGNED_INT, BUFFER_OFFSET(drawn));
-				glDrawElements(mpAsset->GetDrawType(), elementCountPerDrawType, GL_UNSIGNED_INT, reinterpret_cast<void*>(drawn * sizeof(GLuint)));
-				//glDrawElements(mpAsset->GetDrawType(), elementCountPerDrawType, GL_UNSIGNED_INT, drawn * sizeof(GLuint));
+				//glDrawElements(pAsset->GetDrawType(), elementCountPerDrawType, GL_UNSIGNED_INT, BUFFER_OFFSET(drawn));
+				glDrawElements(pAsset->GetDrawType(), elementCountPerDrawType, GL_UNSIGNED_INT, reinterpret_cast<void*>((drawStart + drawn) * sizeof(GLuint)));
+				//glDrawElements(pAsset->GetDrawType(), elementCountPerDrawType, GL_UNSIGNED_INT, drawn * sizeof(GLuint));
 			}
 		}
 	}
 	// Arrays
 	else
 	{
-		glDrawArrays(mpAsset->GetDrawType(), 0, mpAsset->GetVertexCount());
+		glDrawArrays(pAsset->GetDrawType(), 0, pAsset->GetVertexCount());
 	}
 
 	//Unbind
 	glBindVertexArray(0);
-	if(mpAsset->GetHasTexture() == true)
+	if(pAsset->GetHasTexture() == true)
 	{
 		glBindTexture(GL_TEXTURE_2D, 0);
 	}
@@ -166,65 +204,103 @@ void DSGraphics::ModelInstance::Render()
 void DSGraphics::ModelInstance::Move(glm::vec3 displacement, float deviceCoordinatesPerMeter)
 {
 	mPosition += displacement * deviceCoordinatesPerMeter;
-	mPositionUpdated = true;
+	mTransformOutdated = true;
 }
 
 //-----------------------------------------------------------------------------
 
-void DSGraphics::ModelInstance::Spin(float radians)
+/*
+Variables:
+	radians = how far to spin, added on top of the current orientation.
+	axis = world axis to spin around. Must be unit length.
+*/
+void DSGraphics::ModelInstance::Spin(float radians, const glm::vec3& axis)
 {
-	mRotate = glm::rotate(mRotate, radians, mOrientationAxis);
-	
+	Rotate(DSMathematics::Quaternion(radians, axis));
 }
 
 //-----------------------------------------------------------------------------
-// Private Member Functions
-//-----------------------------------------------------------------------------
-//  UpdateTransform Sub-Functions
 
-void DSGraphics::ModelInstance::UpdateScale()
+/*
+Description:
+	Applies rotation after the current orientation, so any number of rotations around any axes can be composed.
+*/
+void DSGraphics::ModelInstance::Rotate(const DSMathematics::Quaternion& rotation)
 {
-	if(mSizeUpdated == true)
-	{
-		mScale = glm::scale(glm::mat4(1.0f), mSize);
-
-		mSizeUpdated = false;
-	}
+	mOrientation = mOrientation.Multiply(rotation);
+	mTransformOutdated = true;
 }
 
 //-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Render Sub-Functions
 
-void DSGraphics::ModelInstance::UpdateRotate()
+/*
+Description:
+	Blends the previous and latest simulation steps.
+	Instances that did not change between the two steps (the vast majority) reuse mTransform.
+*/
+glm::mat4x3 DSGraphics::ModelInstance::GetInterpolatedTransform(float interpolation) const
 {
-	if(mOrientationUpdated == true)
+	if
+	(
+		mHasPreviousState == false
+	||	(mPreviousPosition == mPosition && mPreviousSize == mSize && mPreviousOrientation.mW == mOrientation.mW && mPreviousOrientation.mV == mOrientation.mV)
+	)
 	{
-		//TODO: TOFIX: Can't remember if any orientation can be represented by the sum or multiplication of rotating around each axis... ??? or something totally different
-
-		//Rotate around x
-		//mRotate = glm::rotate(glm::mat4(1.0f), glm::radians(mOrientation.x), glm::vec3(1.0f, 0.0f, 0.0f));
-		//Rotate around y
-		//Rotate around z
+		return mTransform;
+	}
 
-		mRotate = glm::rotate(glm::mat4(1.0f), mOrientationAngle, mOrientationAxis);
+	glm::vec3 size = glm::mix(mPreviousSize, mSize, interpolation);
+	glm::vec3 position = glm::mix(mPreviousPosition, mPosition, interpolation);
+	//Steps are short, so normalized linear interpolation is indistinguishable from slerp here
+	DSMathematics::Quaternion orientation = mPreviousOrientation.Nlerp(mOrientation, interpolation);
 
-		mOrientationUpdated = false;
-	}
+	return ComposeTransform(size, orientation, position);
 }
 
+//-----------------------------------------------------------------------------
+// Helper Functions
 //-----------------------------------------------------------------------------
 
-void DSGraphics::ModelInstance::UpdateTranslate()
+/*
+Description:
+	Builds translate * rotate * scale in one step, writing each element directly instead of building and multiplying three 4x4 matrices.
+	Each rotation column is scaled by the matching size component, and the position is the last column.
+Notes:
+	Scaling by 2 / |q|^2 instead of 2 keeps the result a pure rotation even if the quaternion has drifted from unit length.
+*/
+glm::mat4x3 DSGraphics::ModelInstance::ComposeTransform(const glm::vec3& size, const DSMathematics::Quaternion& orientation, const glm::vec3& position)
 {
-	if(mPositionUpdated == true)
-	{
-		mTranslate = glm::translate(glm::mat4(1.0f), mPosition);
-
-		mPositionUpdated = false;
-	}
+	const float w = orientation.mW;
+	const float x = orientation.mV.x;
+	const float y = orientation.mV.y;
+	const float z = orientation.mV.z;
+
+	float s = 2.0f / (w * w + x * x + y * y + z * z);
+	float xs = x * s;
+	float ys = y * s;
+	float zs = z * s;
+	float xx = x * xs;
+	float yy = y * ys;
+	float zz = z * zs;
+	float xy = x * ys;
+	float xz = x * zs;
+	float yz = y * zs;
+	float wx = w * xs;
+	float wy = w * ys;
+	float wz = w * zs;
+
+	return glm::mat4x3
+	(
+		(1.0f - (yy + zz)) * size.x,	(xy + wz) * size.x,				(xz - wy) * size.x,
+		(xy - wz) * size.y,				(1.0f - (xx + zz)) * size.y,	(yz + wx) * size.y,
+		(xz + wy) * size.z,				(yz - wx) * size.z,				(1.0f - (xx + yy)) * size.z,
+		position.x,						position.y,						position.z
+	);
 }
 
-//-----------------------------------------------------------------------------
-// Helper Functions
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
@@ -238,32 +314,34 @@ glm::vec3 DSGraphics::ModelInstance::GetSize() const
 
 //-----------------------------------------------------------------------------
 
-/*
-glm::vec3 DSGraphics::ModelInstance::GetOrientation() const
+const DSMathematics::Quaternion& DSGraphics::ModelInstance::GetOrientation() const
 {
 	return mOrientation;
 }
-*/
 
 //-----------------------------------------------------------------------------
 
-GLfloat DSGraphics::ModelInstance::GetOrientationAngleInRadians() const
+glm::vec3 DSGraphics::ModelInstance::GetPosition() const
 {
-	return mOrientationAngle;
+	return mPosition;
 }
 
 //-----------------------------------------------------------------------------
 
-glm::vec3 DSGraphics::ModelInstance::GetOrientationAxis() const
+/*
+Notes:
+	Only up to date after UpdateTransform.
+*/
+const glm::mat4x3& DSGraphics::ModelInstance::GetTransform() const
 {
-	return mOrientationAxis;
+	return mTransform;
 }
 
 //-----------------------------------------------------------------------------
 
-glm::vec3 DSGraphics::ModelInstance::GetPosition() const
+DSGraphics::DeformableMesh* DSGraphics::ModelInstance::GetDeformableMesh() const
 {
-	return mPosition;
+	return mpDeformableMesh;
 }
 
 //-----------------------------------------------------------------------------
@@ -273,39 +351,36 @@ glm::vec3 DSGraphics::ModelInstance::GetPosition() const
 void DSGraphics::ModelInstance::SetSize(const glm::vec3& size)
 {
 	mSize = size;
-	mSizeUpdated = true;
+	mTransformOutdated = true;
 }
 
 //-----------------------------------------------------------------------------
 
-void DSGraphics::ModelInstance::SetOrientationAngle(GLfloat radians)
+/*
+Variables:
+	orientation = absolute orientation. Expected to be unit length.
+*/
+void DSGraphics::ModelInstance::SetOrientation(const DSMathematics::Quaternion& orientation)
 {
-	mOrientationAngle = radians;
-	mOrientationUpdated = true;
+	mOrientation = orientation;
+	mTransformOutdated = true;
 }
 
 //-----------------------------------------------------------------------------
 
-void DSGraphics::ModelInstance::SetOrientationAxis(const glm::vec3& rotationAxis)
+void DSGraphics::ModelInstance::SetPosition(const glm::vec3& position)
 {
-	mOrientationAxis = rotationAxis;
-	mOrientationUpdated = true;
+	mPosition = position;
+	mTransformOutdated = true;
 }
 
 //-----------------------------------------------------------------------------
 
 /*
-void DSGraphics::ModelInstance::SetOrientation(const glm::vec3& orientation)
-{
-	mOrientation = orientation;
-	mOrientationUpdated = true;
-}
+Variables:
+	pMesh = a DeformableMesh of this instance's model, or nullptr to draw the model's own vertices. Must outlive the instance or be unset first.
 */
-
-//-----------------------------------------------------------------------------
-
-void DSGraphics::ModelInstance::SetPosition(const glm::vec3& position)
+void DSGraphics::ModelInstance::SetDeformableMesh(DSGraphics::DeformableMesh* pMesh)
 {
-	mPosition = position;
-	mPositionUpdated = true;
-}
+	mpDeformableMesh = pMesh;
+}
\ No newline at end of file
@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		ModelInstance.h
 // Created:		2015/02/15
-// Last Edited:	2015/02/23
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	ModelInstance
 //=============================================================================
@@ -18,13 +18,20 @@
 #include <glm/glm.hpp>
 
 // Daniel Schenker
+#include "AssetManager.h"
 #include "Camera.h"
 #include "ModelAsset.h"
+#include "../DSMathematics/Quaternion.h"
 
 //=============================================================================
 //Forward Declarations
 //=============================================================================
 
+namespace DSGraphics
+{
+	class DeformableMesh;
+}
+
 //=============================================================================
 //Namespace
 //=============================================================================
@@ -44,7 +51,7 @@ namespace DSGraphics
 	{
 	public:
 		//Constructors
-		ModelInstance(DSGraphics::ModelAsset* mpAsset, DSGraphics::Camera* mpCamera = nullptr);
+		ModelInstance(DSGraphics::ModelHandle model, DSGraphics::Camera* mpCamera = nullptr);
 		//Destructor
 		~ModelInstance();
 
@@ -52,66 +59,64 @@ namespace DSGraphics
 		//Member Functions
 		// General
 		void UpdateTransform();
-		void Render();
+		void StorePreviousState();
+		void Render(float interpolation = 1.0f) const;
 
 		// Locomotion
 		void Move(glm::vec3 displacement, float deviceCoordinatesPerMeter = 1);
-		void Spin(float radians);//Not called turning because this is more like turning on the spot, rather than a proper turn that usually invovles some displacement.
+		void Spin(float radians, const glm::vec3& axis = glm::vec3(0.0f, 1.0f, 0.0f));//Not called turning because this is more like turning on the spot, rather than a proper turn that usually invovles some displacement.
+		void Rotate(const DSMathematics::Quaternion& rotation);
 
 	private:
-		// UpdateTransform Sub-Functions
-		void UpdateScale();
-		void UpdateRotate();
-		void UpdateTranslate();
+		// Render Sub-Functions
+		glm::mat4x3 GetInterpolatedTransform(float interpolation) const;
+
+		// Helper Functions
+		static glm::mat4x3 ComposeTransform(const glm::vec3& size, const DSMathematics::Quaternion& orientation, const glm::vec3& position);
 	
 	public:
 		// Getters
 		glm::vec3 GetSize() const;
-		//glm::vec3 GetOrientation() const;
-		GLfloat GetOrientationAngleInRadians() const;
-		glm::vec3 GetOrientationAxis() const;
+		const DSMathematics::Quaternion& GetOrientation() const;
 		glm::vec3 GetPosition() const;
+		const glm::mat4x3& GetTransform() const;
+		DSGraphics::DeformableMesh* GetDeformableMesh() const;
 
 		// Setters
 		void SetSize(const glm::vec3& size);
-		//void SetOrientation(const glm::vec3& orientation);
-		void SetOrientationAngle(GLfloat radians);
-		void SetOrientationAxis(const glm::vec3& rotationAxis);
+		void SetOrientation(const DSMathematics::Quaternion& orientation);
 		void SetPosition(const glm::vec3& position);
+		void SetDeformableMesh(DSGraphics::DeformableMesh* pMesh);
 
 		//Member Variables
 	private:
 		//Externally Accessible (not encapsulated)
 			// Model Asset
-			DSGraphics::ModelAsset* mpAsset;
+			//  Not a reference; whoever loaded the model keeps it alive. Once it is unloaded the instance simply stops drawing.
+			DSGraphics::ModelHandle mModel;
 
 			glm::vec3 mSize;
-			//glm::vec3 mOrientation;
-			GLfloat mOrientationAngle;
-			glm::vec3 mOrientationAxis;
+			DSMathematics::Quaternion mOrientation;
 			glm::vec3 mPosition;
 
+			// Previous Simulation Step (for render interpolation)
+			bool mHasPreviousState;
+			glm::vec3 mPreviousSize;
+			DSMathematics::Quaternion mPreviousOrientation;
+			glm::vec3 mPreviousPosition;
+
 			// Camera
 			DSGraphics::Camera* mpCamera;
 
+			// Deformable Mesh
+			//  Not owned. Drawn instead of the model's vertices once it has deformed; the model still provides everything else.
+			DSGraphics::DeformableMesh* mpDeformableMesh;
+
 		//Externally Inaccessible (encapsulated)
 			// Model Matrix
-			glm::mat4 mTransform;
-			//  Scale
-			glm::mat4 mScale;
-			bool mSizeUpdated;
-			//  Rotate
-			glm::mat4 mRotate;
-			//glm::vec3 mRotationAxis;
-			bool mOrientationUpdated;
-			//  Translate
-			glm::mat4 mTranslate;
-			bool mPositionUpdated;
-			//  Shader Uniform
-			GLuint mUniformModel;
-		
-			//  Shader Uniform
-			GLuint mUniformCamera;
+			//  Affine, so only the top three rows are stored (4 columns x 3 rows). Composed directly from size, orientation and position.
+			glm::mat4x3 mTransform;
+			bool mTransformOutdated;
 	};
 
 }//namespace DSGraphics
@@ -0,0 +1,267 @@
+//=============================================================================
+// File:		PixelConversion.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	PixelConversion
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Platform
+#include "../DSSystem/Platform.h"
+#if defined(DS_SSE2)
+	#include <tmmintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
+// Standard C++ Libraries
+#include <cstring>
+
+// Daniel Schenker
+#include "PixelConversion.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	bool DetectSsse3()
+	{
+#if defined(DS_SSE2)
+	#if defined(_MSC_VER)
+		int info[4] = {};
+		__cpuid(info, 1);
+		return (info[2] & (1 << 9)) != 0;
+	#else
+		unsigned int eax = 0;
+		unsigned int ebx = 0;
+		unsigned int ecx = 0;
+		unsigned int edx = 0;
+		return __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & (1 << 9)) != 0;
+	#endif
+#else
+		return false;
+#endif
+	}
+
+	//Decided once, before main, so the conversions never ask again
+	const bool sHasSsse3 = DetectSsse3();
+
+	//x * a / 255, rounded to nearest, without a division
+	DS_FORCEINLINE unsigned char MultiplyAlpha(unsigned int x, unsigned int a)
+	{
+		unsigned int t = x * a + 128;
+		return static_cast<unsigned char>((t + (t >> 8)) >> 8);
+	}
+
+#if defined(DS_SSE2)
+	//16 pixels (48 bytes in, 64 out) per iteration. Each load takes 16 bytes but only uses 12, so the loop stops while 4 spare bytes remain.
+	DS_TARGET("ssse3") size_t RgbToRgbaSsse3(const unsigned char* pSource, unsigned char* pDestination, size_t pixelCount)
+	{
+		const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+		const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+		size_t i = 0;
+		for(; i + 18 <= pixelCount; i += 16)
+		{
+			const unsigned char* pRgb = pSource + i * 3;
+			unsigned char* pRgba = pDestination + i * 4;
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pRgba + 0), _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pRgb + 0)), shuffle), alpha));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pRgba + 16), _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pRgb + 12)), shuffle), alpha));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pRgba + 32), _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pRgb + 24)), shuffle), alpha));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pRgba + 48), _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pRgb + 36)), shuffle), alpha));
+		}
+		return i;
+	}
+#endif
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  Conversions
+
+/*
+Description:
+	Each gray byte g becomes g, g, g, 255.
+*/
+void DSGraphics::PixelConversion::GrayToRgba(const unsigned char* pSource, unsigned char* pDestination, size_t pixelCount)
+{
+	size_t i = 0;
+
+#if defined(DS_SSE2)
+	const __m128i opaque = _mm_set1_epi8(-1);
+	for(; i + 16 <= pixelCount; i += 16)
+	{
+		__m128i gray = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + i));
+		//Pairs of (g, g) and (g, 255), interleaved into (g, g, g, 255)
+		__m128i grayGrayLow = _mm_unpacklo_epi8(gray, gray);
+		__m128i grayGrayHigh = _mm_unpackhi_epi8(gray, gray);
+		__m128i grayOpaqueLow = _mm_unpacklo_epi8(gray, opaque);
+		__m128i grayOpaqueHigh = _mm_unpackhi_epi8(gray, opaque);
+
+		unsigned char* pRgba = pDestination + i * 4;
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pRgba + 0), _mm_unpacklo_epi16(grayGrayLow, grayOpaqueLow));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pRgba + 16), _mm_unpackhi_epi16(grayGrayLow, grayOpaqueLow));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pRgba + 32), _mm_unpacklo_epi16(grayGrayHigh, grayOpaqueHigh));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pRgba + 48), _mm_unpackhi_epi16(grayGrayHigh, grayOpaqueHigh));
+	}
+#endif
+
+	for(; i < pixelCount; ++i)
+	{
+		unsigned char gray = pSource[i];
+		pDestination[i * 4 + 0] = gray;
+		pDestination[i * 4 + 1] = gray;
+		pDestination[i * 4 + 2] = gray;
+		pDestination[i * 4 + 3] = 255;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Each g, a pair becomes g, g, g, a.
+*/
+void DSGraphics::PixelConversion::GrayAlphaToRgba(const unsigned char* pSource, unsigned char* pDestination, size_t pixelCount)
+{
+	size_t i = 0;
+
+#if defined(DS_SSE2)
+	const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+	for(; i + 16 <= pixelCount; i += 16)
+	{
+		unsigned char* pRgba = pDestination + i * 4;
+		for(unsigned int half = 0; half < 2; ++half)
+		{
+			//As 16 bit words each pixel already is (g, a), the top half of its RGBA. The bottom half is (g, g).
+			__m128i grayAlpha = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + (i + half * 8) * 2));
+			__m128i gray = _mm_and_si128(grayAlpha, lowBytes);
+			__m128i grayGray = _mm_or_si128(gray, _mm_slli_epi16(gray, 8));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pRgba + half * 32 + 0), _mm_unpacklo_epi16(grayGray, grayAlpha));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pRgba + half * 32 + 16), _mm_unpackhi_epi16(grayGray, grayAlpha));
+		}
+	}
+#endif
+
+	for(; i < pixelCount; ++i)
+	{
+		unsigned char gray = pSource[i * 2 + 0];
+		pDestination[i * 4 + 0] = gray;
+		pDestination[i * 4 + 1] = gray;
+		pDestination[i * 4 + 2] = gray;
+		pDestination[i * 4 + 3] = pSource[i * 2 + 1];
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Each r, g, b triple becomes r, g, b, 255.
+*/
+void DSGraphics::PixelConversion::RgbToRgba(const unsigned char* pSource, unsigned char* pDestination, size_t pixelCount)
+{
+	size_t i = 0;
+
+#if defined(DS_SSE2)
+	if(sHasSsse3 == true)
+	{
+		i = RgbToRgbaSsse3(pSource, pDestination, pixelCount);
+	}
+#endif
+
+	for(; i < pixelCount; ++i)
+	{
+		pDestination[i * 4 + 0] = pSource[i * 3 + 0];
+		pDestination[i * 4 + 1] = pSource[i * 3 + 1];
+		pDestination[i * 4 + 2] = pSource[i * 3 + 2];
+		pDestination[i * 4 + 3] = 255;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	pPalette = 256 RGBA entries. Entries past the image's palette should be opaque black, so corrupt indices stay harmless.
+*/
+void DSGraphics::PixelConversion::PaletteToRgba(const unsigned char* pSource, const uint32_t* pPalette, unsigned char* pDestination, size_t pixelCount)
+{
+	for(size_t i = 0; i < pixelCount; ++i)
+	{
+		memcpy(pDestination + i * 4, &pPalette[pSource[i]], 4);
+	}
+}
+
+//-----------------------------------------------------------------------------
+//  Alpha
+
+/*
+Description:
+	Multiplies r, g and b of every RGBA pixel by its alpha, in place, so the texture filters and blends correctly with GL_ONE, GL_ONE_MINUS_SRC_ALPHA.
+*/
+void DSGraphics::PixelConversion::PremultiplyAlpha(unsigned char* pPixels, size_t pixelCount)
+{
+	size_t i = 0;
+
+#if defined(DS_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i rounding = _mm_set1_epi16(128);
+	const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000));
+	for(; i + 4 <= pixelCount; i += 4)
+	{
+		__m128i* pRgba = reinterpret_cast<__m128i*>(pPixels + i * 4);
+		__m128i pixels = _mm_loadu_si128(pRgba);
+
+		//Two pixels per register as 16 bit channels, times their alpha broadcast to every channel
+		__m128i low = _mm_unpacklo_epi8(pixels, zero);
+		__m128i high = _mm_unpackhi_epi8(pixels, zero);
+		__m128i alphaLow = _mm_shufflehi_epi16(_mm_shufflelo_epi16(low, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		__m128i alphaHigh = _mm_shufflehi_epi16(_mm_shufflelo_epi16(high, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		low = _mm_add_epi16(_mm_mullo_epi16(low, alphaLow), rounding);
+		high = _mm_add_epi16(_mm_mullo_epi16(high, alphaHigh), rounding);
+
+		//Divide by 255 the same way as MultiplyAlpha
+		low = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+		high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+
+		//Keep the original alpha
+		__m128i result = _mm_packus_epi16(low, high);
+		result = _mm_or_si128(_mm_andnot_si128(alphaMask, result), _mm_and_si128(alphaMask, pixels));
+		_mm_storeu_si128(pRgba, result);
+	}
+#endif
+
+	for(; i < pixelCount; ++i)
+	{
+		unsigned char* pRgba = pPixels + i * 4;
+		unsigned int alpha = pRgba[3];
+		pRgba[0] = MultiplyAlpha(pRgba[0], alpha);
+		pRgba[1] = MultiplyAlpha(pRgba[1], alpha);
+		pRgba[2] = MultiplyAlpha(pRgba[2], alpha);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+bool DSGraphics::PixelConversion::GetHasSsse3()
+{
+	return sHasSsse3;
+}
\ No newline at end of file
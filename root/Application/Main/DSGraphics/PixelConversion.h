@@ -0,0 +1,66 @@
+//=============================================================================
+// File:		PixelConversion.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	PixelConversion. Expands rows of 8 bit gray, gray alpha, RGB and palette pixels to RGBA, and premultiplies alpha.
+//=============================================================================
+
+#ifndef PIXELCONVERSION_H
+#define PIXELCONVERSION_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSGraphics
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		The conversions Texture needs between what libpng decodes and the RGBA it uploads, done a register of pixels at a time with SSE2,
+		and RGB with an SSSE3 byte shuffle on processors that have it (chosen at run time). Palettes are a table lookup per pixel.
+	Usage:
+		DSGraphics::PixelConversion::RgbToRgba(pRgbRow, pRgbaRow, width);
+		DSGraphics::PixelConversion::PremultiplyAlpha(pRgbaRow, width);
+	Notes:
+		Source and destination must not overlap. Neither needs to be aligned.
+		Bytes are in memory order (R, G, B, A), so a palette entry is the four bytes of an RGBA pixel.
+		Every conversion has a plain C++ fallback, used for the last few pixels of a row and when DS_SSE2 is not defined.
+	*/
+	class PixelConversion
+	{
+	private:
+		//Constructors
+		PixelConversion();
+
+		//Member Functions
+	public:
+		// Conversions
+		static void GrayToRgba(const unsigned char* pSource, unsigned char* pDestination, size_t pixelCount);
+		static void GrayAlphaToRgba(const unsigned char* pSource, unsigned char* pDestination, size_t pixelCount);
+		static void RgbToRgba(const unsigned char* pSource, unsigned char* pDestination, size_t pixelCount);
+		static void PaletteToRgba(const unsigned char* pSource, const uint32_t* pPalette, unsigned char* pDestination, size_t pixelCount);
+
+		// Alpha
+		static void PremultiplyAlpha(unsigned char* pPixels, size_t pixelCount);
+
+		// Getters
+		static bool GetHasSsse3();
+	};
+
+}//namespace DSGraphics
+
+#endif //#ifndef PIXELCONVERSION_H
\ No newline at end of file
@@ -0,0 +1,54 @@
+//=============================================================================
+// File:		RenderSnapshot.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	RenderSnapshot. Everything the render thread needs to draw one simulation step, copied out by the simulation thread.
+//=============================================================================
+
+#ifndef RENDERSNAPSHOT_H
+#define RENDERSNAPSHOT_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <vector>
+
+// Daniel Schenker
+#include "ModelInstance.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSGraphics
+{
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	/*
+	Notes:
+		The instances are copies, so the simulation thread is free to keep changing its own instances while the snapshot is drawn.
+		Each copy still carries its previous simulation step, so the render thread can interpolate.
+		The vector is reused from snapshot to snapshot, so once it has grown large enough publishing a snapshot does not allocate.
+	*/
+	struct RenderSnapshot
+	{
+		RenderSnapshot()
+		:	mStepTime(0.0)
+		,	mStepIndex(0)
+		{
+		}
+
+		std::vector<DSGraphics::ModelInstance> mInstances;
+		double mStepTime;//glfwGetTime() at which the simulation step finished
+		unsigned long long mStepIndex;
+	};
+
+}//namespace DSGraphics
+
+#endif //#ifndef RENDERSNAPSHOT_H
\ No newline at end of file
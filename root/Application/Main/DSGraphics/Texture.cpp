@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		Texture.cpp
 // Created:		2015/02/12
-// Last Edited:	2015/02/17
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	Texture
 //=============================================================================
@@ -10,13 +10,117 @@
 //Includes
 //=============================================================================
 
+// Standard C++ Libraries
+#include <cstring>
+#include <vector>
+
 // Daniel Schenker
 #include "Texture.h"
+#include "GpuMemory.h"
+#include "PixelConversion.h"
+#include "TextureCache.h"
+#include "TextureCooker.h"
+#include "../DSMemory/ArenaAllocator.h"
+#include "../DSMemory/MemoryManager.h"
+#include "../DSMemory/MemoryTracker.h"
+#include "../DSSystem/MappedFile.h"
+#include "../DSSystem/ResourceFile.h"
 
 //=============================================================================
 //Statics
 //=============================================================================
 
+namespace
+{
+	//The unread part of the png, for libpng to read from memory rather than a FILE
+	struct PngSource
+	{
+		const unsigned char* mpNext;
+		const unsigned char* mpEnd;
+	};
+
+	void ReadPngData(png_structp pPngObj, png_bytep pDestination, png_size_t length)
+	{
+		PngSource* pSource = static_cast<PngSource*>(png_get_io_ptr(pPngObj));
+		if(static_cast<png_size_t>(pSource->mpEnd - pSource->mpNext) < length)
+		{
+			png_error(pPngObj, "unexpected end of file");//longjmps to the setjmp in Decode
+		}
+		memcpy(pDestination, pSource->mpNext, length);
+		pSource->mpNext += length;
+	}
+
+	//The palette as RGBA, with its tRNS transparency, and opaque black past its end so corrupt indices stay harmless
+	void ReadPalette(png_structp pPngObj, png_infop pPngInfo, bool premultiplyAlpha, uint32_t* pPalette)
+	{
+		png_colorp pColors = nullptr;
+		int colorCount = 0;
+		png_get_PLTE(pPngObj, pPngInfo, &pColors, &colorCount);
+		png_bytep pAlphas = nullptr;
+		int alphaCount = 0;
+		if(png_get_valid(pPngObj, pPngInfo, PNG_INFO_tRNS) != 0)
+		{
+			png_get_tRNS(pPngObj, pPngInfo, &pAlphas, &alphaCount, nullptr);
+		}
+
+		for(int i = 0; i < 256; ++i)
+		{
+			unsigned char rgba[4] = { 0, 0, 0, 255 };
+			if(i < colorCount)
+			{
+				rgba[0] = pColors[i].red;
+				rgba[1] = pColors[i].green;
+				rgba[2] = pColors[i].blue;
+			}
+			if(i < alphaCount)
+			{
+				rgba[3] = pAlphas[i];
+			}
+			memcpy(&pPalette[i], rgba, 4);
+		}
+
+		//256 entries instead of every pixel
+		if(premultiplyAlpha == true)
+		{
+			DSGraphics::PixelConversion::PremultiplyAlpha(reinterpret_cast<unsigned char*>(pPalette), 256);
+		}
+	}
+
+	//One decoded row (8 bits per channel, after the transforms set up in Decode) to RGBA
+	void ConvertRow(int colorType, const png_byte* pSource, const uint32_t* pPalette, png_byte* pDestination, png_uint_32 width)
+	{
+		switch(colorType)
+		{
+		case PNG_COLOR_TYPE_GRAY:
+			DSGraphics::PixelConversion::GrayToRgba(pSource, pDestination, width);
+			break;
+		case PNG_COLOR_TYPE_GRAY_ALPHA:
+			DSGraphics::PixelConversion::GrayAlphaToRgba(pSource, pDestination, width);
+			break;
+		case PNG_COLOR_TYPE_RGB:
+			DSGraphics::PixelConversion::RgbToRgba(pSource, pDestination, width);
+			break;
+		case PNG_COLOR_TYPE_PALETTE:
+			DSGraphics::PixelConversion::PaletteToRgba(pSource, pPalette, pDestination, width);
+			break;
+		default:
+			memcpy(pDestination, pSource, width * 4);
+			break;
+		}
+	}
+
+	//Compression needs S3TC, which nearly every desktop GPU has. Without it the texture is cooked as RGBA.
+	DSGraphics::TextureOptions GetSupportedOptions(const DSGraphics::TextureOptions& options)
+	{
+		DSGraphics::TextureOptions supported = options;
+		if(supported.mIsCompressed == true && GLEW_EXT_texture_compression_s3tc == GL_FALSE)
+		{
+			supported.mIsCompressed = false;
+		}
+		return supported;
+	}
+}
+
 //=============================================================================
 //Class Definitions
 //=============================================================================
@@ -25,224 +129,500 @@
 // Constuctors
 //-----------------------------------------------------------------------------
 
-DSGraphics::Texture::Texture(const char* pImageFile, GLint minMagFiler, GLint wrapMode)
+DSGraphics::Texture::Texture(const char* pImageFile, const DSGraphics::TextureOptions& options)
 :	mIsTextureLoaded(false)
 ,	mObjectID(0)
 ,	mWidth(0)
 ,	mHeight(0)
 {
-	//Test if pImageFile is a png by checking the header
-	png_byte header[8];
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagTextures);
+
+	//Mipmaps and compression are made by cooking the decoded image, as is anything that goes in the cache
+	DSGraphics::TextureOptions loadOptions = GetSupportedOptions(options);
+	bool isCooking = DSGraphics::TextureCache::GetIsEnabled() == true || loadOptions.mHasMipmaps == true || loadOptions.mIsCompressed == true;
+	if(isCooking == true)
+	{
+		DSGraphics::PreparedTexture prepared;
+		if(Prepare(pImageFile, options, prepared) == true)
+		{
+			UploadCooked(prepared.mpHeader, prepared.mpData, loadOptions, pImageFile);
+			mIsTextureLoaded = true;
+		}
+		return;
+	}
 
-	//Open pImageFile in read only binary mode
-	FILE* pFile = nullptr;
-	errno_t err;
-	err = fopen_s(&pFile, pImageFile, "rb");
+	//Decoding scratch memory comes from the loading arena, and is all freed when the constructor returns (even if libpng longjmps out of the read)
+	DSMemory::ArenaScope scratch(DSMemory::MemoryManager::GetLoadArena());
+
+	//Map pImageFile, or find it in the resource pack
+	DSSystem::ResourceFile file(pImageFile);
 	//If the file opened successfully
-	if(err == 0)
+	if(file.GetIsLoaded() == true)
+	{
+		GLuint uploadBuffer = 0;
+		png_byte* pImageData = Decode(pImageFile, file.GetData(), file.GetSize(), loadOptions.mPremultiplyAlpha, true, scratch, mWidth, mHeight, uploadBuffer);
+		if(pImageData != nullptr)
+		{
+			//Hand the pixels back to the driver. Unmapping fails if the contents were lost (eg. a display mode change), in which case there is no image.
+			const GLvoid* pPixels = pImageData;
+			bool isImageIntact = true;
+			if(uploadBuffer != 0)
+			{
+				isImageIntact = glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+				pPixels = nullptr;//offset 0 into the bound pixel unpack buffer
+			}
+
+			if(isImageIntact == true)
+			{
+				//Generate the OpenGL texture object
+				glGenTextures(1, &mObjectID);
+				glBindTexture(GL_TEXTURE_2D, mObjectID);
+
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, loadOptions.mFilter);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, loadOptions.mFilter);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, loadOptions.mWrapMode);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, loadOptions.mWrapMode);
+
+				DSGraphics::GpuMemory::TexImage2D
+				(
+					GL_TEXTURE_2D,			//target texture
+					mObjectID,				//the texture bound to it
+					0,						//level-of-detail. 0 is the base image level.
+					GL_RGBA,				//internal format
+					mWidth,					//texture width
+					mHeight,				//texture height
+					GL_RGBA,				//format of the pixel data
+					GL_UNSIGNED_BYTE,		//data type of the pixel data
+					pPixels,				//pointer to the image data in memory, or offset into the upload buffer
+					DSGraphics::kGpuMemoryTexture,	//accounted as
+					pImageFile				//accounted to
+				);
+
+				glBindTexture(GL_TEXTURE_2D, 0);
+				mIsTextureLoaded = true;
+			}
+			else
+			{
+				printf("ERROR: The upload buffer for image \"%s\" was lost.\n", pImageFile);
+				mIsTextureLoaded = false;
+			}
+
+			//Clean up memory (the driver keeps the upload buffer's storage until the copy is done)
+			if(uploadBuffer != 0)
+			{
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+				DSGraphics::GpuMemory::DeleteBuffer(uploadBuffer);
+			}
+			pImageData = nullptr;
+		}
+		else
+		{
+			mIsTextureLoaded = false;
+		}
+	}
+	else
+	{
+		printf("ERROR: Image \"%s\" could not be opened.\n", pImageFile);
+
+		mIsTextureLoaded = false;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Uploads a texture prepared by Prepare. If preparing failed (the error has already been printed), GetIsTextureLoaded() is false.
+*/
+DSGraphics::Texture::Texture(const DSGraphics::PreparedTexture& prepared)
+:	mIsTextureLoaded(false)
+,	mObjectID(0)
+,	mWidth(0)
+,	mHeight(0)
+{
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagTextures);
+
+	if(prepared.GetIsPrepared() == true)
 	{
-		//Read the header
-		fread(header, 1, 8, pFile);
+		UploadCooked(prepared.mpHeader, prepared.mpData, prepared.mOptions, prepared.mImageFile.c_str());
+		mIsTextureLoaded = true;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSGraphics::Texture::~Texture()
+{
+	DSGraphics::GpuMemory::DeleteTexture(mObjectID);
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Reads and cooks pImageFile, or maps its cache entry if there is a valid one, storing a fresh cook in the cache (if there is one) for next time.
+	Returns false, with an error printed, if the image couldn't be read; prepared is then not prepared.
+Notes:
+	Touches no OpenGL state and nothing shared, so it may run on any job system thread (cooking uses ParallelFor), any number at once, as long as each has its own prepared.
+	The TextureCache directory must already be set, and GLEW initialized (to know whether compression is supported).
+*/
+bool DSGraphics::Texture::Prepare(const char* pImageFile, const DSGraphics::TextureOptions& options, DSGraphics::PreparedTexture& prepared)
+{
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagTextures);
+
+	prepared.Clear();
+	prepared.mImageFile = pImageFile;
+	prepared.mOptions = options;
+
+	DSGraphics::TextureOptions loadOptions = GetSupportedOptions(options);
+
+	//Decoding scratch memory comes from this thread's loading arena, and is all freed when preparing returns (even if libpng longjmps out of the read)
+	DSMemory::ArenaScope scratch(DSMemory::MemoryManager::GetLoadArena());
 
-		//Is the image of type png?
-		if(png_sig_cmp(header, 0, 8) == 0)
+	//Map pImageFile, or find it in the resource pack
+	DSSystem::ResourceFile file(pImageFile);
+	if(file.GetIsLoaded() == false)
+	{
+		printf("ERROR: Image \"%s\" could not be opened.\n", pImageFile);
+		return false;
+	}
+
+	//A cached copy cooked from these same bytes is used as is, without decoding anything
+	uint64_t entryKey = 0;
+	uint64_t sourceKey = 0;
+	if(DSGraphics::TextureCache::GetIsEnabled() == true)
+	{
+		entryKey = DSGraphics::TextureCache::MakeEntryKey(pImageFile, loadOptions);
+		sourceKey = DSGraphics::TextureCache::MakeSourceKey(file.GetData(), file.GetSize(), loadOptions);
+		if(DSGraphics::TextureCache::GetHasEntry(entryKey) == true)
 		{
-			//Create png object struct
-			png_structp pPngObj = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-			if(pPngObj != nullptr)
+			DSSystem::MappedFile* pEntry = new DSSystem::MappedFile(DSGraphics::TextureCache::GetEntryPath(entryKey).c_str());
+			const DSGraphics::CookedTextureHeader* pHeader = nullptr;
+			if(pEntry->GetIsMapped() == true)
+			{
+				pHeader = DSGraphics::TextureCooker::Validate(pEntry->GetData(), pEntry->GetSize(), sourceKey);
+			}
+
+			if(pHeader != nullptr)
 			{
-				//Create png info struct
-				png_infop pPngInfo = png_create_info_struct(pPngObj);
-				if(pPngInfo != nullptr)
+				prepared.mpEntry = pEntry;
+				prepared.mpHeader = pHeader;
+				prepared.mpData = pEntry->GetData();
+				return true;
+			}
+
+			//Unmapped before it is replaced
+			printf("The cached copy of image \"%s\" is out of date, cooking it again.\n", pImageFile);
+			delete pEntry;
+		}
+	}
+
+	png_uint_32 width = 0;
+	png_uint_32 height = 0;
+	GLuint uploadBuffer = 0;
+	png_byte* pImageData = Decode(pImageFile, file.GetData(), file.GetSize(), loadOptions.mPremultiplyAlpha, false, scratch, width, height, uploadBuffer);
+	if(pImageData == nullptr)
+	{
+		return false;
+	}
+
+	DSGraphics::TextureCooker::Cook(pImageData, width, height, loadOptions.mPremultiplyAlpha, loadOptions.mHasMipmaps, loadOptions.mIsCompressed, sourceKey, prepared.mCooked);
+	prepared.mpHeader = reinterpret_cast<const DSGraphics::CookedTextureHeader*>(&prepared.mCooked[0]);
+	prepared.mpData = &prepared.mCooked[0];
+
+	if(DSGraphics::TextureCache::GetIsEnabled() == true)
+	{
+		DSGraphics::TextureCache::Store(entryKey, prepared.mCooked);
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Loading
+
+/*
+Description:
+	Decodes a PNG to width * height RGBA pixels, bottom row first, and returns them, or nullptr (with an error printed) if it couldn't be decoded.
+Variables:
+	isUsingUploadBuffer = decode into a pixel unpack buffer mapped from the driver, so the image is never held in memory of our own.
+		On success uploadBuffer is then that buffer, still bound and mapped, and the pixels are in it; the caller unmaps and deletes it.
+		If it can't be mapped (or isUsingUploadBuffer is false, which must be the case off the context thread), uploadBuffer is 0 and the pixels are in scratch.
+*/
+png_byte* DSGraphics::Texture::Decode(const char* pImageFile, const unsigned char* pData, size_t size, bool premultiplyAlpha, bool isUsingUploadBuffer,
+	DSMemory::ArenaScope& scratch, png_uint_32& width, png_uint_32& height, GLuint& uploadBuffer)
+{
+	png_byte* pImageData = nullptr;
+	uploadBuffer = 0;
+
+	//Is the image of type png? Test by checking the header
+	if(size >= 8 && png_sig_cmp(const_cast<png_bytep>(pData), 0, 8) == 0)
+	{
+		//Create png object struct
+		png_structp pPngObj = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+		if(pPngObj != nullptr)
+		{
+			//Create png info struct
+			png_infop pPngInfo = png_create_info_struct(pPngObj);
+			if(pPngInfo != nullptr)
+			{
+				//Create png end info struct
+				png_infop pPngInfoEnd = png_create_info_struct(pPngObj);
+				if(pPngInfoEnd != nullptr)
 				{
-					//Create png end info struct
-					png_infop pPngInfoEnd = png_create_info_struct(pPngObj);
-					if(pPngInfoEnd != nullptr)
+					//The upload buffer the rows are decoded into, if there is one. Volatile since it is set after setjmp and needed if libpng longjmps back.
+					volatile GLuint mappedBuffer = 0;
+
+					//Png error handling, taken from OpenGL Programming Wikibook, which is unsure if libpng man suggests this, hence switch in if else error logic flow.
+					if(setjmp(png_jmpbuf(pPngObj)))
 					{
-						//Png error handling, taken from OpenGL Programming Wikibook, which is unsure if libpng man suggests this, hence switch in if else error logic flow.
-						if(setjmp(png_jmpbuf(pPngObj)))
+						png_destroy_read_struct(&pPngObj, &pPngInfo, &pPngInfoEnd);
+						if(mappedBuffer != 0)
 						{
-							png_destroy_read_struct(&pPngObj, &pPngInfo, &pPngInfoEnd);
-							fclose(pFile);
-
-							mIsTextureLoaded = false;
+							glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+							glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+							GLuint buffer = mappedBuffer;
+							DSGraphics::GpuMemory::DeleteBuffer(buffer);
 						}
-						else
-						{
-							//Initialize png reading
-							png_init_io(pPngObj, pFile);
 
-							//Inform libpng that the first 8 bytes have already been read
-							png_set_sig_bytes(pPngObj, 8);
+						printf("ERROR: Image \"%s\" could not be decoded.\n", pImageFile);
+						return nullptr;
+					}
+					else
+					{
+						//Initialize png reading, from just after the header
+						PngSource source = { pData + 8, pData + size };
+						png_set_read_fn(pPngObj, &source, ReadPngData);
+
+						//Inform libpng that the first 8 bytes have already been read
+						png_set_sig_bytes(pPngObj, 8);
 
-							//Read all the info up to the image data
-							png_read_info(pPngObj, pPngInfo);
+						//Read all the info up to the image data
+						png_read_info(pPngObj, pPngInfo);
 
-							//Image data
-							int bitDepth = 0;
-							int colorType = 0;
+						//Image data
+						int bitDepth = 0;
+						int colorType = 0;
 
-							//Get info about png
-							png_get_IHDR(pPngObj, pPngInfo, &mWidth, &mHeight, &bitDepth, &colorType, NULL, NULL, NULL);
+						//Get info about png
+						png_get_IHDR(pPngObj, pPngInfo, &width, &height, &bitDepth, &colorType, NULL, NULL, NULL);
 
-							//Row size in bytes
-							int rowBytes = png_get_rowbytes(pPngObj, pPngInfo);
+						//Have libpng deliver 8 bits per channel, one byte per pixel for palettes and gray. Expanding to RGBA is left to PixelConversion.
+						if(bitDepth == 16)
+						{
+							png_set_strip_16(pPngObj);
+						}
+						if(bitDepth < 8)
+						{
+							if(colorType == PNG_COLOR_TYPE_GRAY)
+							{
+								png_set_expand_gray_1_2_4_to_8(pPngObj);
+							}
+							else
+							{
+								png_set_packing(pPngObj);
+							}
+						}
+						//  A single transparent color in a gray or RGB image becomes an alpha channel (a palette's transparency goes in its table instead)
+						if(colorType != PNG_COLOR_TYPE_PALETTE && png_get_valid(pPngObj, pPngInfo, PNG_INFO_tRNS) != 0)
+						{
+							png_set_tRNS_to_alpha(pPngObj);
+						}
+						int passCount = png_set_interlace_handling(pPngObj);
+						png_read_update_info(pPngObj, pPngInfo);
+						colorType = png_get_color_type(pPngObj, pPngInfo);
+						bool hasAlpha = (colorType & PNG_COLOR_MASK_ALPHA) != 0 || (colorType == PNG_COLOR_TYPE_PALETTE && png_get_valid(pPngObj, pPngInfo, PNG_INFO_tRNS) != 0);
+						bool premultiplyRows = premultiplyAlpha == true && hasAlpha == true && colorType != PNG_COLOR_TYPE_PALETTE;//palettes are premultiplied in their table
+
+						//Row sizes in bytes, as decoded and as uploaded
+						size_t decodedRowBytes = png_get_rowbytes(pPngObj, pPngInfo);
+						size_t rowBytes = static_cast<size_t>(width) * 4;
+						size_t imageBytes = rowBytes * height;
+
+						//Palette
+						uint32_t* pPalette = nullptr;
+						if(colorType == PNG_COLOR_TYPE_PALETTE)
+						{
+							pPalette = scratch.Allocate<uint32_t>(256);
+							if(pPalette == nullptr)
+							{
+								png_error(pPngObj, "out of memory");
+							}
+							ReadPalette(pPngObj, pPngInfo, premultiplyAlpha, pPalette);
+						}
 
-							//Allocate the pImageData as a big block, to be given to OpenGL
-							png_byte* pImageData = new png_byte[rowBytes * mHeight];
+						//Destination
+						//  Rows are decoded straight into a pixel unpack buffer mapped from the driver, so the image is never held in memory of our own and glTexImage2D copies from the buffer.
+						//  If it can't be mapped, or isn't wanted (the image is being cooked, which reads it back), the image goes through the loading arena instead.
+						if(isUsingUploadBuffer == true)
+						{
+							GLuint buffer = 0;
+							glGenBuffers(1, &buffer);
+							glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+							DSGraphics::GpuMemory::BufferData(GL_PIXEL_UNPACK_BUFFER, buffer, imageBytes, NULL, GL_STREAM_DRAW, DSGraphics::kGpuMemoryTexture, pImageFile);
+							pImageData = static_cast<png_byte*>(glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY));
 							if(pImageData != nullptr)
 							{
-								//pRowPointers points to pImageData for reading the png using libpng
-								png_bytep* pRowPointers = new png_bytep[mHeight];
-								if(pRowPointers != nullptr)
-								{
-									//Set the individual pRowPointers to point at the correct offsets in pImageData
-									for(unsigned int i = 0; i < mHeight; ++i)
-									{
-										pRowPointers[mHeight - 1 - i] = pImageData + (i * rowBytes);
-									}
-
-									//Read the png into pImageData through pRowPointers
-									png_read_image(pPngObj, pRowPointers);
-
-									//Generate the OpenGL texture object
-									glGenTextures(1, &mObjectID);
-									glBindTexture(GL_TEXTURE_2D, mObjectID);
-
-									glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minMagFiler);
-									glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, minMagFiler);
-									glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapMode);
-									glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapMode);
-
-									glTexImage2D
-									(
-										GL_TEXTURE_2D,			//target texture
-										0,						//level-of-detail. 0 is the base image level.
-										GL_RGBA,				//internal format
-										mWidth,					//texture width
-										mHeight,				//texture height
-										0,						//border. In older OpenGL specifications you could create a border around texture (it's really useless), specification 3.3 onwards, this parameter MUST be zero.
-										GL_RGBA,				//format of the pixel data
-										GL_UNSIGNED_BYTE,		//data type of the pixel data
-										(GLvoid*) pImageData	//pointer to the image data in memory
-									);
-
-									//Clean up memory
-									glBindTexture(GL_TEXTURE_2D, 0);
-									png_destroy_read_struct(&pPngObj, &pPngInfo, &pPngInfoEnd);
-									delete[] pImageData;
-									pImageData = nullptr;
-									delete[] pRowPointers;
-									pRowPointers = nullptr;
-									pPngInfoEnd = nullptr;
-									pPngInfo = nullptr;
-									pPngObj = nullptr;
-									fclose(pFile);
-									pFile = nullptr;
-
-									mIsTextureLoaded = true;
-								}
-								else
+								mappedBuffer = buffer;
+							}
+							else
+							{
+								glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+								DSGraphics::GpuMemory::DeleteBuffer(buffer);
+							}
+						}
+						if(pImageData == nullptr)
+						{
+							pImageData = scratch.Allocate<png_byte>(imageBytes);
+							if(pImageData == nullptr)
+							{
+								png_error(pPngObj, "out of memory");
+							}
+						}
+
+						//Decode, bottom row first as OpenGL expects
+						//  The destination is only ever written, in order; mapped memory is usually write combined, and reading it back is very slow.
+						//  RGBA rows with nothing to change are decoded in place. Anything else is decoded to a scratch row and converted into place,
+						//  through a second scratch row if it is premultiplied, which has to read what it writes.
+						png_byte* pDecodedRow = scratch.Allocate<png_byte>(decodedRowBytes);
+						png_byte* pConvertedRow = premultiplyRows == true ? scratch.Allocate<png_byte>(rowBytes) : nullptr;
+						if(pDecodedRow == nullptr || (premultiplyRows == true && pConvertedRow == nullptr))
+						{
+							png_error(pPngObj, "out of memory");
+						}
+						//  Interlaced images fill every row a little on each pass, so they are decoded whole before being converted
+						png_byte* pInterlacedImage = nullptr;
+						if(passCount > 1)
+						{
+							pInterlacedImage = scratch.Allocate<png_byte>(decodedRowBytes * height);
+							png_bytep* pRowPointers = scratch.Allocate<png_bytep>(height);
+							if(pInterlacedImage == nullptr || pRowPointers == nullptr)
+							{
+								png_error(pPngObj, "out of memory");
+							}
+							for(unsigned int i = 0; i < height; ++i)
+							{
+								pRowPointers[i] = pInterlacedImage + i * decodedRowBytes;
+							}
+							png_read_image(pPngObj, pRowPointers);
+						}
+						for(unsigned int i = 0; i < height; ++i)
+						{
+							png_byte* pDestination = pImageData + (height - 1 - i) * rowBytes;
+							png_byte* pSource = pInterlacedImage != nullptr ? pInterlacedImage + i * decodedRowBytes : pDecodedRow;
+							if(pInterlacedImage == nullptr)
+							{
+								if(colorType == PNG_COLOR_TYPE_RGBA && premultiplyRows == false)
 								{
-									//Clean up memory
-									png_destroy_read_struct(&pPngObj, &pPngInfo, &pPngInfoEnd);
-									pRowPointers = nullptr;
-									delete[] pImageData;
-									pImageData = nullptr;
-									pPngInfoEnd = nullptr;
-									pPngInfo = nullptr;
-									pPngObj = nullptr;
-									fclose(pFile);
-									pFile = nullptr;
-									
-									mIsTextureLoaded = false;
+									png_read_row(pPngObj, pDestination, NULL);
+									continue;
 								}
+								png_read_row(pPngObj, pDecodedRow, NULL);
+							}
+
+							if(premultiplyRows == true)
+							{
+								ConvertRow(colorType, pSource, pPalette, pConvertedRow, width);
+								DSGraphics::PixelConversion::PremultiplyAlpha(pConvertedRow, width);
+								memcpy(pDestination, pConvertedRow, rowBytes);
 							}
 							else
 							{
-								//Clean up memory
-								png_destroy_read_struct(&pPngObj, &pPngInfo, &pPngInfoEnd);
-								pImageData = nullptr;
-								pPngInfoEnd = nullptr;
-								pPngInfo = nullptr;
-								pPngObj = nullptr;
-								fclose(pFile);
-								pFile = nullptr;
-
-								mIsTextureLoaded = false;
+								ConvertRow(colorType, pSource, pPalette, pDestination, width);
 							}
-
 						}
-					}
-					else
-					{
-						printf("ERRPR: Could not create png info end struct for image \"%s\".\n", pImageFile);
-						png_destroy_read_struct(&pPngObj, &pPngInfo, (png_infopp) NULL);
+
+						//Done with libpng
+						png_destroy_read_struct(&pPngObj, &pPngInfo, &pPngInfoEnd);
 						pPngInfoEnd = nullptr;
 						pPngInfo = nullptr;
 						pPngObj = nullptr;
-						fclose(pFile);
-						pFile = nullptr;
 
-						mIsTextureLoaded = false;
+						uploadBuffer = mappedBuffer;
 					}
 				}
 				else
 				{
-					printf("ERRPR: Could not create png info struct for image \"%s\".\n", pImageFile);
-					png_destroy_read_struct(&pPngObj, (png_infopp) NULL, (png_infopp) NULL);
+					printf("ERRPR: Could not create png info end struct for image \"%s\".\n", pImageFile);
+					png_destroy_read_struct(&pPngObj, &pPngInfo, (png_infopp) NULL);
+					pPngInfoEnd = nullptr;
 					pPngInfo = nullptr;
 					pPngObj = nullptr;
-					fclose(pFile);
-					pFile = nullptr;
-
-					mIsTextureLoaded = false;
 				}
 			}
 			else
 			{
-				printf("ERROR: Could not allocate and initialize png struct for image \"%s\".\n", pImageFile);
+				printf("ERRPR: Could not create png info struct for image \"%s\".\n", pImageFile);
+				png_destroy_read_struct(&pPngObj, (png_infopp) NULL, (png_infopp) NULL);
+				pPngInfo = nullptr;
 				pPngObj = nullptr;
-				fclose(pFile);
-				pFile = nullptr;
-
-				mIsTextureLoaded = false;
 			}
 		}
 		else
 		{
-			printf("ERROR: Image \"%s\" is not of type png.\n", pImageFile);
-			fclose(pFile);
-			pFile = nullptr;
-
-			mIsTextureLoaded = false;
+			printf("ERROR: Could not allocate and initialize png struct for image \"%s\".\n", pImageFile);
+			pPngObj = nullptr;
 		}
 	}
 	else
 	{
-		printf("ERROR: Image \"%s\" could not be opened.\n", pImageFile);
-		pFile = nullptr;
-
-		mIsTextureLoaded = false;
+		printf("ERROR: Image \"%s\" is not of type png.\n", pImageFile);
 	}
+
+	return pImageData;
 }
 
-//-----------------------------------------------------------------------------
-// Destructor
 //-----------------------------------------------------------------------------
 
-DSGraphics::Texture::~Texture()
+/*
+Description:
+	Creates the texture from every level of a validated cooked texture, straight from pData (the mapped cache entry, or what was just cooked).
+*/
+void DSGraphics::Texture::UploadCooked(const DSGraphics::CookedTextureHeader* pHeader, const unsigned char* pData, const DSGraphics::TextureOptions& options, const char* pImageFile)
 {
-	glDeleteTextures(1, &mObjectID);
-}
+	mWidth = pHeader->mWidth;
+	mHeight = pHeader->mHeight;
 
-//-----------------------------------------------------------------------------
-// Public Member Functions
-//-----------------------------------------------------------------------------
+	//Blend between mip levels too, when there are any
+	GLint minFilter = options.mFilter;
+	if(pHeader->mLevelCount > 1)
+	{
+		minFilter = options.mFilter == GL_NEAREST ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR;
+	}
 
-//-----------------------------------------------------------------------------
-// Private Member Functions
-//-----------------------------------------------------------------------------
+	glGenTextures(1, &mObjectID);
+	glBindTexture(GL_TEXTURE_2D, mObjectID);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, options.mFilter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, options.mWrapMode);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, options.mWrapMode);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(pHeader->mLevelCount) - 1);
+
+	for(uint32_t i = 0; i < pHeader->mLevelCount; ++i)
+	{
+		const DSGraphics::CookedTextureLevel& level = pHeader->mLevels[i];
+		const unsigned char* pLevel = pData + level.mOffset;
+		if(pHeader->mFormat == DSGraphics::kCookedTextureRgba8)
+		{
+			DSGraphics::GpuMemory::TexImage2D(GL_TEXTURE_2D, mObjectID, i, GL_RGBA, level.mWidth, level.mHeight, GL_RGBA, GL_UNSIGNED_BYTE, pLevel, DSGraphics::kGpuMemoryTexture, pImageFile);
+		}
+		else
+		{
+			GLenum format = pHeader->mFormat == DSGraphics::kCookedTextureBc1 ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+			DSGraphics::GpuMemory::CompressedTexImage2D(GL_TEXTURE_2D, mObjectID, i, format, level.mWidth, level.mHeight, level.mSize, pLevel, DSGraphics::kGpuMemoryTexture, pImageFile);
+		}
+	}
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
 
 //-----------------------------------------------------------------------------
 // Helper Functions
@@ -280,4 +660,71 @@ png_uint_32 DSGraphics::Texture::GetHeight() const
 
 //-----------------------------------------------------------------------------
 // Setters
-//-----------------------------------------------------------------------------
\ No newline at end of file
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//PreparedTexture
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSGraphics::PreparedTexture::PreparedTexture()
+:	mpEntry(nullptr)
+,	mpHeader(nullptr)
+,	mpData(nullptr)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSGraphics::PreparedTexture::~PreparedTexture()
+{
+	delete mpEntry;
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Unmaps the cache entry and frees the cooked texture, if either is held.
+*/
+void DSGraphics::PreparedTexture::Clear()
+{
+	delete mpEntry;
+	mpEntry = nullptr;
+	std::vector<unsigned char>().swap(mCooked);
+	mpHeader = nullptr;
+	mpData = nullptr;
+	mImageFile.clear();
+	mOptions = DSGraphics::TextureOptions();
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+bool DSGraphics::PreparedTexture::GetIsPrepared() const
+{
+	return mpHeader != nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+const std::string& DSGraphics::PreparedTexture::GetImageFile() const
+{
+	return mImageFile;
+}
+
+//-----------------------------------------------------------------------------
+
+const DSGraphics::TextureOptions& DSGraphics::PreparedTexture::GetOptions() const
+{
+	return mOptions;
+}
\ No newline at end of file
@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		Texture.h
 // Created:		2015/02/12
-// Last Edited:	2015/02/17
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	Texture
 //=============================================================================
@@ -23,10 +23,32 @@
 //  libpng
 #include <png.h>
 
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
 //=============================================================================
 //Forward Declarations
 //=============================================================================
 
+namespace DSGraphics
+{
+	struct CookedTextureHeader;
+	class Texture;
+}
+
+namespace DSMemory
+{
+	class ArenaScope;
+}
+
+namespace DSSystem
+{
+	class MappedFile;
+}
+
 //=============================================================================
 //Namespace
 //=============================================================================
@@ -38,25 +60,117 @@ namespace DSGraphics
 	//Enums
 	//=============================================================================
 
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	/*
+	Notes:
+		Everything that changes what a texture looks like once loaded, so it is all part of the texture's AssetManager and TextureCache keys.
+	*/
+	struct TextureOptions
+	{
+		TextureOptions()
+		:	mFilter(GL_LINEAR)
+		,	mWrapMode(GL_CLAMP_TO_EDGE)
+		,	mPremultiplyAlpha(false)
+		,	mHasMipmaps(false)
+		,	mIsCompressed(false)
+		{
+		}
+
+		GLint mFilter;//GL_LINEAR or GL_NEAREST, for both minification and magnification (between mip levels too, if there are any)
+		GLint mWrapMode;
+		bool mPremultiplyAlpha;//r, g and b multiplied by alpha, for blending with GL_ONE, GL_ONE_MINUS_SRC_ALPHA
+		bool mHasMipmaps;
+		bool mIsCompressed;//BC1 or BC3, where the GPU supports S3TC
+	};
+
 	//=============================================================================
 	//Class Declarations
 	//=============================================================================
 
+	/*
+	Description:
+		A texture that has been read and cooked (or found in the TextureCache) but not yet uploaded: everything a Texture needs except the OpenGL context.
+	Usage:
+		//On any thread
+		DSGraphics::PreparedTexture prepared;
+		DSGraphics::Texture::Prepare("../../Resources/Textures/stripes.png", options, prepared);
+		//Then on the thread that owns the context
+		DSGraphics::Texture texture(prepared);
+	Notes:
+		Holds the cache entry mapped, or the freshly cooked texture, until it is destroyed or prepared again.
+	*/
+	class PreparedTexture
+	{
+	public:
+		//Constructors
+		PreparedTexture();
+		//Destructor
+		~PreparedTexture();
+
+	private:
+		//Disable Copy Constructor
+		PreparedTexture(const PreparedTexture&);
+		const PreparedTexture& operator=(const PreparedTexture&);
+
+		//Member Functions
+	public:
+		// General
+		void Clear();
+
+		// Getters
+		bool GetIsPrepared() const;
+		const std::string& GetImageFile() const;
+		const DSGraphics::TextureOptions& GetOptions() const;
+
+		//Member Variables
+	private:
+		friend class DSGraphics::Texture;
+
+		std::string mImageFile;
+		DSGraphics::TextureOptions mOptions;//as asked for, which is what the texture is known by in the AssetManager
+		DSSystem::MappedFile* mpEntry;//the cache entry, when it was valid
+		std::vector<unsigned char> mCooked;//otherwise, what was just cooked
+		const DSGraphics::CookedTextureHeader* mpHeader;//into one of the above, or nullptr if preparing failed
+		const unsigned char* mpData;
+	};
+
+	/*
+	Description:
+		Any PNG (gray, gray alpha, RGB, RGBA or palette, at any bit depth, interlaced or not) is uploaded as an 8 bit RGBA texture.
+		libpng reads straight from the mapped file or resource pack, and decodes each row into a mapped pixel unpack buffer,
+		converting it to RGBA on the way with PixelConversion, so no copy of the image is ever made in memory of our own.
+		With a TextureCache directory set, or mipmaps or compression asked for, the image is instead prepared (see Prepare): decoded into the loading arena and cooked (see TextureCooker).
+		The cooked texture is kept in the cache, and the next load of the same PNG with the same options maps it and uploads it as is, without decoding anything.
+	Notes:
+		The cache entry is found by the name and options, and only used if it was cooked from these exact bytes, so an edited PNG is cooked again and replaces its stale entry.
+		Preparing uses neither OpenGL nor anything shared, so textures can be prepared on worker threads while the context thread does something else.
+	*/
 	class Texture
 	{
 	public:
 		//Constructors
-		Texture(const char* pImageFile, GLint minMagFiler = GL_LINEAR, GLint wrapMode = GL_CLAMP_TO_EDGE);
+		Texture(const char* pImageFile, const DSGraphics::TextureOptions& options = DSGraphics::TextureOptions());
+		explicit Texture(const DSGraphics::PreparedTexture& prepared);
 		//Destructor
 		~Texture();
 
 		//Member Functions
+		// General
+		static bool Prepare(const char* pImageFile, const DSGraphics::TextureOptions& options, DSGraphics::PreparedTexture& prepared);
 
 	private:
 		//Disable Copy Constructor
 		Texture(const Texture&);
 		const Texture& operator=(const Texture&);
 
+		// Loading
+		static png_byte* Decode(const char* pImageFile, const unsigned char* pData, size_t size, bool premultiplyAlpha, bool isUsingUploadBuffer,
+			DSMemory::ArenaScope& scratch, png_uint_32& width, png_uint_32& height, GLuint& uploadBuffer);
+		void UploadCooked(const DSGraphics::CookedTextureHeader* pHeader, const unsigned char* pData, const DSGraphics::TextureOptions& options, const char* pImageFile);
+
 	public:
 		// Getters
 		bool GetIsTextureLoaded() const;
@@ -0,0 +1,262 @@
+//=============================================================================
+// File:		TextureCache.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	TextureCache
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Platform
+#if defined(_WIN32)
+	#include <direct.h>
+#else
+	#include <sys/stat.h>
+#endif
+
+// Standard C++ Libraries
+#include <cerrno>
+#include <cstring>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "TextureCache.h"
+#include "Texture.h"
+#include "TextureCooker.h"
+#include "../DSSystem/PackFile.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	//Empty while the cache is off, and ends in a slash otherwise
+	std::string sDirectory;
+
+	uint64_t Combine(uint64_t key, uint64_t value)
+	{
+		return (key ^ value) * 1099511628211ull;//FNV-1a prime
+	}
+
+	uint64_t RotateLeft(uint64_t value, unsigned int bits)
+	{
+		return (value << bits) | (value >> (64 - bits));
+	}
+
+	//MurmurHash3's finalizer, so every input bit affects every output bit
+	uint64_t Finalize(uint64_t hash)
+	{
+		hash ^= hash >> 33;
+		hash *= 0xFF51AFD7ED558CCDull;
+		hash ^= hash >> 33;
+		hash *= 0xC4CEB9FE1A85EC53ull;
+		hash ^= hash >> 33;
+		return hash;
+	}
+
+	//A word at a time, so hashing a PNG costs a small fraction of inflating it
+	uint64_t HashBytes(const unsigned char* pData, size_t size)
+	{
+		uint64_t hash = 0x9E3779B97F4A7C15ull ^ static_cast<uint64_t>(size);
+		size_t i = 0;
+		for(; i + 8 <= size; i += 8)
+		{
+			uint64_t word;
+			memcpy(&word, pData + i, 8);
+			word *= 0x87C37B91114253D5ull;
+			word = RotateLeft(word, 31);
+			word *= 0x4CF5AD432745937Full;
+			hash ^= word;
+			hash = RotateLeft(hash, 27) * 5 + 0x52DCE729;
+		}
+
+		uint64_t tail = 0;
+		memcpy(&tail, pData + i, size - i);
+		hash ^= tail * 0x87C37B91114253D5ull;
+		return Finalize(hash);
+	}
+
+	uint64_t CombineOptions(uint64_t key, const DSGraphics::TextureOptions& options)
+	{
+		key = Combine(key, static_cast<uint64_t>(options.mFilter));
+		key = Combine(key, static_cast<uint64_t>(options.mWrapMode));
+		key = Combine(key, options.mPremultiplyAlpha == true ? 1 : 0);
+		key = Combine(key, options.mHasMipmaps == true ? 1 : 0);
+		key = Combine(key, options.mIsCompressed == true ? 1 : 0);
+		return key;
+	}
+
+	bool MakeDirectory(const std::string& directory)
+	{
+		//Without the trailing slash, which not every platform accepts
+		std::string path = directory.substr(0, directory.size() - 1);
+#if defined(_WIN32)
+		return _mkdir(path.c_str()) == 0 || errno == EEXIST;
+#else
+		return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+#endif
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Turns the cache on, keeping entries in pDirectory (created if it doesn't exist), or off if pDirectory is nullptr or empty.
+	If the directory can't be created the cache stays off, with a warning.
+*/
+void DSGraphics::TextureCache::SetDirectory(const char* pDirectory)
+{
+	sDirectory.clear();
+	if(pDirectory == nullptr || pDirectory[0] == '\0')
+	{
+		return;
+	}
+
+	std::string directory = pDirectory;
+	if(directory[directory.size() - 1] != '/' && directory[directory.size() - 1] != '\\')
+	{
+		directory += '/';
+	}
+
+	if(MakeDirectory(directory) == false)
+	{
+		fprintf(stderr, "WARNING: TextureCache could not create \"%s\". Textures will not be cached.\n", directory.c_str());
+		return;
+	}
+
+	sDirectory = directory;
+}
+
+//-----------------------------------------------------------------------------
+//  Keys
+
+/*
+Description:
+	Which entry a texture is cached in.
+*/
+uint64_t DSGraphics::TextureCache::MakeEntryKey(const char* pImageFile, const DSGraphics::TextureOptions& options)
+{
+	return CombineOptions(DSSystem::PackFile::Hash(pImageFile), options);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	What the entry has to have been cooked from to still be valid: these bytes of PNG, with these options, by this version of TextureCooker.
+*/
+uint64_t DSGraphics::TextureCache::MakeSourceKey(const unsigned char* pData, size_t size, const DSGraphics::TextureOptions& options)
+{
+	const uint64_t cookerVersion = DSGraphics::TextureCooker::kVersion;
+	return Finalize(Combine(CombineOptions(HashBytes(pData, size), options), cookerVersion));
+}
+
+//-----------------------------------------------------------------------------
+//  Entries
+
+/*
+Description:
+	Writes cooked as the entry for entryKey, replacing any entry already there.
+	Returns false, with a warning, if it couldn't be written; the texture is still loaded, just cooked again next time.
+Notes:
+	The old entry must not be mapped while it is being replaced.
+*/
+bool DSGraphics::TextureCache::Store(uint64_t entryKey, const std::vector<unsigned char>& cooked)
+{
+	if(GetIsEnabled() == false || cooked.empty() == true)
+	{
+		return false;
+	}
+
+	std::string path = GetEntryPath(entryKey);
+	std::string temporaryPath = path + ".tmp";
+
+	FILE* pFile = nullptr;
+	if(fopen_s(&pFile, temporaryPath.c_str(), "wb") != 0 || pFile == nullptr)
+	{
+		fprintf(stderr, "WARNING: TextureCache could not open \"%s\" for writing.\n", temporaryPath.c_str());
+		return false;
+	}
+
+	bool isWritten = fwrite(&cooked[0], 1, cooked.size(), pFile) == cooked.size();
+	if(fclose(pFile) != 0 || isWritten == false)
+	{
+		fprintf(stderr, "WARNING: TextureCache failed while writing \"%s\".\n", temporaryPath.c_str());
+		remove(temporaryPath.c_str());
+		return false;
+	}
+
+	//rename won't replace an existing file everywhere, so the stale entry goes first
+	remove(path.c_str());
+	if(rename(temporaryPath.c_str(), path.c_str()) != 0)
+	{
+		fprintf(stderr, "WARNING: TextureCache could not rename \"%s\" to \"%s\".\n", temporaryPath.c_str(), path.c_str());
+		remove(temporaryPath.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+bool DSGraphics::TextureCache::GetIsEnabled()
+{
+	return sDirectory.empty() == false;
+}
+
+//-----------------------------------------------------------------------------
+
+const std::string& DSGraphics::TextureCache::GetDirectory()
+{
+	return sDirectory;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	The directory, followed by the entry key as 16 hex digits and ".dstex".
+*/
+std::string DSGraphics::TextureCache::GetEntryPath(uint64_t entryKey)
+{
+	char name[32];
+	sprintf_s(name, sizeof(name), "%016llx.dstex", static_cast<unsigned long long>(entryKey));
+	return sDirectory + name;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Whether there is an entry for entryKey, stale or not, so that a miss never has MappedFile warn about a missing file.
+*/
+bool DSGraphics::TextureCache::GetHasEntry(uint64_t entryKey)
+{
+	if(GetIsEnabled() == false)
+	{
+		return false;
+	}
+
+	FILE* pFile = nullptr;
+	if(fopen_s(&pFile, GetEntryPath(entryKey).c_str(), "rb") != 0 || pFile == nullptr)
+	{
+		return false;
+	}
+	fclose(pFile);
+	return true;
+}
\ No newline at end of file
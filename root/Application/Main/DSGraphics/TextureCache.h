@@ -0,0 +1,88 @@
+//=============================================================================
+// File:		TextureCache.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	TextureCache. A directory of cooked textures (.dstex), so each PNG is only decoded and cooked the first time it is loaded.
+//=============================================================================
+
+#ifndef TEXTURECACHE_H
+#define TEXTURECACHE_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//=============================================================================
+//Forward Declarations
+//=============================================================================
+
+namespace DSGraphics
+{
+	struct TextureOptions;
+}
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSGraphics
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Each entry is named after its entry key: the image's name and options, so loading the same texture the same way always finds the same file.
+		Inside, the cooked header holds the source key: a hash of the PNG's bytes, its options and the cooker version.
+		An entry whose source key doesn't match was cooked from an older version of the image (or by an older cooker), and is cooked again and overwritten.
+	Usage:
+		DSGraphics::TextureCache::SetDirectory("../../Cache/");
+		...
+		uint64_t entryKey = DSGraphics::TextureCache::MakeEntryKey(pImageFile, options);
+		if(DSGraphics::TextureCache::GetHasEntry(entryKey) == true)
+		{
+			DSSystem::MappedFile entry(DSGraphics::TextureCache::GetEntryPath(entryKey).c_str());
+			...
+		}
+	Notes:
+		The cache is off until a directory is set. Deleting the directory is always safe; it only costs the next launch a cook of every texture.
+		Entries are written to a temporary file and renamed into place, so a crash while storing never leaves a half written entry behind.
+		SetDirectory must be called before any textures are loaded.
+	*/
+	class TextureCache
+	{
+	private:
+		//Constructors
+		TextureCache();
+
+		//Member Functions
+	public:
+		// General
+		static void SetDirectory(const char* pDirectory);
+
+		// Keys
+		static uint64_t MakeEntryKey(const char* pImageFile, const DSGraphics::TextureOptions& options);
+		static uint64_t MakeSourceKey(const unsigned char* pData, size_t size, const DSGraphics::TextureOptions& options);
+
+		// Entries
+		static bool Store(uint64_t entryKey, const std::vector<unsigned char>& cooked);
+
+		// Getters
+		static bool GetIsEnabled();
+		static const std::string& GetDirectory();
+		static std::string GetEntryPath(uint64_t entryKey);
+		static bool GetHasEntry(uint64_t entryKey);
+	};
+
+}//namespace DSGraphics
+
+#endif //#ifndef TEXTURECACHE_H
\ No newline at end of file
@@ -0,0 +1,450 @@
+//=============================================================================
+// File:		TextureCooker.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	TextureCooker
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstring>
+
+// Daniel Schenker
+#include "TextureCooker.h"
+#include "../DSThreading/JobSystem.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	//What one ParallelFor over a level's rows of blocks needs
+	struct CompressJob
+	{
+		const unsigned char* mpRgba;
+		unsigned int mWidth;
+		unsigned int mHeight;
+		unsigned int mBlocksWide;
+		unsigned int mBlockBytes;
+		bool mHasAlphaBlock;
+		unsigned char* mpDestination;
+	};
+
+	size_t Align(size_t offset, size_t alignment)
+	{
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	unsigned int GetBlocks(unsigned int pixels)
+	{
+		return (pixels + 3) / 4;
+	}
+
+	//64 bit, so that Validate can check sizes from a corrupt header without overflowing
+	uint64_t GetLevelSize(uint32_t width, uint32_t height, uint32_t format)
+	{
+		if(format == DSGraphics::kCookedTextureRgba8)
+		{
+			return static_cast<uint64_t>(width) * height * 4;
+		}
+		return static_cast<uint64_t>(GetBlocks(width)) * GetBlocks(height) * (format == DSGraphics::kCookedTextureBc1 ? 8 : 16);
+	}
+
+	uint16_t ToRgb565(const int* pRgb)
+	{
+		return static_cast<uint16_t>(((pRgb[0] >> 3) << 11) | ((pRgb[1] >> 2) << 5) | (pRgb[2] >> 3));
+	}
+
+	//Expanded by repeating the top bits, the way the GPU decodes it
+	void FromRgb565(uint16_t color, int* pRgb)
+	{
+		int r = (color >> 11) & 31;
+		int g = (color >> 5) & 63;
+		int b = color & 31;
+		pRgb[0] = (r << 3) | (r >> 2);
+		pRgb[1] = (g << 2) | (g >> 4);
+		pRgb[2] = (b << 3) | (b >> 2);
+	}
+
+	//64 bits of 4 color block, for BC1 or the second half of BC3
+	void CompressColorBlock(const unsigned char* pBlock, unsigned char* pDestination)
+	{
+		int minimum[3] = { 255, 255, 255 };
+		int maximum[3] = { 0, 0, 0 };
+		for(unsigned int i = 0; i < 16; ++i)
+		{
+			for(unsigned int c = 0; c < 3; ++c)
+			{
+				int value = pBlock[i * 4 + c];
+				minimum[c] = value < minimum[c] ? value : minimum[c];
+				maximum[c] = value > maximum[c] ? value : maximum[c];
+			}
+		}
+
+		//Pull the ends in a little, since the colors in between are what most pixels end up using
+		for(unsigned int c = 0; c < 3; ++c)
+		{
+			int inset = (maximum[c] - minimum[c]) >> 4;
+			minimum[c] += inset;
+			maximum[c] -= inset;
+		}
+
+		//The box's corners are only the right diagonal if every channel rises with the widest one. Any that falls instead has its ends swapped.
+		unsigned int widest = 0;
+		for(unsigned int c = 1; c < 3; ++c)
+		{
+			widest = maximum[c] - minimum[c] > maximum[widest] - minimum[widest] ? c : widest;
+		}
+		int sum[3] = { 0, 0, 0 };
+		for(unsigned int i = 0; i < 16; ++i)
+		{
+			for(unsigned int c = 0; c < 3; ++c)
+			{
+				sum[c] += pBlock[i * 4 + c];
+			}
+		}
+		for(unsigned int c = 0; c < 3; ++c)
+		{
+			if(c == widest)
+			{
+				continue;
+			}
+			int covariance = 0;
+			for(unsigned int i = 0; i < 16; ++i)
+			{
+				covariance += (pBlock[i * 4 + c] * 16 - sum[c]) * (pBlock[i * 4 + widest] * 16 - sum[widest]) >> 8;
+			}
+			if(covariance < 0)
+			{
+				int swap = minimum[c];
+				minimum[c] = maximum[c];
+				maximum[c] = swap;
+			}
+		}
+
+		uint16_t color0 = ToRgb565(maximum);
+		uint16_t color1 = ToRgb565(minimum);
+		if(color0 < color1)
+		{
+			uint16_t swap = color0;
+			color0 = color1;
+			color1 = swap;
+		}
+
+		//color0 > color1 selects 4 color mode. When they are equal every pixel is color0.
+		uint32_t indices = 0;
+		if(color0 != color1)
+		{
+			int palette[4][3];
+			FromRgb565(color0, palette[0]);
+			FromRgb565(color1, palette[1]);
+			for(unsigned int c = 0; c < 3; ++c)
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+
+			for(unsigned int i = 0; i < 16; ++i)
+			{
+				unsigned int best = 0;
+				int bestDistance = 0x7FFFFFFF;
+				for(unsigned int p = 0; p < 4; ++p)
+				{
+					int dr = pBlock[i * 4 + 0] - palette[p][0];
+					int dg = pBlock[i * 4 + 1] - palette[p][1];
+					int db = pBlock[i * 4 + 2] - palette[p][2];
+					int distance = dr * dr + dg * dg + db * db;
+					if(distance < bestDistance)
+					{
+						bestDistance = distance;
+						best = p;
+					}
+				}
+				indices |= best << (i * 2);
+			}
+		}
+
+		pDestination[0] = static_cast<unsigned char>(color0 & 0xFF);
+		pDestination[1] = static_cast<unsigned char>(color0 >> 8);
+		pDestination[2] = static_cast<unsigned char>(color1 & 0xFF);
+		pDestination[3] = static_cast<unsigned char>(color1 >> 8);
+		for(unsigned int i = 0; i < 4; ++i)
+		{
+			pDestination[4 + i] = static_cast<unsigned char>(indices >> (i * 8));
+		}
+	}
+
+	//64 bits of BC3 alpha: the extremes and 3 bit indices into the 8 alphas between them
+	void CompressAlphaBlock(const unsigned char* pBlock, unsigned char* pDestination)
+	{
+		int minimum = 255;
+		int maximum = 0;
+		for(unsigned int i = 0; i < 16; ++i)
+		{
+			int alpha = pBlock[i * 4 + 3];
+			minimum = alpha < minimum ? alpha : minimum;
+			maximum = alpha > maximum ? alpha : maximum;
+		}
+
+		//alpha0 > alpha1 selects 8 alpha mode. When they are equal every pixel is alpha0.
+		uint64_t indices = 0;
+		if(maximum != minimum)
+		{
+			int palette[8];
+			palette[0] = maximum;
+			palette[1] = minimum;
+			for(int p = 1; p < 7; ++p)
+			{
+				palette[p + 1] = ((7 - p) * maximum + p * minimum) / 7;
+			}
+
+			for(unsigned int i = 0; i < 16; ++i)
+			{
+				uint64_t best = 0;
+				int bestDistance = 256;
+				for(unsigned int p = 0; p < 8; ++p)
+				{
+					int distance = pBlock[i * 4 + 3] - palette[p];
+					distance = distance < 0 ? -distance : distance;
+					if(distance < bestDistance)
+					{
+						bestDistance = distance;
+						best = p;
+					}
+				}
+				indices |= best << (i * 3);
+			}
+		}
+
+		pDestination[0] = static_cast<unsigned char>(maximum);
+		pDestination[1] = static_cast<unsigned char>(minimum);
+		for(unsigned int i = 0; i < 6; ++i)
+		{
+			pDestination[2 + i] = static_cast<unsigned char>(indices >> (i * 8));
+		}
+	}
+
+	//Rows [begin, end) of blocks. Blocks hanging off the right or top edge repeat the last column or row.
+	void CompressBlockRows(unsigned int begin, unsigned int end, void* pUserData)
+	{
+		const CompressJob* pJob = static_cast<const CompressJob*>(pUserData);
+		unsigned char block[64];
+		for(unsigned int blockY = begin; blockY < end; ++blockY)
+		{
+			for(unsigned int blockX = 0; blockX < pJob->mBlocksWide; ++blockX)
+			{
+				for(unsigned int y = 0; y < 4; ++y)
+				{
+					unsigned int sourceY = blockY * 4 + y < pJob->mHeight ? blockY * 4 + y : pJob->mHeight - 1;
+					for(unsigned int x = 0; x < 4; ++x)
+					{
+						unsigned int sourceX = blockX * 4 + x < pJob->mWidth ? blockX * 4 + x : pJob->mWidth - 1;
+						memcpy(block + (y * 4 + x) * 4, pJob->mpRgba + (static_cast<size_t>(sourceY) * pJob->mWidth + sourceX) * 4, 4);
+					}
+				}
+
+				unsigned char* pDestination = pJob->mpDestination + (static_cast<size_t>(blockY) * pJob->mBlocksWide + blockX) * pJob->mBlockBytes;
+				if(pJob->mHasAlphaBlock == true)
+				{
+					CompressAlphaBlock(block, pDestination);
+					pDestination += 8;
+				}
+				CompressColorBlock(block, pDestination);
+			}
+		}
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Writes a whole .dstex to cooked: the header, then each level at a kLevelAlignment offset.
+Variables:
+	pRgba = width * height RGBA pixels, bottom row first.
+	isCompressed = BC1 if every pixel is opaque, BC3 if not. Otherwise the levels stay RGBA.
+	key = stored in the header for Validate to check.
+*/
+void DSGraphics::TextureCooker::Cook(const unsigned char* pRgba, unsigned int width, unsigned int height, bool isPremultiplied, bool hasMipmaps, bool isCompressed, uint64_t key, std::vector<unsigned char>& cooked)
+{
+	const uint32_t maxLevels = kMaxLevels;
+	const size_t alignment = kLevelAlignment;
+
+	//The RGBA mip chain, each level box filtered from the one before, down to 1x1
+	std::vector< std::vector<unsigned char> > levels;
+	levels.reserve(maxLevels);
+	std::vector<unsigned int> widths;
+	std::vector<unsigned int> heights;
+	unsigned int levelWidth = width;
+	unsigned int levelHeight = height;
+	widths.push_back(levelWidth);
+	heights.push_back(levelHeight);
+	while(hasMipmaps == true && (levelWidth > 1 || levelHeight > 1) && widths.size() < maxLevels)
+	{
+		const unsigned char* pSource = levels.empty() == true ? pRgba : &levels.back()[0];
+		unsigned int sourceWidth = levelWidth;
+		unsigned int sourceHeight = levelHeight;
+		levelWidth = levelWidth > 1 ? levelWidth / 2 : 1;
+		levelHeight = levelHeight > 1 ? levelHeight / 2 : 1;
+
+		levels.push_back(std::vector<unsigned char>(static_cast<size_t>(levelWidth) * levelHeight * 4));
+		Downsample(pSource, sourceWidth, sourceHeight, &levels.back()[0]);
+		widths.push_back(levelWidth);
+		heights.push_back(levelHeight);
+	}
+
+	//Format
+	DSGraphics::CookedTextureFormat format = DSGraphics::kCookedTextureRgba8;
+	if(isCompressed == true)
+	{
+		format = DSGraphics::kCookedTextureBc1;
+		size_t pixelCount = static_cast<size_t>(width) * height;
+		for(size_t i = 0; i < pixelCount; ++i)
+		{
+			if(pRgba[i * 4 + 3] != 255)
+			{
+				format = DSGraphics::kCookedTextureBc3;
+				break;
+			}
+		}
+	}
+
+	//Header
+	DSGraphics::CookedTextureHeader header;
+	memset(&header, 0, sizeof(header));
+	header.mMagic = kMagic;
+	header.mVersion = kVersion;
+	header.mKey = key;
+	header.mWidth = width;
+	header.mHeight = height;
+	header.mFormat = format;
+	header.mLevelCount = static_cast<uint32_t>(widths.size());
+	header.mIsPremultiplied = isPremultiplied == true ? 1 : 0;
+
+	size_t offset = Align(sizeof(header), alignment);
+	for(uint32_t i = 0; i < header.mLevelCount; ++i)
+	{
+		DSGraphics::CookedTextureLevel& level = header.mLevels[i];
+		level.mOffset = offset;
+		level.mWidth = widths[i];
+		level.mHeight = heights[i];
+		level.mSize = static_cast<uint32_t>(GetLevelSize(level.mWidth, level.mHeight, format));
+		offset = Align(offset + level.mSize, alignment);
+	}
+
+	//Levels
+	cooked.assign(offset, 0);
+	memcpy(&cooked[0], &header, sizeof(header));
+	for(uint32_t i = 0; i < header.mLevelCount; ++i)
+	{
+		const DSGraphics::CookedTextureLevel& level = header.mLevels[i];
+		const unsigned char* pLevel = i == 0 ? pRgba : &levels[i - 1][0];
+		if(format == DSGraphics::kCookedTextureRgba8)
+		{
+			memcpy(&cooked[level.mOffset], pLevel, level.mSize);
+		}
+		else
+		{
+			CompressLevel(pLevel, level.mWidth, level.mHeight, format, &cooked[level.mOffset]);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Checks that pData is a whole .dstex of this version, cooked with key, with every level inside it and exactly as big as its size and format need.
+	Returns its header, or nullptr if it is stale, truncated or not a cooked texture at all.
+*/
+const DSGraphics::CookedTextureHeader* DSGraphics::TextureCooker::Validate(const unsigned char* pData, size_t size, uint64_t key)
+{
+	if(pData == nullptr || size < sizeof(DSGraphics::CookedTextureHeader))
+	{
+		return nullptr;
+	}
+
+	const DSGraphics::CookedTextureHeader* pHeader = reinterpret_cast<const DSGraphics::CookedTextureHeader*>(pData);
+	if(pHeader->mMagic != kMagic || pHeader->mVersion != kVersion || pHeader->mKey != key)
+	{
+		return nullptr;
+	}
+	if(pHeader->mFormat >= DSGraphics::kCookedTextureFormatCount || pHeader->mLevelCount == 0 || pHeader->mLevelCount > kMaxLevels || pHeader->mWidth == 0 || pHeader->mHeight == 0)
+	{
+		return nullptr;
+	}
+
+	for(uint32_t i = 0; i < pHeader->mLevelCount; ++i)
+	{
+		const DSGraphics::CookedTextureLevel& level = pHeader->mLevels[i];
+		if(level.mOffset > size || level.mSize > size - level.mOffset || level.mWidth == 0 || level.mHeight == 0)
+		{
+			return nullptr;
+		}
+		//What uploading the level will read
+		if(level.mSize != GetLevelSize(level.mWidth, level.mHeight, pHeader->mFormat))
+		{
+			return nullptr;
+		}
+	}
+
+	return pHeader;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helpers
+
+/*
+Description:
+	Each destination pixel is the average of the 2x2 source pixels under it. An odd last row or column is folded into the one before it by clamping.
+*/
+void DSGraphics::TextureCooker::Downsample(const unsigned char* pSource, unsigned int width, unsigned int height, unsigned char* pDestination)
+{
+	unsigned int destinationWidth = width > 1 ? width / 2 : 1;
+	unsigned int destinationHeight = height > 1 ? height / 2 : 1;
+	for(unsigned int y = 0; y < destinationHeight; ++y)
+	{
+		const unsigned char* pRow0 = pSource + static_cast<size_t>(y * 2) * width * 4;
+		const unsigned char* pRow1 = pSource + static_cast<size_t>(y * 2 + 1 < height ? y * 2 + 1 : height - 1) * width * 4;
+		unsigned char* pOut = pDestination + static_cast<size_t>(y) * destinationWidth * 4;
+		for(unsigned int x = 0; x < destinationWidth; ++x)
+		{
+			unsigned int x0 = x * 2 * 4;
+			unsigned int x1 = (x * 2 + 1 < width ? x * 2 + 1 : width - 1) * 4;
+			for(unsigned int c = 0; c < 4; ++c)
+			{
+				pOut[x * 4 + c] = static_cast<unsigned char>((pRow0[x0 + c] + pRow0[x1 + c] + pRow1[x0 + c] + pRow1[x1 + c] + 2) >> 2);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void DSGraphics::TextureCooker::CompressLevel(const unsigned char* pRgba, unsigned int width, unsigned int height, DSGraphics::CookedTextureFormat format, unsigned char* pDestination)
+{
+	CompressJob job;
+	job.mpRgba = pRgba;
+	job.mWidth = width;
+	job.mHeight = height;
+	job.mBlocksWide = GetBlocks(width);
+	job.mHasAlphaBlock = format == DSGraphics::kCookedTextureBc3;
+	job.mBlockBytes = job.mHasAlphaBlock == true ? 16 : 8;
+	job.mpDestination = pDestination;
+
+	DSThreading::JobSystem::ParallelFor("TextureCooker::CompressLevel", 0, GetBlocks(height), 4, CompressBlockRows, &job);
+}
\ No newline at end of file
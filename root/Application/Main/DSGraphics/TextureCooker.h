@@ -0,0 +1,112 @@
+//=============================================================================
+// File:		TextureCooker.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	TextureCooker. Turns decoded RGBA images into GPU ready cooked textures (.dstex): the mip chain in its final format, optionally block compressed.
+//=============================================================================
+
+#ifndef TEXTURECOOKER_H
+#define TEXTURECOOKER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSGraphics
+{
+
+	//=============================================================================
+	//Enums
+	//=============================================================================
+
+	enum CookedTextureFormat
+	{
+		kCookedTextureRgba8,
+		kCookedTextureBc1,//DXT1, 8 bytes per 4x4 block. Chosen for compressed images that are fully opaque.
+		kCookedTextureBc3,//DXT5, 16 bytes per 4x4 block
+		kCookedTextureFormatCount
+	};
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	//Note: These are the on disk layout. Only add members at the end and bump TextureCooker::kVersion.
+
+	struct CookedTextureLevel
+	{
+		uint64_t mOffset;//bytes from the start of the file, a multiple of TextureCooker::kLevelAlignment
+		uint32_t mSize;//bytes
+		uint32_t mWidth;
+		uint32_t mHeight;
+		uint32_t mPadding;
+	};
+
+	struct CookedTextureHeader
+	{
+		uint32_t mMagic;
+		uint32_t mVersion;
+		uint64_t mKey;//what it was cooked from and how (see TextureCache::MakeSourceKey), so a misplaced or stale file is never used
+		uint32_t mWidth;
+		uint32_t mHeight;
+		uint32_t mFormat;//DSGraphics::CookedTextureFormat
+		uint32_t mLevelCount;
+		uint32_t mIsPremultiplied;
+		uint32_t mPadding;
+		DSGraphics::CookedTextureLevel mLevels[16];//level 0 is the full image. Rows are bottom first, as OpenGL expects.
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Mip levels are box filtered from the level above, in whatever space the pixels are in (premultiplied if the texture is, which keeps edges from darkening).
+		Block compression is a bounding box fit per 4x4 block, done in parallel on the job system: fast rather than best quality,
+		which is the right trade for something cooked on the player's machine the first time a texture is loaded.
+	Usage:
+		std::vector<unsigned char> cooked;
+		DSGraphics::TextureCooker::Cook(pRgba, width, height, true, true, false, key, cooked);
+		const DSGraphics::CookedTextureHeader* pHeader = DSGraphics::TextureCooker::Validate(&cooked[0], cooked.size(), key);
+	Notes:
+		Cooked textures are little endian, and only meaningful on the machine (or at least the GL implementations) that can read their format.
+	*/
+	class TextureCooker
+	{
+	private:
+		//Constructors
+		TextureCooker();
+
+		//Member Functions
+	public:
+		// General
+		static void Cook(const unsigned char* pRgba, unsigned int width, unsigned int height, bool isPremultiplied, bool hasMipmaps, bool isCompressed, uint64_t key, std::vector<unsigned char>& cooked);
+		static const DSGraphics::CookedTextureHeader* Validate(const unsigned char* pData, size_t size, uint64_t key);
+
+	private:
+		// Helpers
+		static void Downsample(const unsigned char* pSource, unsigned int width, unsigned int height, unsigned char* pDestination);
+		static void CompressLevel(const unsigned char* pRgba, unsigned int width, unsigned int height, DSGraphics::CookedTextureFormat format, unsigned char* pDestination);
+
+		//Member Variables
+	public:
+		static const uint32_t kMagic = 0x58545344;//"DSTX"
+		static const uint32_t kVersion = 1;
+		static const uint32_t kMaxLevels = 16;
+		static const uint32_t kLevelAlignment = 16;
+	};
+
+}//namespace DSGraphics
+
+#endif //#ifndef TEXTURECOOKER_H
\ No newline at end of file
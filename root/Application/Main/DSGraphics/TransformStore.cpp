@@ -0,0 +1,766 @@
+//=============================================================================
+// File:		TransformStore.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	TransformStore
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <stdexcept>
+#include <vector>
+
+// Daniel Schenker
+#include "TransformStore.h"
+#include "../DSProfiling/Profiler.h"
+#include "../DSSystem/Platform.h"
+#include "../DSThreading/JobSystem.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+//Defined here as well, since std::vector::resize takes it by reference
+const unsigned int DSGraphics::TransformStore::kNoParent;
+
+namespace
+{
+	//Points a slot reference at where its transform moved to, if it moved
+	void RemapSlot(unsigned int& slot, unsigned int first, const std::vector<unsigned int>& newSlots)
+	{
+		if(slot != DSGraphics::TransformStore::kNoParent && slot >= first && slot - first < newSlots.size())
+		{
+			slot = newSlots[slot - first];
+		}
+	}
+
+	//Reorders values[first, first + order.size()) so that the value at old slot order[i] ends up at first + i
+	template <typename T>
+	void Permute(std::vector<T>& values, unsigned int first, const std::vector<unsigned int>& order)
+	{
+		std::vector<T> moved(values.begin() + first, values.begin() + first + order.size());
+		for(size_t i = 0; i < order.size(); ++i)
+		{
+			values[first + i] = moved[order[i] - first];
+		}
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSGraphics::TransformStore::TransformStore()
+:	mCount(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSGraphics::TransformStore::~TransformStore()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Adds an identity transform and returns its index.
+*/
+unsigned int DSGraphics::TransformStore::Create()
+{
+	//Grow by a whole batch of identity transforms at a time, so the arrays stay padded to a multiple of kBatchSize
+	if(mCount % kBatchSize == 0)
+	{
+		unsigned int paddedCount = mCount + kBatchSize;
+
+		mPositionX.resize(paddedCount, 0.0f);
+		mPositionY.resize(paddedCount, 0.0f);
+		mPositionZ.resize(paddedCount, 0.0f);
+		mRotationW.resize(paddedCount, 1.0f);
+		mRotationX.resize(paddedCount, 0.0f);
+		mRotationY.resize(paddedCount, 0.0f);
+		mRotationZ.resize(paddedCount, 0.0f);
+		mScaleX.resize(paddedCount, 1.0f);
+		mScaleY.resize(paddedCount, 1.0f);
+		mScaleZ.resize(paddedCount, 1.0f);
+
+		mParent.resize(paddedCount, kNoParent);
+		mFirstChild.resize(paddedCount, kNoParent);
+		mNextSibling.resize(paddedCount, kNoParent);
+		mHasParent.resize((paddedCount + kBitsPerWord - 1) / kBitsPerWord, 0);
+		mHasChildren.resize((paddedCount + kBitsPerWord - 1) / kBitsPerWord, 0);
+
+		mWorldMatrices.resize(paddedCount, glm::mat4(1.0f));
+		mDirty.resize((paddedCount + kBitsPerWord - 1) / kBitsPerWord, 0);
+	}
+
+	//New transforms are stored at the end, so until something is reordered an index is its own slot
+	mSlots.push_back(mCount);
+	mIndices.push_back(mCount);
+
+	return mCount++;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSGraphics::TransformStore::Create(const glm::vec3& position, const DSMathematics::Quaternion& rotation, const glm::vec3& scale)
+{
+	unsigned int index = Create();
+
+	SetPosition(index, position);
+	SetRotation(index, rotation);
+	SetScale(index, scale);
+
+	return index;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	parent = index of an existing transform, which position, rotation and scale are then relative to.
+*/
+unsigned int DSGraphics::TransformStore::Create(const glm::vec3& position, const DSMathematics::Quaternion& rotation, const glm::vec3& scale, unsigned int parent)
+{
+	unsigned int index = Create(position, rotation, scale);
+
+	SetParent(index, parent);
+
+	return index;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Reserves room for count transforms, so that creating up to that many does not reallocate.
+*/
+void DSGraphics::TransformStore::Reserve(unsigned int count)
+{
+	unsigned int paddedCount = (count + kBatchSize - 1) / kBatchSize * kBatchSize;
+
+	mPositionX.reserve(paddedCount);
+	mPositionY.reserve(paddedCount);
+	mPositionZ.reserve(paddedCount);
+	mRotationW.reserve(paddedCount);
+	mRotationX.reserve(paddedCount);
+	mRotationY.reserve(paddedCount);
+	mRotationZ.reserve(paddedCount);
+	mScaleX.reserve(paddedCount);
+	mScaleY.reserve(paddedCount);
+	mScaleZ.reserve(paddedCount);
+
+	mSlots.reserve(count);
+	mIndices.reserve(count);
+
+	mParent.reserve(paddedCount);
+	mFirstChild.reserve(paddedCount);
+	mNextSibling.reserve(paddedCount);
+	mHasParent.reserve((paddedCount + kBitsPerWord - 1) / kBitsPerWord);
+	mHasChildren.reserve((paddedCount + kBitsPerWord - 1) / kBitsPerWord);
+
+	mWorldMatrices.reserve(paddedCount);
+	mDirty.reserve((paddedCount + kBitsPerWord - 1) / kBitsPerWord);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Removes every transform. Capacity is kept, so refilling the store does not allocate.
+*/
+void DSGraphics::TransformStore::Clear()
+{
+	mCount = 0;
+
+	mPositionX.clear();
+	mPositionY.clear();
+	mPositionZ.clear();
+	mRotationW.clear();
+	mRotationX.clear();
+	mRotationY.clear();
+	mRotationZ.clear();
+	mScaleX.clear();
+	mScaleY.clear();
+	mScaleZ.clear();
+
+	mSlots.clear();
+	mIndices.clear();
+
+	mParent.clear();
+	mFirstChild.clear();
+	mNextSibling.clear();
+	mHasParent.clear();
+	mHasChildren.clear();
+
+	mWorldMatrices.clear();
+	mDirty.clear();
+}
+
+//-----------------------------------------------------------------------------
+//  World Matrices
+
+/*
+Description:
+	Composes the world matrix of every dirty transform and marks them all clean.
+*/
+void DSGraphics::TransformStore::UpdateWorldMatrices()
+{
+	DS_PROFILE_SCOPE("UpdateWorldMatrices");
+
+	PropagateDirty();
+	UpdateWorldMatricesRange(0, static_cast<unsigned int>(mDirty.size()), this);
+	ApplyParents();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Same as UpdateWorldMatrices, but spreads the dirty words across the job system.
+Notes:
+	Must be called from a thread registered with DSThreading::JobSystem.
+	Only worth it for tens of thousands of transforms; below kWordsPerJob words it runs on the calling thread anyway.
+	Only composing the local matrices is spread out. Propagating dirty flags and applying parents depend on earlier transforms, so they stay on the calling thread,
+	but they only touch transforms that are in a hierarchy.
+*/
+void DSGraphics::TransformStore::UpdateWorldMatricesParallel()
+{
+	PropagateDirty();
+	DSThreading::JobSystem::ParallelFor("UpdateWorldMatrices", 0, static_cast<unsigned int>(mDirty.size()), kWordsPerJob, UpdateWorldMatricesRange, this);
+	ApplyParents();
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  UpdateWorldMatrices Sub-Functions
+
+/*
+Description:
+	Marks the children of every dirty transform dirty, and so on down, so that a moved parent dirties its whole subtree.
+Notes:
+	Children are always stored after their parent, so a single pass in slot order reaches every descendant:
+	a child marked dirty here is visited later in the same pass, including when it shares the parent's word.
+*/
+void DSGraphics::TransformStore::PropagateDirty()
+{
+	unsigned int wordCount = static_cast<unsigned int>(mDirty.size());
+	for(unsigned int word = 0; word < wordCount; ++word)
+	{
+		if((mDirty[word] & mHasChildren[word]) == 0)
+		{
+			continue;
+		}
+
+		for(unsigned int bit = 0; bit < kBitsPerWord; ++bit)
+		{
+			//Reread every bit, since children in the same word get marked as we go
+			if((mDirty[word] & mHasChildren[word] & (1u << bit)) != 0)
+			{
+				for(unsigned int child = mFirstChild[word * kBitsPerWord + bit]; child != kNoParent; child = mNextSibling[child])
+				{
+					MarkDirty(child);
+				}
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	beginWord, endWord = range of dirty words to process, each covering kBitsPerWord transforms.
+	pUserData = the TransformStore.
+Notes:
+	Leaves the dirty words set, since ApplyParents needs to know which transforms were composed. ApplyParents clears them.
+*/
+void DSGraphics::TransformStore::UpdateWorldMatricesRange(unsigned int beginWord, unsigned int endWord, void* pUserData)
+{
+	DSGraphics::TransformStore* pStore = static_cast<DSGraphics::TransformStore*>(pUserData);
+
+	for(unsigned int word = beginWord; word < endWord; ++word)
+	{
+		unsigned int dirty = pStore->mDirty[word];
+		if(dirty == 0)
+		{
+			continue;
+		}
+
+		//One nibble per batch
+		for(unsigned int batch = 0; batch < kBitsPerWord / kBatchSize; ++batch)
+		{
+			if(((dirty >> (batch * kBatchSize)) & 0xF) != 0)
+			{
+				pStore->ComposeBatch(word * kBitsPerWord + batch * kBatchSize);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Builds the world matrices of transforms [first, first + kBatchSize) directly from position, rotation and scale.
+	The result equals translate * mat4_cast(rotation) * scale, without building or multiplying the three matrices.
+Notes:
+	Each SSE register holds one component for all four transforms, so the maths is the scalar formula done four times at once.
+	The four resulting column sets are then transposed into the four column-major glm::mat4.
+*/
+void DSGraphics::TransformStore::ComposeBatch(unsigned int first)
+{
+#if defined(DS_SSE)
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 two = _mm_set1_ps(2.0f);
+	__m128 zero = _mm_setzero_ps();
+
+	//Load
+	__m128 qw = _mm_loadu_ps(&mRotationW[first]);
+	__m128 qx = _mm_loadu_ps(&mRotationX[first]);
+	__m128 qy = _mm_loadu_ps(&mRotationY[first]);
+	__m128 qz = _mm_loadu_ps(&mRotationZ[first]);
+	__m128 sx = _mm_loadu_ps(&mScaleX[first]);
+	__m128 sy = _mm_loadu_ps(&mScaleY[first]);
+	__m128 sz = _mm_loadu_ps(&mScaleZ[first]);
+	__m128 px = _mm_loadu_ps(&mPositionX[first]);
+	__m128 py = _mm_loadu_ps(&mPositionY[first]);
+	__m128 pz = _mm_loadu_ps(&mPositionZ[first]);
+
+	//Rotation terms
+	__m128 x2 = _mm_mul_ps(qx, two);
+	__m128 y2 = _mm_mul_ps(qy, two);
+	__m128 z2 = _mm_mul_ps(qz, two);
+	__m128 xx = _mm_mul_ps(qx, x2);
+	__m128 yy = _mm_mul_ps(qy, y2);
+	__m128 zz = _mm_mul_ps(qz, z2);
+	__m128 xy = _mm_mul_ps(qx, y2);
+	__m128 xz = _mm_mul_ps(qx, z2);
+	__m128 yz = _mm_mul_ps(qy, z2);
+	__m128 wx = _mm_mul_ps(qw, x2);
+	__m128 wy = _mm_mul_ps(qw, y2);
+	__m128 wz = _mm_mul_ps(qw, z2);
+
+	//Columns of rotation * scale
+	__m128 c0x = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(yy, zz)), sx);
+	__m128 c0y = _mm_mul_ps(_mm_add_ps(xy, wz), sx);
+	__m128 c0z = _mm_mul_ps(_mm_sub_ps(xz, wy), sx);
+	__m128 c1x = _mm_mul_ps(_mm_sub_ps(xy, wz), sy);
+	__m128 c1y = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, zz)), sy);
+	__m128 c1z = _mm_mul_ps(_mm_add_ps(yz, wx), sy);
+	__m128 c2x = _mm_mul_ps(_mm_add_ps(xz, wy), sz);
+	__m128 c2y = _mm_mul_ps(_mm_sub_ps(yz, wx), sz);
+	__m128 c2z = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, yy)), sz);
+	__m128 c3w = one;
+
+	//Transpose from one register per component to one register per matrix column, and store
+	float* pOut = &mWorldMatrices[first][0][0];
+	_MM_TRANSPOSE4_PS(c0x, c0y, c0z, zero);
+	_mm_storeu_ps(pOut + 0, c0x);
+	_mm_storeu_ps(pOut + 16, c0y);
+	_mm_storeu_ps(pOut + 32, c0z);
+	_mm_storeu_ps(pOut + 48, zero);
+
+	zero = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(c1x, c1y, c1z, zero);
+	_mm_storeu_ps(pOut + 4, c1x);
+	_mm_storeu_ps(pOut + 20, c1y);
+	_mm_storeu_ps(pOut + 36, c1z);
+	_mm_storeu_ps(pOut + 52, zero);
+
+	zero = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(c2x, c2y, c2z, zero);
+	_mm_storeu_ps(pOut + 8, c2x);
+	_mm_storeu_ps(pOut + 24, c2y);
+	_mm_storeu_ps(pOut + 40, c2z);
+	_mm_storeu_ps(pOut + 56, zero);
+
+	_MM_TRANSPOSE4_PS(px, py, pz, c3w);
+	_mm_storeu_ps(pOut + 12, px);
+	_mm_storeu_ps(pOut + 28, py);
+	_mm_storeu_ps(pOut + 44, pz);
+	_mm_storeu_ps(pOut + 60, c3w);
+#else
+	for(unsigned int i = first; i < first + kBatchSize; ++i)
+	{
+		float x2 = mRotationX[i] * 2.0f;
+		float y2 = mRotationY[i] * 2.0f;
+		float z2 = mRotationZ[i] * 2.0f;
+		float xx = mRotationX[i] * x2;
+		float yy = mRotationY[i] * y2;
+		float zz = mRotationZ[i] * z2;
+		float xy = mRotationX[i] * y2;
+		float xz = mRotationX[i] * z2;
+		float yz = mRotationY[i] * z2;
+		float wx = mRotationW[i] * x2;
+		float wy = mRotationW[i] * y2;
+		float wz = mRotationW[i] * z2;
+
+		glm::mat4& world = mWorldMatrices[i];
+		world[0] = glm::vec4((1.0f - (yy + zz)) * mScaleX[i], (xy + wz) * mScaleX[i], (xz - wy) * mScaleX[i], 0.0f);
+		world[1] = glm::vec4((xy - wz) * mScaleY[i], (1.0f - (xx + zz)) * mScaleY[i], (yz + wx) * mScaleY[i], 0.0f);
+		world[2] = glm::vec4((xz + wy) * mScaleZ[i], (yz - wx) * mScaleZ[i], (1.0f - (xx + yy)) * mScaleZ[i], 0.0f);
+		world[3] = glm::vec4(mPositionX[i], mPositionY[i], mPositionZ[i], 1.0f);
+	}
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Turns the local matrix of every composed transform that has a parent into its world matrix, then marks everything clean.
+Notes:
+	ComposeBatch writes whole batches, so this covers every transform in a batch that had anything dirty, not just the dirty ones:
+	a clean child sharing a batch with a dirty transform had its world matrix overwritten with its local matrix too.
+	Parents come first, so each parent's world matrix is already final when its children are reached.
+*/
+void DSGraphics::TransformStore::ApplyParents()
+{
+	unsigned int wordCount = static_cast<unsigned int>(mDirty.size());
+	for(unsigned int word = 0; word < wordCount; ++word)
+	{
+		unsigned int dirty = mDirty[word];
+		if(dirty == 0)
+		{
+			continue;
+		}
+		mDirty[word] = 0;
+
+		//Widen to whole batches
+		unsigned int composed = 0;
+		for(unsigned int batch = 0; batch < kBitsPerWord / kBatchSize; ++batch)
+		{
+			if(((dirty >> (batch * kBatchSize)) & 0xF) != 0)
+			{
+				composed |= 0xFu << (batch * kBatchSize);
+			}
+		}
+
+		unsigned int parented = composed & mHasParent[word];
+		for(unsigned int bit = 0; parented != 0; ++bit, parented >>= 1)
+		{
+			if((parented & 1u) != 0)
+			{
+				unsigned int slot = word * kBitsPerWord + bit;
+				mWorldMatrices[slot] = mWorldMatrices[mParent[slot]] * mWorldMatrices[slot];
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+//  SetParent Sub-Functions
+
+/*
+Description:
+	Moves the transform in slot, along with its whole subtree, to just behind parentSlot, so that it can be attached there and the arrays stay sorted parents first.
+	Returns the transform's new slot.
+Variables:
+	parentSlot = must be after slot.
+Notes:
+	Only [slot, parentSlot] is reordered: whatever in it is outside the subtree keeps its order and moves down, and the subtree follows, also in its own order.
+	Descendants already past parentSlot stay where they are. Every slot reference and the index remap are updated, so indices held outside stay valid.
+	Linear in the size of the store, since a transform anywhere may refer to a slot that moved.
+	Throws, leaving the store untouched, if parentSlot is in the subtree.
+*/
+unsigned int DSGraphics::TransformStore::MoveSubtreeAfter(unsigned int slot, unsigned int parentSlot)
+{
+	//Find the subtree's slots in the range. Parents are stored first, so one pass in order is enough.
+	unsigned int rangeCount = parentSlot - slot + 1;
+	std::vector<bool> isInSubtree(rangeCount, false);
+	isInSubtree[0] = true;
+	for(unsigned int i = 1; i < rangeCount; ++i)
+	{
+		unsigned int parent = mParent[slot + i];
+		isInSubtree[i] = parent != kNoParent && parent >= slot && isInSubtree[parent - slot] == true;
+	}
+
+	if(isInSubtree[rangeCount - 1] == true)
+	{
+		throw std::runtime_error("ERROR: A transform can't be attached to one of its own descendants.");
+	}
+
+	//New order of the range: the rest first, then the subtree
+	std::vector<unsigned int> order;
+	order.reserve(rangeCount);
+	for(unsigned int pass = 0; pass < 2; ++pass)
+	{
+		for(unsigned int i = 0; i < rangeCount; ++i)
+		{
+			if(isInSubtree[i] == (pass == 1))
+			{
+				order.push_back(slot + i);
+			}
+		}
+	}
+
+	std::vector<unsigned int> newSlots(rangeCount);
+	std::vector<bool> wasDirty(rangeCount);
+	for(unsigned int i = 0; i < rangeCount; ++i)
+	{
+		newSlots[order[i] - slot] = slot + i;
+		wasDirty[i] = GetBit(mDirty, slot + i);
+	}
+
+	//Slot references first, wherever they are, then the data itself
+	for(unsigned int i = 0; i < mCount; ++i)
+	{
+		RemapSlot(mParent[i], slot, newSlots);
+		RemapSlot(mFirstChild[i], slot, newSlots);
+		RemapSlot(mNextSibling[i], slot, newSlots);
+	}
+
+	Permute(mPositionX, slot, order);
+	Permute(mPositionY, slot, order);
+	Permute(mPositionZ, slot, order);
+	Permute(mRotationW, slot, order);
+	Permute(mRotationX, slot, order);
+	Permute(mRotationY, slot, order);
+	Permute(mRotationZ, slot, order);
+	Permute(mScaleX, slot, order);
+	Permute(mScaleY, slot, order);
+	Permute(mScaleZ, slot, order);
+	Permute(mIndices, slot, order);
+	Permute(mParent, slot, order);
+	Permute(mFirstChild, slot, order);
+	Permute(mNextSibling, slot, order);
+	Permute(mWorldMatrices, slot, order);
+
+	for(unsigned int i = 0; i < rangeCount; ++i)
+	{
+		unsigned int newSlot = slot + i;
+		mSlots[mIndices[newSlot]] = newSlot;
+		SetBit(mHasParent, newSlot, mParent[newSlot] != kNoParent);
+		SetBit(mHasChildren, newSlot, mFirstChild[newSlot] != kNoParent);
+		SetBit(mDirty, newSlot, wasDirty[order[i] - slot]);
+	}
+
+	return newSlots[0];
+}
+
+//-----------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------
+
+void DSGraphics::TransformStore::MarkDirty(unsigned int slot)
+{
+	mDirty[slot / kBitsPerWord] |= 1u << (slot % kBitsPerWord);
+}
+
+//-----------------------------------------------------------------------------
+
+void DSGraphics::TransformStore::SetBit(std::vector<unsigned int>& bits, unsigned int slot, bool value)
+{
+	if(value == true)
+	{
+		bits[slot / kBitsPerWord] |= 1u << (slot % kBitsPerWord);
+	}
+	else
+	{
+		bits[slot / kBitsPerWord] &= ~(1u << (slot % kBitsPerWord));
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSGraphics::TransformStore::GetBit(const std::vector<unsigned int>& bits, unsigned int slot)
+{
+	return (bits[slot / kBitsPerWord] & (1u << (slot % kBitsPerWord))) != 0;
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+unsigned int DSGraphics::TransformStore::GetCount() const
+{
+	return mCount;
+}
+
+//-----------------------------------------------------------------------------
+
+glm::vec3 DSGraphics::TransformStore::GetPosition(unsigned int index) const
+{
+	unsigned int slot = mSlots[index];
+	return glm::vec3(mPositionX[slot], mPositionY[slot], mPositionZ[slot]);
+}
+
+//-----------------------------------------------------------------------------
+
+DSMathematics::Quaternion DSGraphics::TransformStore::GetRotation(unsigned int index) const
+{
+	unsigned int slot = mSlots[index];
+	return DSMathematics::Quaternion(mRotationW[slot], mRotationX[slot], mRotationY[slot], mRotationZ[slot]);
+}
+
+//-----------------------------------------------------------------------------
+
+glm::vec3 DSGraphics::TransformStore::GetScale(unsigned int index) const
+{
+	unsigned int slot = mSlots[index];
+	return glm::vec3(mScaleX[slot], mScaleY[slot], mScaleZ[slot]);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Only up to date after UpdateWorldMatrices.
+*/
+const glm::mat4& DSGraphics::TransformStore::GetWorldMatrix(unsigned int index) const
+{
+	return mWorldMatrices[mSlots[index]];
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	GetCount() contiguous matrices, ready to be uploaded as one buffer. They are in storage order, so index i's matrix is at GetSlot(i).
+*/
+const glm::mat4* DSGraphics::TransformStore::GetWorldMatrices() const
+{
+	return mWorldMatrices.empty() == true ? nullptr : &mWorldMatrices[0];
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSGraphics::TransformStore::GetIsDirty(unsigned int index) const
+{
+	return GetBit(mDirty, mSlots[index]);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	kNoParent for transforms at the root of a hierarchy.
+*/
+unsigned int DSGraphics::TransformStore::GetParent(unsigned int index) const
+{
+	unsigned int parentSlot = mParent[mSlots[index]];
+	return parentSlot != kNoParent ? mIndices[parentSlot] : kNoParent;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Where index's transform is stored, eg. its position in GetWorldMatrices(). This is index itself until SetParent has to reorder.
+*/
+unsigned int DSGraphics::TransformStore::GetSlot(unsigned int index) const
+{
+	return mSlots[index];
+}
+
+//-----------------------------------------------------------------------------
+// Setters
+//-----------------------------------------------------------------------------
+
+void DSGraphics::TransformStore::SetPosition(unsigned int index, const glm::vec3& position)
+{
+	unsigned int slot = mSlots[index];
+	mPositionX[slot] = position.x;
+	mPositionY[slot] = position.y;
+	mPositionZ[slot] = position.z;
+	MarkDirty(slot);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	rotation = must be a unit quaternion.
+*/
+void DSGraphics::TransformStore::SetRotation(unsigned int index, const DSMathematics::Quaternion& rotation)
+{
+	unsigned int slot = mSlots[index];
+	mRotationW[slot] = rotation.mW;
+	mRotationX[slot] = rotation.mV.x;
+	mRotationY[slot] = rotation.mV.y;
+	mRotationZ[slot] = rotation.mV.z;
+	MarkDirty(slot);
+}
+
+//-----------------------------------------------------------------------------
+
+void DSGraphics::TransformStore::SetScale(unsigned int index, const glm::vec3& scale)
+{
+	unsigned int slot = mSlots[index];
+	mScaleX[slot] = scale.x;
+	mScaleY[slot] = scale.y;
+	mScaleZ[slot] = scale.z;
+	MarkDirty(slot);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	parent = the transform to attach to, or kNoParent to detach. Can't be index itself or one of its descendants.
+Notes:
+	The local position, rotation and scale are kept as they are, so the transform moves along with its new parent.
+	Attaching to a transform created later, eg. docking a unit on a ship that arrived after it, reorders the storage (see MoveSubtreeAfter).
+	That costs a pass over the whole store, so it is for occasional changes rather than every step.
+*/
+void DSGraphics::TransformStore::SetParent(unsigned int index, unsigned int parent)
+{
+	unsigned int slot = mSlots[index];
+	unsigned int parentSlot = parent != kNoParent ? mSlots[parent] : kNoParent;
+
+	if(parentSlot == slot)
+	{
+		throw std::runtime_error("ERROR: A transform can't be its own parent.");
+	}
+
+	//Keep parents first
+	if(parentSlot != kNoParent && parentSlot > slot)
+	{
+		slot = MoveSubtreeAfter(slot, parentSlot);
+		parentSlot = mSlots[parent];
+	}
+
+	//Detach from the old parent
+	unsigned int oldParentSlot = mParent[slot];
+	if(oldParentSlot != kNoParent)
+	{
+		unsigned int* pLink = &mFirstChild[oldParentSlot];
+		while(*pLink != slot)
+		{
+			pLink = &mNextSibling[*pLink];
+		}
+		*pLink = mNextSibling[slot];
+		mNextSibling[slot] = kNoParent;
+
+		SetBit(mHasChildren, oldParentSlot, mFirstChild[oldParentSlot] != kNoParent);
+	}
+
+	//Attach to the new parent
+	if(parentSlot != kNoParent)
+	{
+		mNextSibling[slot] = mFirstChild[parentSlot];
+		mFirstChild[parentSlot] = slot;
+
+		SetBit(mHasChildren, parentSlot, true);
+	}
+
+	mParent[slot] = parentSlot;
+	SetBit(mHasParent, slot, parentSlot != kNoParent);
+	MarkDirty(slot);
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+//=============================================================================
+// File:		TransformStore.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	TransformStore. Structure of arrays storage for many transforms and their parent/child hierarchy, composing only the world matrices that changed.
+//=============================================================================
+
+#ifndef TRANSFORMSTORE_H
+#define TRANSFORMSTORE_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLM
+#include <glm/glm.hpp>
+
+// Standard C++ Libraries
+#include <vector>
+
+// Daniel Schenker
+#include "../DSMathematics/Quaternion.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSGraphics
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Holds position, rotation (a unit quaternion) and scale for every transform, one contiguous array per component.
+		Setters only mark the transform dirty. UpdateWorldMatrices then composes the world matrix of each dirty transform straight from its TRS,
+		four transforms at a time with SSE, and skips every 32 transforms whose dirty word is empty.
+	Notes:
+		The arrays are padded to a multiple of four with identity transforms, so batches never need a remainder loop.
+		Composing a clean transform that shares a batch with a dirty one rewrites the same matrix, which is harmless.
+		Transforms are referred to by index. Indices are handed out in order and stay valid until Clear().
+	Hierarchy:
+		Position, rotation and scale are relative to the parent, if there is one. The arrays are kept sorted parents first:
+		attaching a transform to one stored after it moves the transform and its subtree to just behind the new parent.
+		Indices are handles into a remap table, so they stay valid when transforms move; only the storage order (see GetSlot) changes.
+		Updating is then three linear passes over the dirty words:
+			1. Marking a transform dirty marks its children dirty, in slot order, so a moved parent dirties exactly its subtree.
+			2. Dirty batches compose their local matrices (the same SSE path as transforms without a parent).
+			3. Every composed transform with a parent is multiplied by its parent's world matrix, which is already final since the parent comes first.
+		Words with nothing dirty, which includes every static subtree, are skipped by all three passes.
+	*/
+	class TransformStore
+	{
+	public:
+		//Constructors
+		TransformStore();
+		//Destructor
+		~TransformStore();
+
+	private:
+		//Disable Copy Constructor
+		TransformStore(const TransformStore&);
+		const TransformStore& operator=(const TransformStore&);
+
+		//Member Functions
+	public:
+		// General
+		unsigned int Create();
+		unsigned int Create(const glm::vec3& position, const DSMathematics::Quaternion& rotation, const glm::vec3& scale);
+		unsigned int Create(const glm::vec3& position, const DSMathematics::Quaternion& rotation, const glm::vec3& scale, unsigned int parent);
+		void Reserve(unsigned int count);
+		void Clear();
+
+		// World Matrices
+		void UpdateWorldMatrices();
+		void UpdateWorldMatricesParallel();
+
+	private:
+		// UpdateWorldMatrices Sub-Functions
+		void PropagateDirty();
+		static void UpdateWorldMatricesRange(unsigned int beginWord, unsigned int endWord, void* pUserData);
+		void ComposeBatch(unsigned int first);
+		void ApplyParents();
+
+		// SetParent Sub-Functions
+		unsigned int MoveSubtreeAfter(unsigned int slot, unsigned int parentSlot);
+
+		// Helper Functions
+		void MarkDirty(unsigned int slot);
+		static void SetBit(std::vector<unsigned int>& bits, unsigned int slot, bool value);
+		static bool GetBit(const std::vector<unsigned int>& bits, unsigned int slot);
+
+	public:
+		// Getters
+		unsigned int GetCount() const;
+		glm::vec3 GetPosition(unsigned int index) const;
+		DSMathematics::Quaternion GetRotation(unsigned int index) const;
+		glm::vec3 GetScale(unsigned int index) const;
+		const glm::mat4& GetWorldMatrix(unsigned int index) const;
+		const glm::mat4* GetWorldMatrices() const;
+		bool GetIsDirty(unsigned int index) const;
+		unsigned int GetParent(unsigned int index) const;
+		unsigned int GetSlot(unsigned int index) const;
+
+		// Setters
+		void SetPosition(unsigned int index, const glm::vec3& position);
+		void SetRotation(unsigned int index, const DSMathematics::Quaternion& rotation);
+		void SetScale(unsigned int index, const glm::vec3& scale);
+		void SetParent(unsigned int index, unsigned int parent);
+
+		//Member Variables
+	public:
+		static const unsigned int kNoParent = 0xFFFFFFFF;
+
+	private:
+		static const unsigned int kBatchSize = 4;//transforms composed per SSE batch
+		static const unsigned int kBitsPerWord = 32;
+		static const unsigned int kWordsPerJob = 64;//2048 transforms per job in UpdateWorldMatricesParallel
+
+		unsigned int mCount;
+
+		// Remap
+		std::vector<unsigned int> mSlots;//index -> where its transform is stored
+		std::vector<unsigned int> mIndices;//slot -> index of the transform stored there
+
+		// Position
+		std::vector<float> mPositionX;
+		std::vector<float> mPositionY;
+		std::vector<float> mPositionZ;
+		// Rotation
+		std::vector<float> mRotationW;
+		std::vector<float> mRotationX;
+		std::vector<float> mRotationY;
+		std::vector<float> mRotationZ;
+		// Scale
+		std::vector<float> mScaleX;
+		std::vector<float> mScaleY;
+		std::vector<float> mScaleZ;
+
+		// Hierarchy (slots, not indices)
+		std::vector<unsigned int> mParent;//kNoParent for roots
+		std::vector<unsigned int> mFirstChild;//kNoParent when childless
+		std::vector<unsigned int> mNextSibling;//kNoParent for the last child
+		std::vector<unsigned int> mHasParent;//one bit per transform
+		std::vector<unsigned int> mHasChildren;//one bit per transform
+
+		// Output
+		std::vector<unsigned int> mDirty;//one bit per transform
+		std::vector<glm::mat4> mWorldMatrices;
+	};
+
+}//namespace DSGraphics
+
+#endif //#ifndef TRANSFORMSTORE_H
\ No newline at end of file
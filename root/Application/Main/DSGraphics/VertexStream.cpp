@@ -0,0 +1,338 @@
+//=============================================================================
+// File:		VertexStream.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	VertexStream
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <stdio.h>
+#include <vector>
+
+// Daniel Schenker
+#include "VertexStream.h"
+#include "GpuMemory.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	struct FreeBlock
+	{
+		GLintptr mOffset;
+		GLsizeiptr mSize;
+	};
+
+	struct Page
+	{
+		GLuint mBuffer;
+		GLsizeiptr mSize;
+		GLsizeiptr mAllocated;
+		std::vector<FreeBlock> mFreeBlocks;//sorted by offset, never touching each other
+	};
+
+	std::vector<Page> sPages;
+	GLsizeiptr sPageBytes = 0;//0 until Initialize
+	size_t sAllocatedBytes = 0;
+	size_t sFrameUploadBytes = 0;
+	GLuint sBoundBuffer = 0;//on GL_COPY_WRITE_BUFFER, so a run of Writes to the same page binds it once
+
+	void BindForWriting(GLuint buffer)
+	{
+		if(buffer != sBoundBuffer)
+		{
+			glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+			sBoundBuffer = buffer;
+		}
+	}
+
+	double ToMB(size_t bytes)
+	{
+		return bytes / (1024.0 * 1024.0);
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Variables:
+	pageBytes = the size of each buffer the regions are shared out of. Regions bigger than that get a page of their own.
+*/
+void DSGraphics::VertexStream::Initialize(GLsizeiptr pageBytes)
+{
+	if(sPageBytes != 0)
+	{
+		fprintf(stderr, "WARNING: VertexStream is already initialized.\n");
+		return;
+	}
+
+	sPageBytes = pageBytes;
+	sAllocatedBytes = 0;
+	sFrameUploadBytes = 0;
+	sBoundBuffer = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Regions still allocated are reported, since whoever holds them is about to be left drawing from a deleted buffer.
+*/
+void DSGraphics::VertexStream::Terminate()
+{
+	if(sAllocatedBytes != 0)
+	{
+		fprintf(stderr, "WARNING: %.1f KB of VertexStream regions were not freed before VertexStream::Terminate.\n", sAllocatedBytes / 1024.0);
+	}
+
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	for(size_t i = 0; i < sPages.size(); ++i)
+	{
+		DSGraphics::GpuMemory::DeleteBuffer(sPages[i].mBuffer);
+	}
+	sPages.clear();
+
+	sPageBytes = 0;
+	sAllocatedBytes = 0;
+	sBoundBuffer = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Starts counting GetFrameUploadBytes again. Call once per frame.
+*/
+void DSGraphics::VertexStream::BeginFrame()
+{
+	sFrameUploadBytes = 0;
+}
+
+//-----------------------------------------------------------------------------
+//  Regions
+
+/*
+Description:
+	Finds size bytes in the first page with room for them, adding a page if none has. Returns false, with a warning, if VertexStream isn't initialized.
+	The region's contents are undefined until written or copied to.
+*/
+bool DSGraphics::VertexStream::Allocate(GLsizeiptr size, DSGraphics::VertexStreamRegion& region)
+{
+	if(sPageBytes == 0)
+	{
+		fprintf(stderr, "WARNING: VertexStream is used before VertexStream::Initialize.\n");
+		return false;
+	}
+
+	const GLsizeiptr kAlign = kAlignment;
+	GLsizeiptr alignedSize = (size + kAlign - 1) / kAlign * kAlign;
+
+	for(unsigned int i = 0; i < sPages.size(); ++i)
+	{
+		std::vector<FreeBlock>& freeBlocks = sPages[i].mFreeBlocks;
+		for(size_t j = 0; j < freeBlocks.size(); ++j)
+		{
+			if(freeBlocks[j].mSize < alignedSize)
+			{
+				continue;
+			}
+
+			region.mBuffer = sPages[i].mBuffer;
+			region.mPage = i;
+			region.mOffset = freeBlocks[j].mOffset;
+			region.mSize = alignedSize;
+
+			freeBlocks[j].mOffset += alignedSize;
+			freeBlocks[j].mSize -= alignedSize;
+			if(freeBlocks[j].mSize == 0)
+			{
+				freeBlocks.erase(freeBlocks.begin() + j);
+			}
+
+			sPages[i].mAllocated += alignedSize;
+			sAllocatedBytes += alignedSize;
+			return true;
+		}
+	}
+
+	//No room anywhere, so a new page, with the region at its start
+	Page page;
+	page.mBuffer = 0;
+	page.mSize = alignedSize > sPageBytes ? alignedSize : sPageBytes;
+	page.mAllocated = alignedSize;
+	glGenBuffers(1, &page.mBuffer);
+	BindForWriting(page.mBuffer);
+	DSGraphics::GpuMemory::BufferData(GL_COPY_WRITE_BUFFER, page.mBuffer, page.mSize, NULL, GL_DYNAMIC_DRAW, DSGraphics::kGpuMemoryVertex, "VertexStream");
+	if(page.mSize > alignedSize)
+	{
+		FreeBlock rest = { alignedSize, page.mSize - alignedSize };
+		page.mFreeBlocks.push_back(rest);
+	}
+	sPages.push_back(page);
+
+	region.mBuffer = page.mBuffer;
+	region.mPage = static_cast<unsigned int>(sPages.size() - 1);
+	region.mOffset = 0;
+	region.mSize = alignedSize;
+	sAllocatedBytes += alignedSize;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Gives the region back to its page, merged with any free space on either side, and nulls it.
+Notes:
+	The GPU may still be drawing from the region this frame; that is safe, since the driver orders any later write to it after those draws.
+*/
+void DSGraphics::VertexStream::Free(DSGraphics::VertexStreamRegion& region)
+{
+	if(region.mBuffer == 0)
+	{
+		return;
+	}
+	if(region.mPage >= sPages.size() || sPages[region.mPage].mBuffer != region.mBuffer)
+	{
+		fprintf(stderr, "WARNING: VertexStream::Free was given a region that isn't from VertexStream.\n");
+		region = DSGraphics::VertexStreamRegion();
+		return;
+	}
+
+	Page& page = sPages[region.mPage];
+	std::vector<FreeBlock>& freeBlocks = page.mFreeBlocks;
+
+	//The first free block after the region
+	size_t next = 0;
+	while(next < freeBlocks.size() && freeBlocks[next].mOffset < region.mOffset)
+	{
+		++next;
+	}
+
+	bool isMergedBefore = next > 0 && freeBlocks[next - 1].mOffset + freeBlocks[next - 1].mSize == region.mOffset;
+	bool isMergedAfter = next < freeBlocks.size() && region.mOffset + region.mSize == freeBlocks[next].mOffset;
+	if(isMergedBefore == true && isMergedAfter == true)
+	{
+		freeBlocks[next - 1].mSize += region.mSize + freeBlocks[next].mSize;
+		freeBlocks.erase(freeBlocks.begin() + next);
+	}
+	else if(isMergedBefore == true)
+	{
+		freeBlocks[next - 1].mSize += region.mSize;
+	}
+	else if(isMergedAfter == true)
+	{
+		freeBlocks[next].mOffset = region.mOffset;
+		freeBlocks[next].mSize += region.mSize;
+	}
+	else
+	{
+		FreeBlock block = { region.mOffset, region.mSize };
+		freeBlocks.insert(freeBlocks.begin() + next, block);
+	}
+
+	page.mAllocated -= region.mSize;
+	sAllocatedBytes -= region.mSize;
+	region = DSGraphics::VertexStreamRegion();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Uploads size bytes to offset bytes into the region, leaving the rest of it as it was.
+*/
+void DSGraphics::VertexStream::Write(const DSGraphics::VertexStreamRegion& region, GLintptr offset, GLsizeiptr size, const GLvoid* pData)
+{
+	if(region.mBuffer == 0 || offset < 0 || size <= 0 || offset + size > region.mSize)
+	{
+		if(size != 0)
+		{
+			fprintf(stderr, "WARNING: VertexStream::Write is outside of its region (%lld bytes at %lld, of %lld).\n", static_cast<long long>(size), static_cast<long long>(offset), static_cast<long long>(region.mSize));
+		}
+		return;
+	}
+
+	BindForWriting(region.mBuffer);
+	glBufferSubData(GL_COPY_WRITE_BUFFER, region.mOffset + offset, size, pData);
+	sFrameUploadBytes += static_cast<size_t>(size);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Fills the start of the region with size bytes from sourceBuffer, copied on the GPU.
+*/
+void DSGraphics::VertexStream::Copy(GLuint sourceBuffer, GLintptr sourceOffset, const DSGraphics::VertexStreamRegion& region, GLsizeiptr size)
+{
+	if(region.mBuffer == 0 || size > region.mSize)
+	{
+		fprintf(stderr, "WARNING: VertexStream::Copy is bigger than its region (%lld bytes, of %lld).\n", static_cast<long long>(size), static_cast<long long>(region.mSize));
+		return;
+	}
+
+	BindForWriting(region.mBuffer);
+	glBindBuffer(GL_COPY_READ_BUFFER, sourceBuffer);
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, sourceOffset, region.mOffset, size);
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+}
+
+//-----------------------------------------------------------------------------
+//  Reports
+
+void DSGraphics::VertexStream::PrintSummary()
+{
+	size_t pageBytes = 0;
+	for(size_t i = 0; i < sPages.size(); ++i)
+	{
+		pageBytes += static_cast<size_t>(sPages[i].mSize);
+	}
+
+	printf("Vertex stream: %u pages, %.2f MB of %.2f MB allocated, %.2f MB uploaded this frame\n", GetPageCount(), ToMB(sAllocatedBytes), ToMB(pageBytes), ToMB(sFrameUploadBytes));
+	for(size_t i = 0; i < sPages.size(); ++i)
+	{
+		printf("  Page %-3u %9.2f of %.2f MB in use, %u free blocks\n", static_cast<unsigned int>(i), ToMB(static_cast<size_t>(sPages[i].mAllocated)), ToMB(static_cast<size_t>(sPages[i].mSize)), static_cast<unsigned int>(sPages[i].mFreeBlocks.size()));
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+unsigned int DSGraphics::VertexStream::GetPageCount()
+{
+	return static_cast<unsigned int>(sPages.size());
+}
+
+//-----------------------------------------------------------------------------
+
+size_t DSGraphics::VertexStream::GetAllocatedBytes()
+{
+	return sAllocatedBytes;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Bytes uploaded by Write since BeginFrame.
+*/
+size_t DSGraphics::VertexStream::GetFrameUploadBytes()
+{
+	return sFrameUploadBytes;
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+//=============================================================================
+// File:		VertexStream.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	VertexStream. A few large dynamic vertex buffers, shared out in regions to meshes whose vertices change while they are drawn.
+//=============================================================================
+
+#ifndef VERTEXSTREAM_H
+#define VERTEXSTREAM_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLEW
+#include <GL/glew.h>
+
+// Standard C++ Libraries
+#include <cstddef>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSGraphics
+{
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	/*
+	Notes:
+		Where a mesh's vertices live: mSize bytes at mOffset into mBuffer. Null (mBuffer 0) until allocated.
+	*/
+	struct VertexStreamRegion
+	{
+		VertexStreamRegion()
+		:	mBuffer(0)
+		,	mPage(0)
+		,	mOffset(0)
+		,	mSize(0)
+		{
+		}
+
+		GLuint mBuffer;
+		unsigned int mPage;
+		GLintptr mOffset;
+		GLsizeiptr mSize;
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Every deforming mesh needs its own vertices on the GPU, and giving each one its own buffer means hundreds of buffer objects,
+		and a glBufferData (a reallocation) for each of them whenever it changes.
+		Instead the vertices are sub-allocated from pages of kDefaultPageBytes, each a single GL_DYNAMIC_DRAW buffer, allocated once and kept.
+		A region is allocated once per mesh and then updated in place with Write, which uploads only the bytes given (glBufferSubData).
+	Usage:
+		DSGraphics::VertexStream::Initialize();
+		DSGraphics::VertexStreamRegion region;
+		DSGraphics::VertexStream::Allocate(bytes, region);
+		DSGraphics::VertexStream::Copy(masterVbo, 0, region, bytes);//start from another buffer's contents, without going through the CPU
+		...
+		DSGraphics::VertexStream::Write(region, firstChangedByte, changedBytes, pChangedVertices);
+		...
+		DSGraphics::VertexStream::Free(region);
+		DSGraphics::VertexStream::Terminate();
+	Notes:
+		Must only be used on the thread that owns the GL context.
+		Writing goes through GL_COPY_WRITE_BUFFER, so it never disturbs a VAO's or the GL_ARRAY_BUFFER binding.
+		Pages are never freed before Terminate; a freed region is merged with its free neighbours and reused.
+	*/
+	class VertexStream
+	{
+	private:
+		//Constructors
+		VertexStream();
+
+		//Member Functions
+	public:
+		// General
+		static void Initialize(GLsizeiptr pageBytes = kDefaultPageBytes);
+		static void Terminate();
+		static void BeginFrame();
+
+		// Regions
+		static bool Allocate(GLsizeiptr size, DSGraphics::VertexStreamRegion& region);
+		static void Free(DSGraphics::VertexStreamRegion& region);
+		static void Write(const DSGraphics::VertexStreamRegion& region, GLintptr offset, GLsizeiptr size, const GLvoid* pData);
+		static void Copy(GLuint sourceBuffer, GLintptr sourceOffset, const DSGraphics::VertexStreamRegion& region, GLsizeiptr size);
+
+		// Reports
+		static void PrintSummary();
+
+		// Getters
+		static unsigned int GetPageCount();
+		static size_t GetAllocatedBytes();
+		static size_t GetFrameUploadBytes();
+
+		//Member Variables
+	public:
+		static const GLsizeiptr kDefaultPageBytes = 4 * 1024 * 1024;
+		static const GLsizeiptr kAlignment = 64;//every region starts on a cache line
+	};
+
+}//namespace DSGraphics
+
+#endif //#ifndef VERTEXSTREAM_H
\ No newline at end of file
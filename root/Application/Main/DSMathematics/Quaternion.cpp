@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		Quaternion.cpp
 // Created:		2015/02/25
-// Last Edited:	2015/04/10
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	Quaternion
 //=============================================================================
@@ -10,16 +10,82 @@
 //Includes
 //=============================================================================
 
-//debugging only
-#include <stdio.h>
+// Standard C++ Libraries
+#include <type_traits>
 
 // Daniel Schenker
 #include "Quaternion.h"
+#include "../DSSystem/Platform.h"
 
 //=============================================================================
 //Statics
 //=============================================================================
 
+static_assert(sizeof(DSMathematics::Quaternion) == 4 * sizeof(float), "Quaternion must be exactly (w, x, y, z) to be loaded as one SSE register");
+static_assert(std::is_trivially_copyable<DSMathematics::Quaternion>::value, "Quaternion must stay trivially copyable (no virtual functions or hand-written copies)");
+
+namespace
+{
+#if defined(DS_SSE)
+	//Quaternions are loaded as (w, x, y, z), vectors as (0, x, y, z)
+
+	DS_FORCEINLINE __m128 Load(const DSMathematics::Quaternion& q)
+	{
+		return _mm_loadu_ps(&q.mW);
+	}
+
+	DS_FORCEINLINE void Store(DSMathematics::Quaternion& q, __m128 v)
+	{
+		_mm_storeu_ps(&q.mW, v);
+	}
+
+	//Sum of the four products, in every lane
+	DS_FORCEINLINE __m128 Dot4(__m128 a, __m128 b)
+	{
+		__m128 m = _mm_mul_ps(a, b);
+		m = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	//Cross product of lanes 1-3, with lane 0 left at 0
+	DS_FORCEINLINE __m128 Cross(__m128 a, __m128 b)
+	{
+		__m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 3, 2, 0));
+		__m128 aZXY = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 1, 3, 0));
+		__m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 3, 2, 0));
+		__m128 bZXY = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 1, 3, 0));
+		return _mm_sub_ps(_mm_mul_ps(aYZX, bZXY), _mm_mul_ps(aZXY, bYZX));
+	}
+
+	//Hamilton product p * q
+	DS_FORCEINLINE __m128 HamiltonProduct(__m128 p, __m128 q)
+	{
+		const __m128 kSignX = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 kSignY = _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f);
+		const __m128 kSignZ = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+
+		__m128 r = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0)), q);
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1)), _mm_xor_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 3, 0, 1)), kSignX)));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2)), _mm_xor_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(1, 0, 3, 2)), kSignY)));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3)), _mm_xor_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 1, 2, 3)), kSignZ)));
+		return r;
+	}
+
+	DS_FORCEINLINE __m128 Normalize4(__m128 q)
+	{
+		return _mm_div_ps(q, _mm_sqrt_ps(Dot4(q, q)));
+	}
+
+	//a + (b - a) * t, with b flipped onto a's hemisphere, normalized
+	DS_FORCEINLINE __m128 Nlerp4(__m128 a, __m128 b, __m128 t)
+	{
+		__m128 sign = _mm_and_ps(_mm_cmplt_ps(Dot4(a, b), _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+		b = _mm_xor_ps(b, sign);
+		return Normalize4(_mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t)));
+	}
+#endif
+}
+
 //=============================================================================
 //Class Definitions
 //=============================================================================
@@ -51,52 +117,12 @@ Variables:
 */
 DSMathematics::Quaternion::Quaternion(float a, const glm::vec3& n)
 {
-	mW = cos(a / 2);
-	mV.x = n.x * sin(a / 2);
-	mV.y = n.y * sin(a / 2);
-	mV.z = n.z * sin(a / 2);
-}
+	float sinHalfAngle = sin(a / 2);
 
-//-----------------------------------------------------------------------------
-// Destructor
-//-----------------------------------------------------------------------------
-
-DSMathematics::Quaternion::~Quaternion()
-{
-}
-
-//-----------------------------------------------------------------------------
-// Copy Constructor
-//-----------------------------------------------------------------------------
-
-DSMathematics::Quaternion::Quaternion(const DSMathematics::Quaternion& rhs)
-{
-	mW = rhs.mW;
-	//mV = rhs.mV
-	mV.x = rhs.mV.x;
-	mV.y = rhs.mV.y;
-	mV.z = rhs.mV.z;
-}
-
-//-----------------------------------------------------------------------------
-// Copy-Assignment Operator
-//-----------------------------------------------------------------------------
-
-DSMathematics::Quaternion& DSMathematics::Quaternion::operator= (const DSMathematics::Quaternion& rhs)
-{
-	//Check for self-assignment by comparing the address of the implicit object and the paramter
-	if(this == &rhs)
-	{
-		return *this;
-	}
-
-	mW = rhs.mW;
-	//mV = rhs.mV
-	mV.x = rhs.mV.x;
-	mV.y = rhs.mV.y;
-	mV.z = rhs.mV.z;
-
-	return *this;
+	mW = cos(a / 2);
+	mV.x = n.x * sinHalfAngle;
+	mV.y = n.y * sinHalfAngle;
+	mV.z = n.z * sinHalfAngle;
 }
 
 //-----------------------------------------------------------------------------
@@ -114,12 +140,6 @@ DSMathematics::Quaternion DSMathematics::Quaternion::Invert() const
 	DSMathematics::Quaternion i;
 	i.mW = mW;
 	i.mV = -mV;
-	/*
-	//same as above for i.mV, just in case the vector copy-assignment operator is not supported.
-	i.mV.x = -mV.x;
-	i.mV.y = -mV.y;
-	i.mV.z = -mV.z;
-	*/
 
 	return i;
 }
@@ -131,28 +151,21 @@ Description:
 	Returns the multiplication of this quaternion with another quaternion.
 	Does not modify original quaternion, rather returns a new one.
 	Operator overloading style, done through a function instead
+Notes:
+	This is the Hamilton product q * (*this), which is the rotation of this quaternion followed by the rotation of q.
 */
 DSMathematics::Quaternion DSMathematics::Quaternion::Multiply(const DSMathematics::Quaternion& q) const
 {
 	DSMathematics::Quaternion m;
 
-	//Non-Optimized Version:
-	m.mW = (mW * q.mW) - glm::dot(mV, q.mV);
-	m.mV = (mV * q.mW) + (q.mV * mW) + glm::cross(q.mV, mV);
-
-	//Optimized Version: (incomplete, requires minor left to right hand fixes, but the concept is correct)
-	/*
-	w = w1w2 - x1x2 - y1y2 - z1z2
-	x = w1x2 + x1w2 + y1z2 - z1y2
-	y = w1y2 + y1w2 + z1x2 - x1z2
-	z = w1z2 + z1w2 + x1y2 - y1x2
-	*/
-	/*
-	m.mW = (mW * q.mW) - (mV.x * q.mV.x) - (mV.y * q.mV.y) - (mV.z * q.mV.z);
-	m.mV.x = (mW * q.mV.x) + (mV.x * q.mW) + (mV.y * q.mV.z) - (mV.z * q.mV.y);
-	m.mV.y = (mW * q.mV.y) + (mV.y * q.mW) + (mV.z * q.mV.x) - (mV.x * q.mV.z);
-	m.mV.z = (mW * q.mV.z) + (mV.z * q.mW) + (mV.x * q.mV.y) - (mV.y * q.mV.x);
-	*/
+#if defined(DS_SSE)
+	Store(m, HamiltonProduct(Load(q), Load(*this)));
+#else
+	m.mW = (q.mW * mW) - (q.mV.x * mV.x) - (q.mV.y * mV.y) - (q.mV.z * mV.z);
+	m.mV.x = (q.mW * mV.x) + (q.mV.x * mW) + (q.mV.y * mV.z) - (q.mV.z * mV.y);
+	m.mV.y = (q.mW * mV.y) - (q.mV.x * mV.z) + (q.mV.y * mW) + (q.mV.z * mV.x);
+	m.mV.z = (q.mW * mV.z) + (q.mV.x * mV.y) - (q.mV.y * mV.x) + (q.mV.z * mW);
+#endif
 
 	return m;
 }
@@ -173,24 +186,26 @@ glm::vec3 DSMathematics::Quaternion::Rotate(const glm::vec3& v) const
 		(q)(p)(q.Invert())
 	Can also be described as:
 		qpq^i where ^i means inverse
-	A simplified version of the basic equation is used instead for optimization.
-
-	Above mentioned basic equation form:
-
-	DSMathematics::Quaternion p;
-	p.mW = 0;
-	p.mV = v;
-
-	const Quaternion& q = (*this);
-	//return (q * p * q.Invert()).mV;
-	DSMathematics::Quaternion res = p.Multiply(q.Invert());
-	res = q.Multiply(res);
-	return res.mV;
+	A simplified version of the basic equation is used instead for optimization:
+		t = 2(q.v x v)
+		v' = v + q.w * t + (q.v x t)
 	*/
 
-	//Above mentioned optimized form:
-	glm::vec3 mVCrossv = glm::cross(mV, v);
-	return v + ((2.0f * mW) * mVCrossv) + (2.0f * glm::cross(mV, mVCrossv));
+#if defined(DS_SSE)
+	__m128 q = Load(*this);
+	__m128 p = _mm_setr_ps(0.0f, v.x, v.y, v.z);
+
+	__m128 t = Cross(q, p);
+	t = _mm_add_ps(t, t);
+	__m128 r = _mm_add_ps(p, _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 0, 0, 0)), t), Cross(q, t)));
+
+	float result[4];
+	_mm_storeu_ps(result, r);
+	return glm::vec3(result[1], result[2], result[3]);
+#else
+	glm::vec3 t = 2.0f * glm::cross(mV, v);
+	return v + (mW * t) + glm::cross(mV, t);
+#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -198,34 +213,73 @@ glm::vec3 DSMathematics::Quaternion::Rotate(const glm::vec3& v) const
 /*
 Description:
 	SLERP (Spherical Linear Interpolation)
-	Start at current quaternion, end at quaternion r, over t time.
+	Start at current quaternion, end at quaternion r, over t time, at a constant angular speed along the shorter way around.
 Variables:
 	r = final rotation
-	t = how far along the rotation we are
+	t = how far along the rotation we are, from 0 to 1
+Notes:
+	Blends the two quaternions directly with weights sin((1 - t)a) / sin(a) and sin(ta) / sin(a), where a is the angle between them,
+	rather than going through axis/angle and Power. Nearly identical orientations fall back to Nlerp, where the weights are unstable and the difference invisible.
 */
 DSMathematics::Quaternion DSMathematics::Quaternion::Slerp(const Quaternion& r, float t) const
 {
-	//Basic Version
-	/*
-	p = (r * q^-1)^t * q
+	float cosAngle = Dot(r);
+	float sign = 1.0f;
+	if(cosAngle < 0.0f)
+	{
+		cosAngle = -cosAngle;
+		sign = -1.0f;
+	}
 
-		inside		= (r * q^-1)
-					=r.Multiply(q.Invert())
+	if(cosAngle > 0.9995f)
+	{
+		return Nlerp(r, t);
+	}
 
-		power		= inside.Power(t)
+	float angle = acos(cosAngle);
+	float invSinAngle = 1.0f / sqrt(1.0f - (cosAngle * cosAngle));
+	float weightThis = sin((1.0f - t) * angle) * invSinAngle;
+	float weightR = sin(t * angle) * invSinAngle * sign;
 
-		multiplied	= q.Multiply(power)
+	DSMathematics::Quaternion s;
+#if defined(DS_SSE)
+	Store(s, _mm_add_ps(_mm_mul_ps(Load(*this), _mm_set1_ps(weightThis)), _mm_mul_ps(Load(r), _mm_set1_ps(weightR))));
+#else
+	s.mW = (mW * weightThis) + (r.mW * weightR);
+	s.mV = (mV * weightThis) + (r.mV * weightR);
+#endif
 
-	Note: q isn't referred to since q refers to *this quaternion, and thus all quaternion functions not scoped refer to *this, aka q.
-	*/
+	return s;
+}
+
+//-----------------------------------------------------------------------------
 
-	Quaternion inside = r.Multiply(Invert());
-	Quaternion power = inside.Power(t);
-	Quaternion multiplied = Multiply(power);
+/*
+Description:
+	NLERP (Normalized Linear Interpolation)
+	Blends the components and normalizes the result. Much cheaper than Slerp (no trigonometry),
+	at the cost of a non-constant angular speed, which is only noticeable when interpolating between orientations far apart.
+	Always takes the shorter way around.
+Variables:
+	r = final rotation
+	t = how far along the rotation we are, from 0 to 1
+*/
+DSMathematics::Quaternion DSMathematics::Quaternion::Nlerp(const Quaternion& r, float t) const
+{
+	DSMathematics::Quaternion n;
 
-	return multiplied;
+#if defined(DS_SSE)
+	Store(n, Nlerp4(Load(*this), Load(r), _mm_set1_ps(t)));
+#else
+	//q and -q are the same rotation; flip r if needed so that the blend doesn't go the long way around
+	float sign = Dot(r) < 0.0f ? -1.0f : 1.0f;
 
-	//Optimized Version (TODO)
+	n.mW = mW + (((r.mW * sign) - mW) * t);
+	n.mV = mV + (((r.mV * sign) - mV) * t);
+	n = n.Normalize();
+#endif
+
+	return n;
 }
 
 //-----------------------------------------------------------------------------
@@ -248,6 +302,39 @@ DSMathematics::Quaternion DSMathematics::Quaternion::Power(float t) const
 	return Quaternion(a * t, n);
 }
 
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Returns this quaternion scaled to unit length.
+	Repeatedly multiplied quaternions slowly drift away from unit length, which would start scaling as well as rotating.
+*/
+DSMathematics::Quaternion DSMathematics::Quaternion::Normalize() const
+{
+	DSMathematics::Quaternion n;
+
+#if defined(DS_SSE)
+	Store(n, Normalize4(Load(*this)));
+#else
+	float invLength = 1.0f / sqrt(Dot(*this));
+	n.mW = mW * invLength;
+	n.mV = mV * invLength;
+#endif
+
+	return n;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Four dimensional dot product. For unit quaternions this is the cosine of half the angle between the two orientations.
+*/
+float DSMathematics::Quaternion::Dot(const Quaternion& q) const
+{
+	return (mW * q.mW) + (mV.x * q.mV.x) + (mV.y * q.mV.y) + (mV.z * q.mV.z);
+}
+
 //-----------------------------------------------------------------------------
 //  Conversions
 
@@ -257,11 +344,8 @@ Variables:
 */
 void DSMathematics::Quaternion::ToAxisAngle(glm::vec3& axis, float& a) const
 {
-	/*
-	The LengthSquared function in glm (length2()) only exists in glx (experimental version of glm)
-	This is extremely wasteful, and will be corrected when I implement my own vectors instead of relying on glm's.
-	*/
-	float vLen = mV.length();
+	//Note: mV.length() is the number of components in glm (always 3), not the vector's length.
+	float vLen = glm::length(mV);
 
 	if((vLen * vLen) < 0.0001f)
 	{
@@ -269,12 +353,166 @@ void DSMathematics::Quaternion::ToAxisAngle(glm::vec3& axis, float& a) const
 	}
 	else
 	{
-		axis = glm::normalize(mV);
+		axis = mV / vLen;
 	}
 
 	//TAssert(fabs(vecAxis.LengthSqr() - 1) < 0.000001f);
 
-	a = acos(mW) * 2;
+	a = acos(glm::clamp(mW, -1.0f, 1.0f)) * 2;
+}
+
+//-----------------------------------------------------------------------------
+//  Batch
+
+/*
+Description:
+	pOut[i] = pA[i].Multiply(pB[i])
+Notes:
+	Processes four quaternions per iteration, transposed so that each SSE register holds one component of all four.
+	pOut may be the same array as pA or pB.
+*/
+void DSMathematics::Quaternion::MultiplyArray(const Quaternion* pA, const Quaternion* pB, Quaternion* pOut, unsigned int count)
+{
+	unsigned int i = 0;
+
+#if defined(DS_SSE)
+	for(; i + 4 <= count; i += 4)
+	{
+		//q = this (a), p = the one applied after it (b); result is the Hamilton product p * q
+		__m128 qw = Load(pA[i + 0]);
+		__m128 qx = Load(pA[i + 1]);
+		__m128 qy = Load(pA[i + 2]);
+		__m128 qz = Load(pA[i + 3]);
+		_MM_TRANSPOSE4_PS(qw, qx, qy, qz);
+		__m128 pw = Load(pB[i + 0]);
+		__m128 px = Load(pB[i + 1]);
+		__m128 py = Load(pB[i + 2]);
+		__m128 pz = Load(pB[i + 3]);
+		_MM_TRANSPOSE4_PS(pw, px, py, pz);
+
+		__m128 w = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(pw, qw), _mm_mul_ps(px, qx)), _mm_add_ps(_mm_mul_ps(py, qy), _mm_mul_ps(pz, qz)));
+		__m128 x = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pw, qx), _mm_mul_ps(px, qw)), _mm_sub_ps(_mm_mul_ps(py, qz), _mm_mul_ps(pz, qy)));
+		__m128 y = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(pw, qy), _mm_mul_ps(px, qz)), _mm_add_ps(_mm_mul_ps(py, qw), _mm_mul_ps(pz, qx)));
+		__m128 z = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pw, qz), _mm_mul_ps(px, qy)), _mm_sub_ps(_mm_mul_ps(pz, qw), _mm_mul_ps(py, qx)));
+
+		_MM_TRANSPOSE4_PS(w, x, y, z);
+		Store(pOut[i + 0], w);
+		Store(pOut[i + 1], x);
+		Store(pOut[i + 2], y);
+		Store(pOut[i + 3], z);
+	}
+#endif
+
+	//Remainder (or everything, without SSE)
+	for(; i < count; ++i)
+	{
+		pOut[i] = pA[i].Multiply(pB[i]);
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	pOut[i] = pQ[i].Rotate(pV[i])
+Notes:
+	pOut may be the same array as pV.
+*/
+void DSMathematics::Quaternion::RotateArray(const Quaternion* pQ, const glm::vec3* pV, glm::vec3* pOut, unsigned int count)
+{
+	unsigned int i = 0;
+
+#if defined(DS_SSE)
+	for(; i + 4 <= count; i += 4)
+	{
+		__m128 qw = Load(pQ[i + 0]);
+		__m128 qx = Load(pQ[i + 1]);
+		__m128 qy = Load(pQ[i + 2]);
+		__m128 qz = Load(pQ[i + 3]);
+		_MM_TRANSPOSE4_PS(qw, qx, qy, qz);
+		__m128 vx = _mm_setr_ps(pV[i + 0].x, pV[i + 1].x, pV[i + 2].x, pV[i + 3].x);
+		__m128 vy = _mm_setr_ps(pV[i + 0].y, pV[i + 1].y, pV[i + 2].y, pV[i + 3].y);
+		__m128 vz = _mm_setr_ps(pV[i + 0].z, pV[i + 1].z, pV[i + 2].z, pV[i + 3].z);
+
+		//t = 2(q.v x v)
+		__m128 tx = _mm_sub_ps(_mm_mul_ps(qy, vz), _mm_mul_ps(qz, vy));
+		__m128 ty = _mm_sub_ps(_mm_mul_ps(qz, vx), _mm_mul_ps(qx, vz));
+		__m128 tz = _mm_sub_ps(_mm_mul_ps(qx, vy), _mm_mul_ps(qy, vx));
+		tx = _mm_add_ps(tx, tx);
+		ty = _mm_add_ps(ty, ty);
+		tz = _mm_add_ps(tz, tz);
+
+		//v' = v + q.w * t + (q.v x t)
+		float x[4];
+		float y[4];
+		float z[4];
+		_mm_storeu_ps(x, _mm_add_ps(_mm_add_ps(vx, _mm_mul_ps(qw, tx)), _mm_sub_ps(_mm_mul_ps(qy, tz), _mm_mul_ps(qz, ty))));
+		_mm_storeu_ps(y, _mm_add_ps(_mm_add_ps(vy, _mm_mul_ps(qw, ty)), _mm_sub_ps(_mm_mul_ps(qz, tx), _mm_mul_ps(qx, tz))));
+		_mm_storeu_ps(z, _mm_add_ps(_mm_add_ps(vz, _mm_mul_ps(qw, tz)), _mm_sub_ps(_mm_mul_ps(qx, ty), _mm_mul_ps(qy, tx))));
+
+		for(unsigned int j = 0; j < 4; ++j)
+		{
+			pOut[i + j] = glm::vec3(x[j], y[j], z[j]);
+		}
+	}
+#endif
+
+	//Remainder (or everything, without SSE)
+	for(; i < count; ++i)
+	{
+		pOut[i] = pQ[i].Rotate(pV[i]);
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	pOut[i] = pA[i].Nlerp(pB[i], t)
+Notes:
+	pOut may be the same array as pA or pB.
+*/
+void DSMathematics::Quaternion::NlerpArray(const Quaternion* pA, const Quaternion* pB, float t, Quaternion* pOut, unsigned int count)
+{
+	unsigned int i = 0;
+
+#if defined(DS_SSE)
+	__m128 t4 = _mm_set1_ps(t);
+	for(; i < count; ++i)
+	{
+		Store(pOut[i], Nlerp4(Load(pA[i]), Load(pB[i]), t4));
+	}
+#endif
+
+	//Without SSE
+	for(; i < count; ++i)
+	{
+		pOut[i] = pA[i].Nlerp(pB[i], t);
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Normalizes every quaternion in place.
+*/
+void DSMathematics::Quaternion::NormalizeArray(Quaternion* pQ, unsigned int count)
+{
+	unsigned int i = 0;
+
+#if defined(DS_SSE)
+	for(; i < count; ++i)
+	{
+		Store(pQ[i], Normalize4(Load(pQ[i])));
+	}
+#endif
+
+	//Without SSE
+	for(; i < count; ++i)
+	{
+		pQ[i] = pQ[i].Normalize();
+	}
 }
 
 //-----------------------------------------------------------------------------
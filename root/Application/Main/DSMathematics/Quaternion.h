@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		Quaternion.h
 // Created:		2015/02/25
-// Last Edited:	2015/04/10
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	Quaternion
 //=============================================================================
@@ -36,6 +36,14 @@ namespace DSMathematics
 	//Class Declarations
 	//=============================================================================
 
+	/*
+	Notes:
+		Trivially copyable and exactly 16 bytes with mW first, so a quaternion loads straight into one SSE register as (w, x, y, z),
+		and arrays of them can be copied with memcpy and processed in batches.
+		It is deliberately not declared 16 byte aligned: 32 bit Windows heaps only guarantee 8 byte alignment, and quaternions live inside heap objects (Camera, ModelInstance).
+		Unaligned loads cost the same as aligned ones when the data happens to be aligned anyway.
+		a.Multiply(b) is the rotation a followed by the rotation b.
+	*/
 	class Quaternion
 	{
 	public:
@@ -43,12 +51,6 @@ namespace DSMathematics
 		Quaternion();
 		Quaternion(float w, float x, float y, float z);
 		Quaternion(float a, const glm::vec3& n);
-		//Destructor
-		virtual ~Quaternion();
-		//Copy Constructor
-		Quaternion(const Quaternion& rhs);
-		//Copy-Assignment Operator
-		Quaternion& operator= (const Quaternion& rhs);
 
 		//Member Functions
 		// General
@@ -56,10 +58,17 @@ namespace DSMathematics
 		Quaternion Multiply(const Quaternion& q) const;
 		glm::vec3 Rotate(const glm::vec3& v) const;
 		Quaternion Slerp(const Quaternion& r, float t) const;
+		Quaternion Nlerp(const Quaternion& r, float t) const;
 		Quaternion Power(float t) const;
+		Quaternion Normalize() const;
+		float Dot(const Quaternion& q) const;
 		// Conversions
 		void ToAxisAngle(glm::vec3& axis, float& a) const;
-	
+		// Batch
+		static void MultiplyArray(const Quaternion* pA, const Quaternion* pB, Quaternion* pOut, unsigned int count);
+		static void RotateArray(const Quaternion* pQ, const glm::vec3* pV, glm::vec3* pOut, unsigned int count);
+		static void NlerpArray(const Quaternion* pA, const Quaternion* pB, float t, Quaternion* pOut, unsigned int count);
+		static void NormalizeArray(Quaternion* pQ, unsigned int count);
 
 		//Member Variables
 	public:
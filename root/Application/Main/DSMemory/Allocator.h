@@ -0,0 +1,56 @@
+//=============================================================================
+// File:		Allocator.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Allocator. Interface shared by every allocator in DSMemory, so containers and StlAllocator can be given any of them.
+//=============================================================================
+
+#ifndef ALLOCATOR_H
+#define ALLOCATOR_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstddef>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMemory
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Notes:
+		alignment must be a power of two.
+		Allocators that only free in bulk (LinearAllocator, ArenaAllocator) ignore Free.
+	*/
+	class Allocator
+	{
+	public:
+		//Destructor
+		virtual ~Allocator()
+		{
+		}
+
+		//Member Functions
+	public:
+		// General
+		virtual void* Allocate(size_t size, size_t alignment = kDefaultAlignment) = 0;
+		virtual void Free(void* pMemory) = 0;
+
+		//Member Variables
+	public:
+		static const size_t kDefaultAlignment = 8;//largest alignment of any built in type on the x86 target
+	};
+
+}//namespace DSMemory
+
+#endif //#ifndef ALLOCATOR_H
\ No newline at end of file
@@ -0,0 +1,173 @@
+//=============================================================================
+// File:		ArenaAllocator.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	ArenaAllocator
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// Daniel Schenker
+#include "ArenaAllocator.h"
+#include "../DSSystem/Platform.h"
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	blockSize = bytes taken from backing at a time.
+	backing = where blocks come from. Must outlive the arena.
+	tag = what the blocks are charged to.
+Notes:
+	No memory is taken until the first allocation.
+*/
+DSMemory::ArenaAllocator::ArenaAllocator(size_t blockSize, DSMemory::Allocator& backing, DSMemory::MemoryTag tag)
+:	mBacking(backing)
+,	mTag(tag)
+,	mBlockSize(blockSize)
+,	mCurrent(0)
+,	mOffset(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+DSMemory::ArenaScope::ArenaScope(DSMemory::ArenaAllocator& arena)
+:	mArena(arena)
+,	mMarker(arena.GetMarker())
+{
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSMemory::ArenaAllocator::~ArenaAllocator()
+{
+	Release();
+}
+
+//-----------------------------------------------------------------------------
+
+DSMemory::ArenaScope::~ArenaScope()
+{
+	mArena.Rewind(mMarker);
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+void* DSMemory::ArenaAllocator::Allocate(size_t size, size_t alignment)
+{
+	DS_MEMORY_TAG_SCOPE(mTag);
+
+	//Too big to be sure of fitting in a block
+	if(size + alignment - 1 > mBlockSize)
+	{
+		void* pLarge = mBacking.Allocate(size, alignment);
+		mLarge.push_back(pLarge);
+		return pLarge;
+	}
+
+	if(mBlocks.empty() == true)
+	{
+		mBlocks.push_back(static_cast<unsigned char*>(mBacking.Allocate(mBlockSize, DS_CACHE_LINE_SIZE)));
+	}
+
+	uintptr_t base = reinterpret_cast<uintptr_t>(mBlocks[mCurrent]);
+	size_t start = static_cast<size_t>(((base + mOffset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base);
+	if(start + size > mBlockSize)
+	{
+		//Move on to the next block, reusing one kept by an earlier rewind if there is one
+		++mCurrent;
+		if(mCurrent == mBlocks.size())
+		{
+			mBlocks.push_back(static_cast<unsigned char*>(mBacking.Allocate(mBlockSize, DS_CACHE_LINE_SIZE)));
+		}
+
+		base = reinterpret_cast<uintptr_t>(mBlocks[mCurrent]);
+		start = static_cast<size_t>(((base + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base);
+	}
+
+	mOffset = start + size;
+	return mBlocks[mCurrent] + start;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSMemory::ArenaAllocator::Free(void* pMemory)
+{
+	//Freed by Rewind
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Frees everything allocated after marker was taken. Blocks are kept for reuse; large allocations are given back.
+*/
+void DSMemory::ArenaAllocator::Rewind(const DSMemory::ArenaMarker& marker)
+{
+	while(mLarge.size() > marker.mLargeCount)
+	{
+		mBacking.Free(mLarge.back());
+		mLarge.pop_back();
+	}
+
+	mCurrent = marker.mBlock;
+	mOffset = marker.mOffset;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Frees everything, and gives every block back to the backing allocator.
+*/
+void DSMemory::ArenaAllocator::Release()
+{
+	DSMemory::ArenaMarker start = { 0, 0, 0 };
+	Rewind(start);
+
+	std::vector<unsigned char*>::iterator it;
+	for(it = mBlocks.begin(); it != mBlocks.end(); ++it)
+	{
+		mBacking.Free(*it);
+	}
+	mBlocks.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+DSMemory::ArenaMarker DSMemory::ArenaAllocator::GetMarker() const
+{
+	DSMemory::ArenaMarker marker;
+	marker.mBlock = mCurrent;
+	marker.mOffset = mOffset;
+	marker.mLargeCount = static_cast<unsigned int>(mLarge.size());
+
+	return marker;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSMemory::ArenaAllocator::GetBlockCount() const
+{
+	return static_cast<unsigned int>(mBlocks.size());
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+//=============================================================================
+// File:		ArenaAllocator.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	ArenaAllocator. Growable bump allocation that is freed by rewinding to a marker, with ArenaScope to do so automatically.
+//=============================================================================
+
+#ifndef ARENAALLOCATOR_H
+#define ARENAALLOCATOR_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <type_traits>
+#include <vector>
+
+// Daniel Schenker
+#include "Allocator.h"
+#include "MemoryTracker.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMemory
+{
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	struct ArenaMarker
+	{
+		unsigned int mBlock;
+		size_t mOffset;
+		unsigned int mLargeCount;
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Like LinearAllocator, but it grows a block at a time instead of having a fixed capacity, and frees back to any earlier marker instead of only all at once.
+		Meant for loading, where the amount of temporary memory (decoded images, parsed files) is unknown in advance but is all thrown away together.
+		Blocks are kept when rewinding, so loading one asset after another reuses the same memory.
+		Allocations that would not fit in an empty block get a block of their own, which is freed as soon as it is rewound past.
+	Usage:
+		See ArenaScope.
+	Notes:
+		Not thread safe: give each loading thread its own arena.
+		Destructors are never run.
+	*/
+	class ArenaAllocator : public DSMemory::Allocator
+	{
+	public:
+		//Constructors
+		ArenaAllocator(size_t blockSize, DSMemory::Allocator& backing, DSMemory::MemoryTag tag);
+		//Destructor
+		virtual ~ArenaAllocator();
+
+	private:
+		//Disable Copy Constructor
+		ArenaAllocator(const ArenaAllocator&);
+		const ArenaAllocator& operator=(const ArenaAllocator&);
+
+		//Member Functions
+	public:
+		// General
+		virtual void* Allocate(size_t size, size_t alignment = kDefaultAlignment);
+		virtual void Free(void* pMemory);
+		void Rewind(const DSMemory::ArenaMarker& marker);
+		void Release();
+
+		// Getters
+		DSMemory::ArenaMarker GetMarker() const;
+		unsigned int GetBlockCount() const;
+
+		//Member Variables
+	private:
+		DSMemory::Allocator& mBacking;
+		DSMemory::MemoryTag mTag;
+		size_t mBlockSize;
+		std::vector<unsigned char*> mBlocks;
+		unsigned int mCurrent;//block being allocated from
+		size_t mOffset;//bytes used in the current block
+		std::vector<void*> mLarge;//allocations too big for a block, in the order they were made
+	};
+
+	/*
+	Description:
+		Rewinds an arena to where it was when the scope was entered, freeing everything allocated through it (or the arena directly) in between.
+	Usage:
+		{
+			DSMemory::ArenaScope scratch(DSMemory::MemoryManager::GetLoadArena());
+			png_byte* pImageData = scratch.Allocate<png_byte>(rowBytes * height);
+			...
+		}//pImageData is freed here
+	Notes:
+		Scopes nest like the stack, so an inner scope must end before an outer one.
+	*/
+	class ArenaScope
+	{
+	public:
+		//Constructors
+		explicit ArenaScope(DSMemory::ArenaAllocator& arena);
+		//Destructor
+		~ArenaScope();
+
+	private:
+		//Disable Copy Constructor
+		ArenaScope(const ArenaScope&);
+		const ArenaScope& operator=(const ArenaScope&);
+
+		//Member Functions
+	public:
+		// General
+		template<typename T>
+		T* Allocate(size_t count)
+		{
+			return static_cast<T*>(mArena.Allocate(count * sizeof(T), std::alignment_of<T>::value));
+		}
+
+		//Member Variables
+	private:
+		DSMemory::ArenaAllocator& mArena;
+		DSMemory::ArenaMarker mMarker;
+	};
+
+}//namespace DSMemory
+
+#endif //#ifndef ARENAALLOCATOR_H
\ No newline at end of file
@@ -0,0 +1,65 @@
+//=============================================================================
+// File:		HeapAllocator.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	HeapAllocator
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <new>
+
+// Daniel Schenker
+#include "HeapAllocator.h"
+#include "MemoryTracker.h"
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSMemory::HeapAllocator::HeapAllocator()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSMemory::HeapAllocator::~HeapAllocator()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Throws std::bad_alloc if the heap is exhausted, like new.
+*/
+void* DSMemory::HeapAllocator::Allocate(size_t size, size_t alignment)
+{
+	void* pMemory = DSMemory::MemoryTracker::Allocate(size, alignment);
+	if(pMemory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return pMemory;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSMemory::HeapAllocator::Free(void* pMemory)
+{
+	DSMemory::MemoryTracker::Free(pMemory);
+}
\ No newline at end of file
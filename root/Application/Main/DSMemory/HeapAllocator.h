@@ -0,0 +1,60 @@
+//=============================================================================
+// File:		HeapAllocator.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	HeapAllocator. The general purpose heap, with any alignment, tracked by DSMemory::MemoryTracker.
+//=============================================================================
+
+#ifndef HEAPALLOCATOR_H
+#define HEAPALLOCATOR_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Daniel Schenker
+#include "Allocator.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMemory
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Backs the other allocators, and anything too irregular for them.
+	Notes:
+		Thread safe.
+		Allocations are charged to the calling thread's memory tag (see DS_MEMORY_TAG_SCOPE), the same as plain new.
+		Stateless, so it is usable before and after static initialization, and every HeapAllocator is interchangeable.
+	*/
+	class HeapAllocator : public DSMemory::Allocator
+	{
+	public:
+		//Constructors
+		HeapAllocator();
+		//Destructor
+		virtual ~HeapAllocator();
+
+	private:
+		//Disable Copy Constructor
+		HeapAllocator(const HeapAllocator&);
+		const HeapAllocator& operator=(const HeapAllocator&);
+
+		//Member Functions
+	public:
+		// General
+		virtual void* Allocate(size_t size, size_t alignment = kDefaultAlignment);
+		virtual void Free(void* pMemory);
+	};
+
+}//namespace DSMemory
+
+#endif //#ifndef HEAPALLOCATOR_H
\ No newline at end of file
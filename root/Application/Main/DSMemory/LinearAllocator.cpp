@@ -0,0 +1,128 @@
+//=============================================================================
+// File:		LinearAllocator.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	LinearAllocator
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstdint>
+#include <stdexcept>
+
+// Daniel Schenker
+#include "LinearAllocator.h"
+#include "../DSSystem/Platform.h"
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	capacity = bytes available between two resets.
+	backing = where the buffer comes from. Must outlive the allocator.
+	tag = what the buffer is charged to.
+*/
+DSMemory::LinearAllocator::LinearAllocator(size_t capacity, DSMemory::Allocator& backing, DSMemory::MemoryTag tag)
+:	mBacking(backing)
+,	mpBuffer(nullptr)
+,	mCapacity(capacity)
+,	mOffset(0)
+,	mPeak(0)
+{
+	DS_MEMORY_TAG_SCOPE(tag);
+
+	mpBuffer = static_cast<unsigned char*>(mBacking.Allocate(mCapacity, DS_CACHE_LINE_SIZE));
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSMemory::LinearAllocator::~LinearAllocator()
+{
+	mBacking.Free(mpBuffer);
+	mpBuffer = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+void* DSMemory::LinearAllocator::Allocate(size_t size, size_t alignment)
+{
+	//Align the address rather than the offset, since alignment may exceed the buffer's own
+	uintptr_t base = reinterpret_cast<uintptr_t>(mpBuffer);
+	size_t offset = mOffset.load();
+	size_t start;
+	do
+	{
+		start = static_cast<size_t>(((base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base);
+		if(start + size > mCapacity)
+		{
+			throw std::runtime_error("ERROR: LinearAllocator is out of room. Raise its capacity, or allocate less per frame.");
+		}
+	}
+	while(mOffset.compare_exchange_weak(offset, start + size) == false);
+
+	return mpBuffer + start;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSMemory::LinearAllocator::Free(void* pMemory)
+{
+	//Everything is freed together by Reset
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Frees everything allocated since the last reset. Pointers into the buffer must not be used afterwards.
+*/
+void DSMemory::LinearAllocator::Reset()
+{
+	size_t used = mOffset.exchange(0);
+	if(used > mPeak)
+	{
+		mPeak = used;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+size_t DSMemory::LinearAllocator::GetCapacity() const
+{
+	return mCapacity;
+}
+
+//-----------------------------------------------------------------------------
+
+size_t DSMemory::LinearAllocator::GetUsed() const
+{
+	return mOffset.load();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Does not include allocations since the last reset.
+*/
+size_t DSMemory::LinearAllocator::GetPeak() const
+{
+	return mPeak;
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+//=============================================================================
+// File:		LinearAllocator.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	LinearAllocator. Bump allocation out of one fixed buffer, all freed at once by Reset. Used for per frame scratch memory.
+//=============================================================================
+
+#ifndef LINEARALLOCATOR_H
+#define LINEARALLOCATOR_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <atomic>
+#include <type_traits>
+
+// Daniel Schenker
+#include "Allocator.h"
+#include "MemoryTracker.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMemory
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Allocating moves an offset forward; Free does nothing; Reset moves the offset back to the start.
+		Anything that only has to live until the end of the frame can be allocated here without ever touching the heap.
+	Usage:
+		DSMemory::LinearAllocator& frame = DSMemory::MemoryManager::GetFrameAllocator();
+		glm::mat4* pMatrices = static_cast<glm::mat4*>(frame.Allocate(count * sizeof(glm::mat4), 16));
+	Notes:
+		Allocate is thread safe (lock free), so jobs may allocate from the same buffer. Reset is not; call it when nothing else is allocating.
+		Running out of room throws rather than falling back to the heap, so a budget that is too small is noticed.
+		Destructors are never run: only allocate memory here for types that don't need them, or destroy them yourself.
+	*/
+	class LinearAllocator : public DSMemory::Allocator
+	{
+	public:
+		//Constructors
+		LinearAllocator(size_t capacity, DSMemory::Allocator& backing, DSMemory::MemoryTag tag);
+		//Destructor
+		virtual ~LinearAllocator();
+
+	private:
+		//Disable Copy Constructor
+		LinearAllocator(const LinearAllocator&);
+		const LinearAllocator& operator=(const LinearAllocator&);
+
+		//Member Functions
+	public:
+		// General
+		virtual void* Allocate(size_t size, size_t alignment = kDefaultAlignment);
+		virtual void Free(void* pMemory);
+		void Reset();
+
+		template<typename T>
+		T* Allocate(unsigned int count)
+		{
+			return static_cast<T*>(Allocate(count * sizeof(T), std::alignment_of<T>::value));
+		}
+
+		// Getters
+		size_t GetCapacity() const;
+		size_t GetUsed() const;
+		size_t GetPeak() const;
+
+		//Member Variables
+	private:
+		DSMemory::Allocator& mBacking;
+		unsigned char* mpBuffer;
+		size_t mCapacity;
+		std::atomic<size_t> mOffset;
+		size_t mPeak;//most ever used between two resets, updated on Reset
+	};
+
+}//namespace DSMemory
+
+#endif //#ifndef LINEARALLOCATOR_H
\ No newline at end of file
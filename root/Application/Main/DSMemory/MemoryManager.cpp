@@ -0,0 +1,159 @@
+//=============================================================================
+// File:		MemoryManager.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	MemoryManager
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Platform
+#include "../DSSystem/Platform.h"
+
+// Standard C++ Libraries
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Daniel Schenker
+#include "MemoryManager.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	DSMemory::HeapAllocator sHeap;
+	DSMemory::LinearAllocator* spFrameAllocator = nullptr;
+	DSMemory::ArenaAllocator* spLoadArena = nullptr;//the main thread's
+
+	//Every other thread that loads (eg. a job system worker running a load task) gets an arena of its own the first time it asks
+	std::thread::id sMainThread;
+	size_t sLoadBlockBytes = 0;
+	unsigned int sGeneration = 0;//which Initialize the thread arenas belong to
+	std::mutex sThreadLoadArenasMutex;
+	std::vector<DSMemory::ArenaAllocator*> sThreadLoadArenas;
+	DS_THREAD_LOCAL DSMemory::ArenaAllocator* tpLoadArena = nullptr;
+	DS_THREAD_LOCAL unsigned int tLoadArenaGeneration = 0;
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Variables:
+	frameBytes = the most the frame allocator can hand out in one frame.
+	loadBlockBytes = how much the loading arena grows by at a time.
+*/
+void DSMemory::MemoryManager::Initialize(size_t frameBytes, size_t loadBlockBytes)
+{
+	if(spFrameAllocator != nullptr)
+	{
+		throw std::runtime_error("ERROR: MemoryManager is already initialized.");
+	}
+
+	spFrameAllocator = new DSMemory::LinearAllocator(frameBytes, sHeap, DSMemory::kMemoryTagFrame);
+	spLoadArena = new DSMemory::ArenaAllocator(loadBlockBytes, sHeap, DSMemory::kMemoryTagLoading);
+	sMainThread = std::this_thread::get_id();
+	sLoadBlockBytes = loadBlockBytes;
+	++sGeneration;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Every other thread that used a loading arena must be done with it (the job system is terminated first).
+*/
+void DSMemory::MemoryManager::Terminate()
+{
+	{
+		std::lock_guard<std::mutex> lock(sThreadLoadArenasMutex);
+		for(size_t i = 0; i < sThreadLoadArenas.size(); ++i)
+		{
+			delete sThreadLoadArenas[i];
+		}
+		sThreadLoadArenas.clear();
+	}
+
+	delete spLoadArena;
+	spLoadArena = nullptr;
+
+	delete spFrameAllocator;
+	spFrameAllocator = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Frees last frame's allocations from the frame allocator. Call on the main thread at the start of each frame, once last frame's jobs are done.
+*/
+void DSMemory::MemoryManager::BeginFrame()
+{
+	spFrameAllocator->Reset();
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+DSMemory::HeapAllocator& DSMemory::MemoryManager::GetHeap()
+{
+	return sHeap;
+}
+
+//-----------------------------------------------------------------------------
+
+DSMemory::LinearAllocator& DSMemory::MemoryManager::GetFrameAllocator()
+{
+	if(spFrameAllocator == nullptr)
+	{
+		throw std::runtime_error("ERROR: MemoryManager is not initialized.");
+	}
+
+	return *spFrameAllocator;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	The calling thread's loading arena. The main thread's exists from Initialize; any other thread's is made the first time it asks, and kept (with its blocks) until Terminate.
+*/
+DSMemory::ArenaAllocator& DSMemory::MemoryManager::GetLoadArena()
+{
+	if(spLoadArena == nullptr)
+	{
+		throw std::runtime_error("ERROR: MemoryManager is not initialized.");
+	}
+
+	if(std::this_thread::get_id() == sMainThread)
+	{
+		return *spLoadArena;
+	}
+
+	if(tpLoadArena == nullptr || tLoadArenaGeneration != sGeneration)
+	{
+		DSMemory::ArenaAllocator* pArena = new DSMemory::ArenaAllocator(sLoadBlockBytes, sHeap, DSMemory::kMemoryTagLoading);
+		{
+			std::lock_guard<std::mutex> lock(sThreadLoadArenasMutex);
+			sThreadLoadArenas.push_back(pArena);
+		}
+		tpLoadArena = pArena;
+		tLoadArenaGeneration = sGeneration;
+	}
+
+	return *tpLoadArena;
+}
\ No newline at end of file
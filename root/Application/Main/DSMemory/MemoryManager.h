@@ -0,0 +1,73 @@
+//=============================================================================
+// File:		MemoryManager.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	MemoryManager. The engine wide allocators: the heap, the per frame allocator and the loading arena.
+//=============================================================================
+
+#ifndef MEMORYMANAGER_H
+#define MEMORYMANAGER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Daniel Schenker
+#include "ArenaAllocator.h"
+#include "HeapAllocator.h"
+#include "LinearAllocator.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMemory
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Which allocator to use:
+			Lives until the end of the frame				-> GetFrameAllocator() (reset by BeginFrame)
+			Temporary while loading							-> DSMemory::ArenaScope over GetLoadArena()
+			Many objects of one size, created and destroyed	-> a DSMemory::PoolAllocator owned by whoever makes them (eg. DSEntity::World's chunk pool)
+			Anything else									-> GetHeap()
+		STL containers can use any of them through DSMemory::StlAllocator.
+		Whatever they take from the heap is charged to a memory tag by DSMemory::MemoryTracker: the frame allocator to kMemoryTagFrame, the loading arena to kMemoryTagLoading.
+	Notes:
+		GetHeap() may be used at any time. The frame allocator and the loading arena exist between Initialize and Terminate.
+		The frame allocator belongs to the main thread's frame: jobs started during a frame may allocate from it,
+		but the simulation thread, which does not follow the frame, must not.
+		Each thread has its own loading arena (GetLoadArena returns the calling thread's), so load tasks may run on any thread.
+	*/
+	class MemoryManager
+	{
+	private:
+		//Constructors
+		MemoryManager();
+
+		//Member Functions
+	public:
+		// General
+		static void Initialize(size_t frameBytes = kDefaultFrameBytes, size_t loadBlockBytes = kDefaultLoadBlockBytes);
+		static void Terminate();
+		static void BeginFrame();
+
+		// Getters
+		static DSMemory::HeapAllocator& GetHeap();
+		static DSMemory::LinearAllocator& GetFrameAllocator();
+		static DSMemory::ArenaAllocator& GetLoadArena();
+
+		//Member Variables
+	public:
+		static const size_t kDefaultFrameBytes = 4 * 1024 * 1024;
+		static const size_t kDefaultLoadBlockBytes = 1024 * 1024;
+	};
+
+}//namespace DSMemory
+
+#endif //#ifndef MEMORYMANAGER_H
\ No newline at end of file
@@ -0,0 +1,281 @@
+//=============================================================================
+// File:		MemoryTracker.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	MemoryTracker
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "MemoryTracker.h"
+#include "../DSSystem/Platform.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	//Stored just before every allocation
+	struct AllocationHeader
+	{
+		void* mpRaw;//what malloc returned
+		size_t mSize;
+		unsigned int mTag;
+	};
+
+	//At least what malloc guarantees, so plain new keeps its usual alignment
+	const size_t kMinAlignment = 2 * sizeof(void*);
+
+	const char* const kTagNames[DSMemory::kMemoryTagCount] =
+	{
+		"General",
+		"Entities",
+		"Rendering",
+		"Meshes",
+		"Textures",
+		"Shaders",
+		"Loading",
+		"Frame",
+		"Profiling",
+		"Threading",
+		"Physics"
+	};
+
+	//No initializers: static storage starts zeroed, and leaving it to that keeps allocations made while other files are statically initialized from being wiped.
+	std::atomic<size_t> sCurrentBytes[DSMemory::kMemoryTagCount];
+	std::atomic<size_t> sPeakBytes[DSMemory::kMemoryTagCount];
+	std::atomic<unsigned int> sCurrentCount[DSMemory::kMemoryTagCount];
+	std::atomic<unsigned int> sTotalCount[DSMemory::kMemoryTagCount];
+	std::atomic<size_t> sBudgetBytes[DSMemory::kMemoryTagCount];
+
+	DS_THREAD_LOCAL unsigned int tCurrentTag;//kMemoryTagGeneral (0) on every thread until a scope says otherwise
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSMemory::MemoryTagScope::MemoryTagScope(DSMemory::MemoryTag tag)
+:	mPrevious(DSMemory::MemoryTracker::GetCurrentTag())
+{
+	DSMemory::MemoryTracker::SetCurrentTag(tag);
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSMemory::MemoryTagScope::~MemoryTagScope()
+{
+	DSMemory::MemoryTracker::SetCurrentTag(mPrevious);
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  Allocation
+
+/*
+Description:
+	Allocates from the heap under the calling thread's current tag. Returns nullptr if the heap is exhausted.
+Variables:
+	alignment = a power of two. Anything below kMinAlignment is raised to it.
+*/
+void* DSMemory::MemoryTracker::Allocate(size_t size, size_t alignment)
+{
+	if(alignment < kMinAlignment)
+	{
+		alignment = kMinAlignment;
+	}
+
+	unsigned char* pRaw = static_cast<unsigned char*>(malloc(size + sizeof(AllocationHeader) + alignment - 1));
+	if(pRaw == nullptr)
+	{
+		return nullptr;
+	}
+
+	uintptr_t aligned = (reinterpret_cast<uintptr_t>(pRaw + sizeof(AllocationHeader)) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+	AllocationHeader* pHeader = reinterpret_cast<AllocationHeader*>(aligned) - 1;
+	unsigned int tag = tCurrentTag;
+	pHeader->mpRaw = pRaw;
+	pHeader->mSize = size;
+	pHeader->mTag = tag;
+
+	size_t current = sCurrentBytes[tag].fetch_add(size, std::memory_order_relaxed) + size;
+	sCurrentCount[tag].fetch_add(1, std::memory_order_relaxed);
+	sTotalCount[tag].fetch_add(1, std::memory_order_relaxed);
+
+	size_t peak = sPeakBytes[tag].load(std::memory_order_relaxed);
+	while(current > peak && sPeakBytes[tag].compare_exchange_weak(peak, current, std::memory_order_relaxed) == false)
+	{
+	}
+
+	//Warn once each time the tag crosses its budget, not on every allocation while over it
+	size_t budget = sBudgetBytes[tag].load(std::memory_order_relaxed);
+	if(budget != 0 && current > budget && current - size <= budget)
+	{
+		fprintf(stderr, "WARNING: Memory tag \"%s\" is over its budget: %.1f KB of %.1f KB.\n", kTagNames[tag], current / 1024.0, budget / 1024.0);
+	}
+
+	return reinterpret_cast<void*>(aligned);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Charged to the tag the memory was allocated under, whichever thread frees it.
+*/
+void DSMemory::MemoryTracker::Free(void* pMemory)
+{
+	if(pMemory == nullptr)
+	{
+		return;
+	}
+
+	AllocationHeader* pHeader = static_cast<AllocationHeader*>(pMemory) - 1;
+	sCurrentBytes[pHeader->mTag].fetch_sub(pHeader->mSize, std::memory_order_relaxed);
+	sCurrentCount[pHeader->mTag].fetch_sub(1, std::memory_order_relaxed);
+
+	free(pHeader->mpRaw);
+}
+
+//-----------------------------------------------------------------------------
+//  Budgets
+
+/*
+Description:
+	Warns (on stderr) whenever the tag's current usage rises above bytes. 0 removes the budget.
+*/
+void DSMemory::MemoryTracker::SetBudget(DSMemory::MemoryTag tag, size_t bytes)
+{
+	sBudgetBytes[tag].store(bytes);
+}
+
+//-----------------------------------------------------------------------------
+//  Reports
+
+/*
+Description:
+	Prints every tag's usage. Called at shutdown, what is still live is either leaked or owned by statics that have not been destroyed yet.
+*/
+void DSMemory::MemoryTracker::PrintReport()
+{
+	printf("Memory report (KB):\n");
+	printf("  %-12s %10s %10s %8s %10s %10s\n", "Tag", "Current", "Peak", "Live", "Allocs", "Budget");
+
+	for(unsigned int i = 0; i < kMemoryTagCount; ++i)
+	{
+		DSMemory::MemoryTagStats stats;
+		GetStats(static_cast<DSMemory::MemoryTag>(i), stats);
+		if(stats.mTotalCount == 0)
+		{
+			continue;
+		}
+
+		if(stats.mBudgetBytes != 0)
+		{
+			printf("  %-12s %10.1f %10.1f %8u %10u %10.1f\n", kTagNames[i], stats.mCurrentBytes / 1024.0, stats.mPeakBytes / 1024.0, stats.mCurrentCount, stats.mTotalCount, stats.mBudgetBytes / 1024.0);
+		}
+		else
+		{
+			printf("  %-12s %10.1f %10.1f %8u %10u %10s\n", kTagNames[i], stats.mCurrentBytes / 1024.0, stats.mPeakBytes / 1024.0, stats.mCurrentCount, stats.mTotalCount, "-");
+		}
+	}
+
+	for(unsigned int i = 0; i < kMemoryTagCount; ++i)
+	{
+		DSMemory::MemoryTagStats stats;
+		GetStats(static_cast<DSMemory::MemoryTag>(i), stats);
+		if(stats.mBudgetBytes != 0 && stats.mPeakBytes > stats.mBudgetBytes)
+		{
+			fprintf(stderr, "WARNING: Memory tag \"%s\" peaked at %.1f KB, over its budget of %.1f KB.\n", kTagNames[i], stats.mPeakBytes / 1024.0, stats.mBudgetBytes / 1024.0);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+DSMemory::MemoryTag DSMemory::MemoryTracker::GetCurrentTag()
+{
+	return static_cast<DSMemory::MemoryTag>(tCurrentTag);
+}
+
+//-----------------------------------------------------------------------------
+
+const char* DSMemory::MemoryTracker::GetTagName(DSMemory::MemoryTag tag)
+{
+	return kTagNames[tag];
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Each value is read separately while other threads may be allocating, so they can be very slightly out of step with each other.
+*/
+void DSMemory::MemoryTracker::GetStats(DSMemory::MemoryTag tag, DSMemory::MemoryTagStats& stats)
+{
+	stats.mCurrentBytes = sCurrentBytes[tag].load(std::memory_order_relaxed);
+	stats.mPeakBytes = sPeakBytes[tag].load(std::memory_order_relaxed);
+	stats.mCurrentCount = sCurrentCount[tag].load(std::memory_order_relaxed);
+	stats.mTotalCount = sTotalCount[tag].load(std::memory_order_relaxed);
+	stats.mBudgetBytes = sBudgetBytes[tag].load(std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Only ever grows; compare it across a frame to see whether the frame allocated anything.
+*/
+unsigned int DSMemory::MemoryTracker::GetTotalAllocationCount()
+{
+	unsigned int count = 0;
+	for(unsigned int i = 0; i < kMemoryTagCount; ++i)
+	{
+		count += sTotalCount[i].load(std::memory_order_relaxed);
+	}
+
+	return count;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSMemory::MemoryTracker::GetCurrentAllocationCount()
+{
+	unsigned int count = 0;
+	for(unsigned int i = 0; i < kMemoryTagCount; ++i)
+	{
+		count += sCurrentCount[i].load(std::memory_order_relaxed);
+	}
+
+	return count;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helpers
+
+void DSMemory::MemoryTracker::SetCurrentTag(DSMemory::MemoryTag tag)
+{
+	tCurrentTag = tag;
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+//=============================================================================
+// File:		MemoryTracker.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	MemoryTracker. Attributes every heap allocation to a subsystem tag, keeping current and peak usage per tag and warning when a tag's budget is exceeded.
+//=============================================================================
+
+#ifndef MEMORYTRACKER_H
+#define MEMORYTRACKER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstddef>
+
+//=============================================================================
+//Defines
+//=============================================================================
+
+//Usage: DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagTextures); attributes this thread's allocations to the tag until the end of the scope
+//Note: Define DS_MEMORY_TRACKING_DISABLED to leave operator new alone and compile tag scopes out; only DSMemory's own allocators are then tracked, all as kMemoryTagGeneral.
+#define DS_MEMORY_CONCAT_INNER(a, b) a##b
+#define DS_MEMORY_CONCAT(a, b) DS_MEMORY_CONCAT_INNER(a, b)
+
+#if defined(DS_MEMORY_TRACKING_DISABLED)
+	#define DS_MEMORY_TAG_SCOPE(tag)
+#else
+	#define DS_MEMORY_TAG_SCOPE(tag) DSMemory::MemoryTagScope DS_MEMORY_CONCAT(memoryTag, __LINE__)(tag)
+#endif
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMemory
+{
+
+	//=============================================================================
+	//Enums
+	//=============================================================================
+
+	enum MemoryTag
+	{
+		kMemoryTagGeneral,//anything not in a tag scope
+		kMemoryTagEntities,//the world: archetype chunks (instances and components), entity records, queries, systems
+		kMemoryTagRendering,//render snapshots
+		kMemoryTagMeshes,//ModelAssets, including the CPU copy of their vertex and element data
+		kMemoryTagTextures,
+		kMemoryTagShaders,
+		kMemoryTagLoading,//temporary memory while loading (the loading arena)
+		kMemoryTagFrame,//the frame allocator
+		kMemoryTagProfiling,
+		kMemoryTagThreading,
+		kMemoryTagPhysics,//soft body particles and constraints
+		kMemoryTagCount
+	};
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	struct MemoryTagStats
+	{
+		size_t mCurrentBytes;
+		size_t mPeakBytes;//high-water mark of mCurrentBytes
+		unsigned int mCurrentCount;//allocations not yet freed
+		unsigned int mTotalCount;//allocations ever made
+		size_t mBudgetBytes;//0 for no budget
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Each allocation carries a small header (the tag and size) so that freeing it, from any thread, is charged to the tag it was made under.
+		The tag of an allocation is the allocating thread's innermost DS_MEMORY_TAG_SCOPE, or kMemoryTagGeneral outside of one.
+		operator new and delete are replaced to go through here, so STL containers and plain new are tracked too, not just DSMemory's allocators.
+	Notes:
+		Cheap enough to leave on: an allocation costs a thread local read and a few relaxed atomic adds on top of malloc, and nothing takes a lock.
+		Memory allocated inside third party DLLs (GLFW, GLEW, libpng) uses their own heaps and is not seen.
+		Jobs run under the tag of the worker thread running them (kMemoryTagGeneral), not of the thread that created them.
+	*/
+	class MemoryTracker
+	{
+	private:
+		//Constructors
+		MemoryTracker();
+
+		//Member Functions
+	public:
+		// Allocation
+		static void* Allocate(size_t size, size_t alignment);
+		static void Free(void* pMemory);
+
+		// Budgets
+		static void SetBudget(DSMemory::MemoryTag tag, size_t bytes);
+
+		// Reports
+		static void PrintReport();
+
+		// Getters
+		static DSMemory::MemoryTag GetCurrentTag();
+		static const char* GetTagName(DSMemory::MemoryTag tag);
+		static void GetStats(DSMemory::MemoryTag tag, DSMemory::MemoryTagStats& stats);
+		static unsigned int GetTotalAllocationCount();
+		static unsigned int GetCurrentAllocationCount();
+
+	private:
+		// Helpers
+		friend class MemoryTagScope;
+		static void SetCurrentTag(DSMemory::MemoryTag tag);
+	};
+
+	/*
+	Description:
+		Use through DS_MEMORY_TAG_SCOPE. Scopes nest; the previous tag is restored when the scope ends.
+	*/
+	class MemoryTagScope
+	{
+	public:
+		//Constructors
+		explicit MemoryTagScope(DSMemory::MemoryTag tag);
+		//Destructor
+		~MemoryTagScope();
+
+	private:
+		//Disable Copy Constructor
+		MemoryTagScope(const MemoryTagScope&);
+		const MemoryTagScope& operator=(const MemoryTagScope&);
+
+		//Member Variables
+	private:
+		DSMemory::MemoryTag mPrevious;
+	};
+
+}//namespace DSMemory
+
+#endif //#ifndef MEMORYTRACKER_H
\ No newline at end of file
@@ -0,0 +1,101 @@
+//=============================================================================
+// File:		OperatorNew.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Replaces the global operator new and delete, so that every allocation in the program goes through DSMemory::MemoryTracker.
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <new>
+
+// Daniel Schenker
+#include "MemoryTracker.h"
+
+#if !defined(DS_MEMORY_TRACKING_DISABLED)
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	/*
+	Notes:
+		Like the standard operator new, zero byte requests get a unique pointer, and running out of memory throws std::bad_alloc.
+	*/
+	void* AllocateOrThrow(size_t size)
+	{
+		void* pMemory = DSMemory::MemoryTracker::Allocate(size == 0 ? 1 : size, 0);
+		if(pMemory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		return pMemory;
+	}
+}
+
+//=============================================================================
+//Global Operators
+//=============================================================================
+
+void* operator new(size_t size)
+{
+	return AllocateOrThrow(size);
+}
+
+//-----------------------------------------------------------------------------
+
+void* operator new[](size_t size)
+{
+	return AllocateOrThrow(size);
+}
+
+//-----------------------------------------------------------------------------
+
+void* operator new(size_t size, const std::nothrow_t&) throw()
+{
+	return DSMemory::MemoryTracker::Allocate(size == 0 ? 1 : size, 0);
+}
+
+//-----------------------------------------------------------------------------
+
+void* operator new[](size_t size, const std::nothrow_t&) throw()
+{
+	return DSMemory::MemoryTracker::Allocate(size == 0 ? 1 : size, 0);
+}
+
+//-----------------------------------------------------------------------------
+
+void operator delete(void* pMemory) throw()
+{
+	DSMemory::MemoryTracker::Free(pMemory);
+}
+
+//-----------------------------------------------------------------------------
+
+void operator delete[](void* pMemory) throw()
+{
+	DSMemory::MemoryTracker::Free(pMemory);
+}
+
+//-----------------------------------------------------------------------------
+
+void operator delete(void* pMemory, const std::nothrow_t&) throw()
+{
+	DSMemory::MemoryTracker::Free(pMemory);
+}
+
+//-----------------------------------------------------------------------------
+
+void operator delete[](void* pMemory, const std::nothrow_t&) throw()
+{
+	DSMemory::MemoryTracker::Free(pMemory);
+}
+
+#endif //#if !defined(DS_MEMORY_TRACKING_DISABLED)
\ No newline at end of file
@@ -0,0 +1,164 @@
+//=============================================================================
+// File:		PoolAllocator.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	PoolAllocator
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <stdexcept>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "PoolAllocator.h"
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	blockSize = largest allocation the pool serves.
+	alignment = alignment of every block; a power of two.
+	backing = where pages come from. Must outlive the pool.
+	tag = what the pages are charged to, whichever thread happens to grow the pool.
+Notes:
+	No memory is taken until the first allocation.
+*/
+DSMemory::PoolAllocator::PoolAllocator(size_t blockSize, unsigned int blocksPerPage, size_t alignment, DSMemory::Allocator& backing, DSMemory::MemoryTag tag)
+:	mBacking(backing)
+,	mTag(tag)
+,	mBlockSize(0)
+,	mAlignment(alignment < sizeof(FreeBlock) ? sizeof(FreeBlock) : alignment)
+,	mBlocksPerPage(blocksPerPage > 0 ? blocksPerPage : 1)
+,	mpFreeHead(nullptr)
+,	mLiveCount(0)
+{
+	//Free blocks hold the free list's links, so no block may be smaller than one
+	mBlockSize = blockSize < sizeof(FreeBlock) ? sizeof(FreeBlock) : blockSize;
+	mBlockSize = (mBlockSize + mAlignment - 1) & ~(mAlignment - 1);
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSMemory::PoolAllocator::~PoolAllocator()
+{
+	if(mLiveCount != 0)
+	{
+		fprintf(stderr, "WARNING: PoolAllocator destroyed with %u blocks still allocated. Their memory is freed anyway.\n", mLiveCount);
+	}
+
+	std::vector<void*>::iterator it;
+	for(it = mPages.begin(); it != mPages.end(); ++it)
+	{
+		mBacking.Free(*it);
+	}
+	mPages.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+void* DSMemory::PoolAllocator::Allocate(size_t size, size_t alignment)
+{
+	if(size > mBlockSize || alignment > mAlignment)
+	{
+		throw std::runtime_error("ERROR: Allocation does not fit a PoolAllocator block. Use a pool with bigger or more aligned blocks.");
+	}
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	if(mpFreeHead == nullptr)
+	{
+		AddPage();
+	}
+
+	FreeBlock* pBlock = mpFreeHead;
+	mpFreeHead = pBlock->mpNext;
+	++mLiveCount;
+
+	return pBlock;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	pMemory must have come from this pool.
+*/
+void DSMemory::PoolAllocator::Free(void* pMemory)
+{
+	if(pMemory == nullptr)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	FreeBlock* pBlock = static_cast<FreeBlock*>(pMemory);
+	pBlock->mpNext = mpFreeHead;
+	mpFreeHead = pBlock;
+	--mLiveCount;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helper Functions
+
+/*
+Notes:
+	Called with mMutex held. Links the new page's blocks so they are handed out in address order.
+*/
+void DSMemory::PoolAllocator::AddPage()
+{
+	DS_MEMORY_TAG_SCOPE(mTag);
+
+	unsigned char* pPage = static_cast<unsigned char*>(mBacking.Allocate(mBlockSize * mBlocksPerPage, mAlignment));
+	mPages.push_back(pPage);
+
+	for(unsigned int i = mBlocksPerPage; i > 0; --i)
+	{
+		FreeBlock* pBlock = reinterpret_cast<FreeBlock*>(pPage + (i - 1) * mBlockSize);
+		pBlock->mpNext = mpFreeHead;
+		mpFreeHead = pBlock;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+size_t DSMemory::PoolAllocator::GetBlockSize() const
+{
+	return mBlockSize;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSMemory::PoolAllocator::GetLiveCount() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mLiveCount;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSMemory::PoolAllocator::GetPageCount() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return static_cast<unsigned int>(mPages.size());
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+//=============================================================================
+// File:		PoolAllocator.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	PoolAllocator. Fixed size blocks carved out of pages, recycled through a free list.
+//=============================================================================
+
+#ifndef POOLALLOCATOR_H
+#define POOLALLOCATOR_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <mutex>
+#include <vector>
+
+// Daniel Schenker
+#include "Allocator.h"
+#include "MemoryTracker.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMemory
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Every block is the same size, so allocating and freeing are a pop and a push on a free list threaded through the free blocks themselves.
+		Pages are taken from the backing allocator blocksPerPage blocks at a time, and are only given back when the pool is destroyed,
+		so once a pool has grown to its working size it never touches the backing allocator again.
+	Usage:
+		DSMemory::PoolAllocator chunks(16 * 1024, 16, DS_CACHE_LINE_SIZE, DSMemory::MemoryManager::GetHeap(), DSMemory::kMemoryTagEntities);
+		void* pChunk = chunks.Allocate(16 * 1024);
+		...
+		chunks.Free(pChunk);
+	Notes:
+		Thread safe. The lock is only held for the pop or push, which is cheap next to what fixed size blocks are typically used for.
+		Requests bigger than the block size, or more aligned than the pool, throw.
+	*/
+	class PoolAllocator : public DSMemory::Allocator
+	{
+	public:
+		//Constructors
+		PoolAllocator(size_t blockSize, unsigned int blocksPerPage, size_t alignment, DSMemory::Allocator& backing, DSMemory::MemoryTag tag);
+		//Destructor
+		virtual ~PoolAllocator();
+
+	private:
+		//Disable Copy Constructor
+		PoolAllocator(const PoolAllocator&);
+		const PoolAllocator& operator=(const PoolAllocator&);
+
+		//Member Functions
+	public:
+		// General
+		virtual void* Allocate(size_t size, size_t alignment = kDefaultAlignment);
+		virtual void Free(void* pMemory);
+
+	private:
+		// Helper Functions
+		void AddPage();
+
+	public:
+		// Getters
+		size_t GetBlockSize() const;
+		unsigned int GetLiveCount() const;
+		unsigned int GetPageCount() const;
+
+		//Member Variables
+	private:
+		struct FreeBlock
+		{
+			FreeBlock* mpNext;
+		};
+
+		DSMemory::Allocator& mBacking;
+		DSMemory::MemoryTag mTag;
+		size_t mBlockSize;//rounded up to a multiple of mAlignment
+		size_t mAlignment;
+		unsigned int mBlocksPerPage;
+
+		std::vector<void*> mPages;
+		FreeBlock* mpFreeHead;
+		unsigned int mLiveCount;//blocks handed out and not yet freed
+
+		mutable std::mutex mMutex;
+	};
+
+}//namespace DSMemory
+
+#endif //#ifndef POOLALLOCATOR_H
\ No newline at end of file
@@ -0,0 +1,154 @@
+//=============================================================================
+// File:		StlAllocator.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	StlAllocator. Lets STL containers allocate from any DSMemory::Allocator.
+//=============================================================================
+
+#ifndef STLALLOCATOR_H
+#define STLALLOCATOR_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Daniel Schenker
+#include "MemoryManager.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMemory
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Standard allocator forwarding to a DSMemory::Allocator. A default constructed one uses the heap.
+	Usage:
+		DSMemory::StlAllocator<int> frame(DSMemory::MemoryManager::GetFrameAllocator());
+		std::vector<int, DSMemory::StlAllocator<int> > visible(frame);
+		visible.reserve(count);//no heap allocation, and nothing to free
+	Notes:
+		Containers over a LinearAllocator or ArenaAllocator must not outlive its reset or rewind (their destructors then only run element destructors).
+		Spells out the whole C++03 allocator interface, since Visual Studio 2013's containers do not fill in the optional parts through allocator_traits.
+		Defined in the header since it is a template.
+	*/
+	template<typename T>
+	class StlAllocator
+	{
+	public:
+		//Typedefs
+		typedef T value_type;
+		typedef T* pointer;
+		typedef const T* const_pointer;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+
+		template<typename U>
+		struct rebind
+		{
+			typedef StlAllocator<U> other;
+		};
+
+		//Constructors
+		StlAllocator()
+		:	mpAllocator(&DSMemory::MemoryManager::GetHeap())
+		{
+		}
+
+		explicit StlAllocator(DSMemory::Allocator& allocator)
+		:	mpAllocator(&allocator)
+		{
+		}
+
+		template<typename U>
+		StlAllocator(const StlAllocator<U>& other)
+		:	mpAllocator(other.GetAllocator())
+		{
+		}
+
+		//Member Functions
+	public:
+		// General
+		pointer allocate(size_type count, const void* pHint = nullptr)
+		{
+			return static_cast<pointer>(mpAllocator->Allocate(count * sizeof(T), std::alignment_of<T>::value));
+		}
+
+		void deallocate(pointer pMemory, size_type count)
+		{
+			mpAllocator->Free(pMemory);
+		}
+
+		template<typename U, typename... Arguments>
+		void construct(U* pObject, Arguments&&... arguments)
+		{
+			::new(static_cast<void*>(pObject)) U(std::forward<Arguments>(arguments)...);
+		}
+
+		template<typename U>
+		void destroy(U* pObject)
+		{
+			pObject->~U();
+		}
+
+		pointer address(reference value) const
+		{
+			return &value;
+		}
+
+		const_pointer address(const_reference value) const
+		{
+			return &value;
+		}
+
+		size_type max_size() const
+		{
+			return static_cast<size_type>(-1) / sizeof(T);
+		}
+
+		// Getters
+		DSMemory::Allocator* GetAllocator() const
+		{
+			return mpAllocator;
+		}
+
+		//Member Variables
+	private:
+		DSMemory::Allocator* mpAllocator;
+	};
+
+	//=============================================================================
+	//Operators
+	//=============================================================================
+
+	//Memory from one can be freed by the other only if they share an allocator
+	template<typename T, typename U>
+	bool operator==(const StlAllocator<T>& left, const StlAllocator<U>& right)
+	{
+		return left.GetAllocator() == right.GetAllocator();
+	}
+
+	template<typename T, typename U>
+	bool operator!=(const StlAllocator<T>& left, const StlAllocator<U>& right)
+	{
+		return left.GetAllocator() != right.GetAllocator();
+	}
+
+}//namespace DSMemory
+
+#endif //#ifndef STLALLOCATOR_H
\ No newline at end of file
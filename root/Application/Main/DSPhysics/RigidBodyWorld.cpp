@@ -0,0 +1,850 @@
+//=============================================================================
+// File:		RigidBodyWorld.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	RigidBodyWorld
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Platform
+#include "../DSSystem/Platform.h"
+
+// Standard C++ Libraries
+#include <algorithm>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "RigidBodyWorld.h"
+#include "../DSGraphics/ModelInstance.h"
+#include "../DSMemory/MemoryTracker.h"
+#include "../DSProfiling/Profiler.h"
+#include "../DSThreading/JobSystem.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	unsigned int CountBits(const std::vector<unsigned int>& bits)
+	{
+		unsigned int count = 0;
+		for(size_t i = 0; i < bits.size(); ++i)
+		{
+			for(unsigned int word = bits[i]; word != 0; word &= word - 1)
+			{
+				++count;
+			}
+		}
+		return count;
+	}
+
+#if defined(DS_SSE)
+	//Four vectors, one register per component
+	struct Vector3x4
+	{
+		__m128 mX;
+		__m128 mY;
+		__m128 mZ;
+	};
+
+	DS_FORCEINLINE Vector3x4 Load3(const std::vector<float>& x, const std::vector<float>& y, const std::vector<float>& z, unsigned int first)
+	{
+		Vector3x4 v = { _mm_loadu_ps(&x[first]), _mm_loadu_ps(&y[first]), _mm_loadu_ps(&z[first]) };
+		return v;
+	}
+
+	DS_FORCEINLINE void Store3(std::vector<float>& x, std::vector<float>& y, std::vector<float>& z, unsigned int first, const Vector3x4& v)
+	{
+		_mm_storeu_ps(&x[first], v.mX);
+		_mm_storeu_ps(&y[first], v.mY);
+		_mm_storeu_ps(&z[first], v.mZ);
+	}
+
+	DS_FORCEINLINE __m128 Dot3(const Vector3x4& a, const Vector3x4& b)
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a.mX, b.mX), _mm_mul_ps(a.mY, b.mY)), _mm_mul_ps(a.mZ, b.mZ));
+	}
+
+	DS_FORCEINLINE Vector3x4 Cross3(const Vector3x4& a, const Vector3x4& b)
+	{
+		Vector3x4 c =
+		{
+			_mm_sub_ps(_mm_mul_ps(a.mY, b.mZ), _mm_mul_ps(a.mZ, b.mY)),
+			_mm_sub_ps(_mm_mul_ps(a.mZ, b.mX), _mm_mul_ps(a.mX, b.mZ)),
+			_mm_sub_ps(_mm_mul_ps(a.mX, b.mY), _mm_mul_ps(a.mY, b.mX))
+		};
+		return c;
+	}
+
+	//a + b * s
+	DS_FORCEINLINE Vector3x4 MultiplyAdd3(const Vector3x4& a, const Vector3x4& b, const __m128& s)
+	{
+		Vector3x4 r = { _mm_add_ps(a.mX, _mm_mul_ps(b.mX, s)), _mm_add_ps(a.mY, _mm_mul_ps(b.mY, s)), _mm_add_ps(a.mZ, _mm_mul_ps(b.mZ, s)) };
+		return r;
+	}
+
+	//Rotates four vectors by four quaternions (w, u), the same way as DSMathematics::Quaternion::Rotate: t = 2(u x v), v' = v + w * t + (u x t)
+	DS_FORCEINLINE Vector3x4 Rotate3(const __m128& w, const Vector3x4& u, const Vector3x4& v)
+	{
+		Vector3x4 t = Cross3(u, v);
+		t.mX = _mm_add_ps(t.mX, t.mX);
+		t.mY = _mm_add_ps(t.mY, t.mY);
+		t.mZ = _mm_add_ps(t.mZ, t.mZ);
+
+		Vector3x4 ut = Cross3(u, t);
+		Vector3x4 r = MultiplyAdd3(v, t, w);
+		r.mX = _mm_add_ps(r.mX, ut.mX);
+		r.mY = _mm_add_ps(r.mY, ut.mY);
+		r.mZ = _mm_add_ps(r.mZ, ut.mZ);
+		return r;
+	}
+
+	//mask ? a : b, per lane
+	DS_FORCEINLINE __m128 Select(const __m128& mask, const __m128& a, const __m128& b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	DS_FORCEINLINE Vector3x4 Select3(const __m128& mask, const Vector3x4& a, const Vector3x4& b)
+	{
+		Vector3x4 r = { Select(mask, a.mX, b.mX), Select(mask, a.mY, b.mY), Select(mask, a.mZ, b.mZ) };
+		return r;
+	}
+#endif
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSPhysics::RigidBodyWorld::RigidBodyWorld(const DSPhysics::RigidBodySettings& settings)
+:	mSettings(settings)
+,	mCount(0)
+,	mTimeStep(0.0f)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSPhysics::RigidBodyWorld::~RigidBodyWorld()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Adds a body at rest and returns its index. A body with mass is awake, so it can settle and fall asleep on its own.
+Variables:
+	mass = 0 for a static body.
+	inertia = principal moments of inertia, in the body's own space (see GetBoxInertia). A moment of 0 means it can't be turned about that axis.
+*/
+unsigned int DSPhysics::RigidBodyWorld::Create(const glm::vec3& position, const DSMathematics::Quaternion& orientation, float mass, const glm::vec3& inertia)
+{
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagPhysics);
+
+	//Grow by a whole batch of static bodies at a time, so the arrays stay padded to a multiple of kBatchSize
+	if(mCount % kBatchSize == 0)
+	{
+		unsigned int paddedCount = mCount + kBatchSize;
+		unsigned int wordCount = (paddedCount + kBitsPerWord - 1) / kBitsPerWord;
+
+		mPositionX.resize(paddedCount, 0.0f);
+		mPositionY.resize(paddedCount, 0.0f);
+		mPositionZ.resize(paddedCount, 0.0f);
+		mOrientationW.resize(paddedCount, 1.0f);
+		mOrientationX.resize(paddedCount, 0.0f);
+		mOrientationY.resize(paddedCount, 0.0f);
+		mOrientationZ.resize(paddedCount, 0.0f);
+		mVelocityX.resize(paddedCount, 0.0f);
+		mVelocityY.resize(paddedCount, 0.0f);
+		mVelocityZ.resize(paddedCount, 0.0f);
+		mAngularVelocityX.resize(paddedCount, 0.0f);
+		mAngularVelocityY.resize(paddedCount, 0.0f);
+		mAngularVelocityZ.resize(paddedCount, 0.0f);
+		mForceX.resize(paddedCount, 0.0f);
+		mForceY.resize(paddedCount, 0.0f);
+		mForceZ.resize(paddedCount, 0.0f);
+		mTorqueX.resize(paddedCount, 0.0f);
+		mTorqueY.resize(paddedCount, 0.0f);
+		mTorqueZ.resize(paddedCount, 0.0f);
+		mInverseMass.resize(paddedCount, 0.0f);
+		mInverseInertiaX.resize(paddedCount, 0.0f);
+		mInverseInertiaY.resize(paddedCount, 0.0f);
+		mInverseInertiaZ.resize(paddedCount, 0.0f);
+
+		mRestingTime.resize(paddedCount, 0.0f);
+		mAwake.resize(wordCount, 0);
+		mSet.resize(wordCount, 0);
+		mMoved.resize(wordCount, 0);
+	}
+
+	unsigned int index = mCount++;
+
+	if(mass > 0.0f)
+	{
+		mInverseMass[index] = 1.0f / mass;
+		mInverseInertiaX[index] = inertia.x > 0.0f ? 1.0f / inertia.x : 0.0f;
+		mInverseInertiaY[index] = inertia.y > 0.0f ? 1.0f / inertia.y : 0.0f;
+		mInverseInertiaZ[index] = inertia.z > 0.0f ? 1.0f / inertia.z : 0.0f;
+	}
+
+	SetPosition(index, position);
+	SetOrientation(index, orientation);
+	Wake(index);
+
+	return index;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Reserves room for count bodies, so that creating up to that many does not reallocate.
+*/
+void DSPhysics::RigidBodyWorld::Reserve(unsigned int count)
+{
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagPhysics);
+
+	unsigned int paddedCount = (count + kBatchSize - 1) / kBatchSize * kBatchSize;
+	unsigned int wordCount = (paddedCount + kBitsPerWord - 1) / kBitsPerWord;
+
+	mPositionX.reserve(paddedCount);
+	mPositionY.reserve(paddedCount);
+	mPositionZ.reserve(paddedCount);
+	mOrientationW.reserve(paddedCount);
+	mOrientationX.reserve(paddedCount);
+	mOrientationY.reserve(paddedCount);
+	mOrientationZ.reserve(paddedCount);
+	mVelocityX.reserve(paddedCount);
+	mVelocityY.reserve(paddedCount);
+	mVelocityZ.reserve(paddedCount);
+	mAngularVelocityX.reserve(paddedCount);
+	mAngularVelocityY.reserve(paddedCount);
+	mAngularVelocityZ.reserve(paddedCount);
+	mForceX.reserve(paddedCount);
+	mForceY.reserve(paddedCount);
+	mForceZ.reserve(paddedCount);
+	mTorqueX.reserve(paddedCount);
+	mTorqueY.reserve(paddedCount);
+	mTorqueZ.reserve(paddedCount);
+	mInverseMass.reserve(paddedCount);
+	mInverseInertiaX.reserve(paddedCount);
+	mInverseInertiaY.reserve(paddedCount);
+	mInverseInertiaZ.reserve(paddedCount);
+
+	mRestingTime.reserve(paddedCount);
+	mAwake.reserve(wordCount);
+	mSet.reserve(wordCount);
+	mMoved.reserve(wordCount);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Removes every body. Capacity is kept, so refilling the world does not allocate.
+*/
+void DSPhysics::RigidBodyWorld::Clear()
+{
+	mCount = 0;
+
+	mPositionX.clear();
+	mPositionY.clear();
+	mPositionZ.clear();
+	mOrientationW.clear();
+	mOrientationX.clear();
+	mOrientationY.clear();
+	mOrientationZ.clear();
+	mVelocityX.clear();
+	mVelocityY.clear();
+	mVelocityZ.clear();
+	mAngularVelocityX.clear();
+	mAngularVelocityY.clear();
+	mAngularVelocityZ.clear();
+	mForceX.clear();
+	mForceY.clear();
+	mForceZ.clear();
+	mTorqueX.clear();
+	mTorqueY.clear();
+	mTorqueZ.clear();
+	mInverseMass.clear();
+	mInverseInertiaX.clear();
+	mInverseInertiaY.clear();
+	mInverseInertiaZ.clear();
+
+	mRestingTime.clear();
+	mAwake.clear();
+	mSet.clear();
+	mMoved.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Advances every awake body by timeStep seconds, using (and then clearing) the forces and torques applied since the last Step.
+	Afterwards GetHasMoved tells which bodies WriteBack needs to copy out: those that were awake, or set with a setter.
+Notes:
+	Must be called from a thread registered with DSThreading::JobSystem. Below kWordsPerJob words it runs on the calling thread anyway.
+*/
+void DSPhysics::RigidBodyWorld::Step(float timeStep)
+{
+	DS_PROFILE_SCOPE("Rigid Bodies");
+
+	unsigned int wordCount = static_cast<unsigned int>(mAwake.size());
+	for(unsigned int word = 0; word < wordCount; ++word)
+	{
+		mMoved[word] = mAwake[word] | mSet[word];
+		mSet[word] = 0;
+	}
+
+	mTimeStep = timeStep;
+	DSThreading::JobSystem::ParallelFor("Rigid Bodies", 0, wordCount, kWordsPerJob, StepRange, this);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Copies the position and orientation of every body the last Step moved into its instance, and updates the instance's transform.
+	Instances of bodies that didn't move are left alone, so idle bodies cost a bit test each.
+Variables:
+	pBodies, pInstances = count bodies and the instances they move, in the same order (eg. the two component arrays of a chunk).
+*/
+void DSPhysics::RigidBodyWorld::WriteBack(const DSPhysics::RigidBody* pBodies, DSGraphics::ModelInstance* pInstances, unsigned int count) const
+{
+	for(unsigned int i = 0; i < count; ++i)
+	{
+		unsigned int body = pBodies[i].mBody;
+		if(GetBit(mMoved, body) == false)
+		{
+			continue;
+		}
+
+		pInstances[i].SetPosition(glm::vec3(mPositionX[body], mPositionY[body], mPositionZ[body]));
+		pInstances[i].SetOrientation(DSMathematics::Quaternion(mOrientationW[body], mOrientationX[body], mOrientationY[body], mOrientationZ[body]));
+		pInstances[i].UpdateTransform();
+	}
+}
+
+//-----------------------------------------------------------------------------
+//  Forces
+
+/*
+Description:
+	Pushes the body through its centre of mass for the next Step, and wakes it.
+*/
+void DSPhysics::RigidBodyWorld::ApplyForce(unsigned int index, const glm::vec3& force)
+{
+	if(GetIsStatic(index) == true)
+	{
+		return;
+	}
+
+	mForceX[index] += force.x;
+	mForceY[index] += force.y;
+	mForceZ[index] += force.z;
+	Wake(index);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Turns the body (torque in world space) for the next Step, and wakes it.
+*/
+void DSPhysics::RigidBodyWorld::ApplyTorque(unsigned int index, const glm::vec3& torque)
+{
+	if(GetIsStatic(index) == true)
+	{
+		return;
+	}
+
+	mTorqueX[index] += torque.x;
+	mTorqueY[index] += torque.y;
+	mTorqueZ[index] += torque.z;
+	Wake(index);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Changes the body's velocity and angular velocity at once, as if hit at point (in world space), and wakes it.
+*/
+void DSPhysics::RigidBodyWorld::ApplyImpulse(unsigned int index, const glm::vec3& impulse, const glm::vec3& point)
+{
+	if(GetIsStatic(index) == true)
+	{
+		return;
+	}
+
+	glm::vec3 velocity = GetLinearVelocity(index) + impulse * mInverseMass[index];
+	glm::vec3 angularVelocity = GetAngularVelocity(index) + ApplyInverseInertia(index, glm::cross(point - GetPosition(index), impulse));
+	SetLinearVelocity(index, velocity);
+	SetAngularVelocity(index, angularVelocity);
+}
+
+//-----------------------------------------------------------------------------
+//  Sleeping
+
+/*
+Notes:
+	Static bodies never wake.
+*/
+void DSPhysics::RigidBodyWorld::Wake(unsigned int index)
+{
+	if(GetIsStatic(index) == true)
+	{
+		return;
+	}
+
+	SetBit(mAwake, index, true);
+	mRestingTime[index] = 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Stops the body where it is, and stops simulating it until something wakes it.
+*/
+void DSPhysics::RigidBodyWorld::Sleep(unsigned int index)
+{
+	SetBit(mAwake, index, false);
+	mVelocityX[index] = mVelocityY[index] = mVelocityZ[index] = 0.0f;
+	mAngularVelocityX[index] = mAngularVelocityY[index] = mAngularVelocityZ[index] = 0.0f;
+	mForceX[index] = mForceY[index] = mForceZ[index] = 0.0f;
+	mTorqueX[index] = mTorqueY[index] = mTorqueZ[index] = 0.0f;
+	mRestingTime[index] = 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+//  Reports
+
+void DSPhysics::RigidBodyWorld::PrintSummary() const
+{
+	unsigned int staticCount = 0;
+	for(unsigned int i = 0; i < mCount; ++i)
+	{
+		if(GetIsStatic(i) == true)
+		{
+			++staticCount;
+		}
+	}
+
+	printf("Rigid bodies: %u (%u awake, %u static), %u moved last step\n", mCount, GetAwakeCount(), staticCount, GetMovedCount());
+}
+
+//-----------------------------------------------------------------------------
+//  Helper Functions
+
+/*
+Description:
+	The principal moments of inertia of a solid box of the given mass and size (full widths), for Create.
+*/
+glm::vec3 DSPhysics::RigidBodyWorld::GetBoxInertia(float mass, const glm::vec3& size)
+{
+	glm::vec3 squared = size * size;
+	return glm::vec3(squared.y + squared.z, squared.x + squared.z, squared.x + squared.y) * (mass / 12.0f);
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Step Sub-Functions
+
+void DSPhysics::RigidBodyWorld::StepRange(unsigned int beginWord, unsigned int endWord, void* pUserData)
+{
+	DSPhysics::RigidBodyWorld* pWorld = static_cast<DSPhysics::RigidBodyWorld*>(pUserData);
+
+	for(unsigned int word = beginWord; word < endWord; ++word)
+	{
+		unsigned int awake = pWorld->mAwake[word];
+		if(awake == 0)
+		{
+			continue;
+		}
+
+		//One nibble per batch
+		for(unsigned int batch = 0; batch < kBitsPerWord / kBatchSize; ++batch)
+		{
+			unsigned int batchAwake = (awake >> (batch * kBatchSize)) & 0xF;
+			if(batchAwake != 0)
+			{
+				pWorld->IntegrateBatch(word * kBitsPerWord + batch * kBatchSize, batchAwake);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Integrates bodies [first, first + kBatchSize), leaving the ones asleep (not in awake, one bit per body) as they are.
+	Then counts how long each has been slow for, and puts to sleep the ones slow for long enough.
+Notes:
+	Velocities first, then position and orientation from the new velocities (semi-implicit Euler), which is stable for orbits and springs where explicit Euler gains energy.
+	The orientation is advanced by dq = (0, angular velocity) * q * timeStep / 2, and renormalized.
+	Each SSE register holds one component for all four bodies, so the maths is the scalar formula done four times at once.
+*/
+void DSPhysics::RigidBodyWorld::IntegrateBatch(unsigned int first, unsigned int awake)
+{
+	float timeStep = mTimeStep;
+	float linearDamping = std::max(0.0f, 1.0f - mSettings.mLinearDamping * timeStep);
+	float angularDamping = std::max(0.0f, 1.0f - mSettings.mAngularDamping * timeStep);
+	unsigned int fallingAsleep = 0;
+
+#if defined(DS_SSE)
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 dt = _mm_set1_ps(timeStep);
+	const __m128 halfDt = _mm_set1_ps(timeStep * 0.5f);
+	__m128 isAwake = _mm_cmpneq_ps(_mm_setr_ps(static_cast<float>(awake & 1), static_cast<float>(awake & 2), static_cast<float>(awake & 4), static_cast<float>(awake & 8)), zero);
+
+	//Load
+	Vector3x4 position = Load3(mPositionX, mPositionY, mPositionZ, first);
+	__m128 qw = _mm_loadu_ps(&mOrientationW[first]);
+	Vector3x4 qv = Load3(mOrientationX, mOrientationY, mOrientationZ, first);
+	Vector3x4 velocity = Load3(mVelocityX, mVelocityY, mVelocityZ, first);
+	Vector3x4 angularVelocity = Load3(mAngularVelocityX, mAngularVelocityY, mAngularVelocityZ, first);
+	Vector3x4 force = Load3(mForceX, mForceY, mForceZ, first);
+	Vector3x4 torque = Load3(mTorqueX, mTorqueY, mTorqueZ, first);
+	__m128 inverseMass = _mm_loadu_ps(&mInverseMass[first]);
+	Vector3x4 inverseInertia = Load3(mInverseInertiaX, mInverseInertiaY, mInverseInertiaZ, first);
+
+	//Velocity: v += (F / m + g) * dt, then damped
+	Vector3x4 acceleration =
+	{
+		_mm_add_ps(_mm_mul_ps(force.mX, inverseMass), _mm_set1_ps(mSettings.mGravity.x)),
+		_mm_add_ps(_mm_mul_ps(force.mY, inverseMass), _mm_set1_ps(mSettings.mGravity.y)),
+		_mm_add_ps(_mm_mul_ps(force.mZ, inverseMass), _mm_set1_ps(mSettings.mGravity.z))
+	};
+	Vector3x4 newVelocity = MultiplyAdd3(velocity, acceleration, dt);
+	__m128 linearDamping4 = _mm_set1_ps(linearDamping);
+	newVelocity.mX = _mm_mul_ps(newVelocity.mX, linearDamping4);
+	newVelocity.mY = _mm_mul_ps(newVelocity.mY, linearDamping4);
+	newVelocity.mZ = _mm_mul_ps(newVelocity.mZ, linearDamping4);
+
+	//Angular velocity: w += I^-1 * torque * dt, with I^-1 taken into world space by the orientation (into body space, scale, back out), then damped
+	Vector3x4 qvInverse = { _mm_sub_ps(zero, qv.mX), _mm_sub_ps(zero, qv.mY), _mm_sub_ps(zero, qv.mZ) };
+	Vector3x4 localTorque = Rotate3(qw, qvInverse, torque);
+	localTorque.mX = _mm_mul_ps(localTorque.mX, inverseInertia.mX);
+	localTorque.mY = _mm_mul_ps(localTorque.mY, inverseInertia.mY);
+	localTorque.mZ = _mm_mul_ps(localTorque.mZ, inverseInertia.mZ);
+	Vector3x4 newAngularVelocity = MultiplyAdd3(angularVelocity, Rotate3(qw, qv, localTorque), dt);
+	__m128 angularDamping4 = _mm_set1_ps(angularDamping);
+	newAngularVelocity.mX = _mm_mul_ps(newAngularVelocity.mX, angularDamping4);
+	newAngularVelocity.mY = _mm_mul_ps(newAngularVelocity.mY, angularDamping4);
+	newAngularVelocity.mZ = _mm_mul_ps(newAngularVelocity.mZ, angularDamping4);
+
+	//Position: p += v * dt
+	Vector3x4 newPosition = MultiplyAdd3(position, newVelocity, dt);
+
+	//Orientation: q += (0, w) * q * dt / 2, which is (-w.u, qw * w + w x u) * dt / 2 for q = (qw, u)
+	__m128 newQw = _mm_sub_ps(qw, _mm_mul_ps(Dot3(newAngularVelocity, qv), halfDt));
+	Vector3x4 spin = MultiplyAdd3(Cross3(newAngularVelocity, qv), newAngularVelocity, qw);
+	Vector3x4 newQv = MultiplyAdd3(qv, spin, halfDt);
+	__m128 inverseLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(newQw, newQw), Dot3(newQv, newQv))));
+	newQw = _mm_mul_ps(newQw, inverseLength);
+	newQv.mX = _mm_mul_ps(newQv.mX, inverseLength);
+	newQv.mY = _mm_mul_ps(newQv.mY, inverseLength);
+	newQv.mZ = _mm_mul_ps(newQv.mZ, inverseLength);
+
+	//Sleeping: count the time spent slow, and fall asleep once it is long enough
+	__m128 isSlow = _mm_and_ps(
+		_mm_cmplt_ps(Dot3(newVelocity, newVelocity), _mm_set1_ps(mSettings.mSleepLinearSpeed * mSettings.mSleepLinearSpeed)),
+		_mm_cmplt_ps(Dot3(newAngularVelocity, newAngularVelocity), _mm_set1_ps(mSettings.mSleepAngularSpeed * mSettings.mSleepAngularSpeed)));
+	__m128 restingTime = _mm_and_ps(_mm_add_ps(_mm_loadu_ps(&mRestingTime[first]), dt), isSlow);
+	__m128 isFallingAsleep = _mm_and_ps(isAwake, _mm_cmpge_ps(restingTime, _mm_set1_ps(mSettings.mSleepTime)));
+	fallingAsleep = static_cast<unsigned int>(_mm_movemask_ps(isFallingAsleep));
+
+	//Store the awake bodies' results (Sleep below then stops the ones falling asleep)
+	Store3(mPositionX, mPositionY, mPositionZ, first, Select3(isAwake, newPosition, position));
+	_mm_storeu_ps(&mOrientationW[first], Select(isAwake, newQw, qw));
+	Store3(mOrientationX, mOrientationY, mOrientationZ, first, Select3(isAwake, newQv, qv));
+	Store3(mVelocityX, mVelocityY, mVelocityZ, first, Select3(isAwake, newVelocity, velocity));
+	Store3(mAngularVelocityX, mAngularVelocityY, mAngularVelocityZ, first, Select3(isAwake, newAngularVelocity, angularVelocity));
+	_mm_storeu_ps(&mRestingTime[first], Select(isAwake, restingTime, _mm_loadu_ps(&mRestingTime[first])));
+
+	//Forces only ever build up on awake bodies, so the whole batch can be cleared
+	Vector3x4 none = { zero, zero, zero };
+	Store3(mForceX, mForceY, mForceZ, first, none);
+	Store3(mTorqueX, mTorqueY, mTorqueZ, first, none);
+#else
+	for(unsigned int lane = 0; lane < kBatchSize; ++lane)
+	{
+		if((awake & (1u << lane)) == 0)
+		{
+			continue;
+		}
+		unsigned int i = first + lane;
+
+		//Velocity
+		glm::vec3 force(mForceX[i], mForceY[i], mForceZ[i]);
+		glm::vec3 velocity = (GetLinearVelocity(i) + (force * mInverseMass[i] + mSettings.mGravity) * timeStep) * linearDamping;
+
+		//Angular velocity
+		glm::vec3 torque(mTorqueX[i], mTorqueY[i], mTorqueZ[i]);
+		glm::vec3 angularVelocity = (GetAngularVelocity(i) + ApplyInverseInertia(i, torque) * timeStep) * angularDamping;
+
+		//Position
+		glm::vec3 position = GetPosition(i) + velocity * timeStep;
+
+		//Orientation ((0, w) * q is q.Multiply((0, w)), see DSMathematics::Quaternion::Multiply)
+		DSMathematics::Quaternion q = GetOrientation(i);
+		DSMathematics::Quaternion spin = q.Multiply(DSMathematics::Quaternion(0.0f, angularVelocity.x, angularVelocity.y, angularVelocity.z));
+		q.mW += spin.mW * timeStep * 0.5f;
+		q.mV += spin.mV * timeStep * 0.5f;
+		q = q.Normalize();
+
+		//Store
+		mPositionX[i] = position.x;
+		mPositionY[i] = position.y;
+		mPositionZ[i] = position.z;
+		mOrientationW[i] = q.mW;
+		mOrientationX[i] = q.mV.x;
+		mOrientationY[i] = q.mV.y;
+		mOrientationZ[i] = q.mV.z;
+		mVelocityX[i] = velocity.x;
+		mVelocityY[i] = velocity.y;
+		mVelocityZ[i] = velocity.z;
+		mAngularVelocityX[i] = angularVelocity.x;
+		mAngularVelocityY[i] = angularVelocity.y;
+		mAngularVelocityZ[i] = angularVelocity.z;
+		mForceX[i] = mForceY[i] = mForceZ[i] = 0.0f;
+		mTorqueX[i] = mTorqueY[i] = mTorqueZ[i] = 0.0f;
+
+		//Sleeping
+		bool isSlow = glm::dot(velocity, velocity) < mSettings.mSleepLinearSpeed * mSettings.mSleepLinearSpeed
+			&& glm::dot(angularVelocity, angularVelocity) < mSettings.mSleepAngularSpeed * mSettings.mSleepAngularSpeed;
+		mRestingTime[i] = isSlow == true ? mRestingTime[i] + timeStep : 0.0f;
+		if(mRestingTime[i] >= mSettings.mSleepTime)
+		{
+			fallingAsleep |= 1u << lane;
+		}
+	}
+#endif
+
+	//Only this batch's bits, and each word belongs to one job, so this is safe in parallel
+	for(unsigned int lane = 0; lane < kBatchSize; ++lane)
+	{
+		if((fallingAsleep & (1u << lane)) != 0)
+		{
+			Sleep(first + lane);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+//  Helper Functions
+
+/*
+Description:
+	Multiplies v (in world space) by the body's inverse inertia: into the body's own space, scaled by the inverse principal moments, and back out.
+*/
+glm::vec3 DSPhysics::RigidBodyWorld::ApplyInverseInertia(unsigned int index, const glm::vec3& v) const
+{
+	DSMathematics::Quaternion orientation = GetOrientation(index);
+	glm::vec3 local = orientation.Invert().Rotate(v);
+	local *= glm::vec3(mInverseInertiaX[index], mInverseInertiaY[index], mInverseInertiaZ[index]);
+	return orientation.Rotate(local);
+}
+
+//-----------------------------------------------------------------------------
+
+void DSPhysics::RigidBodyWorld::SetBit(std::vector<unsigned int>& bits, unsigned int index, bool value)
+{
+	unsigned int mask = 1u << (index % kBitsPerWord);
+	if(value == true)
+	{
+		bits[index / kBitsPerWord] |= mask;
+	}
+	else
+	{
+		bits[index / kBitsPerWord] &= ~mask;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSPhysics::RigidBodyWorld::GetBit(const std::vector<unsigned int>& bits, unsigned int index)
+{
+	return (bits[index / kBitsPerWord] & (1u << (index % kBitsPerWord))) != 0;
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+const DSPhysics::RigidBodySettings& DSPhysics::RigidBodyWorld::GetSettings() const
+{
+	return mSettings;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSPhysics::RigidBodyWorld::GetCount() const
+{
+	return mCount;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSPhysics::RigidBodyWorld::GetAwakeCount() const
+{
+	return CountBits(mAwake);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	How many bodies the last Step moved, so a caller can skip WriteBack entirely when nothing did.
+*/
+unsigned int DSPhysics::RigidBodyWorld::GetMovedCount() const
+{
+	return CountBits(mMoved);
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSPhysics::RigidBodyWorld::GetIsAwake(unsigned int index) const
+{
+	return GetBit(mAwake, index);
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSPhysics::RigidBodyWorld::GetHasMoved(unsigned int index) const
+{
+	return GetBit(mMoved, index);
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSPhysics::RigidBodyWorld::GetIsStatic(unsigned int index) const
+{
+	return mInverseMass[index] == 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+glm::vec3 DSPhysics::RigidBodyWorld::GetPosition(unsigned int index) const
+{
+	return glm::vec3(mPositionX[index], mPositionY[index], mPositionZ[index]);
+}
+
+//-----------------------------------------------------------------------------
+
+DSMathematics::Quaternion DSPhysics::RigidBodyWorld::GetOrientation(unsigned int index) const
+{
+	return DSMathematics::Quaternion(mOrientationW[index], mOrientationX[index], mOrientationY[index], mOrientationZ[index]);
+}
+
+//-----------------------------------------------------------------------------
+
+glm::vec3 DSPhysics::RigidBodyWorld::GetLinearVelocity(unsigned int index) const
+{
+	return glm::vec3(mVelocityX[index], mVelocityY[index], mVelocityZ[index]);
+}
+
+//-----------------------------------------------------------------------------
+
+glm::vec3 DSPhysics::RigidBodyWorld::GetAngularVelocity(unsigned int index) const
+{
+	return glm::vec3(mAngularVelocityX[index], mAngularVelocityY[index], mAngularVelocityZ[index]);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	0 for static bodies.
+*/
+float DSPhysics::RigidBodyWorld::GetMass(unsigned int index) const
+{
+	return mInverseMass[index] > 0.0f ? 1.0f / mInverseMass[index] : 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+// Setters
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	The setters wake the body (unless it is static), and make sure the next WriteBack copies it out even if it is static.
+*/
+void DSPhysics::RigidBodyWorld::SetPosition(unsigned int index, const glm::vec3& position)
+{
+	mPositionX[index] = position.x;
+	mPositionY[index] = position.y;
+	mPositionZ[index] = position.z;
+	SetBit(mSet, index, true);
+	Wake(index);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	orientation = a unit quaternion.
+*/
+void DSPhysics::RigidBodyWorld::SetOrientation(unsigned int index, const DSMathematics::Quaternion& orientation)
+{
+	mOrientationW[index] = orientation.mW;
+	mOrientationX[index] = orientation.mV.x;
+	mOrientationY[index] = orientation.mV.y;
+	mOrientationZ[index] = orientation.mV.z;
+	SetBit(mSet, index, true);
+	Wake(index);
+}
+
+//-----------------------------------------------------------------------------
+
+void DSPhysics::RigidBodyWorld::SetLinearVelocity(unsigned int index, const glm::vec3& velocity)
+{
+	if(GetIsStatic(index) == true)
+	{
+		return;
+	}
+
+	mVelocityX[index] = velocity.x;
+	mVelocityY[index] = velocity.y;
+	mVelocityZ[index] = velocity.z;
+	Wake(index);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	angularVelocity = axis (in world space) times radians per second.
+*/
+void DSPhysics::RigidBodyWorld::SetAngularVelocity(unsigned int index, const glm::vec3& angularVelocity)
+{
+	if(GetIsStatic(index) == true)
+	{
+		return;
+	}
+
+	mAngularVelocityX[index] = angularVelocity.x;
+	mAngularVelocityY[index] = angularVelocity.y;
+	mAngularVelocityZ[index] = angularVelocity.z;
+	Wake(index);
+}
\ No newline at end of file
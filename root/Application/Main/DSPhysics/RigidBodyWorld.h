@@ -0,0 +1,226 @@
+//=============================================================================
+// File:		RigidBodyWorld.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	RigidBodyWorld. Structure of arrays storage and integration for many rigid bodies, where bodies at rest fall asleep and cost nothing.
+//=============================================================================
+
+#ifndef RIGIDBODYWORLD_H
+#define RIGIDBODYWORLD_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLM
+#include <glm/glm.hpp>
+
+// Standard C++ Libraries
+#include <vector>
+
+// Daniel Schenker
+#include "../DSMathematics/Quaternion.h"
+
+//=============================================================================
+//Forward Declarations
+//=============================================================================
+
+namespace DSGraphics
+{
+	class ModelInstance;
+}
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSPhysics
+{
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	/*
+	Notes:
+		Distances are in the same units as DSGraphics::ModelInstance positions (device coordinates, see Object::sDCPerM).
+	*/
+	struct RigidBodySettings
+	{
+		RigidBodySettings()
+		:	mGravity(0.0f)
+		,	mLinearDamping(0.0f)
+		,	mAngularDamping(0.0f)
+		,	mSleepLinearSpeed(0.01f)
+		,	mSleepAngularSpeed(0.01f)
+		,	mSleepTime(0.5f)
+		{
+		}
+
+		glm::vec3 mGravity;
+		float mLinearDamping;//fraction of each body's velocity lost per second
+		float mAngularDamping;//fraction of each body's angular velocity lost per second
+		float mSleepLinearSpeed;//a body slower than this...
+		float mSleepAngularSpeed;//...and turning slower than this (radians per second)...
+		float mSleepTime;//...for this many seconds falls asleep until something wakes it
+	};
+
+	//-----------------------------------------------------------------------------
+
+	/*
+	Description:
+		The component an entity carries to be moved by a RigidBodyWorld (see RigidBodyWorld::WriteBack).
+	*/
+	struct RigidBody
+	{
+		unsigned int mBody;//index into the RigidBodyWorld
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Holds position, orientation (a unit quaternion), velocity and angular velocity for every body, one contiguous array per component.
+		Step integrates with semi-implicit Euler: velocities first, from the forces applied since the last step, then position and orientation from the new velocities,
+		four bodies at a time with SSE.
+		Every body is awake or asleep, one bit each. Step only visits awake bodies, and skips every 32 bodies whose awake word is empty,
+		so a world of idle bodies costs a pass over its awake words and nothing else.
+		A body that stays slower than the sleep speeds for mSleepTime falls asleep, and its velocities are zeroed.
+		Applying a force, torque or impulse, or setting its state, wakes it again.
+	Usage:
+		DSPhysics::RigidBodyWorld bodies;
+		unsigned int ship = bodies.Create(position, orientation, 1.0f, DSPhysics::RigidBodyWorld::GetBoxInertia(1.0f, size));
+		...
+		bodies.ApplyForce(ship, thrust);//simulation thread
+		bodies.Step(timeStep);
+		bodies.WriteBack(pBodies, pInstances, count);//eg. per chunk of entities with both components
+	Notes:
+		Angular velocity is in world space. Inertia is given as the principal moments in the body's own space, and turned into world space with its orientation as needed.
+		Gyroscopic effects are left out, so a body spins about its angular velocity until something else turns it.
+		A body with no mass is static: it never moves on its own and never wakes, though it can still be placed with the setters.
+		The arrays are padded to a multiple of four with static bodies, so batches never need a remainder loop.
+		Not thread safe, apart from Step spreading itself over the job system. Use it from one thread (the simulation's).
+		Bodies are referred to by index. Indices are handed out in order and stay valid until Clear().
+	*/
+	class RigidBodyWorld
+	{
+	public:
+		//Constructors
+		explicit RigidBodyWorld(const DSPhysics::RigidBodySettings& settings = DSPhysics::RigidBodySettings());
+		//Destructor
+		~RigidBodyWorld();
+
+	private:
+		//Disable Copy Constructor
+		RigidBodyWorld(const RigidBodyWorld&);
+		const RigidBodyWorld& operator=(const RigidBodyWorld&);
+
+		//Member Functions
+	public:
+		// General
+		unsigned int Create(const glm::vec3& position, const DSMathematics::Quaternion& orientation, float mass, const glm::vec3& inertia);
+		void Reserve(unsigned int count);
+		void Clear();
+		void Step(float timeStep);
+		void WriteBack(const DSPhysics::RigidBody* pBodies, DSGraphics::ModelInstance* pInstances, unsigned int count) const;
+
+		// Forces
+		void ApplyForce(unsigned int index, const glm::vec3& force);
+		void ApplyTorque(unsigned int index, const glm::vec3& torque);
+		void ApplyImpulse(unsigned int index, const glm::vec3& impulse, const glm::vec3& point);
+
+		// Sleeping
+		void Wake(unsigned int index);
+		void Sleep(unsigned int index);
+
+		// Reports
+		void PrintSummary() const;
+
+		// Helper Functions
+		static glm::vec3 GetBoxInertia(float mass, const glm::vec3& size);
+
+	private:
+		// Step Sub-Functions
+		static void StepRange(unsigned int beginWord, unsigned int endWord, void* pUserData);
+		void IntegrateBatch(unsigned int first, unsigned int awake);
+
+		// Helper Functions
+		glm::vec3 ApplyInverseInertia(unsigned int index, const glm::vec3& v) const;
+		static void SetBit(std::vector<unsigned int>& bits, unsigned int index, bool value);
+		static bool GetBit(const std::vector<unsigned int>& bits, unsigned int index);
+
+	public:
+		// Getters
+		const DSPhysics::RigidBodySettings& GetSettings() const;
+		unsigned int GetCount() const;
+		unsigned int GetAwakeCount() const;
+		unsigned int GetMovedCount() const;
+		bool GetIsAwake(unsigned int index) const;
+		bool GetHasMoved(unsigned int index) const;
+		bool GetIsStatic(unsigned int index) const;
+		glm::vec3 GetPosition(unsigned int index) const;
+		DSMathematics::Quaternion GetOrientation(unsigned int index) const;
+		glm::vec3 GetLinearVelocity(unsigned int index) const;
+		glm::vec3 GetAngularVelocity(unsigned int index) const;
+		float GetMass(unsigned int index) const;
+
+		// Setters
+		void SetPosition(unsigned int index, const glm::vec3& position);
+		void SetOrientation(unsigned int index, const DSMathematics::Quaternion& orientation);
+		void SetLinearVelocity(unsigned int index, const glm::vec3& velocity);
+		void SetAngularVelocity(unsigned int index, const glm::vec3& angularVelocity);
+
+		//Member Variables
+	private:
+		static const unsigned int kBatchSize = 4;//bodies integrated per SSE batch
+		static const unsigned int kBitsPerWord = 32;
+		static const unsigned int kWordsPerJob = 64;//2048 bodies per job in Step
+
+		DSPhysics::RigidBodySettings mSettings;
+		unsigned int mCount;
+		float mTimeStep;//of the Step in progress
+
+		// Position
+		std::vector<float> mPositionX;
+		std::vector<float> mPositionY;
+		std::vector<float> mPositionZ;
+		// Orientation
+		std::vector<float> mOrientationW;
+		std::vector<float> mOrientationX;
+		std::vector<float> mOrientationY;
+		std::vector<float> mOrientationZ;
+		// Linear Velocity
+		std::vector<float> mVelocityX;
+		std::vector<float> mVelocityY;
+		std::vector<float> mVelocityZ;
+		// Angular Velocity (world space)
+		std::vector<float> mAngularVelocityX;
+		std::vector<float> mAngularVelocityY;
+		std::vector<float> mAngularVelocityZ;
+		// Accumulated Since the Last Step
+		std::vector<float> mForceX;
+		std::vector<float> mForceY;
+		std::vector<float> mForceZ;
+		std::vector<float> mTorqueX;
+		std::vector<float> mTorqueY;
+		std::vector<float> mTorqueZ;
+		// Mass
+		std::vector<float> mInverseMass;//0 for static bodies
+		std::vector<float> mInverseInertiaX;//principal moments, in the body's own space
+		std::vector<float> mInverseInertiaY;
+		std::vector<float> mInverseInertiaZ;
+
+		// Sleeping
+		std::vector<float> mRestingTime;//seconds spent below the sleep speeds
+		std::vector<unsigned int> mAwake;//one bit per body
+		std::vector<unsigned int> mSet;//one bit per body placed or set by a setter since the last Step
+		std::vector<unsigned int> mMoved;//one bit per body whose position or orientation the last Step may have changed, for WriteBack
+	};
+
+}//namespace DSPhysics
+
+#endif //#ifndef RIGIDBODYWORLD_H
\ No newline at end of file
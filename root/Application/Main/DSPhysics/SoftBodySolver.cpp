@@ -0,0 +1,1147 @@
+//=============================================================================
+// File:		SoftBodySolver.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	SoftBodySolver
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Platform
+#include "../DSSystem/Platform.h"
+
+// Standard C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "SoftBodySolver.h"
+#include "../DSGraphics/DeformableMesh.h"
+#include "../DSGraphics/ModelAsset.h"
+#include "../DSMemory/MemoryTracker.h"
+#include "../DSProfiling/Profiler.h"
+#include "../DSThreading/JobSystem.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	const float kMinLength = 0.000001f;//shorter constraints are left out, and lengths are clamped to it before dividing
+	const float kMinLengthSquared = kMinLength * kMinLength;
+
+	//A vertex's position, for finding the vertices that share one
+	struct WeldEntry
+	{
+		float mX;
+		float mY;
+		float mZ;
+		unsigned int mVertex;
+
+		bool operator<(const WeldEntry& other) const
+		{
+			if(mX != other.mX)
+			{
+				return mX < other.mX;
+			}
+			if(mY != other.mY)
+			{
+				return mY < other.mY;
+			}
+			return mZ < other.mZ;
+		}
+
+		bool GetIsSamePosition(const WeldEntry& other) const
+		{
+			return mX == other.mX && mY == other.mY && mZ == other.mZ;
+		}
+	};
+
+	//One triangle's side, with the corner across from it
+	struct Edge
+	{
+		unsigned int mLow;
+		unsigned int mHigh;
+		unsigned int mOpposite;
+
+		bool operator<(const Edge& other) const
+		{
+			return mLow != other.mLow ? mLow < other.mLow : mHigh < other.mHigh;
+		}
+	};
+
+	bool GetHasColor(const std::vector<unsigned int>& colors, unsigned int color)
+	{
+		return std::find(colors.begin(), colors.end(), color) != colors.end();
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSPhysics::SoftBodyShape::SoftBodyShape()
+:	mIsClosed(false)
+,	mRestVolume(0.0f)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+DSPhysics::SoftBodySolver::SoftBodySolver(const DSPhysics::SoftBodySettings& settings)
+:	mSettings(settings)
+,	mTimeStep(0.0f)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Builds the particles and constraints from the model's triangles (its most detailed LOD). Returns false, with a warning, if it isn't drawn as triangles.
+*/
+bool DSPhysics::SoftBodyShape::Build(DSGraphics::ModelAsset& model)
+{
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagPhysics);
+
+	Clear();
+
+	if(model.GetDrawType() != GL_TRIANGLES)
+	{
+		fprintf(stderr, "WARNING: SoftBodyShape::Build needs a model drawn as GL_TRIANGLES.\n");
+		return false;
+	}
+
+	const GLfloat* pVertices = model.GetVertices();
+	const GLuint* pElements = model.GetElements();
+	unsigned int vertexCount = model.GetVertexCount();
+	unsigned int elementCount = pElements != nullptr ? model.GetElementCountTotal() : vertexCount;
+
+	Weld(model, pVertices);
+
+	//Triangles, leaving out any that welding collapsed
+	for(unsigned int i = 0; i + 2 < elementCount; i += 3)
+	{
+		unsigned int corners[3];
+		for(unsigned int j = 0; j < 3; ++j)
+		{
+			unsigned int vertex = pElements != nullptr ? pElements[i + j] : i + j;
+			if(vertex >= vertexCount)
+			{
+				fprintf(stderr, "WARNING: SoftBodyShape::Build was given a model with an element past its last vertex.\n");
+				Clear();
+				return false;
+			}
+			corners[j] = mVertexParticles[vertex];
+		}
+
+		if(corners[0] != corners[1] && corners[1] != corners[2] && corners[2] != corners[0])
+		{
+			mTriangles.insert(mTriangles.end(), corners, corners + 3);
+		}
+	}
+
+	//Edges, once for each triangle they border
+	std::vector<Edge> edges;
+	edges.reserve(mTriangles.size());
+	for(size_t i = 0; i < mTriangles.size(); i += 3)
+	{
+		for(unsigned int j = 0; j < 3; ++j)
+		{
+			unsigned int a = mTriangles[i + j];
+			unsigned int b = mTriangles[i + (j + 1) % 3];
+			Edge edge = { std::min(a, b), std::max(a, b), mTriangles[i + (j + 2) % 3] };
+			edges.push_back(edge);
+		}
+	}
+	std::sort(edges.begin(), edges.end());
+
+	//A stretch constraint per edge, and a bending constraint across each edge with a triangle on either side
+	mIsClosed = edges.empty() == false;
+	for(size_t i = 0; i < edges.size();)
+	{
+		size_t end = i + 1;
+		while(end < edges.size() && edges[end].mLow == edges[i].mLow && edges[end].mHigh == edges[i].mHigh)
+		{
+			++end;
+		}
+
+		AddConstraint(edges[i].mLow, edges[i].mHigh, false);
+		if(end - i == 2)
+		{
+			if(edges[i].mOpposite != edges[i + 1].mOpposite)
+			{
+				AddConstraint(edges[i].mOpposite, edges[i + 1].mOpposite, true);
+			}
+		}
+		else
+		{
+			mIsClosed = false;
+		}
+
+		i = end;
+	}
+
+	//Volume (the sum of the tetrahedra from the origin to each triangle)
+	if(mIsClosed == true)
+	{
+		double volume = 0.0;
+		for(size_t i = 0; i < mTriangles.size(); i += 3)
+		{
+			volume += glm::dot(glm::cross(mRestPositions[mTriangles[i]], mRestPositions[mTriangles[i + 1]]), mRestPositions[mTriangles[i + 2]]);
+		}
+		mRestVolume = static_cast<float>(volume / 6.0);
+	}
+
+	Color();
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSPhysics::SoftBodyShape::Clear()
+{
+	mRestPositions.clear();
+	mVertexParticles.clear();
+	mConstraintA.clear();
+	mConstraintB.clear();
+	mRestLengths.clear();
+	mIsBending.clear();
+	mColorStarts.clear();
+	mTriangles.clear();
+	mIsClosed = false;
+	mRestVolume = 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Adds a body made of shape, starting at rest in the shape of its model, and returns its index.
+Variables:
+	pMesh = a DeformableMesh of the model shape was built from, which UpdateMeshes moves; or nullptr for a body that is simulated but not drawn.
+*/
+unsigned int DSPhysics::SoftBodySolver::AddBody(const DSPhysics::SoftBodyShape& shape, DSGraphics::DeformableMesh* pMesh)
+{
+	if(shape.GetIsBuilt() == false)
+	{
+		throw std::runtime_error("ERROR: SoftBodySolver::AddBody was given a SoftBodyShape that isn't built.");
+	}
+	if(pMesh != nullptr && pMesh->GetVertexCount() != shape.GetVertexCount())
+	{
+		throw std::runtime_error("ERROR: SoftBodySolver::AddBody was given a DeformableMesh of a different model than its SoftBodyShape.");
+	}
+
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagPhysics);
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	Body body;
+	body.mpMesh = pMesh;
+	body.mFirstParticle = static_cast<unsigned int>(mPositionX.size());
+	body.mParticleCount = shape.GetParticleCount();
+	body.mPaddedParticleCount = (body.mParticleCount + kBatchSize - 1) / kBatchSize * kBatchSize;
+	body.mFirstColor = static_cast<unsigned int>(mColorStarts.size());
+	body.mColorCount = shape.GetColorCount();
+	body.mFirstTriangle = static_cast<unsigned int>(mTriangles.size() / 3);
+	body.mTriangleCount = shape.GetTriangleCount();
+	body.mFirstVertex = static_cast<unsigned int>(mVertexParticles.size());
+	body.mVertexCount = shape.GetVertexCount();
+	body.mRestVolume = shape.mRestVolume;
+	body.mRestingSteps = 0;
+	body.mIsAwake = false;//at rest until something hits it
+	body.mIsPublishPending = false;
+
+	//Particles
+	for(unsigned int i = 0; i < body.mPaddedParticleCount; ++i)
+	{
+		bool isPadding = i >= body.mParticleCount;
+		glm::vec3 position = isPadding == true ? glm::vec3(0.0f) : shape.mRestPositions[i];
+		mPositionX.push_back(position.x);
+		mPositionY.push_back(position.y);
+		mPositionZ.push_back(position.z);
+		mPreviousX.push_back(position.x);
+		mPreviousY.push_back(position.y);
+		mPreviousZ.push_back(position.z);
+		mVelocityX.push_back(0.0f);
+		mVelocityY.push_back(0.0f);
+		mVelocityZ.push_back(0.0f);
+		mInverseMass.push_back(isPadding == true ? 0.0f : 1.0f);
+		mGradients.push_back(glm::vec3(0.0f));
+	}
+
+	//Constraints
+	unsigned int firstConstraint = static_cast<unsigned int>(mConstraintA.size());
+	for(unsigned int i = 0; i < shape.GetConstraintCount(); ++i)
+	{
+		mConstraintA.push_back(body.mFirstParticle + shape.mConstraintA[i]);
+		mConstraintB.push_back(body.mFirstParticle + shape.mConstraintB[i]);
+		mRestLengths.push_back(shape.mRestLengths[i]);
+		mCompliances.push_back(shape.mIsBending[i] != 0 ? mSettings.mBendCompliance : mSettings.mStretchCompliance);
+	}
+	for(unsigned int i = 0; i <= body.mColorCount; ++i)
+	{
+		mColorStarts.push_back(firstConstraint + shape.mColorStarts[i]);
+	}
+	for(size_t i = 0; i < shape.mTriangles.size(); ++i)
+	{
+		mTriangles.push_back(body.mFirstParticle + shape.mTriangles[i]);
+	}
+
+	//Vertices
+	for(unsigned int i = 0; i < body.mVertexCount; ++i)
+	{
+		mVertexParticles.push_back(body.mFirstParticle + shape.mVertexParticles[i]);
+		mPublishedPositions.push_back(shape.mRestPositions[shape.mVertexParticles[i]]);
+	}
+
+	mBodies.push_back(body);
+	return static_cast<unsigned int>(mBodies.size() - 1);
+}
+
+//-----------------------------------------------------------------------------
+
+void DSPhysics::SoftBodySolver::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	mBodies.clear();
+	mAwakeBodies.clear();
+	mPositionX.clear();
+	mPositionY.clear();
+	mPositionZ.clear();
+	mPreviousX.clear();
+	mPreviousY.clear();
+	mPreviousZ.clear();
+	mVelocityX.clear();
+	mVelocityY.clear();
+	mVelocityZ.clear();
+	mInverseMass.clear();
+	mGradients.clear();
+	mConstraintA.clear();
+	mConstraintB.clear();
+	mRestLengths.clear();
+	mCompliances.clear();
+	mColorStarts.clear();
+	mTriangles.clear();
+	mVertexParticles.clear();
+	mImpacts.clear();
+	mPublishedPositions.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Hits a body at point (in its model's coordinates): every particle within radius of it gains velocity, all of it at point, fading to none at radius.
+	It only dents the body (see RemoveRigidMotion). Wakes the body. Safe to call from any thread; the impact is applied at the start of the next Step.
+*/
+void DSPhysics::SoftBodySolver::ApplyImpact(unsigned int body, const glm::vec3& point, const glm::vec3& velocity, float radius)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	if(body >= mBodies.size())
+	{
+		fprintf(stderr, "WARNING: SoftBodySolver::ApplyImpact was given a body that doesn't exist.\n");
+		return;
+	}
+
+	Impact impact;
+	impact.mBody = body;
+	impact.mPoint = point;
+	impact.mVelocity = velocity;
+	impact.mRadius = radius;
+	mImpacts.push_back(impact);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Advances every awake body by timeStep seconds, then publishes their new positions for UpdateMeshes.
+	Call from the simulation thread (which must be registered with the job system).
+*/
+void DSPhysics::SoftBodySolver::Step(float timeStep)
+{
+	DS_PROFILE_SCOPE("Soft Bodies");
+
+	ApplyImpacts();
+
+	mAwakeBodies.clear();
+	for(unsigned int i = 0; i < mBodies.size(); ++i)
+	{
+		if(mBodies[i].mIsAwake == true)
+		{
+			mAwakeBodies.push_back(i);
+		}
+	}
+	if(mAwakeBodies.empty() == true)
+	{
+		return;
+	}
+
+	mTimeStep = timeStep;
+	DSThreading::JobSystem::ParallelFor("Soft Bodies", 0, static_cast<unsigned int>(mAwakeBodies.size()), kBodiesPerJob, StepBodies, this);
+
+	Publish();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Moves each mesh whose body has moved since the last call to the body's latest positions, and uploads the vertices that changed.
+	Call on the thread that owns the GL context, before rendering.
+*/
+void DSPhysics::SoftBodySolver::UpdateMeshes()
+{
+	DS_PROFILE_SCOPE("Soft Body Meshes");
+
+	mUploads.clear();
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		for(unsigned int i = 0; i < mBodies.size(); ++i)
+		{
+			Body& body = mBodies[i];
+			if(body.mIsPublishPending == false || body.mpMesh == nullptr)
+			{
+				continue;
+			}
+
+			body.mpMesh->SetPositions(0, body.mVertexCount, &mPublishedPositions[body.mFirstVertex]);
+			body.mIsPublishPending = false;
+			mUploads.push_back(i);
+		}
+	}
+
+	//Outside the lock, so Step isn't kept waiting on the driver
+	for(size_t i = 0; i < mUploads.size(); ++i)
+	{
+		mBodies[mUploads[i]].mpMesh->Upload();
+	}
+}
+
+//-----------------------------------------------------------------------------
+//  Reports
+
+void DSPhysics::SoftBodySolver::PrintSummary() const
+{
+	unsigned int maxColorCount = 0;
+	for(size_t i = 0; i < mBodies.size(); ++i)
+	{
+		maxColorCount = std::max(maxColorCount, mBodies[i].mColorCount);
+	}
+
+	printf("Soft bodies: %u (%u awake), %u particles, %u constraints in at most %u colours, %u triangles\n",
+		GetBodyCount(), GetAwakeCount(), static_cast<unsigned int>(mPositionX.size()), static_cast<unsigned int>(mConstraintA.size()),
+		maxColorCount, static_cast<unsigned int>(mTriangles.size() / 3));
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Build Sub-Functions
+
+/*
+Description:
+	Makes a particle for each distinct vertex position, and maps every vertex to its particle.
+*/
+void DSPhysics::SoftBodyShape::Weld(const DSGraphics::ModelAsset& model, const float* pVertices)
+{
+	unsigned int vertexCount = model.GetVertexCount();
+	unsigned int floatsPerVertex = model.GetFloatsPerVertex();
+	bool is3D = model.GetPositionDimensions() > 2;
+
+	std::vector<WeldEntry> entries(vertexCount);
+	for(unsigned int i = 0; i < vertexCount; ++i)
+	{
+		const float* pPosition = pVertices + i * floatsPerVertex;
+		entries[i].mX = pPosition[0];
+		entries[i].mY = pPosition[1];
+		entries[i].mZ = is3D == true ? pPosition[2] : 0.0f;
+		entries[i].mVertex = i;
+	}
+	std::sort(entries.begin(), entries.end());
+
+	mVertexParticles.resize(vertexCount);
+	for(unsigned int i = 0; i < vertexCount; ++i)
+	{
+		if(i == 0 || entries[i].GetIsSamePosition(entries[i - 1]) == false)
+		{
+			mRestPositions.push_back(glm::vec3(entries[i].mX, entries[i].mY, entries[i].mZ));
+		}
+		mVertexParticles[entries[i].mVertex] = static_cast<unsigned int>(mRestPositions.size() - 1);
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void DSPhysics::SoftBodyShape::AddConstraint(unsigned int a, unsigned int b, bool isBending)
+{
+	float restLength = glm::length(mRestPositions[b] - mRestPositions[a]);
+	if(restLength < kMinLength)
+	{
+		return;
+	}
+
+	mConstraintA.push_back(a);
+	mConstraintB.push_back(b);
+	mRestLengths.push_back(restLength);
+	mIsBending.push_back(isBending == true ? 1 : 0);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Gives each constraint the lowest colour neither of its particles has yet (greedy graph colouring), then sorts the constraints by colour.
+*/
+void DSPhysics::SoftBodyShape::Color()
+{
+	unsigned int constraintCount = GetConstraintCount();
+
+	std::vector<std::vector<unsigned int> > particleColors(mRestPositions.size());
+	std::vector<unsigned int> colors(constraintCount);
+	unsigned int colorCount = 0;
+	for(unsigned int i = 0; i < constraintCount; ++i)
+	{
+		std::vector<unsigned int>& colorsA = particleColors[mConstraintA[i]];
+		std::vector<unsigned int>& colorsB = particleColors[mConstraintB[i]];
+
+		unsigned int color = 0;
+		while(GetHasColor(colorsA, color) == true || GetHasColor(colorsB, color) == true)
+		{
+			++color;
+		}
+
+		colors[i] = color;
+		colorsA.push_back(color);
+		colorsB.push_back(color);
+		colorCount = std::max(colorCount, color + 1);
+	}
+
+	//Counting sort by colour
+	mColorStarts.assign(colorCount + 1, 0);
+	for(unsigned int i = 0; i < constraintCount; ++i)
+	{
+		++mColorStarts[colors[i] + 1];
+	}
+	for(unsigned int i = 0; i < colorCount; ++i)
+	{
+		mColorStarts[i + 1] += mColorStarts[i];
+	}
+
+	std::vector<unsigned int> next(mColorStarts.begin(), mColorStarts.end() - 1);
+	std::vector<unsigned int> constraintA(constraintCount);
+	std::vector<unsigned int> constraintB(constraintCount);
+	std::vector<float> restLengths(constraintCount);
+	std::vector<unsigned char> isBending(constraintCount);
+	for(unsigned int i = 0; i < constraintCount; ++i)
+	{
+		unsigned int sorted = next[colors[i]]++;
+		constraintA[sorted] = mConstraintA[i];
+		constraintB[sorted] = mConstraintB[i];
+		restLengths[sorted] = mRestLengths[i];
+		isBending[sorted] = mIsBending[i];
+	}
+	mConstraintA.swap(constraintA);
+	mConstraintB.swap(constraintB);
+	mRestLengths.swap(restLengths);
+	mIsBending.swap(isBending);
+}
+
+//-----------------------------------------------------------------------------
+//  Step Sub-Functions
+
+void DSPhysics::SoftBodySolver::ApplyImpacts()
+{
+	std::vector<Impact> impacts;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		impacts.swap(mImpacts);
+	}
+
+	for(size_t i = 0; i < impacts.size(); ++i)
+	{
+		const Impact& impact = impacts[i];
+		Body& body = mBodies[impact.mBody];
+
+		bool isHit = false;
+		for(unsigned int j = body.mFirstParticle; j < body.mFirstParticle + body.mParticleCount; ++j)
+		{
+			glm::vec3 offset(mPositionX[j] - impact.mPoint.x, mPositionY[j] - impact.mPoint.y, mPositionZ[j] - impact.mPoint.z);
+			float distanceSquared = glm::dot(offset, offset);
+			if(distanceSquared >= impact.mRadius * impact.mRadius)
+			{
+				continue;
+			}
+
+			glm::vec3 velocity = impact.mVelocity * (1.0f - std::sqrt(distanceSquared) / impact.mRadius);
+			mVelocityX[j] += velocity.x;
+			mVelocityY[j] += velocity.y;
+			mVelocityZ[j] += velocity.z;
+			isHit = true;
+		}
+
+		if(isHit == true)
+		{
+			body.mIsAwake = true;
+			body.mRestingSteps = 0;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Takes away the part of the body's velocity that would move or spin it as a whole, leaving only what deforms it.
+	The body is in its model's coordinates, so moving the ship itself is up to its instance; anything left here would slide the mesh off it.
+	Done after every step rather than once per impact, since solving conflicting constraints one after another also drifts the body a little.
+*/
+void DSPhysics::SoftBodySolver::RemoveRigidMotion(const Body& body)
+{
+	unsigned int first = body.mFirstParticle;
+	unsigned int end = first + body.mParticleCount;
+
+	//Centre of mass and its velocity
+	glm::vec3 centre(0.0f);
+	glm::vec3 velocity(0.0f);
+	for(unsigned int i = first; i < end; ++i)
+	{
+		centre += glm::vec3(mPositionX[i], mPositionY[i], mPositionZ[i]);
+		velocity += glm::vec3(mVelocityX[i], mVelocityY[i], mVelocityZ[i]);
+	}
+	centre /= static_cast<float>(body.mParticleCount);
+	velocity /= static_cast<float>(body.mParticleCount);
+
+	//Angular velocity, from the angular momentum and inertia about the centre
+	glm::vec3 angularMomentum(0.0f);
+	glm::mat3 inertia(0.0f);
+	for(unsigned int i = first; i < end; ++i)
+	{
+		glm::vec3 offset = glm::vec3(mPositionX[i], mPositionY[i], mPositionZ[i]) - centre;
+		angularMomentum += glm::cross(offset, glm::vec3(mVelocityX[i], mVelocityY[i], mVelocityZ[i]));
+		inertia += glm::mat3(glm::dot(offset, offset)) - glm::outerProduct(offset, offset);
+	}
+	glm::vec3 angularVelocity(0.0f);
+	if(std::abs(glm::determinant(inertia)) > kMinLengthSquared)//a line of particles, which has no inertia about itself
+	{
+		angularVelocity = glm::inverse(inertia) * angularMomentum;
+	}
+
+	for(unsigned int i = first; i < end; ++i)
+	{
+		glm::vec3 offset = glm::vec3(mPositionX[i], mPositionY[i], mPositionZ[i]) - centre;
+		glm::vec3 rigid = velocity + glm::cross(angularVelocity, offset);
+		mVelocityX[i] -= rigid.x;
+		mVelocityY[i] -= rigid.y;
+		mVelocityZ[i] -= rigid.z;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void DSPhysics::SoftBodySolver::StepBodies(unsigned int begin, unsigned int end, void* pUserData)
+{
+	DSPhysics::SoftBodySolver* pSolver = static_cast<DSPhysics::SoftBodySolver*>(pUserData);
+	for(unsigned int i = begin; i < end; ++i)
+	{
+		pSolver->StepBody(pSolver->mBodies[pSolver->mAwakeBodies[i]]);
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void DSPhysics::SoftBodySolver::StepBody(Body& body)
+{
+	unsigned int substeps = mSettings.mSubsteps > 0 ? mSettings.mSubsteps : 1;
+	float substep = mTimeStep / substeps;
+	float alphaScale = 1.0f / (substep * substep);//compliance becomes a correction weight through the square of the time step
+
+	for(unsigned int i = 0; i < substeps; ++i)
+	{
+		Integrate(body, substep);
+		for(unsigned int color = 0; color < body.mColorCount; ++color)
+		{
+			SolveDistances(mColorStarts[body.mFirstColor + color], mColorStarts[body.mFirstColor + color + 1], alphaScale);
+		}
+		if(body.mRestVolume != 0.0f)
+		{
+			SolveVolume(body, alphaScale);
+		}
+		UpdateVelocities(body, substep);
+	}
+
+	Deform(body);
+	RemoveRigidMotion(body);
+
+	//Sleep once every particle has (nearly) stopped for long enough
+	float maxSpeedSquared = 0.0f;
+	for(unsigned int i = body.mFirstParticle; i < body.mFirstParticle + body.mParticleCount; ++i)
+	{
+		maxSpeedSquared = std::max(maxSpeedSquared, mVelocityX[i] * mVelocityX[i] + mVelocityY[i] * mVelocityY[i] + mVelocityZ[i] * mVelocityZ[i]);
+	}
+	if(maxSpeedSquared >= mSettings.mSleepSpeed * mSettings.mSleepSpeed)
+	{
+		body.mRestingSteps = 0;
+	}
+	else if(++body.mRestingSteps >= mSettings.mSleepSteps)
+	{
+		body.mIsAwake = false;
+		std::fill(mVelocityX.begin() + body.mFirstParticle, mVelocityX.begin() + body.mFirstParticle + body.mPaddedParticleCount, 0.0f);
+		std::fill(mVelocityY.begin() + body.mFirstParticle, mVelocityY.begin() + body.mFirstParticle + body.mPaddedParticleCount, 0.0f);
+		std::fill(mVelocityZ.begin() + body.mFirstParticle, mVelocityZ.begin() + body.mFirstParticle + body.mPaddedParticleCount, 0.0f);
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Remembers where each particle starts the substep, and predicts where it ends up from its velocity and gravity.
+*/
+void DSPhysics::SoftBodySolver::Integrate(const Body& body, float substep)
+{
+	unsigned int end = body.mFirstParticle + body.mPaddedParticleCount;
+	glm::vec3 gravity = mSettings.mGravity * substep;
+
+#if defined(DS_SSE)
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 h = _mm_set1_ps(substep);
+	const __m128 gx = _mm_set1_ps(gravity.x);
+	const __m128 gy = _mm_set1_ps(gravity.y);
+	const __m128 gz = _mm_set1_ps(gravity.z);
+
+	for(unsigned int i = body.mFirstParticle; i < end; i += kBatchSize)
+	{
+		//Massless (padding) particles don't fall
+		__m128 hasMass = _mm_cmpgt_ps(_mm_loadu_ps(&mInverseMass[i]), zero);
+		__m128 vx = _mm_add_ps(_mm_loadu_ps(&mVelocityX[i]), _mm_and_ps(gx, hasMass));
+		__m128 vy = _mm_add_ps(_mm_loadu_ps(&mVelocityY[i]), _mm_and_ps(gy, hasMass));
+		__m128 vz = _mm_add_ps(_mm_loadu_ps(&mVelocityZ[i]), _mm_and_ps(gz, hasMass));
+		__m128 px = _mm_loadu_ps(&mPositionX[i]);
+		__m128 py = _mm_loadu_ps(&mPositionY[i]);
+		__m128 pz = _mm_loadu_ps(&mPositionZ[i]);
+
+		_mm_storeu_ps(&mVelocityX[i], vx);
+		_mm_storeu_ps(&mVelocityY[i], vy);
+		_mm_storeu_ps(&mVelocityZ[i], vz);
+		_mm_storeu_ps(&mPreviousX[i], px);
+		_mm_storeu_ps(&mPreviousY[i], py);
+		_mm_storeu_ps(&mPreviousZ[i], pz);
+		_mm_storeu_ps(&mPositionX[i], _mm_add_ps(px, _mm_mul_ps(vx, h)));
+		_mm_storeu_ps(&mPositionY[i], _mm_add_ps(py, _mm_mul_ps(vy, h)));
+		_mm_storeu_ps(&mPositionZ[i], _mm_add_ps(pz, _mm_mul_ps(vz, h)));
+	}
+#else
+	for(unsigned int i = body.mFirstParticle; i < end; ++i)
+	{
+		if(mInverseMass[i] > 0.0f)
+		{
+			mVelocityX[i] += gravity.x;
+			mVelocityY[i] += gravity.y;
+			mVelocityZ[i] += gravity.z;
+		}
+		mPreviousX[i] = mPositionX[i];
+		mPreviousY[i] = mPositionY[i];
+		mPreviousZ[i] = mPositionZ[i];
+		mPositionX[i] += mVelocityX[i] * substep;
+		mPositionY[i] += mVelocityY[i] * substep;
+		mPositionZ[i] += mVelocityZ[i] * substep;
+	}
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Solves the distance constraints [begin, end), which must all be one colour, four at a time.
+*/
+void DSPhysics::SoftBodySolver::SolveDistances(unsigned int begin, unsigned int end, float alphaScale)
+{
+	unsigned int i = begin;
+	for(; i + kBatchSize <= end; i += kBatchSize)
+	{
+		SolveDistanceBatch(i, alphaScale);
+	}
+	for(; i < end; ++i)
+	{
+		SolveDistance(i, alphaScale);
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Solves four distance constraints at once. They are one colour, so no two of them move the same particle,
+	and gathering their particles, solving, and scattering the results gives the same answer as solving them one by one.
+*/
+void DSPhysics::SoftBodySolver::SolveDistanceBatch(unsigned int first, float alphaScale)
+{
+#if defined(DS_SSE)
+	const unsigned int* pA = &mConstraintA[first];
+	const unsigned int* pB = &mConstraintB[first];
+
+	//Gather
+	__m128 ax = _mm_setr_ps(mPositionX[pA[0]], mPositionX[pA[1]], mPositionX[pA[2]], mPositionX[pA[3]]);
+	__m128 ay = _mm_setr_ps(mPositionY[pA[0]], mPositionY[pA[1]], mPositionY[pA[2]], mPositionY[pA[3]]);
+	__m128 az = _mm_setr_ps(mPositionZ[pA[0]], mPositionZ[pA[1]], mPositionZ[pA[2]], mPositionZ[pA[3]]);
+	__m128 bx = _mm_setr_ps(mPositionX[pB[0]], mPositionX[pB[1]], mPositionX[pB[2]], mPositionX[pB[3]]);
+	__m128 by = _mm_setr_ps(mPositionY[pB[0]], mPositionY[pB[1]], mPositionY[pB[2]], mPositionY[pB[3]]);
+	__m128 bz = _mm_setr_ps(mPositionZ[pB[0]], mPositionZ[pB[1]], mPositionZ[pB[2]], mPositionZ[pB[3]]);
+	__m128 wa = _mm_setr_ps(mInverseMass[pA[0]], mInverseMass[pA[1]], mInverseMass[pA[2]], mInverseMass[pA[3]]);
+	__m128 wb = _mm_setr_ps(mInverseMass[pB[0]], mInverseMass[pB[1]], mInverseMass[pB[2]], mInverseMass[pB[3]]);
+	__m128 restLength = _mm_loadu_ps(&mRestLengths[first]);
+	__m128 alpha = _mm_mul_ps(_mm_loadu_ps(&mCompliances[first]), _mm_set1_ps(alphaScale));
+
+	//Solve: each end moves along the constraint by its share of the error, weighted by inverse mass and softened by compliance
+	__m128 dx = _mm_sub_ps(bx, ax);
+	__m128 dy = _mm_sub_ps(by, ay);
+	__m128 dz = _mm_sub_ps(bz, az);
+	__m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+	__m128 length = _mm_sqrt_ps(_mm_max_ps(lengthSquared, _mm_set1_ps(kMinLengthSquared)));
+	__m128 denominator = _mm_mul_ps(_mm_add_ps(_mm_add_ps(wa, wb), alpha), length);
+	__m128 isSolvable = _mm_cmpgt_ps(denominator, _mm_setzero_ps());
+	__m128 scale = _mm_and_ps(_mm_div_ps(_mm_sub_ps(length, restLength), _mm_max_ps(denominator, _mm_set1_ps(kMinLengthSquared))), isSolvable);
+	__m128 scaleA = _mm_mul_ps(wa, scale);
+	__m128 scaleB = _mm_mul_ps(wb, scale);
+
+	//Scatter
+	DS_ALIGN(16) float results[6][kBatchSize];
+	_mm_store_ps(results[0], _mm_add_ps(ax, _mm_mul_ps(dx, scaleA)));
+	_mm_store_ps(results[1], _mm_add_ps(ay, _mm_mul_ps(dy, scaleA)));
+	_mm_store_ps(results[2], _mm_add_ps(az, _mm_mul_ps(dz, scaleA)));
+	_mm_store_ps(results[3], _mm_sub_ps(bx, _mm_mul_ps(dx, scaleB)));
+	_mm_store_ps(results[4], _mm_sub_ps(by, _mm_mul_ps(dy, scaleB)));
+	_mm_store_ps(results[5], _mm_sub_ps(bz, _mm_mul_ps(dz, scaleB)));
+	for(unsigned int i = 0; i < kBatchSize; ++i)
+	{
+		mPositionX[pA[i]] = results[0][i];
+		mPositionY[pA[i]] = results[1][i];
+		mPositionZ[pA[i]] = results[2][i];
+		mPositionX[pB[i]] = results[3][i];
+		mPositionY[pB[i]] = results[4][i];
+		mPositionZ[pB[i]] = results[5][i];
+	}
+#else
+	for(unsigned int i = 0; i < kBatchSize; ++i)
+	{
+		SolveDistance(first + i, alphaScale);
+	}
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void DSPhysics::SoftBodySolver::SolveDistance(unsigned int constraint, float alphaScale)
+{
+	unsigned int a = mConstraintA[constraint];
+	unsigned int b = mConstraintB[constraint];
+
+	glm::vec3 delta(mPositionX[b] - mPositionX[a], mPositionY[b] - mPositionY[a], mPositionZ[b] - mPositionZ[a]);
+	float length = std::sqrt(std::max(glm::dot(delta, delta), kMinLengthSquared));
+	float denominator = (mInverseMass[a] + mInverseMass[b] + mCompliances[constraint] * alphaScale) * length;
+	if(denominator <= 0.0f)
+	{
+		return;
+	}
+
+	glm::vec3 correction = delta * ((length - mRestLengths[constraint]) / denominator);
+	mPositionX[a] += correction.x * mInverseMass[a];
+	mPositionY[a] += correction.y * mInverseMass[a];
+	mPositionZ[a] += correction.z * mInverseMass[a];
+	mPositionX[b] -= correction.x * mInverseMass[b];
+	mPositionY[b] -= correction.y * mInverseMass[b];
+	mPositionZ[b] -= correction.z * mInverseMass[b];
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Pushes every particle along the gradient of the enclosed volume (the direction that grows it fastest) until the volume is back to its rest volume.
+	It is one constraint over the whole body, so it is solved on its own after the distance constraints.
+*/
+void DSPhysics::SoftBodySolver::SolveVolume(const Body& body, float alphaScale)
+{
+	unsigned int first = body.mFirstParticle;
+	unsigned int end = first + body.mParticleCount;
+	std::fill(mGradients.begin() + first, mGradients.begin() + end, glm::vec3(0.0f));
+
+	//Volume, and six times its gradient, from every triangle
+	float volume = 0.0f;
+	for(unsigned int i = body.mFirstTriangle * 3; i < (body.mFirstTriangle + body.mTriangleCount) * 3; i += 3)
+	{
+		unsigned int a = mTriangles[i];
+		unsigned int b = mTriangles[i + 1];
+		unsigned int c = mTriangles[i + 2];
+		glm::vec3 pa(mPositionX[a], mPositionY[a], mPositionZ[a]);
+		glm::vec3 pb(mPositionX[b], mPositionY[b], mPositionZ[b]);
+		glm::vec3 pc(mPositionX[c], mPositionY[c], mPositionZ[c]);
+
+		glm::vec3 crossAB = glm::cross(pa, pb);
+		volume += glm::dot(crossAB, pc);
+		mGradients[a] += glm::cross(pb, pc);
+		mGradients[b] += glm::cross(pc, pa);
+		mGradients[c] += crossAB;
+	}
+	volume /= 6.0f;
+
+	float denominator = 0.0f;
+	for(unsigned int i = first; i < end; ++i)
+	{
+		denominator += mInverseMass[i] * glm::dot(mGradients[i], mGradients[i]);
+	}
+	denominator = denominator / 36.0f + mSettings.mVolumeCompliance * alphaScale;
+	if(denominator <= 0.0f)
+	{
+		return;
+	}
+
+	float scale = -(volume - body.mRestVolume) / denominator / 6.0f;
+	for(unsigned int i = first; i < end; ++i)
+	{
+		glm::vec3 correction = mGradients[i] * (scale * mInverseMass[i]);
+		mPositionX[i] += correction.x;
+		mPositionY[i] += correction.y;
+		mPositionZ[i] += correction.z;
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Takes each particle's velocity from how far it moved this substep, less damping.
+*/
+void DSPhysics::SoftBodySolver::UpdateVelocities(const Body& body, float substep)
+{
+	unsigned int end = body.mFirstParticle + body.mPaddedParticleCount;
+	float scale = std::max(0.0f, 1.0f - mSettings.mDamping * substep) / substep;
+
+#if defined(DS_SSE)
+	const __m128 s = _mm_set1_ps(scale);
+	for(unsigned int i = body.mFirstParticle; i < end; i += kBatchSize)
+	{
+		_mm_storeu_ps(&mVelocityX[i], _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&mPositionX[i]), _mm_loadu_ps(&mPreviousX[i])), s));
+		_mm_storeu_ps(&mVelocityY[i], _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&mPositionY[i]), _mm_loadu_ps(&mPreviousY[i])), s));
+		_mm_storeu_ps(&mVelocityZ[i], _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&mPositionZ[i]), _mm_loadu_ps(&mPreviousZ[i])), s));
+	}
+#else
+	for(unsigned int i = body.mFirstParticle; i < end; ++i)
+	{
+		mVelocityX[i] = (mPositionX[i] - mPreviousX[i]) * scale;
+		mVelocityY[i] = (mPositionY[i] - mPreviousY[i]) * scale;
+		mVelocityZ[i] = (mPositionZ[i] - mPreviousZ[i]) * scale;
+	}
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Plasticity: moves the rest length of every constraint strained past mYieldStrain (and the rest volume) part of the way to its current one,
+	so the body stops trying to spring all the way back.
+*/
+void DSPhysics::SoftBodySolver::Deform(Body& body)
+{
+	float plasticity = mSettings.mPlasticity;
+	float yieldStrain = mSettings.mYieldStrain;
+	if(plasticity <= 0.0f)
+	{
+		return;
+	}
+
+	unsigned int end = mColorStarts[body.mFirstColor + body.mColorCount];
+	for(unsigned int i = mColorStarts[body.mFirstColor]; i < end; ++i)
+	{
+		unsigned int a = mConstraintA[i];
+		unsigned int b = mConstraintB[i];
+		glm::vec3 delta(mPositionX[b] - mPositionX[a], mPositionY[b] - mPositionY[a], mPositionZ[b] - mPositionZ[a]);
+		float length = glm::length(delta);
+		float& restLength = mRestLengths[i];
+
+		float strain = (length - restLength) / restLength;
+		if(strain > yieldStrain)
+		{
+			restLength += (length - restLength * (1.0f + yieldStrain)) * plasticity;
+		}
+		else if(strain < -yieldStrain)
+		{
+			restLength += (length - restLength * (1.0f - yieldStrain)) * plasticity;
+		}
+		restLength = std::max(restLength, kMinLength);
+	}
+
+	if(body.mRestVolume != 0.0f)
+	{
+		float volume = MeasureVolume(body);
+		float strain = (volume - body.mRestVolume) / body.mRestVolume;
+		if(strain > yieldStrain)
+		{
+			body.mRestVolume += (volume - body.mRestVolume * (1.0f + yieldStrain)) * plasticity;
+		}
+		else if(strain < -yieldStrain)
+		{
+			body.mRestVolume += (volume - body.mRestVolume * (1.0f - yieldStrain)) * plasticity;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+float DSPhysics::SoftBodySolver::MeasureVolume(const Body& body) const
+{
+	float volume = 0.0f;
+	for(unsigned int i = body.mFirstTriangle * 3; i < (body.mFirstTriangle + body.mTriangleCount) * 3; i += 3)
+	{
+		unsigned int a = mTriangles[i];
+		unsigned int b = mTriangles[i + 1];
+		unsigned int c = mTriangles[i + 2];
+		glm::vec3 pa(mPositionX[a], mPositionY[a], mPositionZ[a]);
+		glm::vec3 pb(mPositionX[b], mPositionY[b], mPositionZ[b]);
+		glm::vec3 pc(mPositionX[c], mPositionY[c], mPositionZ[c]);
+		volume += glm::dot(glm::cross(pa, pb), pc);
+	}
+	return volume / 6.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Copies the vertex positions of every body this Step moved (including any that just fell asleep) for UpdateMeshes.
+*/
+void DSPhysics::SoftBodySolver::Publish()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	for(size_t i = 0; i < mAwakeBodies.size(); ++i)
+	{
+		Body& body = mBodies[mAwakeBodies[i]];
+		for(unsigned int j = body.mFirstVertex; j < body.mFirstVertex + body.mVertexCount; ++j)
+		{
+			unsigned int particle = mVertexParticles[j];
+			mPublishedPositions[j] = glm::vec3(mPositionX[particle], mPositionY[particle], mPositionZ[particle]);
+		}
+		body.mIsPublishPending = true;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+bool DSPhysics::SoftBodyShape::GetIsBuilt() const
+{
+	return mRestPositions.empty() == false;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Whether every edge is shared by exactly two triangles, so the surface encloses a volume that the body keeps.
+*/
+bool DSPhysics::SoftBodyShape::GetIsClosed() const
+{
+	return mIsClosed;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSPhysics::SoftBodyShape::GetParticleCount() const
+{
+	return static_cast<unsigned int>(mRestPositions.size());
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSPhysics::SoftBodyShape::GetVertexCount() const
+{
+	return static_cast<unsigned int>(mVertexParticles.size());
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSPhysics::SoftBodyShape::GetTriangleCount() const
+{
+	return static_cast<unsigned int>(mTriangles.size() / 3);
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSPhysics::SoftBodyShape::GetConstraintCount() const
+{
+	return static_cast<unsigned int>(mConstraintA.size());
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSPhysics::SoftBodyShape::GetColorCount() const
+{
+	return mColorStarts.empty() == true ? 0 : static_cast<unsigned int>(mColorStarts.size() - 1);
+}
+
+//-----------------------------------------------------------------------------
+
+float DSPhysics::SoftBodyShape::GetRestVolume() const
+{
+	return mRestVolume;
+}
+
+//-----------------------------------------------------------------------------
+
+const DSPhysics::SoftBodySettings& DSPhysics::SoftBodySolver::GetSettings() const
+{
+	return mSettings;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSPhysics::SoftBodySolver::GetBodyCount() const
+{
+	return static_cast<unsigned int>(mBodies.size());
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Changes during Step, so only meaningful on the simulation thread.
+*/
+unsigned int DSPhysics::SoftBodySolver::GetAwakeCount() const
+{
+	unsigned int count = 0;
+	for(size_t i = 0; i < mBodies.size(); ++i)
+	{
+		if(mBodies[i].mIsAwake == true)
+		{
+			++count;
+		}
+	}
+	return count;
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSPhysics::SoftBodySolver::GetIsAwake(unsigned int body) const
+{
+	return mBodies[body].mIsAwake;
+}
\ No newline at end of file
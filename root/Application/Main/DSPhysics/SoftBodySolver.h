@@ -0,0 +1,290 @@
+//=============================================================================
+// File:		SoftBodySolver.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	SoftBodySolver. Position based dynamics for objects that dent and crumple, built from their models' triangles and drawn through DSGraphics::DeformableMesh.
+//=============================================================================
+
+#ifndef SOFTBODYSOLVER_H
+#define SOFTBODYSOLVER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLM
+#include <glm/glm.hpp>
+
+// Standard C++ Libraries
+#include <mutex>
+#include <vector>
+
+//=============================================================================
+//Forward Declarations
+//=============================================================================
+
+namespace DSGraphics
+{
+	class DeformableMesh;
+	class ModelAsset;
+}
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSPhysics
+{
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	/*
+	Notes:
+		Compliance is the inverse of stiffness (0 is perfectly stiff). Every particle has a mass of 1.
+		Distances are in the model's coordinates (device coordinates, see Object::sDCPerM).
+	*/
+	struct SoftBodySettings
+	{
+		SoftBodySettings()
+		:	mSubsteps(8)
+		,	mStretchCompliance(0.0f)
+		,	mBendCompliance(0.001f)
+		,	mVolumeCompliance(0.0f)
+		,	mDamping(1.0f)
+		,	mYieldStrain(0.02f)
+		,	mPlasticity(0.5f)
+		,	mGravity(0.0f)
+		,	mSleepSpeed(0.001f)
+		,	mSleepSteps(30)
+		{
+		}
+
+		unsigned int mSubsteps;//per Step, each with a single pass over the constraints
+		float mStretchCompliance;//along the mesh's edges
+		float mBendCompliance;//across each pair of triangles sharing an edge
+		float mVolumeCompliance;//of the enclosed volume, for closed meshes
+		float mDamping;//fraction of each particle's velocity lost per second
+		float mYieldStrain;//how far a constraint can be stretched or squashed (relative to its length) before it stays that way
+		float mPlasticity;//how much of the strain beyond mYieldStrain becomes permanent each step, from 0 (springs back) to 1 (stays dented)
+		glm::vec3 mGravity;
+		float mSleepSpeed;//a body whose particles are all slower than this...
+		unsigned int mSleepSteps;//...for this many steps stops being simulated until something hits it
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		The particles and constraints of a model, built once and shared by every body made from it.
+		Vertices with the same position (split for texture coordinates or colours) become one particle, so the surface holds together.
+		Every edge becomes a stretch constraint, and every pair of triangles sharing an edge a bending constraint between their far corners.
+		A closed surface (every edge shared by exactly two triangles) also keeps its volume.
+		The constraints are graph coloured: no two constraints of the same colour share a particle, so a colour can be solved in any order,
+		four at a time with SSE, and is stored contiguously.
+	Notes:
+		The model must be drawn as GL_TRIANGLES. Build reads its vertices and elements back from the GPU if it has no CPU copy, so it must be
+		called on the thread that owns the GL context.
+	*/
+	class SoftBodyShape
+	{
+	public:
+		//Constructors
+		SoftBodyShape();
+
+	private:
+		//Disable Copy Constructor
+		SoftBodyShape(const SoftBodyShape&);
+		const SoftBodyShape& operator=(const SoftBodyShape&);
+
+		//Member Functions
+	public:
+		// General
+		bool Build(DSGraphics::ModelAsset& model);
+		void Clear();
+
+	private:
+		// Build Sub-Functions
+		void Weld(const DSGraphics::ModelAsset& model, const float* pVertices);
+		void AddConstraint(unsigned int a, unsigned int b, bool isBending);
+		void Color();
+
+	public:
+		// Getters
+		bool GetIsBuilt() const;
+		bool GetIsClosed() const;
+		unsigned int GetParticleCount() const;
+		unsigned int GetVertexCount() const;
+		unsigned int GetTriangleCount() const;
+		unsigned int GetConstraintCount() const;
+		unsigned int GetColorCount() const;
+		float GetRestVolume() const;
+
+		//Member Variables
+	private:
+		friend class SoftBodySolver;
+
+		// Particles
+		std::vector<glm::vec3> mRestPositions;
+		std::vector<unsigned int> mVertexParticles;//the particle each of the model's vertices follows
+		// Constraints (sorted by colour)
+		std::vector<unsigned int> mConstraintA;
+		std::vector<unsigned int> mConstraintB;
+		std::vector<float> mRestLengths;
+		std::vector<unsigned char> mIsBending;
+		std::vector<unsigned int> mColorStarts;//the first constraint of each colour, and then the constraint count
+		// Surface
+		std::vector<unsigned int> mTriangles;//three particles each
+		bool mIsClosed;
+		float mRestVolume;//signed (negative if the triangles wind inwards), 0 if not closed
+	};
+
+	//-----------------------------------------------------------------------------
+
+	/*
+	Description:
+		Simulates every soft body with extended position based dynamics (XPBD), in small substeps with one pass over the constraints each,
+		which converges better than many passes over one large step and needs no per-constraint state.
+		Each substep predicts the particles' positions from their velocities, moves them to satisfy the constraints a colour at a time,
+		and takes the velocities from how far they actually moved.
+		Strain beyond mYieldStrain is partly kept by moving the constraints' rest lengths (and volume), which is what leaves a dent after a crash.
+		Bodies are independent, so Step solves the awake ones in parallel (a job per few bodies), and sleeping bodies cost nothing.
+		The particles of every body are kept in one set of arrays per component, each body's starting on a multiple of four,
+		so integration runs four particles at a time.
+	Usage:
+		DSPhysics::SoftBodyShape shipShape;
+		shipShape.Build(*DSGraphics::AssetManager::Get(shipModel));//context thread
+		DSPhysics::SoftBodySolver softBodies;
+		unsigned int ship = softBodies.AddBody(shipShape, &shipMesh);
+		...
+		softBodies.ApplyImpact(ship, hitPoint, hitVelocity, 0.5f);//any thread
+		softBodies.Step(timeStep);//simulation thread
+		...
+		softBodies.UpdateMeshes();//context thread, before rendering
+	Notes:
+		Positions are in the model's own coordinates; the instance's transform still places the body in the world.
+		Step and UpdateMeshes may run at the same time on different threads. Step publishes the positions of the bodies it moved,
+		and UpdateMeshes hands the latest published positions to their meshes, so a body that moved is never missed even if frames are skipped.
+		AddBody and Clear must not run at the same time as either, though several threads may add bodies at once (eg. load tasks).
+		Bodies are referred to by index. Indices are handed out in order and stay valid until Clear().
+	*/
+	class SoftBodySolver
+	{
+	public:
+		//Constructors
+		explicit SoftBodySolver(const DSPhysics::SoftBodySettings& settings = DSPhysics::SoftBodySettings());
+
+	private:
+		//Disable Copy Constructor
+		SoftBodySolver(const SoftBodySolver&);
+		const SoftBodySolver& operator=(const SoftBodySolver&);
+
+		//Member Functions
+	public:
+		// General
+		unsigned int AddBody(const DSPhysics::SoftBodyShape& shape, DSGraphics::DeformableMesh* pMesh);
+		void Clear();
+		void ApplyImpact(unsigned int body, const glm::vec3& point, const glm::vec3& velocity, float radius);
+		void Step(float timeStep);
+		void UpdateMeshes();
+
+		// Reports
+		void PrintSummary() const;
+
+	private:
+		//Structs
+		struct Body
+		{
+			DSGraphics::DeformableMesh* mpMesh;
+			unsigned int mFirstParticle;
+			unsigned int mParticleCount;
+			unsigned int mPaddedParticleCount;//a multiple of kBatchSize, the rest massless and unconstrained
+			unsigned int mFirstColor;//into mColorStarts, which has mColorCount + 1 entries for the body
+			unsigned int mColorCount;
+			unsigned int mFirstTriangle;
+			unsigned int mTriangleCount;
+			unsigned int mFirstVertex;
+			unsigned int mVertexCount;
+			float mRestVolume;//0 if the body doesn't keep its volume
+			unsigned int mRestingSteps;
+			bool mIsAwake;
+			bool mIsPublishPending;//guarded by mMutex
+		};
+
+		struct Impact
+		{
+			unsigned int mBody;
+			glm::vec3 mPoint;
+			glm::vec3 mVelocity;
+			float mRadius;
+		};
+
+		// Step Sub-Functions
+		void ApplyImpacts();
+		void RemoveRigidMotion(const Body& body);
+		static void StepBodies(unsigned int begin, unsigned int end, void* pUserData);
+		void StepBody(Body& body);
+		void Integrate(const Body& body, float substep);
+		void SolveDistances(unsigned int begin, unsigned int end, float alphaScale);
+		void SolveDistanceBatch(unsigned int first, float alphaScale);
+		void SolveDistance(unsigned int constraint, float alphaScale);
+		void SolveVolume(const Body& body, float alphaScale);
+		void UpdateVelocities(const Body& body, float substep);
+		void Deform(Body& body);
+		float MeasureVolume(const Body& body) const;
+		void Publish();
+
+	public:
+		// Getters
+		const DSPhysics::SoftBodySettings& GetSettings() const;
+		unsigned int GetBodyCount() const;
+		unsigned int GetAwakeCount() const;
+		bool GetIsAwake(unsigned int body) const;
+
+		//Member Variables
+	private:
+		static const unsigned int kBatchSize = 4;//particles integrated, and constraints solved, per SSE batch
+		static const unsigned int kBodiesPerJob = 4;
+
+		DSPhysics::SoftBodySettings mSettings;
+		std::vector<Body> mBodies;
+		std::vector<unsigned int> mAwakeBodies;//the bodies Step is moving
+		float mTimeStep;//of the Step in progress
+
+		// Particles
+		std::vector<float> mPositionX;
+		std::vector<float> mPositionY;
+		std::vector<float> mPositionZ;
+		std::vector<float> mPreviousX;//at the start of the substep
+		std::vector<float> mPreviousY;
+		std::vector<float> mPreviousZ;
+		std::vector<float> mVelocityX;
+		std::vector<float> mVelocityY;
+		std::vector<float> mVelocityZ;
+		std::vector<float> mInverseMass;
+		std::vector<glm::vec3> mGradients;//of the volume, scratch for SolveVolume
+
+		// Constraints
+		std::vector<unsigned int> mConstraintA;
+		std::vector<unsigned int> mConstraintB;
+		std::vector<float> mRestLengths;
+		std::vector<float> mCompliances;
+		std::vector<unsigned int> mColorStarts;
+		std::vector<unsigned int> mTriangles;
+
+		// Meshes
+		std::vector<unsigned int> mVertexParticles;
+		std::mutex mMutex;//guards mImpacts, mPublishedPositions and each body's mIsPublishPending
+		std::vector<Impact> mImpacts;//waiting for the next Step
+		std::vector<glm::vec3> mPublishedPositions;//one per vertex
+		std::vector<unsigned int> mUploads;//UpdateMeshes' scratch
+	};
+
+}//namespace DSPhysics
+
+#endif //#ifndef SOFTBODYSOLVER_H
\ No newline at end of file
@@ -0,0 +1,137 @@
+//=============================================================================
+// File:		GpuProfiler.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	GpuProfiler. Times GPU work with GL_TIME_ELAPSED queries and reads the results back a few frames later so the CPU never waits on the GPU.
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Daniel Schenker
+#include "GpuProfiler.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSProfiling::GpuProfiler::GpuProfiler()
+:	mCurrentFrame(0)
+,	mIsZoneOpen(false)
+,	mDroppedCount(0)
+{
+	for(unsigned int i = 0; i < kFramesInFlight; ++i)
+	{
+		glGenQueries(kMaxZonesPerFrame, mFrames[i].mQueries);
+		mFrames[i].mZoneCount = 0;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSProfiling::GpuProfiler::~GpuProfiler()
+{
+	for(unsigned int i = 0; i < kFramesInFlight; ++i)
+	{
+		glDeleteQueries(kMaxZonesPerFrame, mFrames[i].mQueries);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Moves on to the next slot in the ring, first reporting the results that slot still holds from kFramesInFlight frames ago.
+*/
+void DSProfiling::GpuProfiler::BeginFrame()
+{
+	mCurrentFrame = (mCurrentFrame + 1) % kFramesInFlight;
+	ResolveFrame(mCurrentFrame);
+}
+
+//-----------------------------------------------------------------------------
+
+void DSProfiling::GpuProfiler::BeginZone(const char* pName)
+{
+	Frame& frame = mFrames[mCurrentFrame];
+	if(mIsZoneOpen == true || frame.mZoneCount >= kMaxZonesPerFrame)
+	{
+		//Either nested (which GL_TIME_ELAPSED cannot do) or out of queries for this frame
+		++mDroppedCount;
+		return;
+	}
+
+	unsigned int zone = frame.mZoneCount;
+	frame.mpNames[zone] = pName;
+	frame.mCpuStarts[zone] = DSProfiling::Profiler::GetTicks();
+	glBeginQuery(GL_TIME_ELAPSED, frame.mQueries[zone]);
+
+	mIsZoneOpen = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSProfiling::GpuProfiler::EndZone()
+{
+	if(mIsZoneOpen == false)
+	{
+		return;
+	}
+
+	glEndQuery(GL_TIME_ELAPSED);
+	++mFrames[mCurrentFrame].mZoneCount;
+
+	mIsZoneOpen = false;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helpers
+
+void DSProfiling::GpuProfiler::ResolveFrame(unsigned int frameIndex)
+{
+	Frame& frame = mFrames[frameIndex];
+
+	for(unsigned int i = 0; i < frame.mZoneCount; ++i)
+	{
+		GLint isAvailable = GL_FALSE;
+		glGetQueryObjectiv(frame.mQueries[i], GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+		if(isAvailable == GL_TRUE)
+		{
+			GLuint64 nanoseconds = 0;
+			glGetQueryObjectui64v(frame.mQueries[i], GL_QUERY_RESULT, &nanoseconds);
+			DSProfiling::Profiler::RecordGpuEvent(frame.mpNames[i], frame.mCpuStarts[i], static_cast<double>(nanoseconds) / 1000000.0);
+		}
+		else
+		{
+			++mDroppedCount;
+		}
+	}
+
+	frame.mZoneCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+unsigned int DSProfiling::GpuProfiler::GetDroppedCount() const
+{
+	return mDroppedCount;
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+//=============================================================================
+// File:		GpuProfiler.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	GpuProfiler. Times GPU work with GL_TIME_ELAPSED queries and reads the results back a few frames later so the CPU never waits on the GPU.
+//=============================================================================
+
+#ifndef GPUPROFILER_H
+#define GPUPROFILER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLEW
+#include <GL/glew.h>
+
+// Daniel Schenker
+#include "Profiler.h"
+
+//=============================================================================
+//Defines
+//=============================================================================
+
+#if defined(DS_PROFILING_DISABLED)
+	#define DS_PROFILE_GPU_SCOPE(pGpuProfiler, name)
+#else
+	#define DS_PROFILE_GPU_SCOPE(pGpuProfiler, name) DSProfiling::ScopedGpuZone DS_PROFILE_CONCAT(profileGpuZone, __LINE__)(pGpuProfiler, name)
+#endif
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSProfiling
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Notes:
+		GL_TIME_ELAPSED queries cannot be nested or overlapped, so only one GPU zone may be open at a time.
+		Queries are kept in a ring of kFramesInFlight frames. A frame's results are read when its slot comes around again,
+		by which point the GPU has normally finished with it. Results that are still not available are dropped instead of stalling.
+		Must only be used on the thread that owns the GL context.
+	*/
+	class GpuProfiler
+	{
+	public:
+		//Constructors
+		GpuProfiler();
+		//Destructor
+		~GpuProfiler();
+
+	private:
+		//Disable Copy Constructor
+		GpuProfiler(const GpuProfiler&);
+		const GpuProfiler& operator=(const GpuProfiler&);
+
+		//Member Functions
+	public:
+		// General
+		void BeginFrame();
+		void BeginZone(const char* pName);
+		void EndZone();
+
+		// Getters
+		unsigned int GetDroppedCount() const;
+
+	private:
+		// Helpers
+		void ResolveFrame(unsigned int frame);
+
+		//Member Variables
+	public:
+		static const unsigned int kFramesInFlight = 4;
+		static const unsigned int kMaxZonesPerFrame = 32;
+
+	private:
+		struct Frame
+		{
+			GLuint mQueries[kMaxZonesPerFrame];
+			const char* mpNames[kMaxZonesPerFrame];
+			unsigned long long mCpuStarts[kMaxZonesPerFrame];
+			unsigned int mZoneCount;
+		};
+
+		Frame mFrames[kFramesInFlight];
+		unsigned int mCurrentFrame;
+		bool mIsZoneOpen;
+		unsigned int mDroppedCount;
+	};
+
+	//-----------------------------------------------------------------------------
+
+	class ScopedGpuZone
+	{
+	public:
+		//Constructors
+		ScopedGpuZone(GpuProfiler* pGpuProfiler, const char* pName)
+		:	mpGpuProfiler(nullptr)
+		{
+			if(pGpuProfiler != nullptr && Profiler::sIsEnabled.load(std::memory_order_relaxed) == true)
+			{
+				mpGpuProfiler = pGpuProfiler;
+				mpGpuProfiler->BeginZone(pName);
+			}
+		}
+		//Destructor
+		~ScopedGpuZone()
+		{
+			if(mpGpuProfiler != nullptr)
+			{
+				mpGpuProfiler->EndZone();
+			}
+		}
+
+	private:
+		//Disable Copy Constructor
+		ScopedGpuZone(const ScopedGpuZone&);
+		const ScopedGpuZone& operator=(const ScopedGpuZone&);
+
+		//Member Variables
+	private:
+		GpuProfiler* mpGpuProfiler;
+	};
+
+}//namespace DSProfiling
+
+#endif //#ifndef GPUPROFILER_H
\ No newline at end of file
@@ -0,0 +1,573 @@
+//=============================================================================
+// File:		Profiler.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Profiler. Scoped CPU timing zones recorded into per thread lock-free buffers, collected once per frame into rolling statistics and an optional Chrome trace capture.
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <stdio.h>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#endif
+
+// Daniel Schenker
+#include "Profiler.h"
+#include "../DSMemory/MemoryTracker.h"
+#include "../DSSystem/Platform.h"
+
+//=============================================================================
+//Internal Types
+//=============================================================================
+
+namespace
+{
+	//Events per thread between two EndFrame calls. Events recorded while a buffer is full are dropped (and counted).
+	const unsigned int kThreadBufferCapacity = 8192;
+	//Frames of history kept per zone for the rolling statistics.
+	const unsigned int kZoneHistoryLength = 240;
+	//Thread index used for GPU events in captures.
+	const unsigned int kGpuThreadIndex = 0xFFFF;
+
+	/*
+	Description:
+		Single producer (the owning thread), single consumer (the thread calling EndFrame) ring buffer.
+		The producer only writes mWrite and the consumer only writes mRead, so no locks are needed.
+	*/
+	struct ThreadBuffer
+	{
+		DSProfiling::Event mEvents[kThreadBufferCapacity];
+		std::atomic<unsigned int> mWrite;
+		char mPadding[DS_CACHE_LINE_SIZE];//keeps the producer's and consumer's indices on separate cache lines
+		std::atomic<unsigned int> mRead;
+		unsigned int mThreadIndex;
+		unsigned int mDropped;
+		std::string mName;
+	};
+
+	//-----------------------------------------------------------------------------
+
+	struct ZoneHistory
+	{
+		ZoneHistory()
+		:	mNext(0)
+		,	mCount(0)
+		{
+			mSamples.resize(kZoneHistoryLength, 0.0);
+		}
+
+		std::vector<double> mSamples;
+		unsigned int mNext;
+		unsigned int mCount;
+	};
+
+	//-----------------------------------------------------------------------------
+
+	struct GpuCaptureEvent
+	{
+		const char* mpName;
+		unsigned long long mCpuStart;
+		double mGpuMs;
+	};
+}
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+std::atomic<bool> DSProfiling::Profiler::sIsEnabled(false);
+
+namespace
+{
+	// Threads
+	std::mutex sRegistryMutex;
+	std::vector<ThreadBuffer*> sThreadBuffers;
+	DS_THREAD_LOCAL ThreadBuffer* tpThreadBuffer = nullptr;
+
+	// Time
+	double sMsPerTick = 0.0;
+
+	// Frame
+	unsigned long long sFrameIndex = 0;
+	unsigned long long sFrameStart = 0;
+	std::unordered_map<const char*, double> sFrameTotals;//per zone name pointer, reused every frame
+
+	// Statistics (only touched by the thread calling EndFrame)
+	std::unordered_map<std::string, ZoneHistory> sZoneHistories;
+
+	// Capture (only touched by the thread calling EndFrame)
+	bool sIsCapturing = false;
+	unsigned long long sCaptureStart = 0;
+	std::vector<DSProfiling::Event> sCapturedEvents;
+	std::vector<GpuCaptureEvent> sCapturedGpuEvents;
+}
+
+//=============================================================================
+//Function Prototypes
+//=============================================================================
+
+static ThreadBuffer* GetThreadBuffer();
+static void WriteJsonString(FILE* pFile, const char* pString);
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSProfiling::Profiler::Profiler()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+void DSProfiling::Profiler::Initialize()
+{
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagProfiling);
+
+#if defined(_WIN32)
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	sMsPerTick = 1000.0 / static_cast<double>(frequency.QuadPart);
+#else
+	sMsPerTick = 1000.0 * static_cast<double>(std::chrono::steady_clock::period::num) / static_cast<double>(std::chrono::steady_clock::period::den);
+#endif
+
+	SetThreadName("Main");
+	sIsEnabled.store(true);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Note:
+	Every other thread that recorded zones must have exited before this is called, since their buffers are freed here.
+*/
+void DSProfiling::Profiler::Terminate()
+{
+	sIsEnabled.store(false);
+
+	std::lock_guard<std::mutex> lock(sRegistryMutex);
+	for(unsigned int i = 0; i < sThreadBuffers.size(); ++i)
+	{
+		delete sThreadBuffers[i];
+	}
+	sThreadBuffers.clear();
+	tpThreadBuffer = nullptr;
+
+	sZoneHistories.clear();
+	sCapturedEvents.clear();
+	sCapturedGpuEvents.clear();
+	sIsCapturing = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSProfiling::Profiler::BeginFrame()
+{
+	sFrameStart = GetTicks();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Records the frame itself as a zone, then drains every thread's buffer into the statistics (and the capture, if one is running).
+	Must always be called from the same thread.
+*/
+void DSProfiling::Profiler::EndFrame()
+{
+	if(sIsEnabled.load(std::memory_order_relaxed) == true)
+	{
+		RecordEvent("Frame", sFrameStart, GetTicks());
+	}
+
+	CollectThreadBuffers();
+
+	++sFrameIndex;
+}
+
+//-----------------------------------------------------------------------------
+//  Recording
+
+void DSProfiling::Profiler::SetThreadName(const char* pName)
+{
+	ThreadBuffer* pBuffer = GetThreadBuffer();
+
+	std::lock_guard<std::mutex> lock(sRegistryMutex);
+	pBuffer->mName = pName;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSProfiling::Profiler::RecordEvent(const char* pName, unsigned long long start, unsigned long long end)
+{
+	ThreadBuffer* pBuffer = GetThreadBuffer();
+
+	unsigned int write = pBuffer->mWrite.load(std::memory_order_relaxed);
+	unsigned int read = pBuffer->mRead.load(std::memory_order_acquire);
+	if(write - read >= kThreadBufferCapacity)
+	{
+		++pBuffer->mDropped;
+		return;
+	}
+
+	DSProfiling::Event& event = pBuffer->mEvents[write % kThreadBufferCapacity];
+	event.mpName = pName;
+	event.mStart = start;
+	event.mEnd = end;
+	event.mThreadIndex = pBuffer->mThreadIndex;
+
+	pBuffer->mWrite.store(write + 1, std::memory_order_release);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	GPU results arrive several frames after the work was submitted (see GpuProfiler), so they are added straight to the statistics.
+	Must be called from the thread calling EndFrame, which is also the thread owning the GL context.
+*/
+void DSProfiling::Profiler::RecordGpuEvent(const char* pName, unsigned long long cpuStart, double gpuMs)
+{
+	if(sIsEnabled.load(std::memory_order_relaxed) == false)
+	{
+		return;
+	}
+
+	AddSample(std::string("GPU ") + pName, gpuMs);
+
+	if(sIsCapturing == true && cpuStart >= sCaptureStart)
+	{
+		GpuCaptureEvent event;
+		event.mpName = pName;
+		event.mCpuStart = cpuStart;
+		event.mGpuMs = gpuMs;
+		sCapturedGpuEvents.push_back(event);
+	}
+}
+
+//-----------------------------------------------------------------------------
+//  Capture
+
+void DSProfiling::Profiler::BeginCapture()
+{
+	sCapturedEvents.clear();
+	sCapturedGpuEvents.clear();
+	sCaptureStart = GetTicks();
+	sIsCapturing = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSProfiling::Profiler::EndCapture()
+{
+	sIsCapturing = false;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Writes the current capture in the Chrome trace event format.
+	Open the file with chrome://tracing (or https://ui.perfetto.dev).
+	GPU zones only carry a duration, so they are placed at the CPU time they were submitted on their own "GPU" track.
+*/
+bool DSProfiling::Profiler::WriteChromeTrace(const char* pFilePath)
+{
+	FILE* pFile = nullptr;
+	if(fopen_s(&pFile, pFilePath, "w") != 0 || pFile == nullptr)
+	{
+		fprintf(stderr, "WARNING: Could not open \"%s\" to write the profiler trace.\n", pFilePath);
+		return false;
+	}
+
+	fprintf(pFile, "{\"traceEvents\":[\n");
+	bool first = true;
+
+	//Thread names
+	{
+		std::lock_guard<std::mutex> lock(sRegistryMutex);
+		for(unsigned int i = 0; i < sThreadBuffers.size(); ++i)
+		{
+			fprintf(pFile, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":", first ? "" : ",\n", sThreadBuffers[i]->mThreadIndex);
+			WriteJsonString(pFile, sThreadBuffers[i]->mName.c_str());
+			fprintf(pFile, "}}");
+			first = false;
+		}
+	}
+	fprintf(pFile, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"GPU\"}}", first ? "" : ",\n", kGpuThreadIndex);
+
+	//CPU zones
+	for(unsigned int i = 0; i < sCapturedEvents.size(); ++i)
+	{
+		const DSProfiling::Event& event = sCapturedEvents[i];
+		fprintf(pFile, ",\n{\"name\":");
+		WriteJsonString(pFile, event.mpName);
+		fprintf
+		(
+			pFile,
+			",\"cat\":\"CPU\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+			event.mThreadIndex,
+			TicksToMs(event.mStart - sCaptureStart) * 1000.0,
+			TicksToMs(event.mEnd - event.mStart) * 1000.0
+		);
+	}
+
+	//GPU zones
+	for(unsigned int i = 0; i < sCapturedGpuEvents.size(); ++i)
+	{
+		const GpuCaptureEvent& event = sCapturedGpuEvents[i];
+		fprintf(pFile, ",\n{\"name\":");
+		WriteJsonString(pFile, event.mpName);
+		fprintf
+		(
+			pFile,
+			",\"cat\":\"GPU\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+			kGpuThreadIndex,
+			TicksToMs(event.mCpuStart - sCaptureStart) * 1000.0,
+			event.mGpuMs * 1000.0
+		);
+	}
+
+	fprintf(pFile, "\n]}\n");
+	fclose(pFile);
+
+	printf("Profiler: wrote %u CPU and %u GPU zones to \"%s\".\n", static_cast<unsigned int>(sCapturedEvents.size()), static_cast<unsigned int>(sCapturedGpuEvents.size()), pFilePath);
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+//  Reports
+
+void DSProfiling::Profiler::PrintReport()
+{
+	std::vector<std::pair<double, std::string> > order;
+	for(std::unordered_map<std::string, ZoneHistory>::const_iterator it = sZoneHistories.begin(); it != sZoneHistories.end(); ++it)
+	{
+		DSProfiling::ZoneStats stats;
+		GetZoneStats(it->first.c_str(), stats);
+		order.push_back(std::make_pair(stats.mMeanMs, it->first));
+	}
+	std::sort(order.rbegin(), order.rend());
+
+	printf("Profiler report (last %u frames, milliseconds):\n", kZoneHistoryLength);
+	printf("  %-24s %9s %9s %9s %9s\n", "Zone", "Mean", "P95", "P99", "Max");
+	for(unsigned int i = 0; i < order.size(); ++i)
+	{
+		DSProfiling::ZoneStats stats;
+		GetZoneStats(order[i].second.c_str(), stats);
+		printf("  %-24s %9.3f %9.3f %9.3f %9.3f\n", order[i].second.c_str(), stats.mMeanMs, stats.mP95Ms, stats.mP99Ms, stats.mMaxMs);
+	}
+
+	std::lock_guard<std::mutex> lock(sRegistryMutex);
+	for(unsigned int i = 0; i < sThreadBuffers.size(); ++i)
+	{
+		if(sThreadBuffers[i]->mDropped > 0)
+		{
+			fprintf(stderr, "WARNING: Profiler dropped %u events on thread \"%s\". Increase kThreadBufferCapacity.\n", sThreadBuffers[i]->mDropped, sThreadBuffers[i]->mName.c_str());
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+//  Time
+
+unsigned long long DSProfiling::Profiler::GetTicks()
+{
+#if defined(_WIN32)
+	LARGE_INTEGER ticks;
+	QueryPerformanceCounter(&ticks);
+	return static_cast<unsigned long long>(ticks.QuadPart);
+#else
+	return static_cast<unsigned long long>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+double DSProfiling::Profiler::TicksToMs(unsigned long long ticks)
+{
+	return static_cast<double>(ticks) * sMsPerTick;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helpers
+
+void DSProfiling::Profiler::CollectThreadBuffers()
+{
+	sFrameTotals.clear();
+
+	{
+		std::lock_guard<std::mutex> lock(sRegistryMutex);
+		for(unsigned int i = 0; i < sThreadBuffers.size(); ++i)
+		{
+			ThreadBuffer* pBuffer = sThreadBuffers[i];
+			unsigned int read = pBuffer->mRead.load(std::memory_order_relaxed);
+			unsigned int write = pBuffer->mWrite.load(std::memory_order_acquire);
+
+			for(; read != write; ++read)
+			{
+				const DSProfiling::Event& event = pBuffer->mEvents[read % kThreadBufferCapacity];
+				sFrameTotals[event.mpName] += TicksToMs(event.mEnd - event.mStart);
+
+				if(sIsCapturing == true)
+				{
+					sCapturedEvents.push_back(event);
+				}
+			}
+
+			pBuffer->mRead.store(read, std::memory_order_release);
+		}
+	}
+
+	//One sample per zone per frame, so zones entered many times a frame report their frame total
+	for(std::unordered_map<const char*, double>::const_iterator it = sFrameTotals.begin(); it != sFrameTotals.end(); ++it)
+	{
+		AddSample(it->first, it->second);
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void DSProfiling::Profiler::AddSample(const std::string& name, double ms)
+{
+	ZoneHistory& history = sZoneHistories[name];
+	history.mSamples[history.mNext] = ms;
+	history.mNext = (history.mNext + 1) % kZoneHistoryLength;
+	if(history.mCount < kZoneHistoryLength)
+	{
+		++history.mCount;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+bool DSProfiling::Profiler::GetIsEnabled()
+{
+	return sIsEnabled.load(std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSProfiling::Profiler::GetIsCapturing()
+{
+	return sIsCapturing;
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSProfiling::Profiler::GetZoneStats(const char* pName, DSProfiling::ZoneStats& stats)
+{
+	std::unordered_map<std::string, ZoneHistory>::const_iterator it = sZoneHistories.find(pName);
+	if(it == sZoneHistories.end() || it->second.mCount == 0)
+	{
+		return false;
+	}
+
+	const ZoneHistory& history = it->second;
+	std::vector<double> sorted(history.mSamples.begin(), history.mSamples.begin() + history.mCount);
+	std::sort(sorted.begin(), sorted.end());
+
+	double sum = 0.0;
+	for(unsigned int i = 0; i < sorted.size(); ++i)
+	{
+		sum += sorted[i];
+	}
+
+	stats.mLastMs = history.mSamples[(history.mNext + kZoneHistoryLength - 1) % kZoneHistoryLength];
+	stats.mMeanMs = sum / static_cast<double>(sorted.size());
+	stats.mP95Ms = sorted[(sorted.size() - 1) * 95 / 100];
+	stats.mP99Ms = sorted[(sorted.size() - 1) * 99 / 100];
+	stats.mMaxMs = sorted.back();
+	stats.mSampleCount = history.mCount;
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned long long DSProfiling::Profiler::GetFrameIndex()
+{
+	return sFrameIndex;
+}
+
+//-----------------------------------------------------------------------------
+// Setters
+//-----------------------------------------------------------------------------
+
+void DSProfiling::Profiler::SetIsEnabled(bool isEnabled)
+{
+	sIsEnabled.store(isEnabled);
+}
+
+//-----------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Returns the calling thread's event buffer, registering a new one the first time a thread records anything.
+*/
+static ThreadBuffer* GetThreadBuffer()
+{
+	if(tpThreadBuffer == nullptr)
+	{
+		DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagProfiling);
+
+		ThreadBuffer* pBuffer = new ThreadBuffer();
+		pBuffer->mWrite.store(0);
+		pBuffer->mRead.store(0);
+		pBuffer->mDropped = 0;
+
+		std::lock_guard<std::mutex> lock(sRegistryMutex);
+		pBuffer->mThreadIndex = static_cast<unsigned int>(sThreadBuffers.size());
+		char name[32];
+		sprintf_s(name, sizeof(name), "Thread %u", pBuffer->mThreadIndex);
+		pBuffer->mName = name;
+		sThreadBuffers.push_back(pBuffer);
+
+		tpThreadBuffer = pBuffer;
+	}
+
+	return tpThreadBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+static void WriteJsonString(FILE* pFile, const char* pString)
+{
+	fputc('"', pFile);
+	for(const char* p = pString; *p != '\0'; ++p)
+	{
+		if(*p == '"' || *p == '\\')
+		{
+			fputc('\\', pFile);
+		}
+		fputc(*p, pFile);
+	}
+	fputc('"', pFile);
+}
\ No newline at end of file
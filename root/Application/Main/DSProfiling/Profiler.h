@@ -0,0 +1,173 @@
+//=============================================================================
+// File:		Profiler.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Profiler. Scoped CPU timing zones recorded into per thread lock-free buffers, collected once per frame into rolling statistics and an optional Chrome trace capture.
+//=============================================================================
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <atomic>
+#include <string>
+
+//=============================================================================
+//Defines
+//=============================================================================
+
+/*
+Usage:
+	void Application::Physics()
+	{
+		DS_PROFILE_SCOPE("Physics");
+		...
+	}
+
+	Defining DS_PROFILING_DISABLED compiles every zone out entirely.
+	Otherwise a zone costs a single relaxed atomic load while the profiler is switched off at runtime.
+*/
+#define DS_PROFILE_CONCAT_INNER(a, b) a##b
+#define DS_PROFILE_CONCAT(a, b) DS_PROFILE_CONCAT_INNER(a, b)
+
+#if defined(DS_PROFILING_DISABLED)
+	#define DS_PROFILE_SCOPE(name)
+#else
+	#define DS_PROFILE_SCOPE(name) DSProfiling::ScopedZone DS_PROFILE_CONCAT(profileZone, __LINE__)(name)
+#endif
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSProfiling
+{
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	//A single completed zone. Names must be string literals (or otherwise outlive the profiler), since only the pointer is stored.
+	struct Event
+	{
+		const char* mpName;
+		unsigned long long mStart;//ticks
+		unsigned long long mEnd;//ticks
+		unsigned int mThreadIndex;
+	};
+
+	//-----------------------------------------------------------------------------
+
+	struct ZoneStats
+	{
+		double mLastMs;
+		double mMeanMs;
+		double mP95Ms;
+		double mP99Ms;
+		double mMaxMs;
+		unsigned int mSampleCount;
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	class Profiler
+	{
+	private:
+		//Constructors
+		Profiler();
+
+		//Member Functions
+	public:
+		// General
+		static void Initialize();
+		static void Terminate();
+		static void BeginFrame();
+		static void EndFrame();
+
+		// Recording (callable from any thread)
+		static void SetThreadName(const char* pName);
+		static void RecordEvent(const char* pName, unsigned long long start, unsigned long long end);
+		static void RecordGpuEvent(const char* pName, unsigned long long cpuStart, double gpuMs);
+
+		// Capture
+		static void BeginCapture();
+		static void EndCapture();
+		static bool WriteChromeTrace(const char* pFilePath);
+
+		// Reports
+		static void PrintReport();
+
+		// Time
+		static unsigned long long GetTicks();
+		static double TicksToMs(unsigned long long ticks);
+
+		// Getters
+		static bool GetIsEnabled();
+		static bool GetIsCapturing();
+		static bool GetZoneStats(const char* pName, ZoneStats& stats);
+		static unsigned long long GetFrameIndex();
+
+		// Setters
+		static void SetIsEnabled(bool isEnabled);
+
+	private:
+		// Helpers
+		static void CollectThreadBuffers();
+		static void AddSample(const std::string& name, double ms);
+
+	public:
+		//Member Variables
+		// Statics
+		static std::atomic<bool> sIsEnabled;//public so that ScopedZone can test it inline
+	};
+
+	//-----------------------------------------------------------------------------
+
+	/*
+	Description:
+		Times its own lifetime and records it as a zone on the calling thread.
+		Everything is inline so that a disabled profiler costs one branch.
+	*/
+	class ScopedZone
+	{
+	public:
+		//Constructors
+		explicit ScopedZone(const char* pName)
+		:	mpName(pName)
+		,	mStart(0)
+		{
+			if(Profiler::sIsEnabled.load(std::memory_order_relaxed) == true)
+			{
+				mStart = Profiler::GetTicks();
+			}
+		}
+		//Destructor
+		~ScopedZone()
+		{
+			if(mStart != 0)
+			{
+				Profiler::RecordEvent(mpName, mStart, Profiler::GetTicks());
+			}
+		}
+
+	private:
+		//Disable Copy Constructor
+		ScopedZone(const ScopedZone&);
+		const ScopedZone& operator=(const ScopedZone&);
+
+		//Member Variables
+	private:
+		const char* mpName;
+		unsigned long long mStart;
+	};
+
+}//namespace DSProfiling
+
+#endif //#ifndef PROFILER_H
\ No newline at end of file
@@ -0,0 +1,177 @@
+//=============================================================================
+// File:		MappedFile.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	MappedFile
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Platform
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+// Standard C++ Libraries
+#include <stdio.h>
+
+// Daniel Schenker
+#include "MappedFile.h"
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+#if defined(_WIN32)
+
+DSSystem::MappedFile::MappedFile(const char* pPath)
+:	mpData(nullptr)
+,	mSize(0)
+,	mpFileHandle(INVALID_HANDLE_VALUE)
+,	mpMappingHandle(nullptr)
+{
+	//FILE_FLAG_SEQUENTIAL_SCAN lets the cache manager read ahead, since the whole file is usually consumed front to back
+	mpFileHandle = CreateFileA(pPath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if(mpFileHandle == INVALID_HANDLE_VALUE)
+	{
+		fprintf(stderr, "WARNING: MappedFile could not open \"%s\".\n", pPath);
+		return;
+	}
+
+	LARGE_INTEGER size;
+	if(GetFileSizeEx(mpFileHandle, &size) == FALSE || size.QuadPart == 0 || static_cast<unsigned long long>(size.QuadPart) > static_cast<size_t>(-1))
+	{
+		fprintf(stderr, "WARNING: MappedFile could not map \"%s\": it is empty or too large.\n", pPath);
+		return;
+	}
+
+	mpMappingHandle = CreateFileMappingA(mpFileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if(mpMappingHandle == nullptr)
+	{
+		fprintf(stderr, "WARNING: MappedFile could not create a mapping of \"%s\".\n", pPath);
+		return;
+	}
+
+	mpData = static_cast<const unsigned char*>(MapViewOfFile(mpMappingHandle, FILE_MAP_READ, 0, 0, 0));
+	if(mpData == nullptr)
+	{
+		fprintf(stderr, "WARNING: MappedFile could not map a view of \"%s\".\n", pPath);
+		return;
+	}
+
+	mSize = static_cast<size_t>(size.QuadPart);
+}
+
+#else
+
+DSSystem::MappedFile::MappedFile(const char* pPath)
+:	mpData(nullptr)
+,	mSize(0)
+,	mFileDescriptor(-1)
+{
+	mFileDescriptor = open(pPath, O_RDONLY);
+	if(mFileDescriptor == -1)
+	{
+		fprintf(stderr, "WARNING: MappedFile could not open \"%s\".\n", pPath);
+		return;
+	}
+
+	struct stat status;
+	if(fstat(mFileDescriptor, &status) != 0 || status.st_size <= 0)
+	{
+		fprintf(stderr, "WARNING: MappedFile could not map \"%s\": it is empty or could not be read.\n", pPath);
+		return;
+	}
+
+	void* pData = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, mFileDescriptor, 0);
+	if(pData == MAP_FAILED)
+	{
+		fprintf(stderr, "WARNING: MappedFile could not map \"%s\".\n", pPath);
+		return;
+	}
+	madvise(pData, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+
+	mpData = static_cast<const unsigned char*>(pData);
+	mSize = static_cast<size_t>(status.st_size);
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+#if defined(_WIN32)
+
+DSSystem::MappedFile::~MappedFile()
+{
+	if(mpData != nullptr)
+	{
+		UnmapViewOfFile(mpData);
+	}
+	if(mpMappingHandle != nullptr)
+	{
+		CloseHandle(mpMappingHandle);
+	}
+	if(mpFileHandle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(mpFileHandle);
+	}
+}
+
+#else
+
+DSSystem::MappedFile::~MappedFile()
+{
+	if(mpData != nullptr)
+	{
+		munmap(const_cast<unsigned char*>(mpData), mSize);
+	}
+	if(mFileDescriptor != -1)
+	{
+		close(mFileDescriptor);
+	}
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+bool DSSystem::MappedFile::GetIsMapped() const
+{
+	return mpData != nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Page aligned, so any offset that is a multiple of a type's alignment is suitably aligned for it.
+*/
+const unsigned char* DSSystem::MappedFile::GetData() const
+{
+	return mpData;
+}
+
+//-----------------------------------------------------------------------------
+
+size_t DSSystem::MappedFile::GetSize() const
+{
+	return mSize;
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+//=============================================================================
+// File:		MappedFile.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	MappedFile. A read only view of a whole file mapped into memory.
+//=============================================================================
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstddef>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSSystem
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Maps the file into the address space instead of reading it, so nothing is copied up front and the OS pages the contents in as they are touched.
+	Usage:
+		DSSystem::MappedFile file("../../Resources/Meshes/Wall.dsmesh");
+		if(file.GetIsMapped() == true)
+		{
+			const unsigned char* pBytes = file.GetData();
+			...
+		}
+	Notes:
+		The view is only valid for the lifetime of the MappedFile.
+		Failing to open or map the file prints a warning and leaves GetIsMapped() false; empty files count as failures.
+	*/
+	class MappedFile
+	{
+	public:
+		//Constructors
+		explicit MappedFile(const char* pPath);
+		//Destructor
+		~MappedFile();
+
+	private:
+		//Disable Copy Constructor
+		MappedFile(const MappedFile&);
+		const MappedFile& operator=(const MappedFile&);
+
+		//Member Functions
+	public:
+		// Getters
+		bool GetIsMapped() const;
+		const unsigned char* GetData() const;
+		size_t GetSize() const;
+
+		//Member Variables
+	private:
+		const unsigned char* mpData;
+		size_t mSize;
+#if defined(_WIN32)
+		void* mpFileHandle;//HANDLE
+		void* mpMappingHandle;//HANDLE
+#else
+		int mFileDescriptor;
+#endif
+	};
+
+}//namespace DSSystem
+
+#endif //#ifndef MAPPEDFILE_H
\ No newline at end of file
@@ -0,0 +1,372 @@
+//=============================================================================
+// File:		PackFile.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	PackFile
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  zlib
+#include <zlib.h>
+
+// Standard C++ Libraries
+#include <atomic>
+#include <cstring>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "PackFile.h"
+#include "../DSProfiling/Profiler.h"
+#include "../DSThreading/JobSystem.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	char NormalizeNameCharacter(char c)
+	{
+		if(c == '\\')
+		{
+			return '/';
+		}
+		if(c >= 'A' && c <= 'Z')
+		{
+			return static_cast<char>(c - 'A' + 'a');
+		}
+		return c;
+	}
+
+	bool GetIsSameName(const char* pA, const char* pB)
+	{
+		while(*pA != '\0' && NormalizeNameCharacter(*pA) == NormalizeNameCharacter(*pB))
+		{
+			++pA;
+			++pB;
+		}
+		return *pA == '\0' && *pB == '\0';
+	}
+
+	unsigned int GetBucket(uint64_t hash, uint32_t bucketBits)
+	{
+		//The top bits, so buckets are contiguous runs of the sorted index
+		return bucketBits == 0 ? 0 : static_cast<unsigned int>(hash >> (64 - bucketBits));
+	}
+
+	struct ReadData
+	{
+		const DSSystem::PackFile* mpPack;
+		const DSSystem::PackEntry* mpEntry;
+		unsigned char* mpDestination;
+		const unsigned char* mpFile;
+		std::atomic<bool> mIsFailed;
+	};
+
+	//Inflates chunks [begin, end) of the entry, each into its own slice of the destination
+	void InflateChunks(unsigned int begin, unsigned int end, void* pUserData)
+	{
+		ReadData& data = *static_cast<ReadData*>(pUserData);
+		for(unsigned int i = begin; i < end; ++i)
+		{
+			const DSSystem::PackChunk& chunk = data.mpPack->GetChunk(data.mpEntry->mFirstChunk + i);
+			unsigned char* pDestination = data.mpDestination + static_cast<size_t>(i) * DSSystem::PackFile::kChunkSize;
+			const unsigned char* pSource = data.mpFile + chunk.mOffset;
+
+			if(chunk.mStoredSize == chunk.mSize)
+			{
+				memcpy(pDestination, pSource, chunk.mSize);
+				continue;
+			}
+
+			uLongf size = chunk.mSize;
+			if(uncompress(pDestination, &size, pSource, chunk.mStoredSize) != Z_OK || size != chunk.mSize)
+			{
+				data.mIsFailed = true;
+			}
+		}
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	A pack that is missing or fails validation prints a warning and leaves GetIsLoaded() false.
+*/
+DSSystem::PackFile::PackFile(const char* pPath)
+:	mFile(pPath)
+,	mpHeader(nullptr)
+,	mpBuckets(nullptr)
+,	mpEntries(nullptr)
+,	mpChunks(nullptr)
+,	mpNames(nullptr)
+{
+	if(mFile.GetIsMapped() == true && Validate(pPath) == true)
+	{
+		const unsigned char* pData = mFile.GetData();
+		mpHeader = reinterpret_cast<const DSSystem::PackHeader*>(pData);
+		mpBuckets = reinterpret_cast<const uint32_t*>(pData + mpHeader->mBucketOffset);
+		mpEntries = reinterpret_cast<const DSSystem::PackEntry*>(pData + mpHeader->mEntryOffset);
+		mpChunks = reinterpret_cast<const DSSystem::PackChunk*>(pData + mpHeader->mChunkOffset);
+		mpNames = reinterpret_cast<const char*>(pData + mpHeader->mNamesOffset);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSSystem::PackFile::~PackFile()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Returns the entry called pName, or nullptr if the pack does not have one.
+Notes:
+	The bucket holds about one entry on average. The name is compared as well as the hash, so a collision can never return the wrong entry.
+*/
+const DSSystem::PackEntry* DSSystem::PackFile::Find(const char* pName) const
+{
+	if(mpHeader == nullptr)
+	{
+		return nullptr;
+	}
+
+	uint64_t hash = Hash(pName);
+	unsigned int bucket = GetBucket(hash, mpHeader->mBucketBits);
+	for(uint32_t i = mpBuckets[bucket]; i < mpBuckets[bucket + 1]; ++i)
+	{
+		if(mpEntries[i].mHash == hash && GetIsSameName(mpNames + mpEntries[i].mNameOffset, pName) == true)
+		{
+			return &mpEntries[i];
+		}
+	}
+
+	return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Copies the entry, uncompressed, into pDestination, which must hold entry.mSize bytes.
+	The chunks of a compressed entry are inflated in parallel.
+Notes:
+	Returns false if a chunk is corrupt; zlib checks every chunk against its checksum.
+*/
+bool DSSystem::PackFile::Read(const DSSystem::PackEntry& entry, void* pDestination) const
+{
+	DS_PROFILE_SCOPE("PackFile Read");
+
+	if(entry.mChunkCount == 0)
+	{
+		memcpy(pDestination, GetStoredData(entry), entry.mSize);
+		return true;
+	}
+
+	ReadData data;
+	data.mpPack = this;
+	data.mpEntry = &entry;
+	data.mpDestination = static_cast<unsigned char*>(pDestination);
+	data.mpFile = mFile.GetData();
+	data.mIsFailed = false;
+	DSThreading::JobSystem::ParallelFor("PackFile Inflate", 0, entry.mChunkCount, DSThreading::JobSystem::GetGrainSize(entry.mChunkCount), InflateChunks, &data);
+
+	if(data.mIsFailed == true)
+	{
+		fprintf(stderr, "WARNING: PackFile entry \"%s\" is corrupt.\n", GetName(entry));
+		return false;
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	64 bit FNV-1a of the name, lower case and with '/' for '\\', so the same file hashes the same however it is spelled.
+*/
+uint64_t DSSystem::PackFile::Hash(const char* pName)
+{
+	uint64_t hash = 14695981039346656037ull;
+	for(const char* p = pName; *p != '\0'; ++p)
+	{
+		hash ^= static_cast<unsigned char>(NormalizeNameCharacter(*p));
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helpers
+
+/*
+Description:
+	Checks that the header matches the file, and that every table, name and entry lies within it,
+	so nothing read through the pack afterwards can go out of bounds.
+*/
+bool DSSystem::PackFile::Validate(const char* pPath) const
+{
+	const unsigned char* pData = mFile.GetData();
+	unsigned long long size = mFile.GetSize();
+	if(size < sizeof(DSSystem::PackHeader))
+	{
+		fprintf(stderr, "WARNING: \"%s\" is too small to be a pack.\n", pPath);
+		return false;
+	}
+
+	const DSSystem::PackHeader& header = *reinterpret_cast<const DSSystem::PackHeader*>(pData);
+	if(header.mMagic != kMagic || header.mVersion != kVersion)
+	{
+		fprintf(stderr, "WARNING: \"%s\" is not a version %u pack.\n", pPath, kVersion);
+		return false;
+	}
+	if(header.mFileSize != size || header.mBucketBits > 24)
+	{
+		fprintf(stderr, "WARNING: \"%s\" is truncated or has a corrupt header.\n", pPath);
+		return false;
+	}
+
+	//Tables
+	unsigned long long bucketCount = 1ull << header.mBucketBits;
+	if(header.mBucketOffset % 4 != 0 || header.mEntryOffset % 8 != 0 || header.mChunkOffset % 8 != 0
+		|| header.mBucketOffset + (bucketCount + 1) * sizeof(uint32_t) > size
+		|| header.mEntryOffset + static_cast<unsigned long long>(header.mEntryCount) * sizeof(DSSystem::PackEntry) > size
+		|| header.mChunkOffset + static_cast<unsigned long long>(header.mChunkCount) * sizeof(DSSystem::PackChunk) > size
+		|| header.mNamesOffset + header.mNamesSize > size
+		|| (header.mNamesSize == 0 ? header.mEntryCount != 0 : pData[header.mNamesOffset + header.mNamesSize - 1] != '\0'))
+	{
+		fprintf(stderr, "WARNING: \"%s\" has tables outside of the file.\n", pPath);
+		return false;
+	}
+
+	//Index
+	const uint32_t* pBuckets = reinterpret_cast<const uint32_t*>(pData + header.mBucketOffset);
+	const DSSystem::PackEntry* pEntries = reinterpret_cast<const DSSystem::PackEntry*>(pData + header.mEntryOffset);
+	if(pBuckets[0] != 0 || pBuckets[bucketCount] != header.mEntryCount)
+	{
+		fprintf(stderr, "WARNING: \"%s\" has a corrupt index.\n", pPath);
+		return false;
+	}
+	for(unsigned int bucket = 0; bucket < bucketCount; ++bucket)
+	{
+		if(pBuckets[bucket] > pBuckets[bucket + 1])
+		{
+			fprintf(stderr, "WARNING: \"%s\" has a corrupt index.\n", pPath);
+			return false;
+		}
+		for(uint32_t i = pBuckets[bucket]; i < pBuckets[bucket + 1]; ++i)
+		{
+			if(GetBucket(pEntries[i].mHash, header.mBucketBits) != bucket)
+			{
+				fprintf(stderr, "WARNING: \"%s\" has a corrupt index.\n", pPath);
+				return false;
+			}
+		}
+	}
+
+	//Entries
+	const DSSystem::PackChunk* pChunks = reinterpret_cast<const DSSystem::PackChunk*>(pData + header.mChunkOffset);
+	for(uint32_t i = 0; i < header.mEntryCount; ++i)
+	{
+		const DSSystem::PackEntry& entry = pEntries[i];
+		bool isValid = entry.mNameOffset < header.mNamesSize;
+		if(entry.mChunkCount == 0)
+		{
+			isValid = isValid && entry.mOffset % kStoredAlignment == 0 && entry.mOffset + entry.mSize <= size;
+		}
+		else
+		{
+			isValid = isValid && static_cast<unsigned long long>(entry.mFirstChunk) + entry.mChunkCount <= header.mChunkCount;
+			unsigned long long entrySize = 0;
+			for(uint32_t j = 0; isValid == true && j < entry.mChunkCount; ++j)
+			{
+				const DSSystem::PackChunk& chunk = pChunks[entry.mFirstChunk + j];
+				bool isLast = j + 1 == entry.mChunkCount;
+				isValid = chunk.mOffset + chunk.mStoredSize <= size && (isLast == true ? chunk.mSize <= kChunkSize : chunk.mSize == kChunkSize);
+				entrySize += chunk.mSize;
+			}
+			isValid = isValid && entrySize == entry.mSize;
+		}
+
+		if(isValid == false)
+		{
+			fprintf(stderr, "WARNING: \"%s\" has a corrupt entry (%u).\n", pPath, i);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+bool DSSystem::PackFile::GetIsLoaded() const
+{
+	return mpHeader != nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSSystem::PackFile::GetEntryCount() const
+{
+	return mpHeader != nullptr ? mpHeader->mEntryCount : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Entries are in hash order, not the order they were packed in.
+*/
+const DSSystem::PackEntry& DSSystem::PackFile::GetEntry(unsigned int index) const
+{
+	return mpEntries[index];
+}
+
+//-----------------------------------------------------------------------------
+
+const char* DSSystem::PackFile::GetName(const DSSystem::PackEntry& entry) const
+{
+	return mpNames + entry.mNameOffset;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Points into the mapping and is kStoredAlignment aligned. nullptr if the entry is compressed; use Read instead.
+*/
+const unsigned char* DSSystem::PackFile::GetStoredData(const DSSystem::PackEntry& entry) const
+{
+	return entry.mChunkCount == 0 ? mFile.GetData() + entry.mOffset : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+const DSSystem::PackChunk& DSSystem::PackFile::GetChunk(unsigned int index) const
+{
+	return mpChunks[index];
+}
\ No newline at end of file
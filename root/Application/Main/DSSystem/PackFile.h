@@ -0,0 +1,142 @@
+//=============================================================================
+// File:		PackFile.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	PackFile. A read only archive of resources (.dspack), mapped and indexed by name hash.
+//=============================================================================
+
+#ifndef PACKFILE_H
+#define PACKFILE_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+// Daniel Schenker
+#include "MappedFile.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSSystem
+{
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	//Note: These are the on disk layout. Only add members at the end and bump PackFile::kVersion.
+
+	struct PackHeader
+	{
+		uint32_t mMagic;
+		uint32_t mVersion;
+		uint64_t mFileSize;
+		uint32_t mEntryCount;
+		uint32_t mBucketBits;//the index has 1 << mBucketBits buckets
+		uint32_t mChunkCount;
+		uint32_t mNamesSize;//bytes
+		// Section offsets in bytes from the start of the file
+		uint64_t mBucketOffset;//uint32_t[(1 << mBucketBits) + 1], the first entry of each bucket, then the entry count
+		uint64_t mEntryOffset;//PackEntry[mEntryCount], sorted by mHash
+		uint64_t mChunkOffset;//PackChunk[mChunkCount]
+		uint64_t mNamesOffset;//'\0' terminated names
+	};
+
+	struct PackEntry
+	{
+		uint64_t mHash;//PackFile::Hash of the name
+		uint64_t mOffset;//stored entries: the data, a multiple of PackFile::kStoredAlignment. 0 for compressed entries.
+		uint32_t mSize;//bytes, uncompressed
+		uint32_t mFirstChunk;
+		uint32_t mChunkCount;//0 for stored entries
+		uint32_t mNameOffset;//into the names section
+	};
+
+	struct PackChunk
+	{
+		uint64_t mOffset;
+		uint32_t mStoredSize;//zlib stream bytes, or mSize if the chunk did not compress and is stored as is
+		uint32_t mSize;//bytes, uncompressed; PackFile::kChunkSize except for an entry's last chunk
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Opening a pack is one file mapping and a bounds check of its tables; entries are then found by hashing their name
+		and looking in one bucket of the sorted index, so lookups are O(1) and never touch the disk.
+		Entries are either stored, page aligned so they can be used straight from the mapping (already compressed formats like PNG),
+		or split into kChunkSize chunks compressed independently with zlib, which Read inflates in parallel on the job system.
+	Usage:
+		DSSystem::PackFile pack("../../Resources/Resources.dspack");
+		const DSSystem::PackEntry* pEntry = pack.Find("Textures/stripes.png");
+		if(pEntry != nullptr)
+		{
+			const unsigned char* pData = pack.GetStoredData(*pEntry);//nullptr if the entry is compressed
+			...or...
+			pack.Read(*pEntry, pDestination);//pEntry->mSize bytes
+		}
+	Notes:
+		Names are relative to the packed directory and are matched case insensitively, with either slash.
+		Packs are little endian, as written by the Packer tool.
+	*/
+	class PackFile
+	{
+	public:
+		//Constructors
+		explicit PackFile(const char* pPath);
+		//Destructor
+		~PackFile();
+
+	private:
+		//Disable Copy Constructor
+		PackFile(const PackFile&);
+		const PackFile& operator=(const PackFile&);
+
+		//Member Functions
+	public:
+		// General
+		const DSSystem::PackEntry* Find(const char* pName) const;
+		bool Read(const DSSystem::PackEntry& entry, void* pDestination) const;
+		static uint64_t Hash(const char* pName);
+
+		// Getters
+		bool GetIsLoaded() const;
+		unsigned int GetEntryCount() const;
+		const DSSystem::PackEntry& GetEntry(unsigned int index) const;
+		const char* GetName(const DSSystem::PackEntry& entry) const;
+		const unsigned char* GetStoredData(const DSSystem::PackEntry& entry) const;
+		const DSSystem::PackChunk& GetChunk(unsigned int index) const;
+
+	private:
+		// Helpers
+		bool Validate(const char* pPath) const;
+
+		//Member Variables
+	public:
+		static const uint32_t kMagic = 0x4B505344;//"DSPK"
+		static const uint32_t kVersion = 1;
+		static const uint32_t kStoredAlignment = 4096;
+		static const uint32_t kChunkSize = 256 * 1024;
+
+	private:
+		DSSystem::MappedFile mFile;
+		const DSSystem::PackHeader* mpHeader;//nullptr if the pack did not load
+		const uint32_t* mpBuckets;
+		const DSSystem::PackEntry* mpEntries;
+		const DSSystem::PackChunk* mpChunks;
+		const char* mpNames;
+	};
+
+}//namespace DSSystem
+
+#endif //#ifndef PACKFILE_H
\ No newline at end of file
@@ -0,0 +1,48 @@
+//=============================================================================
+// File:		Platform.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Compiler specific keywords that Visual Studio 2013 does not yet support in their standard C++11 form.
+//=============================================================================
+
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+//=============================================================================
+//Defines
+//=============================================================================
+
+#if defined(_MSC_VER)
+	//Visual Studio 2013 has neither thread_local nor alignas.
+	//Note: __declspec(thread) only works with plain old data, so thread local objects must be pointers or PODs.
+	#define DS_THREAD_LOCAL __declspec(thread)
+	#define DS_ALIGN(bytes) __declspec(align(bytes))
+	#define DS_FORCEINLINE __forceinline
+	//Visual Studio lets any function use any intrinsic, so code picking an instruction set at run time needs nothing extra.
+	#define DS_TARGET(instructionSet)
+#else
+	#define DS_THREAD_LOCAL __thread
+	#define DS_ALIGN(bytes) __attribute__((aligned(bytes)))
+	#define DS_FORCEINLINE inline __attribute__((always_inline))
+	//GCC and Clang only allow intrinsics beyond the compiler's target in functions marked with the instruction set, eg. DS_TARGET("ssse3").
+	#define DS_TARGET(instructionSet) __attribute__((target(instructionSet)))
+#endif
+
+//SSE intrinsics (<xmmintrin.h>) are available. Every x64 target has them, and Visual Studio 2013 targets SSE2 by default on x86 as well.
+//Code using them keeps a plain C++ fallback for when DS_SSE is not defined.
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1) || defined(__SSE__)
+	#define DS_SSE
+	#include <xmmintrin.h>
+#endif
+
+//SSE2 integer intrinsics (<emmintrin.h>). Likewise on every x64 target, and Visual Studio 2013's x86 default.
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+	#define DS_SSE2
+	#include <emmintrin.h>
+#endif
+
+//Size of a cache line in bytes. Used to keep data written by different threads from sharing a line (false sharing).
+#define DS_CACHE_LINE_SIZE 64
+
+#endif //#ifndef PLATFORM_H
\ No newline at end of file
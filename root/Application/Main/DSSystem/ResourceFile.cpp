@@ -0,0 +1,183 @@
+//=============================================================================
+// File:		ResourceFile.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	ResourceFile
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <stdio.h>
+#include <string>
+
+// Daniel Schenker
+#include "ResourceFile.h"
+#include "MappedFile.h"
+#include "PackFile.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	DSSystem::PackFile* spPack = nullptr;
+	std::string sRoot;
+
+	//The path within the mounted root, or nullptr if pPath is outside of it
+	const char* GetPackName(const char* pPath)
+	{
+		for(size_t i = 0; i < sRoot.size(); ++i)
+		{
+			char c = pPath[i] == '\\' ? '/' : pPath[i];
+			char r = sRoot[i] == '\\' ? '/' : sRoot[i];
+			if(c != r)
+			{
+				return nullptr;
+			}
+		}
+		return pPath + sRoot.size();
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	A resource that is in neither the pack nor on disk prints a warning and leaves GetIsLoaded() false.
+*/
+DSSystem::ResourceFile::ResourceFile(const char* pPath)
+:	mpFile(nullptr)
+,	mpBuffer(nullptr)
+,	mpData(nullptr)
+,	mSize(0)
+,	mIsFromPack(false)
+{
+	const char* pName = spPack != nullptr ? GetPackName(pPath) : nullptr;
+	const DSSystem::PackEntry* pEntry = pName != nullptr ? spPack->Find(pName) : nullptr;
+	if(pEntry != nullptr)
+	{
+		mpData = spPack->GetStoredData(*pEntry);
+		if(mpData == nullptr)
+		{
+			mpBuffer = new unsigned char[pEntry->mSize > 0 ? pEntry->mSize : 1];
+			if(spPack->Read(*pEntry, mpBuffer) == true)
+			{
+				mpData = mpBuffer;
+			}
+		}
+		if(mpData != nullptr)
+		{
+			mSize = pEntry->mSize;
+			mIsFromPack = true;
+			return;
+		}
+	}
+
+	//Not packed, or the entry is corrupt
+	mpFile = new DSSystem::MappedFile(pPath);
+	mpData = mpFile->GetData();
+	mSize = mpFile->GetSize();
+}
+
+//-----------------------------------------------------------------------------
+// Destructor
+//-----------------------------------------------------------------------------
+
+DSSystem::ResourceFile::~ResourceFile()
+{
+	delete mpFile;
+	delete[] mpBuffer;
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  Mounting
+
+/*
+Description:
+	Opens the pack at pPackPath, which was packed from the directory pRoot, eg. "../../Resources/". Replaces any pack already mounted.
+Notes:
+	Returns false, leaving resources to be read from loose files, if the pack could not be loaded.
+*/
+bool DSSystem::ResourceFile::Mount(const char* pPackPath, const char* pRoot)
+{
+	Unmount();
+
+	DSSystem::PackFile* pPack = new DSSystem::PackFile(pPackPath);
+	if(pPack->GetIsLoaded() == false)
+	{
+		delete pPack;
+		return false;
+	}
+
+	spPack = pPack;
+	sRoot = pRoot;
+	printf("Mounted \"%s\" (%u resources) for \"%s\".\n", pPackPath, spPack->GetEntryCount(), pRoot);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSSystem::ResourceFile::Unmount()
+{
+	delete spPack;
+	spPack = nullptr;
+	sRoot.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	nullptr if no pack is mounted.
+*/
+const DSSystem::PackFile* DSSystem::ResourceFile::GetMountedPack()
+{
+	return spPack;
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+bool DSSystem::ResourceFile::GetIsLoaded() const
+{
+	return mpData != nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSSystem::ResourceFile::GetIsFromPack() const
+{
+	return mIsFromPack;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	At least 8 byte aligned: page aligned for loose files and stored entries, and new[] aligned for inflated ones.
+*/
+const unsigned char* DSSystem::ResourceFile::GetData() const
+{
+	return mpData;
+}
+
+//-----------------------------------------------------------------------------
+
+size_t DSSystem::ResourceFile::GetSize() const
+{
+	return mSize;
+}
\ No newline at end of file
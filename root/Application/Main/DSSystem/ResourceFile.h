@@ -0,0 +1,92 @@
+//=============================================================================
+// File:		ResourceFile.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	ResourceFile. The contents of a resource, from the mounted pack if it has it, or else from the loose file.
+//=============================================================================
+
+#ifndef RESOURCEFILE_H
+#define RESOURCEFILE_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstddef>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSSystem
+{
+
+	//=============================================================================
+	//Forward Declarations
+	//=============================================================================
+
+	class MappedFile;
+	class PackFile;
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Resources are always opened by their loose path, eg. "../../Resources/Textures/stripes.png".
+		Once a pack has been mounted for a directory, paths within it are looked up in the pack instead, so a build with the pack reads
+		a single file however many resources it loads, and a build without one (or a resource not packed yet) still works from loose files.
+	Usage:
+		DSSystem::ResourceFile::Mount("../../Resources/Resources.dspack", "../../Resources/");
+		...
+		DSSystem::ResourceFile file("../../Resources/Textures/stripes.png");
+		if(file.GetIsLoaded() == true)
+		{
+			const unsigned char* pBytes = file.GetData();
+			...
+		}
+	Notes:
+		Stored pack entries and loose files are used straight from their mapping; compressed pack entries are inflated into a buffer the ResourceFile owns.
+		The data is only valid for the lifetime of the ResourceFile. Mount and Unmount while no ResourceFile is being opened.
+	*/
+	class ResourceFile
+	{
+	public:
+		//Constructors
+		explicit ResourceFile(const char* pPath);
+		//Destructor
+		~ResourceFile();
+
+	private:
+		//Disable Copy Constructor
+		ResourceFile(const ResourceFile&);
+		const ResourceFile& operator=(const ResourceFile&);
+
+		//Member Functions
+	public:
+		// Mounting
+		static bool Mount(const char* pPackPath, const char* pRoot);
+		static void Unmount();
+		static const DSSystem::PackFile* GetMountedPack();
+
+		// Getters
+		bool GetIsLoaded() const;
+		bool GetIsFromPack() const;
+		const unsigned char* GetData() const;
+		size_t GetSize() const;
+
+		//Member Variables
+	private:
+		DSSystem::MappedFile* mpFile;//loose files
+		unsigned char* mpBuffer;//compressed pack entries, inflated
+		const unsigned char* mpData;
+		size_t mSize;
+		bool mIsFromPack;
+	};
+
+}//namespace DSSystem
+
+#endif //#ifndef RESOURCEFILE_H
\ No newline at end of file
@@ -0,0 +1,672 @@
+//=============================================================================
+// File:		JobSystem.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	JobSystem. Work-stealing job scheduler shared by every engine subsystem that wants to use more than one core.
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+// Daniel Schenker
+#include "JobSystem.h"
+#include "../DSMemory/MemoryTracker.h"
+#include "../DSProfiling/Profiler.h"
+#include "../DSSystem/Platform.h"
+
+//=============================================================================
+//Internal Types
+//=============================================================================
+
+namespace
+{
+	const unsigned int kJobMask = DSThreading::JobSystem::kMaxJobsPerThread - 1;
+	const unsigned int kUnregistered = 0xFFFFFFFF;
+
+	/*
+	Description:
+		Bounded Chase-Lev work-stealing deque.
+		Only the owning thread calls Push and Pop (at the bottom), any thread may call Steal (at the top).
+	*/
+	class JobDeque
+	{
+	public:
+		JobDeque()
+		:	mTop(0)
+		,	mBottom(0)
+		{
+			for(unsigned int i = 0; i < DSThreading::JobSystem::kMaxJobsPerThread; ++i)
+			{
+				mJobs[i].store(nullptr, std::memory_order_relaxed);
+			}
+		}
+
+		//Returns false, without pushing, if the deque is full
+		bool Push(DSThreading::Job* pJob)
+		{
+			long long bottom = mBottom.load(std::memory_order_relaxed);
+			long long top = mTop.load(std::memory_order_acquire);
+			if(bottom - top >= static_cast<long long>(DSThreading::JobSystem::kMaxJobsPerThread))
+			{
+				return false;
+			}
+
+			mJobs[bottom & kJobMask].store(pJob, std::memory_order_relaxed);
+			//Make the job (and everything written into it) visible before the new bottom
+			mBottom.store(bottom + 1, std::memory_order_release);
+			return true;
+		}
+
+		DSThreading::Job* Pop()
+		{
+			long long bottom = mBottom.load(std::memory_order_relaxed) - 1;
+			mBottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			long long top = mTop.load(std::memory_order_relaxed);
+
+			if(top > bottom)
+			{
+				//Empty
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			DSThreading::Job* pJob = mJobs[bottom & kJobMask].load(std::memory_order_relaxed);
+			if(top == bottom)
+			{
+				//Last job: race any thieves for it
+				if(mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed) == false)
+				{
+					pJob = nullptr;
+				}
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return pJob;
+		}
+
+		DSThreading::Job* Steal()
+		{
+			long long top = mTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			long long bottom = mBottom.load(std::memory_order_acquire);
+
+			if(top >= bottom)
+			{
+				return nullptr;
+			}
+
+			DSThreading::Job* pJob = mJobs[top & kJobMask].load(std::memory_order_relaxed);
+			if(mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed) == false)
+			{
+				//Another thread got there first
+				return nullptr;
+			}
+
+			return pJob;
+		}
+
+	private:
+		std::atomic<long long> mTop;
+		char mPadding[DS_CACHE_LINE_SIZE];//keeps thieves and the owner off each other's cache line
+		std::atomic<long long> mBottom;
+		std::atomic<DSThreading::Job*> mJobs[DSThreading::JobSystem::kMaxJobsPerThread];
+	};
+
+	//-----------------------------------------------------------------------------
+
+	struct ThreadData
+	{
+		ThreadData()
+		:	mNextJob(0)
+		{
+			//Every job starts out finished, so the whole ring is free
+			for(unsigned int i = 0; i < DSThreading::JobSystem::kMaxJobsPerThread; ++i)
+			{
+				mJobs[i].mUnfinishedJobs.store(0, std::memory_order_relaxed);
+				mJobs[i].mWaiters.store(0, std::memory_order_relaxed);
+				mJobs[i].mHasException.store(false, std::memory_order_relaxed);
+			}
+		}
+
+		JobDeque mDeque;
+		DSThreading::Job mJobs[DSThreading::JobSystem::kMaxJobsPerThread];
+		unsigned int mNextJob;
+	};
+
+	//-----------------------------------------------------------------------------
+
+	struct ParallelForData
+	{
+		unsigned int mBegin;
+		unsigned int mEnd;
+		unsigned int mGrainSize;
+		DSThreading::ParallelForFunction mpFunction;
+		void* mpUserData;
+		const char* mpName;
+	};
+}
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	std::atomic<ThreadData*> sThreadData[DSThreading::JobSystem::kMaxThreads];//written once on registration, read by thieves
+	std::atomic<unsigned int> sThreadCount(0);
+	std::vector<std::thread> sWorkers;
+	std::atomic<bool> sIsRunning(false);
+
+	//Idle workers sleep here instead of spinning
+	std::mutex sWakeMutex;
+	std::condition_variable sWakeCondition;
+
+	DS_THREAD_LOCAL unsigned int tThreadIndex = kUnregistered;
+	DS_THREAD_LOCAL unsigned int tRandomState = 0;
+}
+
+//=============================================================================
+//Function Prototypes
+//=============================================================================
+
+static void ParallelForJob(DSThreading::Job* pJob, const void* pData);
+static unsigned int NextRandom();
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSThreading::JobSystem::JobSystem()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Registers the calling thread (normally the main thread) and starts the workers.
+	workerCount = 0 starts one worker per hardware thread, less one for the calling thread.
+*/
+void DSThreading::JobSystem::Initialize(unsigned int workerCount)
+{
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagThreading);
+
+	if(sIsRunning.load() == true)
+	{
+		fprintf(stderr, "WARNING: JobSystem::Initialize was called twice. Ignoring the second call.\n");
+		return;
+	}
+
+	if(workerCount == 0)
+	{
+		unsigned int hardwareThreads = std::thread::hardware_concurrency();
+		workerCount = (hardwareThreads > 1) ? hardwareThreads - 1 : 1;
+	}
+	if(workerCount > kMaxThreads / 2)
+	{
+		workerCount = kMaxThreads / 2;//leave room for other threads to register
+	}
+
+	sIsRunning.store(true);
+	RegisterThread("Main");
+
+	for(unsigned int i = 0; i < workerCount; ++i)
+	{
+		unsigned int threadIndex = sThreadCount.fetch_add(1);
+		ThreadData* pThreadData = new ThreadData();
+		sThreadData[threadIndex].store(pThreadData);
+		sWorkers.push_back(std::thread(&DSThreading::JobSystem::WorkerThread, threadIndex));
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Note:
+	Every job must have finished, and no registered thread other than the caller may still be using the job system.
+*/
+void DSThreading::JobSystem::Terminate()
+{
+	if(sIsRunning.load() == false)
+	{
+		return;
+	}
+
+	sIsRunning.store(false);
+	sWakeCondition.notify_all();
+	for(unsigned int i = 0; i < sWorkers.size(); ++i)
+	{
+		sWorkers[i].join();
+	}
+	sWorkers.clear();
+
+	unsigned int threadCount = sThreadCount.exchange(0);
+	for(unsigned int i = 0; i < threadCount; ++i)
+	{
+		delete sThreadData[i].exchange(nullptr);
+	}
+
+	tThreadIndex = kUnregistered;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Gives the calling thread its own job pool and deque, which it needs before it can create, run or wait on jobs.
+	Workers and the thread calling Initialize are registered automatically.
+*/
+void DSThreading::JobSystem::RegisterThread(const char* pName)
+{
+	if(tThreadIndex != kUnregistered)
+	{
+		return;
+	}
+
+	DS_MEMORY_TAG_SCOPE(DSMemory::kMemoryTagThreading);
+
+	unsigned int threadIndex = sThreadCount.fetch_add(1);
+	if(threadIndex >= kMaxThreads)
+	{
+		throw std::runtime_error("ERROR: Too many threads registered with the JobSystem.");
+	}
+
+	ThreadData* pThreadData = new ThreadData();
+	sThreadData[threadIndex].store(pThreadData);
+	tThreadIndex = threadIndex;
+	tRandomState = threadIndex * 2654435761u + 1;
+
+	DSProfiling::Profiler::SetThreadName(pName);
+}
+
+//-----------------------------------------------------------------------------
+//  Jobs
+
+DSThreading::Job* DSThreading::JobSystem::CreateJob(const char* pName, DSThreading::JobFunction pFunction)
+{
+	return CreateChildJob(nullptr, pName, pFunction, nullptr, 0);
+}
+
+//-----------------------------------------------------------------------------
+
+DSThreading::Job* DSThreading::JobSystem::CreateJob(const char* pName, DSThreading::JobFunction pFunction, const void* pData, unsigned int dataSize)
+{
+	return CreateChildJob(nullptr, pName, pFunction, pData, dataSize);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Creates a job that pParent will wait for. pParent must not have finished yet (ie. create children from inside the parent, or before running it).
+	dataSize bytes of pData are copied into the job and handed back to pFunction.
+*/
+DSThreading::Job* DSThreading::JobSystem::CreateChildJob(DSThreading::Job* pParent, const char* pName, DSThreading::JobFunction pFunction, const void* pData, unsigned int dataSize)
+{
+	assert(dataSize <= DSThreading::Job::kDataSize);
+
+	if(pParent != nullptr)
+	{
+		pParent->mUnfinishedJobs.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	DSThreading::Job* pJob = AllocateJob();
+	pJob->mpFunction = pFunction;
+	pJob->mpParent = pParent;
+	pJob->mpName = pName;
+	pJob->mUnfinishedJobs.store(1, std::memory_order_relaxed);
+	pJob->mHasException.store(false, std::memory_order_relaxed);
+	pJob->mpException = std::exception_ptr();
+	if(dataSize > 0)
+	{
+		memcpy(pJob->mData, pData, dataSize);
+	}
+
+	return pJob;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	If this thread's deque is full, pJob is executed before Run returns instead of being queued.
+*/
+void DSThreading::JobSystem::Run(DSThreading::Job* pJob)
+{
+	assert(tThreadIndex != kUnregistered);
+
+	if(sThreadData[tThreadIndex].load(std::memory_order_relaxed)->mDeque.Push(pJob) == false)
+	{
+		Execute(pJob);
+		return;
+	}
+	sWakeCondition.notify_one();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Returns once pJob and all of its children have finished, executing other jobs in the meantime.
+	Rethrows the first exception thrown by pJob or any of its children.
+Notes:
+	pJob can be handed out again as soon as it has finished, so wait on it before then, or from the thread that created it before that thread creates more jobs.
+*/
+void DSThreading::JobSystem::Wait(const DSThreading::Job* pJob)
+{
+	assert(tThreadIndex != kUnregistered);
+
+	pJob->mWaiters.fetch_add(1);
+
+	while(GetIsFinished(pJob) == false)
+	{
+		DSThreading::Job* pOther = GetJob();
+		if(pOther != nullptr)
+		{
+			Execute(pOther);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	std::exception_ptr pException;
+	if(pJob->mHasException.load(std::memory_order_acquire) == true)
+	{
+		pException = pJob->mpException;
+	}
+
+	pJob->mWaiters.fetch_sub(1);
+
+	if(pException != nullptr)
+	{
+		std::rethrow_exception(pException);
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSThreading::JobSystem::GetIsFinished(const DSThreading::Job* pJob)
+{
+	return pJob->mUnfinishedJobs.load(std::memory_order_acquire) <= 0;
+}
+
+//-----------------------------------------------------------------------------
+//  Algorithms
+
+/*
+Description:
+	Calls pFunction over [begin, end) in chunks of at most grainSize, spread across every thread, and returns when all chunks are done.
+	The range is split in halves recursively, so idle threads steal large pieces and the split itself is done in parallel.
+	pFunction is called concurrently and must only write data belonging to its own chunk.
+*/
+void DSThreading::JobSystem::ParallelFor(const char* pName, unsigned int begin, unsigned int end, unsigned int grainSize, DSThreading::ParallelForFunction pFunction, void* pUserData)
+{
+	if(begin >= end)
+	{
+		return;
+	}
+	if(grainSize == 0)
+	{
+		grainSize = 1;
+	}
+
+	//Not worth a job
+	if(end - begin <= grainSize)
+	{
+		DSProfiling::ScopedZone zone(pName);
+		pFunction(begin, end, pUserData);
+		return;
+	}
+
+	ParallelForData data;
+	data.mBegin = begin;
+	data.mEnd = end;
+	data.mGrainSize = grainSize;
+	data.mpFunction = pFunction;
+	data.mpUserData = pUserData;
+	data.mpName = pName;
+
+	DSThreading::Job* pRoot = CreateJob(pName, ParallelForJob, &data, sizeof(data));
+	Run(pRoot);
+	Wait(pRoot);
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+unsigned int DSThreading::JobSystem::GetThreadCount()
+{
+	return sThreadCount.load();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	A grain size that splits count items into about kChunksPerThread chunks per thread.
+	For ParallelFor over coarse items (eg. file chunks or entity chunks), where a grain size of 1 would make two jobs per item.
+*/
+unsigned int DSThreading::JobSystem::GetGrainSize(unsigned int count)
+{
+	unsigned int chunkCount = GetThreadCount() * kChunksPerThread;
+	if(chunkCount == 0)
+	{
+		return count > 0 ? count : 1;
+	}
+
+	unsigned int grainSize = (count + chunkCount - 1) / chunkCount;
+	return grainSize > 0 ? grainSize : 1;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helpers
+
+void DSThreading::JobSystem::WorkerThread(unsigned int threadIndex)
+{
+	tThreadIndex = threadIndex;
+	tRandomState = threadIndex * 2654435761u + 1;
+
+	char name[32];
+	sprintf_s(name, sizeof(name), "Worker %u", threadIndex);
+	DSProfiling::Profiler::SetThreadName(name);
+
+	while(sIsRunning.load(std::memory_order_relaxed) == true)
+	{
+		DSThreading::Job* pJob = GetJob();
+		if(pJob != nullptr)
+		{
+			Execute(pJob);
+		}
+		else
+		{
+			//Nothing to do. Sleep until Run wakes a worker, but never for long, in case a wake-up was missed.
+			std::unique_lock<std::mutex> lock(sWakeMutex);
+			sWakeCondition.wait_for(lock, std::chrono::milliseconds(1));
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Hands out the next job in this thread's ring that has finished and that nobody is waiting on.
+	If every job is still alive, runs other jobs (which are what the live ones are waiting for) until one is free.
+*/
+DSThreading::Job* DSThreading::JobSystem::AllocateJob()
+{
+	assert(tThreadIndex != kUnregistered);
+
+	ThreadData* pThreadData = sThreadData[tThreadIndex].load(std::memory_order_relaxed);
+	for(;;)
+	{
+		for(unsigned int i = 0; i < kMaxJobsPerThread; ++i)
+		{
+			DSThreading::Job* pJob = &pThreadData->mJobs[pThreadData->mNextJob & kJobMask];
+			++pThreadData->mNextJob;
+
+			if(GetIsFinished(pJob) == true && pJob->mWaiters.load() == 0)
+			{
+				return pJob;
+			}
+		}
+
+		DSThreading::Job* pOther = GetJob();
+		if(pOther != nullptr)
+		{
+			Execute(pOther);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Pops the newest job from this thread's own deque, or failing that, steals the oldest job from a random other thread.
+*/
+DSThreading::Job* DSThreading::JobSystem::GetJob()
+{
+	DSThreading::Job* pJob = sThreadData[tThreadIndex].load(std::memory_order_relaxed)->mDeque.Pop();
+	if(pJob != nullptr)
+	{
+		return pJob;
+	}
+
+	unsigned int threadCount = sThreadCount.load(std::memory_order_acquire);
+	if(threadCount <= 1)
+	{
+		return nullptr;
+	}
+
+	//Try every other thread once, starting at a random one so thieves spread out
+	unsigned int start = NextRandom() % threadCount;
+	for(unsigned int i = 0; i < threadCount; ++i)
+	{
+		unsigned int victim = (start + i) % threadCount;
+		ThreadData* pVictim = sThreadData[victim].load(std::memory_order_acquire);
+		if(victim == tThreadIndex || pVictim == nullptr)
+		{
+			continue;
+		}
+
+		pJob = pVictim->mDeque.Steal();
+		if(pJob != nullptr)
+		{
+			return pJob;
+		}
+	}
+
+	return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	An exception is handed to the job and to every parent above it, while they are all certain to be alive, so that whichever of them is waited on rethrows it.
+	It never reaches the worker thread, which would terminate the process.
+*/
+void DSThreading::JobSystem::Execute(DSThreading::Job* pJob)
+{
+	try
+	{
+		DSProfiling::ScopedZone zone(pJob->mpName);
+		pJob->mpFunction(pJob, pJob->mData);
+	}
+	catch(...)
+	{
+		std::exception_ptr pException = std::current_exception();
+		for(DSThreading::Job* pOwner = pJob; pOwner != nullptr; pOwner = pOwner->mpParent)
+		{
+			//The first exception wins
+			bool hasException = false;
+			if(pOwner->mHasException.compare_exchange_strong(hasException, true) == true)
+			{
+				pOwner->mpException = pException;
+			}
+		}
+	}
+	Finish(pJob);
+}
+
+//-----------------------------------------------------------------------------
+
+void DSThreading::JobSystem::Finish(DSThreading::Job* pJob)
+{
+	//Read first, since a finished job can be handed out again straight away
+	DSThreading::Job* pParent = pJob->mpParent;
+
+	int unfinishedJobs = pJob->mUnfinishedJobs.fetch_sub(1, std::memory_order_acq_rel) - 1;
+	if(unfinishedJobs == 0 && pParent != nullptr)
+	{
+		Finish(pParent);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Helper Functions
+//-----------------------------------------------------------------------------
+
+static void ParallelForJob(DSThreading::Job* pJob, const void* pData)
+{
+	const ParallelForData& data = *static_cast<const ParallelForData*>(pData);
+
+	unsigned int count = data.mEnd - data.mBegin;
+	if(count > data.mGrainSize)
+	{
+		//Split in half, each half becoming a child of this job
+		ParallelForData left = data;
+		ParallelForData right = data;
+		left.mEnd = data.mBegin + count / 2;
+		right.mBegin = left.mEnd;
+
+		DSThreading::JobSystem::Run(DSThreading::JobSystem::CreateChildJob(pJob, data.mpName, ParallelForJob, &left, sizeof(left)));
+		DSThreading::JobSystem::Run(DSThreading::JobSystem::CreateChildJob(pJob, data.mpName, ParallelForJob, &right, sizeof(right)));
+	}
+	else
+	{
+		data.mpFunction(data.mBegin, data.mEnd, data.mpUserData);
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+//xorshift32
+static unsigned int NextRandom()
+{
+	tRandomState ^= tRandomState << 13;
+	tRandomState ^= tRandomState >> 17;
+	tRandomState ^= tRandomState << 5;
+	return tRandomState;
+}
\ No newline at end of file
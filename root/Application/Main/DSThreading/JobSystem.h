@@ -0,0 +1,125 @@
+//=============================================================================
+// File:		JobSystem.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	JobSystem. Work-stealing job scheduler shared by every engine subsystem that wants to use more than one core.
+//=============================================================================
+
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <atomic>
+#include <exception>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSThreading
+{
+
+	//=============================================================================
+	//Forward Declarations
+	//=============================================================================
+
+	struct Job;
+
+	//=============================================================================
+	//Typedefs
+	//=============================================================================
+
+	typedef void (*JobFunction)(Job* pJob, const void* pData);
+	typedef void (*ParallelForFunction)(unsigned int begin, unsigned int end, void* pUserData);
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	/*
+	Notes:
+		A job counts as unfinished until its own function has returned and every child created with it as parent has finished.
+		Waiting on a parent is therefore how dependencies are expressed: make the dependent work wait on (or be spawned after) the parent.
+		Small arguments are copied into mData, so creating a job never allocates.
+		A job may throw. The first exception thrown by a job or any of its children is kept, and Wait on that job rethrows it once everything has finished.
+		An exception thrown by a job that nobody waits on, and that has no parent, is lost.
+	*/
+	struct Job
+	{
+		static const unsigned int kDataSize = 80;
+
+		JobFunction mpFunction;
+		Job* mpParent;
+		const char* mpName;//profiler zone name
+		std::atomic<int> mUnfinishedJobs;
+		mutable std::atomic<int> mWaiters;//threads in Wait on this job, which keep it from being handed out again
+		std::atomic<bool> mHasException;
+		std::exception_ptr mpException;//only valid once mHasException is set and the job has finished
+		char mData[kDataSize];
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Notes:
+		Every participating thread (the main thread, the workers, and any other thread that calls RegisterThread) owns a job pool and a deque.
+		A thread pushes and pops its own deque from the bottom (newest first, which keeps caches warm),
+		and idle threads steal from the top of other threads' deques (oldest first, which are usually the biggest pieces of work).
+		Wait() executes other jobs rather than blocking, so the waiting thread helps finish the work it is waiting for.
+		Each thread's pool is a ring of kMaxJobsPerThread jobs. A job is only handed out again once it has finished and nobody is waiting on it;
+		if every job in the ring is alive, creating one runs other jobs until one is free. A job run while its thread's deque is full is executed on the spot.
+		ParallelFor makes about two jobs per chunk, so ranges of many cheap items want a grain size of more than one (see GetGrainSize).
+	*/
+	class JobSystem
+	{
+	private:
+		//Constructors
+		JobSystem();
+
+		//Member Functions
+	public:
+		// General
+		static void Initialize(unsigned int workerCount = 0);
+		static void Terminate();
+		static void RegisterThread(const char* pName);
+
+		// Jobs
+		static Job* CreateJob(const char* pName, JobFunction pFunction);
+		static Job* CreateJob(const char* pName, JobFunction pFunction, const void* pData, unsigned int dataSize);
+		static Job* CreateChildJob(Job* pParent, const char* pName, JobFunction pFunction, const void* pData, unsigned int dataSize);
+		static void Run(Job* pJob);
+		static void Wait(const Job* pJob);
+		static bool GetIsFinished(const Job* pJob);
+
+		// Algorithms
+		static void ParallelFor(const char* pName, unsigned int begin, unsigned int end, unsigned int grainSize, ParallelForFunction pFunction, void* pUserData);
+
+		// Getters
+		static unsigned int GetThreadCount();
+		static unsigned int GetGrainSize(unsigned int count);
+
+	private:
+		// Helpers
+		static void WorkerThread(unsigned int threadIndex);
+		static Job* AllocateJob();
+		static Job* GetJob();
+		static void Execute(Job* pJob);
+		static void Finish(Job* pJob);
+
+	public:
+		//Member Variables
+		static const unsigned int kMaxThreads = 64;
+		static const unsigned int kMaxJobsPerThread = 4096;//must be a power of two
+		static const unsigned int kChunksPerThread = 4;//what GetGrainSize aims for, so that uneven chunks still balance
+	};
+
+}//namespace DSThreading
+
+#endif //#ifndef JOBSYSTEM_H
\ No newline at end of file
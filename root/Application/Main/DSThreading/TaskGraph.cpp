@@ -0,0 +1,376 @@
+//=============================================================================
+// File:		TaskGraph.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	TaskGraph
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <algorithm>
+#include <stdexcept>
+#include <stdio.h>
+#include <utility>
+
+// Daniel Schenker
+#include "TaskGraph.h"
+#include "JobSystem.h"
+#include "../DSProfiling/Profiler.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	//What a task's job carries in Job::mData
+	struct TaskJobData
+	{
+		DSThreading::TaskGraph* mpGraph;
+		unsigned int mTask;
+	};
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSThreading::TaskGraph::TaskGraph()
+:	mUnfinishedCount(0)
+,	mIsInline(false)
+,	mStartTicks(0)
+,	mEndTicks(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Adds a task and returns its index, for AddDependency.
+Variables:
+	pName = shown by the profiler and the report. Must outlive the graph.
+	thread = kTaskContextThread for anything that uses OpenGL.
+*/
+unsigned int DSThreading::TaskGraph::Add(const char* pName, DSThreading::TaskFunction pFunction, void* pUserData, DSThreading::TaskThread thread)
+{
+	Task task;
+	task.mpName = pName;
+	task.mpFunction = pFunction;
+	task.mpUserData = pUserData;
+	task.mThread = thread;
+	task.mWaitingFor = 0;
+	task.mStartTicks = 0;
+	task.mEndTicks = 0;
+	task.mIsOnContextThread = false;
+	task.mIsSkipped = false;
+	mTasks.push_back(task);
+	return static_cast<unsigned int>(mTasks.size() - 1);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	task won't start until prerequisite has finished.
+*/
+void DSThreading::TaskGraph::AddDependency(unsigned int task, unsigned int prerequisite)
+{
+	if(task >= mTasks.size() || prerequisite >= mTasks.size() || task == prerequisite)
+	{
+		throw std::runtime_error("ERROR: TaskGraph::AddDependency was given an invalid task.");
+	}
+
+	mTasks[task].mPrerequisites.push_back(prerequisite);
+	mTasks[prerequisite].mDependents.push_back(task);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Runs every task, returning once they have all finished. Call on the context thread, with the job system initialized.
+Notes:
+	A graph is run once; adding tasks afterwards and running it again runs everything again.
+*/
+void DSThreading::TaskGraph::Run()
+{
+	//A cycle would never finish, so it is caught before anything starts (by checking that every task can be ordered)
+	{
+		std::vector<unsigned int> waitingFor(mTasks.size());
+		std::vector<unsigned int> ready;
+		for(unsigned int i = 0; i < mTasks.size(); ++i)
+		{
+			waitingFor[i] = static_cast<unsigned int>(mTasks[i].mPrerequisites.size());
+			if(waitingFor[i] == 0)
+			{
+				ready.push_back(i);
+			}
+		}
+
+		size_t orderedCount = 0;
+		while(ready.empty() == false)
+		{
+			unsigned int task = ready.back();
+			ready.pop_back();
+			++orderedCount;
+			for(size_t i = 0; i < mTasks[task].mDependents.size(); ++i)
+			{
+				if(--waitingFor[mTasks[task].mDependents[i]] == 0)
+				{
+					ready.push_back(mTasks[task].mDependents[i]);
+				}
+			}
+		}
+
+		if(orderedCount != mTasks.size())
+		{
+			throw std::runtime_error("ERROR: TaskGraph has a dependency cycle.");
+		}
+	}
+
+	mIsInline = DSThreading::JobSystem::GetThreadCount() <= 1;
+	mUnfinishedCount = static_cast<unsigned int>(mTasks.size());
+	mpException = std::exception_ptr();
+	mContextQueue.clear();
+	for(size_t i = 0; i < mTasks.size(); ++i)
+	{
+		mTasks[i].mWaitingFor = static_cast<unsigned int>(mTasks[i].mPrerequisites.size());
+		mTasks[i].mIsSkipped = false;
+	}
+
+	mStartTicks = DSProfiling::Profiler::GetTicks();
+	for(unsigned int i = 0; i < mTasks.size(); ++i)
+	{
+		if(mTasks[i].mPrerequisites.empty() == true)
+		{
+			Dispatch(i);
+		}
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		while(mUnfinishedCount > 0)
+		{
+			if(mContextQueue.empty() == true)
+			{
+				mCondition.wait(lock);
+				continue;
+			}
+
+			unsigned int task = mContextQueue.front();
+			mContextQueue.pop_front();
+			lock.unlock();
+			Execute(task, true);
+			Finish(task);
+			lock.lock();
+		}
+	}
+	mEndTicks = DSProfiling::Profiler::GetTicks();
+
+	if(mpException != nullptr)
+	{
+		std::rethrow_exception(mpException);
+	}
+}
+
+//-----------------------------------------------------------------------------
+//  Reports
+
+/*
+Description:
+	Prints every task in the order they started, then the critical path: the chain of dependent tasks that decided the total time.
+	Shortening anything off the critical path doesn't make the graph finish any sooner.
+*/
+void DSThreading::TaskGraph::PrintReport(const char* pTitle) const
+{
+	printf("%s: %.2f ms on %u threads\n", pTitle, GetElapsedMs(), DSThreading::JobSystem::GetThreadCount());
+	if(mTasks.empty() == true)
+	{
+		return;
+	}
+
+	std::vector<std::pair<unsigned long long, unsigned int> > order;
+	for(unsigned int i = 0; i < mTasks.size(); ++i)
+	{
+		order.push_back(std::make_pair(mTasks[i].mStartTicks, i));
+	}
+	std::sort(order.begin(), order.end());
+
+	printf("  %-32s %-8s %10s %10s\n", "Task", "Thread", "Start (ms)", "Time (ms)");
+	for(size_t i = 0; i < order.size(); ++i)
+	{
+		const Task& task = mTasks[order[i].second];
+		printf("  %-32s %-8s %10.2f %10.2f%s\n", task.mpName, task.mIsOnContextThread == true ? "context" : "worker",
+			DSProfiling::Profiler::TicksToMs(task.mStartTicks - mStartTicks), DSProfiling::Profiler::TicksToMs(task.mEndTicks - task.mStartTicks),
+			task.mIsSkipped == true ? " (skipped)" : "");
+	}
+
+	//Back from whichever task finished last, each time through the prerequisite that finished last (the one it was really waiting for)
+	std::vector<unsigned int> path;
+	unsigned int task = 0;
+	for(unsigned int i = 1; i < mTasks.size(); ++i)
+	{
+		if(mTasks[i].mEndTicks > mTasks[task].mEndTicks)
+		{
+			task = i;
+		}
+	}
+	while(true)
+	{
+		path.push_back(task);
+		const std::vector<unsigned int>& prerequisites = mTasks[task].mPrerequisites;
+		if(prerequisites.empty() == true)
+		{
+			break;
+		}
+
+		unsigned int latest = prerequisites[0];
+		for(size_t i = 1; i < prerequisites.size(); ++i)
+		{
+			if(mTasks[prerequisites[i]].mEndTicks > mTasks[latest].mEndTicks)
+			{
+				latest = prerequisites[i];
+			}
+		}
+		task = latest;
+	}
+
+	unsigned long long pathTicks = 0;
+	for(size_t i = 0; i < path.size(); ++i)
+	{
+		pathTicks += mTasks[path[i]].mEndTicks - mTasks[path[i]].mStartTicks;
+	}
+
+	printf("  Critical path (%.2f ms of work, the rest is waiting for a thread):\n", DSProfiling::Profiler::TicksToMs(pathTicks));
+	for(size_t i = path.size(); i > 0; --i)
+	{
+		const Task& step = mTasks[path[i - 1]];
+		printf("    %-30s %10.2f\n", step.mpName, DSProfiling::Profiler::TicksToMs(step.mEndTicks - step.mStartTicks));
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	How long the last Run took, from dispatching the first tasks to the last one finishing.
+*/
+double DSThreading::TaskGraph::GetElapsedMs() const
+{
+	return DSProfiling::Profiler::TicksToMs(mEndTicks - mStartTicks);
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helpers
+
+void DSThreading::TaskGraph::TaskJob(DSThreading::Job* /*pJob*/, const void* pData)
+{
+	const TaskJobData* pTaskData = static_cast<const TaskJobData*>(pData);
+	pTaskData->mpGraph->Execute(pTaskData->mTask, false);
+	pTaskData->mpGraph->Finish(pTaskData->mTask);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Starts a task whose prerequisites have all finished: as a job, or by queueing it for the context thread.
+*/
+void DSThreading::TaskGraph::Dispatch(unsigned int task)
+{
+	if(mTasks[task].mThread == kTaskContextThread || mIsInline == true)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mContextQueue.push_back(task);
+		mCondition.notify_all();
+		return;
+	}
+
+	TaskJobData data;
+	data.mpGraph = this;
+	data.mTask = task;
+	DSThreading::JobSystem::Run(DSThreading::JobSystem::CreateJob(mTasks[task].mpName, TaskJob, &data, sizeof(data)));
+}
+
+//-----------------------------------------------------------------------------
+
+void DSThreading::TaskGraph::Execute(unsigned int task, bool isOnContextThread)
+{
+	Task& current = mTasks[task];
+
+	bool isSkipped;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		isSkipped = mpException != nullptr;
+	}
+
+	current.mIsOnContextThread = isOnContextThread;
+	current.mIsSkipped = isSkipped;
+	current.mStartTicks = DSProfiling::Profiler::GetTicks();
+	if(isSkipped == false)
+	{
+		try
+		{
+			DSProfiling::ScopedZone zone(current.mpName);
+			current.mpFunction(current.mpUserData);
+		}
+		catch(...)
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if(mpException == nullptr)
+			{
+				mpException = std::current_exception();
+			}
+		}
+	}
+	current.mEndTicks = DSProfiling::Profiler::GetTicks();
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Run may return (and the graph be destroyed) as soon as the last task is counted as finished, so nothing is touched after that.
+*/
+void DSThreading::TaskGraph::Finish(unsigned int task)
+{
+	std::vector<unsigned int> ready;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		const std::vector<unsigned int>& dependents = mTasks[task].mDependents;
+		for(size_t i = 0; i < dependents.size(); ++i)
+		{
+			if(--mTasks[dependents[i]].mWaitingFor == 0)
+			{
+				ready.push_back(dependents[i]);
+			}
+		}
+	}
+
+	for(size_t i = 0; i < ready.size(); ++i)
+	{
+		Dispatch(ready[i]);
+	}
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	if(--mUnfinishedCount == 0)
+	{
+		mCondition.notify_all();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+//=============================================================================
+// File:		TaskGraph.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	TaskGraph. A one-shot dependency graph of named tasks, run on the job system, with the steps that need the OpenGL context kept on the thread that owns it.
+//=============================================================================
+
+#ifndef TASKGRAPH_H
+#define TASKGRAPH_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSThreading
+{
+
+	//=============================================================================
+	//Forward Declarations
+	//=============================================================================
+
+	struct Job;
+
+	//=============================================================================
+	//Typedefs
+	//=============================================================================
+
+	typedef void (*TaskFunction)(void* pUserData);
+
+	//=============================================================================
+	//Enums
+	//=============================================================================
+
+	enum TaskThread
+	{
+		kTaskAnyThread,//run as a job on whichever thread gets to it first
+		kTaskContextThread//run on the thread that called Run (the one that owns the OpenGL context)
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Each task starts as soon as every task it depends on has finished, so independent work overlaps
+		and the total time approaches the longest chain of dependent tasks (the critical path) rather than the sum of them all.
+		Every task is timed, and PrintReport shows when each one ran, for how long and on which thread, followed by the critical path.
+	Usage:
+		DSThreading::TaskGraph graph;
+		unsigned int pack = graph.Add("Resource Pack", LoadPack, this);
+		unsigned int shaders = graph.Add("Shaders", LoadShaders, this, DSThreading::kTaskContextThread);
+		unsigned int meshes = graph.Add("Meshes", LoadMeshes, this);
+		graph.AddDependency(meshes, pack);
+		graph.Run();
+		graph.PrintReport("Startup");
+	Notes:
+		Run blocks, running the context thread's tasks itself and sleeping while there are none.
+		Without worker threads every task runs on the context thread, in an order that still respects the dependencies.
+		If a task throws, tasks that haven't started yet are skipped, and Run rethrows the first exception once the running ones have finished.
+		Tasks may use the job system themselves (eg. ParallelFor), but must not wait on the context thread.
+	*/
+	class TaskGraph
+	{
+	public:
+		//Constructors
+		TaskGraph();
+
+	private:
+		//Disable Copy Constructor
+		TaskGraph(const TaskGraph&);
+		const TaskGraph& operator=(const TaskGraph&);
+
+		//Member Functions
+	public:
+		// General
+		unsigned int Add(const char* pName, DSThreading::TaskFunction pFunction, void* pUserData, DSThreading::TaskThread thread = kTaskAnyThread);
+		void AddDependency(unsigned int task, unsigned int prerequisite);
+		void Run();
+
+		// Reports
+		void PrintReport(const char* pTitle) const;
+
+		// Getters
+		double GetElapsedMs() const;
+
+	private:
+		// Helpers
+		static void TaskJob(DSThreading::Job* pJob, const void* pData);
+		void Dispatch(unsigned int task);
+		void Execute(unsigned int task, bool isOnContextThread);
+		void Finish(unsigned int task);
+
+		//Structs
+		struct Task
+		{
+			const char* mpName;
+			DSThreading::TaskFunction mpFunction;
+			void* mpUserData;
+			DSThreading::TaskThread mThread;
+			std::vector<unsigned int> mPrerequisites;
+			std::vector<unsigned int> mDependents;
+			unsigned int mWaitingFor;//prerequisites that haven't finished yet, while running
+			unsigned long long mStartTicks;
+			unsigned long long mEndTicks;
+			bool mIsOnContextThread;
+			bool mIsSkipped;
+		};
+
+		//Member Variables
+		std::vector<Task> mTasks;
+		std::mutex mMutex;//guards everything below, and each task's mWaitingFor
+		std::condition_variable mCondition;//signalled when a context task is ready or the last task has finished
+		std::deque<unsigned int> mContextQueue;
+		unsigned int mUnfinishedCount;
+		std::exception_ptr mpException;
+		bool mIsInline;//no worker threads: every task goes through mContextQueue
+		unsigned long long mStartTicks;
+		unsigned long long mEndTicks;
+	};
+
+}//namespace DSThreading
+
+#endif //#ifndef TASKGRAPH_H
\ No newline at end of file
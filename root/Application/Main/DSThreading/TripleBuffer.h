@@ -0,0 +1,95 @@
+//=============================================================================
+// File:		TripleBuffer.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	TripleBuffer. Lock-free hand-off of the latest value from one producer thread to one consumer thread.
+//=============================================================================
+
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <atomic>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSThreading
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Three copies of T: one being written by the producer, one being read by the consumer, and one shared between them holding the latest published value.
+		Publishing swaps the written copy with the shared one, and acquiring swaps the shared copy with the read one if it is newer.
+		Neither side ever waits for the other. The consumer may skip values (it only ever sees the latest), and may see the same value more than once.
+	Usage:
+		Producer:	Fill GetWriteBuffer() completely, then Publish().
+		Consumer:	Acquire() returns the newest published value, which stays valid and unchanged until the next Acquire().
+	Notes:
+		Defined in the header since it is a template.
+	*/
+	template<typename T>
+	class TripleBuffer
+	{
+	public:
+		//Constructors
+		TripleBuffer()
+		:	mShared(1)
+		,	mWrite(0)
+		,	mRead(2)
+		{
+		}
+
+	private:
+		//Disable Copy Constructor
+		TripleBuffer(const TripleBuffer&);
+		const TripleBuffer& operator=(const TripleBuffer&);
+
+		//Member Functions
+	public:
+		// Producer
+		T& GetWriteBuffer()
+		{
+			return mBuffers[mWrite];
+		}
+
+		void Publish()
+		{
+			mWrite = mShared.exchange(mWrite | kNewData, std::memory_order_acq_rel) & kIndexMask;
+		}
+
+		// Consumer
+		const T& Acquire()
+		{
+			if((mShared.load(std::memory_order_relaxed) & kNewData) != 0)
+			{
+				mRead = mShared.exchange(mRead, std::memory_order_acq_rel) & kIndexMask;
+			}
+
+			return mBuffers[mRead];
+		}
+
+		//Member Variables
+	private:
+		static const unsigned int kIndexMask = 3;
+		static const unsigned int kNewData = 4;
+
+		T mBuffers[3];
+		std::atomic<unsigned int> mShared;//index of the shared buffer, plus kNewData if the producer published since the consumer last acquired
+		unsigned int mWrite;//producer only
+		unsigned int mRead;//consumer only
+	};
+
+}//namespace DSThreading
+
+#endif //#ifndef TRIPLEBUFFER_H
\ No newline at end of file
@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		Main.cpp
 // Created:		2015/01/28
-// Last Edited:	2015/03/01
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 //				All files in this solution are copyright Daniel Schenker.
 //				Please contact Daniel Schenker at D.A.Schenker@gmail.com to request file usage.
@@ -24,12 +24,9 @@
 //=============================================================================
 int main()
 {
-	//Allocating entire application here for when I create a memory manager in the future
-	Application* pApp= new Application();
-	if(pApp != nullptr)
+	//The application runs entirely within its constructor and destructor, so it can live on the stack
 	{
-		delete pApp;
-		pApp = nullptr;
+		Application app;
 	}
 
 	return 0;
@@ -0,0 +1,38 @@
+//=============================================================================
+// File:		Components.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Components that the game's entities are made of, besides DSGraphics::ModelInstance and DSPhysics::RigidBody.
+//=============================================================================
+
+#ifndef COMPONENTS_H
+#define COMPONENTS_H
+
+//=============================================================================
+//Structs
+//=============================================================================
+
+//Tags
+// Empty, so they take no room in chunks; they only sort entities into the categories instances used to be listed by.
+struct AbstractTag
+{
+};
+
+struct AestheticTag
+{
+};
+
+struct EnvironmentalTag
+{
+};
+
+struct PlayerTag
+{
+};
+
+struct UnitTag
+{
+};
+
+#endif //#ifndef COMPONENTS_H
\ No newline at end of file
@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		Wall.h
 // Created:		2015/02/27
-// Last Edited:	2015/02/27
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	Object > Environmental > Wall.
 //=============================================================================
@@ -41,10 +41,11 @@ public:
 
 	//Member Functions
 public:
-	virtual void LoadAsset(DSGraphics::Program* pProgram, DSGraphics::Texture* pTexture = nullptr);
+	virtual void LoadAsset(DSGraphics::ProgramHandle program, DSGraphics::TextureHandle texture = DSGraphics::TextureHandle(), const DSGraphics::MeshFile* pMesh = nullptr);
 private:
 public:
 	// Getters
+	static const char* GetMeshFile();
 	// Setters
 
 	//Member Variables
@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		Object.cpp
 // Created:		2015/02/27
-// Last Edited:	2015/02/27
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	Object is abstract class which is a parent of all object types.
 //=============================================================================
@@ -28,7 +28,7 @@ float Object::sDCPerM = 0.01f;//Device Coordinates / meter
 //-----------------------------------------------------------------------------
 
 Object::Object()
-:	mpModelAsset(nullptr)
+:	mModelAsset()
 ,	mIsModelAssetLoaded(false)
 {
 }
@@ -39,6 +39,7 @@ Object::Object()
 
 Object::~Object()
 {
+	DSGraphics::AssetManager::Release(mModelAsset);
 }
 
 //-----------------------------------------------------------------------------
@@ -57,9 +58,9 @@ Object::~Object()
 // Getters
 //-----------------------------------------------------------------------------
 
-DSGraphics::ModelAsset* Object::GetModelAsset()
+DSGraphics::ModelHandle Object::GetModelAsset()
 {
-	return mpModelAsset;
+	return mModelAsset;
 }
 
 //-----------------------------------------------------------------------------
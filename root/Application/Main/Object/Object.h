@@ -1,7 +1,7 @@
 //=============================================================================
 // File:		Object.h
 // Created:		2015/02/27
-// Last Edited:	2015/02/27
+// Last Edited:	2026/10/19
 // Copyright:	Daniel Schenker
 // Description:	Object is abstract class which is a parent of all object types.
 //=============================================================================
@@ -13,6 +13,7 @@
 //Includes
 //=============================================================================
 
+#include "../DSGraphics/AssetManager.h"
 #include "../DSGraphics/ModelAsset.h"
 
 //=============================================================================
@@ -41,10 +42,10 @@ protected:
 
 	//Member Functions
 protected:
-	virtual void LoadAsset(DSGraphics::Program* pProgram, DSGraphics::Texture* pTexture = nullptr) = 0;//TODO: Change pTexture to a STL container that knows how many textures are being passed in
+	virtual void LoadAsset(DSGraphics::ProgramHandle program, DSGraphics::TextureHandle texture = DSGraphics::TextureHandle(), const DSGraphics::MeshFile* pMesh = nullptr) = 0;//TODO: Change texture to a STL container that knows how many textures are being passed in
 public:
 	// Getters
-	DSGraphics::ModelAsset* GetModelAsset();
+	DSGraphics::ModelHandle GetModelAsset();
 	bool GetIsModelAssetLoaded();
 	// Setters
 
@@ -53,7 +54,7 @@ public:
 public:
 	static float sDCPerM;//Device Coordinates / meter
 protected:
-	DSGraphics::ModelAsset* mpModelAsset;//TODO: Change this to a smart pointer, in case misuse of ModelAsset occurs and the ModelAsset gets deleted before the ModelInstance pointing to the ModelAsset gets deleted.
+	DSGraphics::ModelHandle mModelAsset;//holds a reference (see DSGraphics::AssetManager), released when the object is deleted. ModelInstances of a model that has been unloaded draw nothing rather than crash.
 	bool mIsModelAssetLoaded;
 };
 
@@ -0,0 +1,696 @@
+//=============================================================================
+// File:		GltfImporter.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	GltfImporter
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLM
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+// Standard C++ Libraries
+#include <cstdint>
+#include <cstring>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+// Daniel Schenker
+#include "GltfImporter.h"
+#include "Json.h"
+#include "VertexWelder.h"
+#include "../Main/DSProfiling/Profiler.h"
+#include "../Main/DSSystem/MappedFile.h"
+#include "../Main/DSThreading/JobSystem.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	//GLB container
+	const uint32_t kGlbMagic = 0x46546C67;//"glTF"
+	const uint32_t kGlbChunkJson = 0x4E4F534A;//"JSON"
+	const uint32_t kGlbChunkBin = 0x004E4942;//"BIN\0"
+
+	//Accessor component types
+	const unsigned int kByte = 5120;
+	const unsigned int kUnsignedByte = 5121;
+	const unsigned int kShort = 5122;
+	const unsigned int kUnsignedShort = 5123;
+	const unsigned int kUnsignedInt = 5125;
+	const unsigned int kFloat = 5126;
+
+	const unsigned int kModeTriangles = 4;
+
+	//Vertices decoded per job
+	const unsigned int kDecodeGrainSize = 16384;
+
+	struct GltfBuffer
+	{
+		const unsigned char* mpData;
+		size_t mSize;
+	};
+
+	struct GltfDocument
+	{
+		DSMeshImporter::JsonValue mJson;
+		std::vector<GltfBuffer> mBuffers;
+		std::vector<std::vector<unsigned char> > mDecodedBuffers;//base64 buffers
+		std::vector<DSSystem::MappedFile*> mFiles;//external buffers
+		const unsigned char* mpGlbBin;
+		size_t mGlbBinSize;
+	};
+
+	//A validated view of an accessor's elements
+	struct AccessorView
+	{
+		const unsigned char* mpData;//first element
+		size_t mStride;//bytes between elements
+		unsigned int mCount;
+		unsigned int mComponents;
+		unsigned int mComponentType;
+		bool mIsNormalized;
+	};
+
+	struct DecodeData
+	{
+		AccessorView mPositions;
+		AccessorView mTexCoords;//mCount 0 if absent
+		AccessorView mColors;//mCount 0 if absent
+		glm::mat4 mWorld;
+		const DSMeshImporter::ImportOptions* mpOptions;
+		bool mHasTexCoords;//the mesh as a whole
+		unsigned int mFloatsPerVertex;
+		GLfloat* mpVertices;//output, mPositions.mCount vertices
+	};
+
+	//-----------------------------------------------------------------------------
+	//  Loading
+
+	unsigned int GetComponentCount(const std::string& type)
+	{
+		if(type == "SCALAR") return 1;
+		if(type == "VEC2") return 2;
+		if(type == "VEC3") return 3;
+		if(type == "VEC4") return 4;
+		return 0;
+	}
+
+	unsigned int GetComponentSize(unsigned int componentType)
+	{
+		switch(componentType)
+		{
+		case kByte:
+		case kUnsignedByte:
+			return 1;
+		case kShort:
+		case kUnsignedShort:
+			return 2;
+		case kUnsignedInt:
+		case kFloat:
+			return 4;
+		default:
+			return 0;
+		}
+	}
+
+	bool DecodeBase64(const char* pText, size_t length, std::vector<unsigned char>& bytes)
+	{
+		unsigned int accumulator = 0;
+		int bits = 0;
+		bytes.reserve(length * 3 / 4);
+		for(size_t i = 0; i < length; ++i)
+		{
+			char c = pText[i];
+			int value;
+			if(c >= 'A' && c <= 'Z') value = c - 'A';
+			else if(c >= 'a' && c <= 'z') value = c - 'a' + 26;
+			else if(c >= '0' && c <= '9') value = c - '0' + 52;
+			else if(c == '+') value = 62;
+			else if(c == '/') value = 63;
+			else if(c == '=') break;
+			else return false;
+
+			accumulator = (accumulator << 6) | static_cast<unsigned int>(value);
+			bits += 6;
+			if(bits >= 8)
+			{
+				bits -= 8;
+				bytes.push_back(static_cast<unsigned char>((accumulator >> bits) & 0xFF));
+			}
+		}
+		return true;
+	}
+
+	/*
+	Description:
+		Parses the JSON (from a .gltf, or the JSON chunk of a .glb) and resolves every buffer to memory.
+	*/
+	bool LoadDocument(const char* pPath, const DSSystem::MappedFile& file, GltfDocument& document)
+	{
+		const unsigned char* pData = file.GetData();
+		size_t size = file.GetSize();
+		const char* pJson = reinterpret_cast<const char*>(pData);
+		size_t jsonSize = size;
+		document.mpGlbBin = nullptr;
+		document.mGlbBinSize = 0;
+
+		// Binary container
+		uint32_t magic = 0;
+		if(size >= 12)
+		{
+			memcpy(&magic, pData, 4);
+		}
+		if(magic == kGlbMagic)
+		{
+			uint32_t header[3];
+			memcpy(header, pData, sizeof(header));
+			if(header[1] != 2 || header[2] > size)
+			{
+				fprintf(stderr, "WARNING: \"%s\" is not a valid glTF 2.0 binary.\n", pPath);
+				return false;
+			}
+
+			jsonSize = 0;
+			size_t offset = 12;
+			while(offset + 8 <= header[2])
+			{
+				uint32_t chunk[2];//length, type
+				memcpy(chunk, pData + offset, sizeof(chunk));
+				offset += 8;
+				if(chunk[0] > header[2] - offset)
+				{
+					fprintf(stderr, "WARNING: \"%s\" has a truncated chunk.\n", pPath);
+					return false;
+				}
+
+				if(chunk[1] == kGlbChunkJson && jsonSize == 0)
+				{
+					pJson = reinterpret_cast<const char*>(pData + offset);
+					jsonSize = chunk[0];
+				}
+				else if(chunk[1] == kGlbChunkBin && document.mpGlbBin == nullptr)
+				{
+					document.mpGlbBin = pData + offset;
+					document.mGlbBinSize = chunk[0];
+				}
+				//Padded in 64 bits, so a length near 4 GB cannot wrap the offset
+				uint64_t next = static_cast<uint64_t>(offset) + ((static_cast<uint64_t>(chunk[0]) + 3) & ~3ull);
+				if(next >= header[2])
+				{
+					break;
+				}
+				offset = static_cast<size_t>(next);
+			}
+			if(jsonSize == 0)
+			{
+				fprintf(stderr, "WARNING: \"%s\" has no JSON chunk.\n", pPath);
+				return false;
+			}
+		}
+
+		if(DSMeshImporter::JsonValue::Parse(pJson, jsonSize, document.mJson) == false)
+		{
+			fprintf(stderr, "WARNING: \"%s\" is not valid JSON.\n", pPath);
+			return false;
+		}
+
+		// Buffers
+		std::string directory(pPath);
+		size_t slash = directory.find_last_of("/\\");
+		directory = slash != std::string::npos ? directory.substr(0, slash + 1) : std::string();
+
+		const DSMeshImporter::JsonValue& buffers = document.mJson.Get("buffers");
+		document.mDecodedBuffers.resize(buffers.GetSize());
+		for(size_t i = 0; i < buffers.GetSize(); ++i)
+		{
+			const DSMeshImporter::JsonValue& buffer = buffers.GetElement(i);
+			const std::string& uri = buffer.Get("uri").GetString();
+			GltfBuffer view = {nullptr, 0};
+
+			if(uri.empty() == true)
+			{
+				//The GLB binary chunk
+				view.mpData = document.mpGlbBin;
+				view.mSize = document.mGlbBinSize;
+			}
+			else if(uri.compare(0, 5, "data:") == 0)
+			{
+				size_t comma = uri.find(";base64,");
+				if(comma == std::string::npos || DecodeBase64(uri.c_str() + comma + 8, uri.size() - comma - 8, document.mDecodedBuffers[i]) == false)
+				{
+					fprintf(stderr, "WARNING: Buffer %u of \"%s\" has an unsupported data URI.\n", static_cast<unsigned int>(i), pPath);
+					return false;
+				}
+				view.mpData = document.mDecodedBuffers[i].empty() == false ? &document.mDecodedBuffers[i][0] : nullptr;
+				view.mSize = document.mDecodedBuffers[i].size();
+			}
+			else
+			{
+				//Percent encoded URIs are not decoded; exporters rarely write them for plain file names
+				DSSystem::MappedFile* pFile = new DSSystem::MappedFile((directory + uri).c_str());
+				document.mFiles.push_back(pFile);
+				view.mpData = pFile->GetData();
+				view.mSize = pFile->GetSize();
+			}
+
+			size_t byteLength = buffer.Get("byteLength").GetUnsigned(0);
+			if(view.mpData == nullptr || view.mSize < byteLength)
+			{
+				fprintf(stderr, "WARNING: Buffer %u of \"%s\" is missing or shorter than its byteLength.\n", static_cast<unsigned int>(i), pPath);
+				return false;
+			}
+			document.mBuffers.push_back(view);
+		}
+
+		return true;
+	}
+
+	/*
+	Description:
+		Resolves an accessor to memory, checking that every element lies within its buffer.
+	*/
+	bool GetAccessor(const GltfDocument& document, unsigned int accessorIndex, AccessorView& view)
+	{
+		const DSMeshImporter::JsonValue& accessor = document.mJson.Get("accessors").GetElement(accessorIndex);
+		if(accessor.GetIsNull() == true)
+		{
+			return false;
+		}
+		if(accessor.Get("sparse").GetIsNull() == false)
+		{
+			fprintf(stderr, "WARNING: Sparse accessors are not supported. Skipping accessor %u.\n", accessorIndex);
+			return false;
+		}
+
+		view.mCount = accessor.Get("count").GetUnsigned(0);
+		view.mComponents = GetComponentCount(accessor.Get("type").GetString());
+		view.mComponentType = accessor.Get("componentType").GetUnsigned(0);
+		view.mIsNormalized = accessor.Get("normalized").GetBool(false);
+		unsigned int componentSize = GetComponentSize(view.mComponentType);
+		if(view.mComponents == 0 || componentSize == 0)
+		{
+			return false;
+		}
+
+		unsigned int bufferViewIndex = accessor.Get("bufferView").GetUnsigned(0xFFFFFFFF);
+		const DSMeshImporter::JsonValue& bufferView = document.mJson.Get("bufferViews").GetElement(bufferViewIndex);
+		unsigned int bufferIndex = bufferView.Get("buffer").GetUnsigned(0xFFFFFFFF);
+		if(bufferView.GetIsNull() == true || bufferIndex >= document.mBuffers.size())
+		{
+			//No buffer view means all zeros; nothing worth importing
+			return false;
+		}
+
+		size_t elementSize = static_cast<size_t>(view.mComponents) * componentSize;
+		size_t offset = static_cast<size_t>(bufferView.Get("byteOffset").GetUnsigned(0)) + accessor.Get("byteOffset").GetUnsigned(0);
+		size_t viewLength = bufferView.Get("byteLength").GetUnsigned(0);
+		view.mStride = bufferView.Get("byteStride").GetUnsigned(0);
+		if(view.mStride == 0)
+		{
+			view.mStride = elementSize;
+		}
+
+		const GltfBuffer& buffer = document.mBuffers[bufferIndex];
+		unsigned long long lastByte = offset + (view.mCount > 0 ? static_cast<unsigned long long>(view.mCount - 1) * view.mStride + elementSize : 0);
+		unsigned long long viewEnd = static_cast<unsigned long long>(bufferView.Get("byteOffset").GetUnsigned(0)) + viewLength;
+		if(lastByte > viewEnd || viewEnd > buffer.mSize)
+		{
+			fprintf(stderr, "WARNING: Accessor %u reads outside of its buffer.\n", accessorIndex);
+			return false;
+		}
+
+		view.mpData = buffer.mpData + offset;
+		return true;
+	}
+
+	//Reads component i of element as a float, normalizing integers if the accessor says to
+	float ReadComponent(const AccessorView& view, unsigned int element, unsigned int component)
+	{
+		const unsigned char* p = view.mpData + static_cast<size_t>(element) * view.mStride;
+		switch(view.mComponentType)
+		{
+		case kFloat:
+		{
+			float value;
+			memcpy(&value, p + component * 4, 4);
+			return value;
+		}
+		case kUnsignedByte:
+		{
+			float value = static_cast<float>(p[component]);
+			return view.mIsNormalized == true ? value / 255.0f : value;
+		}
+		case kByte:
+		{
+			float value = static_cast<float>(static_cast<signed char>(p[component]));
+			return view.mIsNormalized == true ? glm::max(value / 127.0f, -1.0f) : value;
+		}
+		case kUnsignedShort:
+		{
+			uint16_t raw;
+			memcpy(&raw, p + component * 2, 2);
+			return view.mIsNormalized == true ? raw / 65535.0f : static_cast<float>(raw);
+		}
+		case kShort:
+		{
+			int16_t raw;
+			memcpy(&raw, p + component * 2, 2);
+			return view.mIsNormalized == true ? glm::max(raw / 32767.0f, -1.0f) : static_cast<float>(raw);
+		}
+		case kUnsignedInt:
+		{
+			uint32_t raw;
+			memcpy(&raw, p + component * 4, 4);
+			return static_cast<float>(raw);
+		}
+		default:
+			return 0.0f;
+		}
+	}
+
+	GLuint ReadIndex(const AccessorView& view, unsigned int element)
+	{
+		const unsigned char* p = view.mpData + static_cast<size_t>(element) * view.mStride;
+		switch(view.mComponentType)
+		{
+		case kUnsignedByte:
+			return p[0];
+		case kUnsignedShort:
+		{
+			uint16_t index;
+			memcpy(&index, p, 2);
+			return index;
+		}
+		default://kUnsignedInt
+		{
+			uint32_t index;
+			memcpy(&index, p, 4);
+			return index;
+		}
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//  Jobs
+
+	/*
+	Description:
+		Writes vertices [begin, end) of a primitive in the output layout, in world space and scaled.
+	*/
+	void DecodeVertices(unsigned int begin, unsigned int end, void* pUserData)
+	{
+		const DecodeData& data = *static_cast<const DecodeData*>(pUserData);
+		const GLfloat* pDefaultColor = data.mpOptions->mDefaultColor;
+
+		for(unsigned int i = begin; i < end; ++i)
+		{
+			GLfloat* pVertex = data.mpVertices + static_cast<size_t>(i) * data.mFloatsPerVertex;
+
+			glm::vec4 position(ReadComponent(data.mPositions, i, 0), ReadComponent(data.mPositions, i, 1), ReadComponent(data.mPositions, i, 2), 1.0f);
+			position = data.mWorld * position;
+			*pVertex++ = position.x * data.mpOptions->mScale;
+			*pVertex++ = position.y * data.mpOptions->mScale;
+			*pVertex++ = position.z * data.mpOptions->mScale;
+
+			if(data.mHasTexCoords == true)
+			{
+				if(data.mTexCoords.mCount > 0)
+				{
+					*pVertex++ = ReadComponent(data.mTexCoords, i, 0);
+					*pVertex++ = 1.0f - ReadComponent(data.mTexCoords, i, 1);
+				}
+				else
+				{
+					*pVertex++ = 0.0f;
+					*pVertex++ = 0.0f;
+				}
+			}
+
+			if(data.mColors.mCount > 0)
+			{
+				*pVertex++ = ReadComponent(data.mColors, i, 0);
+				*pVertex++ = ReadComponent(data.mColors, i, 1);
+				*pVertex++ = ReadComponent(data.mColors, i, 2);
+				*pVertex++ = data.mColors.mComponents == 4 ? ReadComponent(data.mColors, i, 3) : 1.0f;
+			}
+			else
+			{
+				memcpy(pVertex, pDefaultColor, 4 * sizeof(GLfloat));
+			}
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+	//  Scene
+
+	glm::mat4 GetLocalMatrix(const DSMeshImporter::JsonValue& node)
+	{
+		const DSMeshImporter::JsonValue& matrix = node.Get("matrix");
+		if(matrix.GetSize() == 16)
+		{
+			float values[16];
+			for(unsigned int i = 0; i < 16; ++i)
+			{
+				values[i] = static_cast<float>(matrix.GetElement(i).GetNumber(0.0));
+			}
+			return glm::make_mat4(values);//both column major
+		}
+
+		const DSMeshImporter::JsonValue& t = node.Get("translation");
+		const DSMeshImporter::JsonValue& r = node.Get("rotation");
+		const DSMeshImporter::JsonValue& s = node.Get("scale");
+		glm::vec3 translation(t.GetElement(0).GetNumber(0.0), t.GetElement(1).GetNumber(0.0), t.GetElement(2).GetNumber(0.0));
+		glm::quat rotation(static_cast<float>(r.GetElement(3).GetNumber(1.0)), static_cast<float>(r.GetElement(0).GetNumber(0.0)), static_cast<float>(r.GetElement(1).GetNumber(0.0)), static_cast<float>(r.GetElement(2).GetNumber(0.0)));//w, x, y, z
+		glm::vec3 scale(s.GetElement(0).GetNumber(1.0), s.GetElement(1).GetNumber(1.0), s.GetElement(2).GetNumber(1.0));
+
+		return glm::translate(glm::mat4(1.0f), translation) * glm::mat4_cast(rotation) * glm::scale(glm::mat4(1.0f), scale);
+	}
+
+	struct MeshInstance
+	{
+		unsigned int mMesh;
+		glm::mat4 mWorld;
+	};
+
+	void CollectInstances(const DSMeshImporter::JsonValue& nodes, unsigned int nodeIndex, const glm::mat4& parent, unsigned int depth, std::vector<MeshInstance>& instances)
+	{
+		const DSMeshImporter::JsonValue& node = nodes.GetElement(nodeIndex);
+		if(node.GetIsNull() == true || depth > 256)//glTF node graphs must be trees, but don't trust that
+		{
+			return;
+		}
+
+		glm::mat4 world = parent * GetLocalMatrix(node);
+		if(node.Get("mesh").GetIsNull() == false)
+		{
+			MeshInstance instance;
+			instance.mMesh = node.Get("mesh").GetUnsigned(0);
+			instance.mWorld = world;
+			instances.push_back(instance);
+		}
+
+		const DSMeshImporter::JsonValue& children = node.Get("children");
+		for(size_t i = 0; i < children.GetSize(); ++i)
+		{
+			CollectInstances(nodes, children.GetElement(i).GetUnsigned(0xFFFFFFFF), world, depth + 1, instances);
+		}
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+bool DSMeshImporter::GltfImporter::Import(const char* pPath, const DSMeshImporter::ImportOptions& options, DSMeshImporter::ImportedMesh& mesh)
+{
+	DSSystem::MappedFile file(pPath);
+	if(file.GetIsMapped() == false)
+	{
+		return false;
+	}
+
+	GltfDocument document;
+	bool isLoaded;
+	{
+		DS_PROFILE_SCOPE("GltfImporter Load");
+		isLoaded = LoadDocument(pPath, file, document);
+	}
+
+	bool isImported = false;
+	if(isLoaded == true)
+	{
+		const DSMeshImporter::JsonValue& json = document.mJson;
+		const DSMeshImporter::JsonValue& meshes = json.Get("meshes");
+
+		//The default scene's mesh nodes, or every mesh untransformed if there are no scenes
+		std::vector<MeshInstance> instances;
+		const DSMeshImporter::JsonValue& scene = json.Get("scenes").GetElement(json.Get("scene").GetUnsigned(0));
+		if(scene.GetIsNull() == false)
+		{
+			const DSMeshImporter::JsonValue& roots = scene.Get("nodes");
+			for(size_t i = 0; i < roots.GetSize(); ++i)
+			{
+				CollectInstances(json.Get("nodes"), roots.GetElement(i).GetUnsigned(0xFFFFFFFF), glm::mat4(1.0f), 0, instances);
+			}
+		}
+		else
+		{
+			for(unsigned int i = 0; i < meshes.GetSize(); ++i)
+			{
+				MeshInstance instance;
+				instance.mMesh = i;
+				instance.mWorld = glm::mat4(1.0f);
+				instances.push_back(instance);
+			}
+		}
+
+		//Texture coordinates are in the output if any primitive has them, and corners are counted to size the welder
+		mesh.mHasTexCoords = false;
+		unsigned long long cornerCount = 0;
+		for(size_t i = 0; i < instances.size(); ++i)
+		{
+			const DSMeshImporter::JsonValue& primitives = meshes.GetElement(instances[i].mMesh).Get("primitives");
+			for(size_t j = 0; j < primitives.GetSize(); ++j)
+			{
+				const DSMeshImporter::JsonValue& primitive = primitives.GetElement(j);
+				if(primitive.Get("attributes").Get("TEXCOORD_0").GetIsNull() == false)
+				{
+					mesh.mHasTexCoords = true;
+				}
+				unsigned int indicesAccessor = primitive.Get("indices").GetUnsigned(0xFFFFFFFF);
+				unsigned int countAccessor = indicesAccessor != 0xFFFFFFFF ? indicesAccessor : primitive.Get("attributes").Get("POSITION").GetUnsigned(0xFFFFFFFF);
+				cornerCount += json.Get("accessors").GetElement(countAccessor).Get("count").GetUnsigned(0);
+			}
+		}
+		if(cornerCount > 0xFFFFFFFFull)
+		{
+			fprintf(stderr, "WARNING: \"%s\" is too large to import.\n", pPath);
+			cornerCount = 0;
+		}
+
+		unsigned int floatsPerVertex = DSMeshImporter::MeshImporter::GetFloatsPerVertex(mesh.mHasTexCoords);
+		DSMeshImporter::VertexWelder welder(floatsPerVertex, static_cast<size_t>(cornerCount));
+		std::vector<GLfloat> primitiveVertices;
+		mesh.mIndices.clear();
+		mesh.mIndices.reserve(static_cast<size_t>(cornerCount));
+		mesh.mSourceVertexCount = 0;
+
+		for(size_t i = 0; i < instances.size(); ++i)
+		{
+			const DSMeshImporter::JsonValue& primitives = meshes.GetElement(instances[i].mMesh).Get("primitives");
+			for(size_t j = 0; j < primitives.GetSize(); ++j)
+			{
+				const DSMeshImporter::JsonValue& primitive = primitives.GetElement(j);
+				const DSMeshImporter::JsonValue& attributes = primitive.Get("attributes");
+				if(primitive.Get("mode").GetUnsigned(kModeTriangles) != kModeTriangles)
+				{
+					fprintf(stderr, "WARNING: Skipping primitive %u of mesh %u: only triangles are supported.\n", static_cast<unsigned int>(j), instances[i].mMesh);
+					continue;
+				}
+
+				DecodeData data;
+				data.mTexCoords.mCount = 0;
+				data.mColors.mCount = 0;
+				if(GetAccessor(document, attributes.Get("POSITION").GetUnsigned(0xFFFFFFFF), data.mPositions) == false || data.mPositions.mComponents != 3 || data.mPositions.mCount == 0)
+				{
+					fprintf(stderr, "WARNING: Skipping primitive %u of mesh %u: it has no usable positions.\n", static_cast<unsigned int>(j), instances[i].mMesh);
+					continue;
+				}
+				if(attributes.Get("TEXCOORD_0").GetIsNull() == false
+					&& (GetAccessor(document, attributes.Get("TEXCOORD_0").GetUnsigned(0), data.mTexCoords) == false || data.mTexCoords.mComponents != 2 || data.mTexCoords.mCount < data.mPositions.mCount))
+				{
+					data.mTexCoords.mCount = 0;
+				}
+				if(attributes.Get("COLOR_0").GetIsNull() == false
+					&& (GetAccessor(document, attributes.Get("COLOR_0").GetUnsigned(0), data.mColors) == false || data.mColors.mComponents < 3 || data.mColors.mCount < data.mPositions.mCount))
+				{
+					data.mColors.mCount = 0;
+				}
+
+				//Decode every vertex of the primitive in parallel
+				primitiveVertices.resize(static_cast<size_t>(data.mPositions.mCount) * floatsPerVertex);
+				data.mWorld = instances[i].mWorld;
+				data.mpOptions = &options;
+				data.mHasTexCoords = mesh.mHasTexCoords;
+				data.mFloatsPerVertex = floatsPerVertex;
+				data.mpVertices = primitiveVertices.empty() == false ? &primitiveVertices[0] : nullptr;
+				DSThreading::JobSystem::ParallelFor("GltfImporter Decode", 0, data.mPositions.mCount, kDecodeGrainSize, DecodeVertices, &data);
+
+				//Weld the corners
+				DS_PROFILE_SCOPE("GltfImporter Weld");
+				AccessorView indices;
+				bool hasIndices = primitive.Get("indices").GetIsNull() == false;
+				if(hasIndices == true && (GetAccessor(document, primitive.Get("indices").GetUnsigned(0), indices) == false || indices.mComponents != 1
+					|| (indices.mComponentType != kUnsignedByte && indices.mComponentType != kUnsignedShort && indices.mComponentType != kUnsignedInt)))
+				{
+					fprintf(stderr, "WARNING: Skipping primitive %u of mesh %u: its indices are unusable.\n", static_cast<unsigned int>(j), instances[i].mMesh);
+					continue;
+				}
+
+				unsigned int corners = hasIndices == true ? indices.mCount : data.mPositions.mCount;
+				corners -= corners % 3;
+				unsigned int badTriangleCount = 0;
+				for(unsigned int corner = 0; corner < corners; corner += 3)
+				{
+					//A triangle with an out of range index is dropped whole, so the rest stay aligned
+					GLuint triangle[3];
+					bool isValid = true;
+					for(unsigned int k = 0; k < 3; ++k)
+					{
+						triangle[k] = hasIndices == true ? ReadIndex(indices, corner + k) : corner + k;
+						if(triangle[k] >= data.mPositions.mCount)
+						{
+							isValid = false;
+						}
+					}
+					if(isValid == false)
+					{
+						++badTriangleCount;
+						continue;
+					}
+
+					for(unsigned int k = 0; k < 3; ++k)
+					{
+						mesh.mIndices.push_back(welder.Add(&primitiveVertices[static_cast<size_t>(triangle[k]) * floatsPerVertex]));
+					}
+				}
+				if(badTriangleCount > 0)
+				{
+					fprintf(stderr, "WARNING: Skipped %u triangles of primitive %u of mesh %u with out of range indices.\n", badTriangleCount, static_cast<unsigned int>(j), instances[i].mMesh);
+				}
+				mesh.mSourceVertexCount += corners;
+			}
+		}
+
+		welder.TakeVertices(mesh.mVertices);
+		isImported = mesh.mIndices.empty() == false;
+		if(isImported == false)
+		{
+			fprintf(stderr, "WARNING: \"%s\" has no triangles to import.\n", pPath);
+		}
+	}
+
+	for(size_t i = 0; i < document.mFiles.size(); ++i)
+	{
+		delete document.mFiles[i];
+	}
+
+	return isImported;
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+//=============================================================================
+// File:		GltfImporter.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	GltfImporter. Reads the triangle meshes of a glTF 2.0 scene (.gltf or .glb).
+//=============================================================================
+
+#ifndef GLTFIMPORTER_H
+#define GLTFIMPORTER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Daniel Schenker
+#include "MeshImporter.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMeshImporter
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Every triangle primitive of every mesh in the default scene is transformed by its node's world matrix and merged into one mesh.
+		The accessors are decoded in parallel, a job per range of vertices, and the result is welded, which also merges vertices
+		that different primitives (or seams) duplicated.
+	Notes:
+		Reads POSITION, TEXCOORD_0 and COLOR_0, with any component type glTF allows. Normals, skins, morph targets and materials are ignored.
+		Buffers can be in the .glb binary chunk, in separate files next to the .gltf, or embedded as base64 data URIs.
+		Sparse accessors and primitive modes other than triangles are skipped with a warning.
+		glTF texture coordinates start at the top left, so v is flipped for OpenGL.
+	*/
+	class GltfImporter
+	{
+	private:
+		//Constructors
+		GltfImporter();
+
+		//Member Functions
+	public:
+		// General
+		static bool Import(const char* pPath, const DSMeshImporter::ImportOptions& options, DSMeshImporter::ImportedMesh& mesh);
+	};
+
+}//namespace DSMeshImporter
+
+#endif //#ifndef GLTFIMPORTER_H
\ No newline at end of file
@@ -0,0 +1,421 @@
+//=============================================================================
+// File:		Json.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	JsonValue
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstdlib>
+#include <cstring>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "Json.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	const DSMeshImporter::JsonValue sNull;
+	const std::string sEmpty;
+	const unsigned int kMaxDepth = 256;
+}
+
+//=============================================================================
+//Class Declarations
+//=============================================================================
+
+namespace DSMeshImporter
+{
+	/*
+	Description:
+		Recursive descent over the text. A friend of JsonValue so it can fill values in place.
+	*/
+	class JsonParser
+	{
+	public:
+		JsonParser(const char* pText, size_t length)
+		:	mp(pText)
+		,	mpEnd(pText + length)
+		{
+		}
+
+		bool ParseDocument(DSMeshImporter::JsonValue& root)
+		{
+			if(ParseValue(root, 0) == false)
+			{
+				return false;
+			}
+			SkipWhitespace();
+			return mp == mpEnd || Fail("unexpected text after the document");
+		}
+
+	private:
+		void SkipWhitespace()
+		{
+			while(mp < mpEnd && (*mp == ' ' || *mp == '\t' || *mp == '\n' || *mp == '\r'))
+			{
+				++mp;
+			}
+		}
+
+		bool Fail(const char* pReason)
+		{
+			fprintf(stderr, "WARNING: JSON parse error: %s.\n", pReason);
+			return false;
+		}
+
+		bool Match(const char* pLiteral)
+		{
+			size_t length = strlen(pLiteral);
+			if(static_cast<size_t>(mpEnd - mp) >= length && memcmp(mp, pLiteral, length) == 0)
+			{
+				mp += length;
+				return true;
+			}
+			return false;
+		}
+
+		bool ParseValue(DSMeshImporter::JsonValue& value, unsigned int depth)
+		{
+			if(depth > kMaxDepth)
+			{
+				return Fail("nested too deeply");
+			}
+
+			SkipWhitespace();
+			if(mp >= mpEnd)
+			{
+				return Fail("unexpected end of text");
+			}
+
+			switch(*mp)
+			{
+			case '{':
+				return ParseObject(value, depth);
+			case '[':
+				return ParseArray(value, depth);
+			case '"':
+				value.mType = DSMeshImporter::kJsonString;
+				return ParseString(value.mString);
+			case 't':
+				value.mType = DSMeshImporter::kJsonBool;
+				value.mBool = true;
+				return Match("true") || Fail("invalid literal");
+			case 'f':
+				value.mType = DSMeshImporter::kJsonBool;
+				value.mBool = false;
+				return Match("false") || Fail("invalid literal");
+			case 'n':
+				value.mType = DSMeshImporter::kJsonNull;
+				return Match("null") || Fail("invalid literal");
+			default:
+				return ParseNumber(value);
+			}
+		}
+
+		bool ParseObject(DSMeshImporter::JsonValue& value, unsigned int depth)
+		{
+			value.mType = DSMeshImporter::kJsonObject;
+			++mp;//{
+			SkipWhitespace();
+			if(mp < mpEnd && *mp == '}')
+			{
+				++mp;
+				return true;
+			}
+
+			for(;;)
+			{
+				SkipWhitespace();
+				value.mKeys.push_back(std::string());
+				if(mp >= mpEnd || *mp != '"' || ParseString(value.mKeys.back()) == false)
+				{
+					return Fail("expected a member name");
+				}
+				SkipWhitespace();
+				if(mp >= mpEnd || *mp != ':')
+				{
+					return Fail("expected ':'");
+				}
+				++mp;
+
+				value.mElements.push_back(DSMeshImporter::JsonValue());
+				if(ParseValue(value.mElements.back(), depth + 1) == false)
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+				if(mp < mpEnd && *mp == ',')
+				{
+					++mp;
+				}
+				else if(mp < mpEnd && *mp == '}')
+				{
+					++mp;
+					return true;
+				}
+				else
+				{
+					return Fail("expected ',' or '}'");
+				}
+			}
+		}
+
+		bool ParseArray(DSMeshImporter::JsonValue& value, unsigned int depth)
+		{
+			value.mType = DSMeshImporter::kJsonArray;
+			++mp;//[
+			SkipWhitespace();
+			if(mp < mpEnd && *mp == ']')
+			{
+				++mp;
+				return true;
+			}
+
+			for(;;)
+			{
+				value.mElements.push_back(DSMeshImporter::JsonValue());
+				if(ParseValue(value.mElements.back(), depth + 1) == false)
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+				if(mp < mpEnd && *mp == ',')
+				{
+					++mp;
+				}
+				else if(mp < mpEnd && *mp == ']')
+				{
+					++mp;
+					return true;
+				}
+				else
+				{
+					return Fail("expected ',' or ']'");
+				}
+			}
+		}
+
+		bool ParseString(std::string& text)
+		{
+			++mp;//"
+			while(mp < mpEnd && *mp != '"')
+			{
+				if(*mp != '\\')
+				{
+					text.push_back(*mp++);
+					continue;
+				}
+
+				++mp;
+				if(mp >= mpEnd)
+				{
+					break;
+				}
+				char escape = *mp++;
+				switch(escape)
+				{
+				case '"':	text.push_back('"');	break;
+				case '\\':	text.push_back('\\');	break;
+				case '/':	text.push_back('/');	break;
+				case 'b':	text.push_back('\b');	break;
+				case 'f':	text.push_back('\f');	break;
+				case 'n':	text.push_back('\n');	break;
+				case 'r':	text.push_back('\r');	break;
+				case 't':	text.push_back('\t');	break;
+				case 'u':
+				{
+					//As UTF-8. Surrogate pairs are not combined; glTF names and URIs are very rarely outside the basic plane.
+					if(mpEnd - mp < 4)
+					{
+						return Fail("truncated \\u escape");
+					}
+					char digits[5] = {mp[0], mp[1], mp[2], mp[3], '\0'};
+					mp += 4;
+					unsigned long code = strtoul(digits, nullptr, 16);
+					if(code < 0x80)
+					{
+						text.push_back(static_cast<char>(code));
+					}
+					else if(code < 0x800)
+					{
+						text.push_back(static_cast<char>(0xC0 | (code >> 6)));
+						text.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+					}
+					else
+					{
+						text.push_back(static_cast<char>(0xE0 | (code >> 12)));
+						text.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+						text.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+					}
+					break;
+				}
+				default:
+					return Fail("invalid escape");
+				}
+			}
+
+			if(mp >= mpEnd)
+			{
+				return Fail("unterminated string");
+			}
+			++mp;//"
+			return true;
+		}
+
+		bool ParseNumber(DSMeshImporter::JsonValue& value)
+		{
+			//strtod needs a terminated string, and numbers are short
+			char buffer[64];
+			size_t length = 0;
+			while(mp + length < mpEnd && length < sizeof(buffer) - 1 && strchr("+-0123456789.eE", mp[length]) != nullptr)
+			{
+				buffer[length] = mp[length];
+				++length;
+			}
+			buffer[length] = '\0';
+
+			char* pNumberEnd = nullptr;
+			value.mType = DSMeshImporter::kJsonNumber;
+			value.mNumber = strtod(buffer, &pNumberEnd);
+			if(length == 0 || pNumberEnd != buffer + length)
+			{
+				return Fail("invalid number");
+			}
+
+			mp += length;
+			return true;
+		}
+
+	private:
+		const char* mp;
+		const char* mpEnd;
+	};
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+DSMeshImporter::JsonValue::JsonValue()
+:	mType(DSMeshImporter::kJsonNull)
+,	mBool(false)
+,	mNumber(0.0)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  Parsing
+
+/*
+Description:
+	Parses the length characters at pText into root. Returns false, with a warning, if the text is not valid JSON.
+*/
+bool DSMeshImporter::JsonValue::Parse(const char* pText, size_t length, DSMeshImporter::JsonValue& root)
+{
+	root = DSMeshImporter::JsonValue();
+
+	DSMeshImporter::JsonParser parser(pText, length);
+	return parser.ParseDocument(root);
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+DSMeshImporter::JsonType DSMeshImporter::JsonValue::GetType() const
+{
+	return mType;
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSMeshImporter::JsonValue::GetIsNull() const
+{
+	return mType == DSMeshImporter::kJsonNull;
+}
+
+//-----------------------------------------------------------------------------
+
+bool DSMeshImporter::JsonValue::GetBool(bool defaultValue) const
+{
+	return mType == DSMeshImporter::kJsonBool ? mBool : defaultValue;
+}
+
+//-----------------------------------------------------------------------------
+
+double DSMeshImporter::JsonValue::GetNumber(double defaultValue) const
+{
+	return mType == DSMeshImporter::kJsonNumber ? mNumber : defaultValue;
+}
+
+//-----------------------------------------------------------------------------
+
+unsigned int DSMeshImporter::JsonValue::GetUnsigned(unsigned int defaultValue) const
+{
+	return mType == DSMeshImporter::kJsonNumber && mNumber >= 0.0 && mNumber <= 4294967295.0 ? static_cast<unsigned int>(mNumber) : defaultValue;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	Empty for anything but a string.
+*/
+const std::string& DSMeshImporter::JsonValue::GetString() const
+{
+	return mType == DSMeshImporter::kJsonString ? mString : sEmpty;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	The number of elements of an array or members of an object. 0 for anything else.
+*/
+size_t DSMeshImporter::JsonValue::GetSize() const
+{
+	return mType == DSMeshImporter::kJsonArray || mType == DSMeshImporter::kJsonObject ? mElements.size() : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+const DSMeshImporter::JsonValue& DSMeshImporter::JsonValue::GetElement(size_t index) const
+{
+	return mType == DSMeshImporter::kJsonArray && index < mElements.size() ? mElements[index] : sNull;
+}
+
+//-----------------------------------------------------------------------------
+
+const DSMeshImporter::JsonValue& DSMeshImporter::JsonValue::Get(const char* pKey) const
+{
+	if(mType == DSMeshImporter::kJsonObject)
+	{
+		for(size_t i = 0; i < mKeys.size(); ++i)
+		{
+			if(mKeys[i] == pKey)
+			{
+				return mElements[i];
+			}
+		}
+	}
+
+	return sNull;
+}
\ No newline at end of file
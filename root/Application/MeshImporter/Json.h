@@ -0,0 +1,88 @@
+//=============================================================================
+// File:		Json.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	JsonValue. A small JSON document reader, enough for glTF.
+//=============================================================================
+
+#ifndef JSON_H
+#define JSON_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <string>
+#include <vector>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMeshImporter
+{
+
+	//=============================================================================
+	//Enums
+	//=============================================================================
+
+	enum JsonType
+	{
+		kJsonNull,
+		kJsonBool,
+		kJsonNumber,
+		kJsonString,
+		kJsonArray,
+		kJsonObject
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		A parsed JSON value. Looking up a missing member or element returns a null value rather than failing,
+		so optional glTF properties can be read with a default in one expression, eg. primitive.Get("mode").GetUnsigned(4).
+	Notes:
+		Objects keep their members in file order and are searched linearly; glTF objects are small.
+	*/
+	class JsonValue
+	{
+	public:
+		//Constructors
+		JsonValue();
+
+		//Member Functions
+	public:
+		// Parsing
+		static bool Parse(const char* pText, size_t length, DSMeshImporter::JsonValue& root);
+
+		// Getters
+		DSMeshImporter::JsonType GetType() const;
+		bool GetIsNull() const;
+		bool GetBool(bool defaultValue) const;
+		double GetNumber(double defaultValue) const;
+		unsigned int GetUnsigned(unsigned int defaultValue) const;
+		const std::string& GetString() const;
+		size_t GetSize() const;
+		const DSMeshImporter::JsonValue& GetElement(size_t index) const;
+		const DSMeshImporter::JsonValue& Get(const char* pKey) const;
+
+		//Member Variables
+	private:
+		friend class JsonParser;
+
+		DSMeshImporter::JsonType mType;
+		bool mBool;
+		double mNumber;
+		std::string mString;
+		std::vector<DSMeshImporter::JsonValue> mElements;//array elements, or object member values
+		std::vector<std::string> mKeys;//object member names, parallel to mElements
+	};
+
+}//namespace DSMeshImporter
+
+#endif //#ifndef JSON_H
\ No newline at end of file
@@ -0,0 +1,95 @@
+//=============================================================================
+// File:		Main.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	MeshImporter entry point.
+//				Usage: MeshImporter.exe input.(obj|gltf|glb) output.dsmesh [--scale s] [--chunk bytes] [--threads count]
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstdlib>
+#include <cstring>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "MeshImporter.h"
+#include "../Main/DSProfiling/Profiler.h"
+#include "../Main/DSThreading/JobSystem.h"
+
+//=============================================================================
+//Main
+//=============================================================================
+
+int main(int argc, char* argv[])
+{
+	if(argc < 3)
+	{
+		fprintf(stderr, "Usage: MeshImporter.exe input.(obj|gltf|glb) output.dsmesh [--scale s] [--chunk bytes] [--threads count]\n");
+		return 1;
+	}
+
+	const char* pInput = argv[1];
+	const char* pOutput = argv[2];
+	DSMeshImporter::ImportOptions options;
+	DSMeshImporter::MeshImporter::GetDefaultOptions(options);
+	unsigned int workerCount = 0;
+
+	//Arguments
+	for(int i = 3; i + 1 < argc; i += 2)
+	{
+		if(strcmp(argv[i], "--scale") == 0)
+		{
+			options.mScale = static_cast<float>(atof(argv[i + 1]));
+		}
+		else if(strcmp(argv[i], "--chunk") == 0)
+		{
+			options.mChunkBytes = static_cast<unsigned int>(atoi(argv[i + 1]));
+		}
+		else if(strcmp(argv[i], "--threads") == 0)
+		{
+			workerCount = static_cast<unsigned int>(atoi(argv[i + 1]));
+		}
+		else
+		{
+			fprintf(stderr, "WARNING: Unknown argument \"%s\".\n", argv[i]);
+		}
+	}
+	if(options.mChunkBytes < 4096)
+	{
+		options.mChunkBytes = 4096;
+	}
+
+	//The profiler provides the timer; its zones stay disabled as there is no viewer to send them to
+	DSProfiling::Profiler::Initialize();
+	DSProfiling::Profiler::SetIsEnabled(false);
+	DSThreading::JobSystem::Initialize(workerCount);
+
+	DSMeshImporter::ImportedMesh mesh;
+	unsigned long long start = DSProfiling::Profiler::GetTicks();
+	bool isImported = DSMeshImporter::MeshImporter::Import(pInput, options, mesh);
+	unsigned long long imported = DSProfiling::Profiler::GetTicks();
+	bool isWritten = isImported == true && DSMeshImporter::MeshImporter::Write(pOutput, mesh);
+	unsigned long long written = DSProfiling::Profiler::GetTicks();
+
+	if(isWritten == true)
+	{
+		unsigned int vertexCount = static_cast<unsigned int>(mesh.mVertices.size() / DSMeshImporter::MeshImporter::GetFloatsPerVertex(mesh.mHasTexCoords));
+		printf("%s -> %s\n", pInput, pOutput);
+		printf("  Triangles:       %u\n", static_cast<unsigned int>(mesh.mIndices.size() / 3));
+		printf("  Vertices:        %u (welded from %u corners, %.1f%%)\n", vertexCount, mesh.mSourceVertexCount,
+			mesh.mSourceVertexCount > 0 ? 100.0 * vertexCount / mesh.mSourceVertexCount : 0.0);
+		printf("  Texture coords:  %s\n", mesh.mHasTexCoords == true ? "yes" : "no");
+		printf("  Import:          %.1f ms\n", DSProfiling::Profiler::TicksToMs(imported - start));
+		printf("  Write:           %.1f ms\n", DSProfiling::Profiler::TicksToMs(written - imported));
+	}
+
+	DSThreading::JobSystem::Terminate();
+	DSProfiling::Profiler::Terminate();
+
+	return isWritten == true ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+//=============================================================================
+// File:		MeshImporter.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	MeshImporter
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cctype>
+#include <cstring>
+#include <stdio.h>
+#include <string>
+
+// Daniel Schenker
+#include "MeshImporter.h"
+#include "GltfImporter.h"
+#include "ObjImporter.h"
+#include "../Main/DSGraphics/MeshFile.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	std::string GetExtension(const char* pPath)
+	{
+		const char* pDot = strrchr(pPath, '.');
+		std::string extension(pDot != nullptr ? pDot + 1 : "");
+		for(size_t i = 0; i < extension.size(); ++i)
+		{
+			extension[i] = static_cast<char>(tolower(static_cast<unsigned char>(extension[i])));
+		}
+		return extension;
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Imports the mesh at pPath, choosing the importer by extension: .obj, .gltf or .glb.
+*/
+bool DSMeshImporter::MeshImporter::Import(const char* pPath, const DSMeshImporter::ImportOptions& options, DSMeshImporter::ImportedMesh& mesh)
+{
+	mesh.mHasTexCoords = false;
+	mesh.mVertices.clear();
+	mesh.mIndices.clear();
+	mesh.mSourceVertexCount = 0;
+
+	std::string extension = GetExtension(pPath);
+	if(extension == "obj")
+	{
+		return DSMeshImporter::ObjImporter::Import(pPath, options, mesh);
+	}
+	if(extension == "gltf" || extension == "glb")
+	{
+		return DSMeshImporter::GltfImporter::Import(pPath, options, mesh);
+	}
+
+	fprintf(stderr, "WARNING: \"%s\" is not an .obj, .gltf or .glb file.\n", pPath);
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Writes the mesh as a .dsmesh with a single LOD, ready for ModelAsset.
+*/
+bool DSMeshImporter::MeshImporter::Write(const char* pPath, const DSMeshImporter::ImportedMesh& mesh)
+{
+	if(mesh.mVertices.empty() == true || mesh.mIndices.empty() == true)
+	{
+		fprintf(stderr, "WARNING: Not writing \"%s\": the mesh is empty.\n", pPath);
+		return false;
+	}
+
+	DSGraphics::MeshData data;
+	data.mDrawType = GL_TRIANGLES;
+	data.mComponents[DSGraphics::kMeshAttributePosition] = 3;
+	data.mComponents[DSGraphics::kMeshAttributeTexCoord] = mesh.mHasTexCoords == true ? 2 : 0;
+	data.mComponents[DSGraphics::kMeshAttributeColor] = 4;
+	data.mVertexCount = static_cast<uint32_t>(mesh.mVertices.size() / GetFloatsPerVertex(mesh.mHasTexCoords));
+	data.mpVertices = &mesh.mVertices[0];
+	data.mIndexCount = static_cast<uint32_t>(mesh.mIndices.size());
+	data.mpIndices = &mesh.mIndices[0];
+	data.mLodCount = 0;
+	data.mpLods = nullptr;
+
+	return DSGraphics::MeshFile::Write(pPath, data);
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+unsigned int DSMeshImporter::MeshImporter::GetFloatsPerVertex(bool hasTexCoords)
+{
+	return hasTexCoords == true ? 3 + 2 + 4 : 3 + 4;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSMeshImporter::MeshImporter::GetDefaultOptions(DSMeshImporter::ImportOptions& options)
+{
+	options.mScale = 0.01f;
+	options.mDefaultColor[0] = 1.0f;
+	options.mDefaultColor[1] = 1.0f;
+	options.mDefaultColor[2] = 1.0f;
+	options.mDefaultColor[3] = 1.0f;
+	options.mChunkBytes = 1024 * 1024;
+}
\ No newline at end of file
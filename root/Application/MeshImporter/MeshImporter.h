@@ -0,0 +1,77 @@
+//=============================================================================
+// File:		MeshImporter.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	MeshImporter. Converts Wavefront OBJ and glTF 2.0 meshes into the engine's binary mesh format (.dsmesh).
+//=============================================================================
+
+#ifndef MESHIMPORTER_H
+#define MESHIMPORTER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLEW
+#include <GL/glew.h>
+
+// Standard C++ Libraries
+#include <vector>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMeshImporter
+{
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	struct ImportOptions
+	{
+		float mScale;//applied to positions; the default, 0.01, is Object::sDCPerM, converting meters to device coordinates
+		GLfloat mDefaultColor[4];//for vertices the source gives no color
+		unsigned int mChunkBytes;//OBJ files are split into chunks of about this size, one job each
+	};
+
+	/*
+	Notes:
+		Vertices are interleaved in the layout ModelAsset expects: position (3), texture coordinates (2, only if mHasTexCoords), color (4).
+		Triangles only, counter clockwise.
+	*/
+	struct ImportedMesh
+	{
+		bool mHasTexCoords;
+		std::vector<GLfloat> mVertices;
+		std::vector<GLuint> mIndices;
+		unsigned int mSourceVertexCount;//triangle corners read, before welding
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	class MeshImporter
+	{
+	private:
+		//Constructors
+		MeshImporter();
+
+		//Member Functions
+	public:
+		// General
+		static bool Import(const char* pPath, const DSMeshImporter::ImportOptions& options, DSMeshImporter::ImportedMesh& mesh);
+		static bool Write(const char* pPath, const DSMeshImporter::ImportedMesh& mesh);
+
+		// Getters
+		static unsigned int GetFloatsPerVertex(bool hasTexCoords);
+		static void GetDefaultOptions(DSMeshImporter::ImportOptions& options);
+	};
+
+}//namespace DSMeshImporter
+
+#endif //#ifndef MESHIMPORTER_H
\ No newline at end of file
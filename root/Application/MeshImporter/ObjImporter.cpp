@@ -0,0 +1,595 @@
+//=============================================================================
+// File:		ObjImporter.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	ObjImporter
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <climits>
+#include <cstring>
+#include <stdio.h>
+#include <vector>
+
+// Daniel Schenker
+#include "ObjImporter.h"
+#include "VertexWelder.h"
+#include "../Main/DSProfiling/Profiler.h"
+#include "../Main/DSSystem/MappedFile.h"
+#include "../Main/DSThreading/JobSystem.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	const int kNoTexCoord = INT_MIN;
+
+	enum CornerFlags
+	{
+		kCornerRelativePosition = 1 << 0,
+		kCornerRelativeTexCoord = 1 << 1
+	};
+
+	//A face corner's indices, 0 based. Relative indices (negative in the file) are stored relative to the start of the chunk,
+	//which can make them negative, until ResolveChunks adds the chunk's base.
+	struct ObjCorner
+	{
+		int mPosition;
+		int mTexCoord;
+		unsigned int mFlags;//CornerFlags
+	};
+
+	struct ObjChunk
+	{
+		const char* mpBegin;
+		const char* mpEnd;
+		std::vector<GLfloat> mPositions;//3 per position
+		std::vector<GLfloat> mColors;//4 per position
+		std::vector<GLfloat> mTexCoords;//2 per texture coordinate
+		std::vector<ObjCorner> mCorners;//3 per triangle
+		unsigned int mPositionBase;//positions in earlier chunks
+		unsigned int mTexCoordBase;
+		unsigned int mBadLineCount;
+		unsigned int mBadIndexCount;
+	};
+
+	struct ParseData
+	{
+		std::vector<ObjChunk>* mpChunks;
+		const DSMeshImporter::ImportOptions* mpOptions;
+		unsigned int mPositionCount;//total, for ResolveChunks
+		unsigned int mTexCoordCount;
+	};
+
+	//-----------------------------------------------------------------------------
+	//  Tokenizing
+
+	bool IsSpace(char c)
+	{
+		return c == ' ' || c == '\t' || c == '\r';
+	}
+
+	void SkipSpaces(const char*& p, const char* pEnd)
+	{
+		while(p < pEnd && IsSpace(*p) == true)
+		{
+			++p;
+		}
+	}
+
+	void SkipLine(const char*& p, const char* pEnd)
+	{
+		const char* pNewline = static_cast<const char*>(memchr(p, '\n', pEnd - p));
+		p = pNewline != nullptr ? pNewline + 1 : pEnd;
+	}
+
+	/*
+	Notes:
+		Much faster than strtod, and locale independent. Exact for the short decimals meshes are written with, and within an ulp or two otherwise.
+	*/
+	bool ParseFloat(const char*& p, const char* pEnd, GLfloat& value)
+	{
+		static const double kPowersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+
+		SkipSpaces(p, pEnd);
+		const char* pStart = p;
+
+		bool isNegative = false;
+		if(p < pEnd && (*p == '-' || *p == '+'))
+		{
+			isNegative = *p == '-';
+			++p;
+		}
+
+		unsigned long long mantissa = 0;
+		int exponent = 0;
+		unsigned int digitCount = 0;
+		for(; p < pEnd && *p >= '0' && *p <= '9'; ++p, ++digitCount)
+		{
+			if(mantissa < 100000000000000000ull)
+			{
+				mantissa = mantissa * 10 + (*p - '0');
+			}
+			else
+			{
+				++exponent;
+			}
+		}
+		if(p < pEnd && *p == '.')
+		{
+			for(++p; p < pEnd && *p >= '0' && *p <= '9'; ++p, ++digitCount)
+			{
+				if(mantissa < 100000000000000000ull)
+				{
+					mantissa = mantissa * 10 + (*p - '0');
+					--exponent;
+				}
+			}
+		}
+		if(digitCount == 0)
+		{
+			p = pStart;
+			return false;
+		}
+		if(p < pEnd && (*p == 'e' || *p == 'E'))
+		{
+			const char* pExponent = p++;
+			bool isExponentNegative = false;
+			if(p < pEnd && (*p == '-' || *p == '+'))
+			{
+				isExponentNegative = *p == '-';
+				++p;
+			}
+			if(p < pEnd && *p >= '0' && *p <= '9')
+			{
+				int explicitExponent = 0;
+				for(; p < pEnd && *p >= '0' && *p <= '9'; ++p)
+				{
+					if(explicitExponent < 10000)
+					{
+						explicitExponent = explicitExponent * 10 + (*p - '0');
+					}
+				}
+				exponent += isExponentNegative == true ? -explicitExponent : explicitExponent;
+			}
+			else
+			{
+				p = pExponent;//just an "e", not an exponent
+			}
+		}
+
+		double result = static_cast<double>(mantissa);
+		while(exponent > 0)
+		{
+			int step = exponent > 18 ? 18 : exponent;
+			result *= kPowersOfTen[step];
+			exponent -= step;
+		}
+		while(exponent < 0)
+		{
+			int step = exponent < -18 ? 18 : -exponent;
+			result /= kPowersOfTen[step];
+			exponent += step;
+		}
+
+		value = static_cast<GLfloat>(isNegative == true ? -result : result);
+		return true;
+	}
+
+	bool ParseInt(const char*& p, const char* pEnd, int& value)
+	{
+		bool isNegative = false;
+		if(p < pEnd && (*p == '-' || *p == '+'))
+		{
+			isNegative = *p == '-';
+			++p;
+		}
+		if(p >= pEnd || *p < '0' || *p > '9')
+		{
+			return false;
+		}
+
+		long long result = 0;
+		for(; p < pEnd && *p >= '0' && *p <= '9'; ++p)
+		{
+			if(result <= INT_MAX)
+			{
+				result = result * 10 + (*p - '0');
+			}
+		}
+		if(result > INT_MAX)
+		{
+			return false;
+		}
+
+		value = static_cast<int>(isNegative == true ? -result : result);
+		return true;
+	}
+
+	/*
+	Description:
+		Converts an index from the file into the ObjCorner encoding. 0 is invalid in OBJ.
+	*/
+	bool EncodeIndex(int index, unsigned int localCount, int& encoded, bool& isRelative)
+	{
+		if(index > 0)
+		{
+			encoded = index - 1;
+			isRelative = false;
+			return true;
+		}
+		if(index < 0)
+		{
+			encoded = static_cast<int>(localCount) + index;
+			isRelative = true;
+			return true;
+		}
+		return false;
+	}
+
+	/*
+	Description:
+		Parses a corner ("v", "v/vt", "v//vn" or "v/vt/vn").
+	*/
+	bool ParseCorner(const char*& p, const char* pEnd, const ObjChunk& chunk, ObjCorner& corner)
+	{
+		corner.mFlags = 0;
+		bool isRelative = false;
+
+		int position = 0;
+		if(ParseInt(p, pEnd, position) == false || EncodeIndex(position, static_cast<unsigned int>(chunk.mPositions.size() / 3), corner.mPosition, isRelative) == false)
+		{
+			return false;
+		}
+		if(isRelative == true)
+		{
+			corner.mFlags |= kCornerRelativePosition;
+		}
+
+		corner.mTexCoord = kNoTexCoord;
+		if(p < pEnd && *p == '/')
+		{
+			++p;
+			int texCoord = 0;
+			if(p < pEnd && *p != '/')
+			{
+				if(ParseInt(p, pEnd, texCoord) == false || EncodeIndex(texCoord, static_cast<unsigned int>(chunk.mTexCoords.size() / 2), corner.mTexCoord, isRelative) == false)
+				{
+					return false;
+				}
+				if(isRelative == true)
+				{
+					corner.mFlags |= kCornerRelativeTexCoord;
+				}
+			}
+			//Skip the normal
+			if(p < pEnd && *p == '/')
+			{
+				++p;
+				int normal = 0;
+				ParseInt(p, pEnd, normal);
+			}
+		}
+
+		return p >= pEnd || IsSpace(*p) == true || *p == '\n';
+	}
+
+	//-----------------------------------------------------------------------------
+	//  Jobs
+
+	void ParseChunks(unsigned int begin, unsigned int end, void* pUserData)
+	{
+		ParseData& data = *static_cast<ParseData*>(pUserData);
+		const GLfloat* pDefaultColor = data.mpOptions->mDefaultColor;
+
+		for(unsigned int chunkIndex = begin; chunkIndex < end; ++chunkIndex)
+		{
+			ObjChunk& chunk = (*data.mpChunks)[chunkIndex];
+			const char* p = chunk.mpBegin;
+			const char* pEnd = chunk.mpEnd;
+
+			//Guess generously from the size, so the arrays rarely reallocate
+			size_t lineEstimate = (pEnd - p) / 24;
+			chunk.mPositions.reserve(lineEstimate * 3 / 2);
+			chunk.mColors.reserve(lineEstimate * 2);
+			chunk.mCorners.reserve(lineEstimate * 3 / 2);
+
+			while(p < pEnd)
+			{
+				SkipSpaces(p, pEnd);
+				if(p + 1 < pEnd && p[0] == 'v' && IsSpace(p[1]) == true)
+				{
+					//Position, optionally followed by w or by a color
+					p += 1;
+					GLfloat values[7];
+					unsigned int count = 0;
+					while(count < 7 && ParseFloat(p, pEnd, values[count]) == true)
+					{
+						++count;
+					}
+					if(count < 3)
+					{
+						++chunk.mBadLineCount;
+						SkipLine(p, pEnd);
+						continue;
+					}
+
+					chunk.mPositions.insert(chunk.mPositions.end(), values, values + 3);
+					if(count >= 6)
+					{
+						chunk.mColors.insert(chunk.mColors.end(), values + 3, values + 6);
+						chunk.mColors.push_back(count == 7 ? values[6] : 1.0f);
+					}
+					else
+					{
+						chunk.mColors.insert(chunk.mColors.end(), pDefaultColor, pDefaultColor + 4);
+					}
+				}
+				else if(p + 2 < pEnd && p[0] == 'v' && p[1] == 't' && IsSpace(p[2]) == true)
+				{
+					p += 2;
+					GLfloat uv[2] = {0.0f, 0.0f};
+					if(ParseFloat(p, pEnd, uv[0]) == false)
+					{
+						++chunk.mBadLineCount;
+						SkipLine(p, pEnd);
+						continue;
+					}
+					ParseFloat(p, pEnd, uv[1]);
+					chunk.mTexCoords.insert(chunk.mTexCoords.end(), uv, uv + 2);
+				}
+				else if(p + 1 < pEnd && p[0] == 'f' && IsSpace(p[1]) == true)
+				{
+					//Fan triangulation: (first, previous, current) for every corner after the second
+					p += 1;
+					ObjCorner first;
+					ObjCorner previous;
+					unsigned int cornerCount = 0;
+					bool isBad = false;
+					for(;;)
+					{
+						SkipSpaces(p, pEnd);
+						if(p >= pEnd || *p == '\n' || *p == '#')
+						{
+							break;
+						}
+
+						ObjCorner corner;
+						if(ParseCorner(p, pEnd, chunk, corner) == false)
+						{
+							isBad = true;
+							break;
+						}
+
+						if(cornerCount == 0)
+						{
+							first = corner;
+						}
+						else if(cornerCount >= 2)
+						{
+							chunk.mCorners.push_back(first);
+							chunk.mCorners.push_back(previous);
+							chunk.mCorners.push_back(corner);
+						}
+						previous = corner;
+						++cornerCount;
+					}
+					if(isBad == true || cornerCount < 3)
+					{
+						++chunk.mBadLineCount;
+					}
+				}
+
+				SkipLine(p, pEnd);
+			}
+		}
+	}
+
+	//-----------------------------------------------------------------------------
+
+	void ResolveChunks(unsigned int begin, unsigned int end, void* pUserData)
+	{
+		ParseData& data = *static_cast<ParseData*>(pUserData);
+
+		for(unsigned int chunkIndex = begin; chunkIndex < end; ++chunkIndex)
+		{
+			ObjChunk& chunk = (*data.mpChunks)[chunkIndex];
+			for(size_t i = 0; i < chunk.mCorners.size(); ++i)
+			{
+				ObjCorner& corner = chunk.mCorners[i];
+
+				long long position = (corner.mFlags & kCornerRelativePosition) != 0 ? static_cast<long long>(chunk.mPositionBase) + corner.mPosition : corner.mPosition;
+				if(position < 0 || position >= data.mPositionCount)
+				{
+					++chunk.mBadIndexCount;
+					position = 0;
+				}
+				corner.mPosition = static_cast<int>(position);
+
+				if(corner.mTexCoord != kNoTexCoord)
+				{
+					long long texCoord = (corner.mFlags & kCornerRelativeTexCoord) != 0 ? static_cast<long long>(chunk.mTexCoordBase) + corner.mTexCoord : corner.mTexCoord;
+					if(texCoord < 0 || texCoord >= data.mTexCoordCount)
+					{
+						++chunk.mBadIndexCount;
+						texCoord = 0;
+					}
+					corner.mTexCoord = static_cast<int>(texCoord);
+				}
+			}
+		}
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+bool DSMeshImporter::ObjImporter::Import(const char* pPath, const DSMeshImporter::ImportOptions& options, DSMeshImporter::ImportedMesh& mesh)
+{
+	DSSystem::MappedFile file(pPath);
+	if(file.GetIsMapped() == false)
+	{
+		return false;
+	}
+
+	//Chunks, each ending just after a newline
+	std::vector<ObjChunk> chunks;
+	{
+		DS_PROFILE_SCOPE("ObjImporter Chunk");
+		const char* pBegin = reinterpret_cast<const char*>(file.GetData());
+		const char* pFileEnd = pBegin + file.GetSize();
+		while(pBegin < pFileEnd)
+		{
+			const char* pEnd = pFileEnd;
+			if(static_cast<size_t>(pFileEnd - pBegin) > options.mChunkBytes)
+			{
+				pEnd = pBegin + options.mChunkBytes;
+				SkipLine(pEnd, pFileEnd);
+			}
+
+			ObjChunk chunk;
+			chunk.mpBegin = pBegin;
+			chunk.mpEnd = pEnd;
+			chunk.mPositionBase = 0;
+			chunk.mTexCoordBase = 0;
+			chunk.mBadLineCount = 0;
+			chunk.mBadIndexCount = 0;
+			chunks.push_back(chunk);
+
+			pBegin = pEnd;
+		}
+	}
+
+	ParseData data;
+	data.mpChunks = &chunks;
+	data.mpOptions = &options;
+	data.mPositionCount = 0;
+	data.mTexCoordCount = 0;
+
+	unsigned int chunkCount = static_cast<unsigned int>(chunks.size());
+	DSThreading::JobSystem::ParallelFor("ObjImporter Parse", 0, chunkCount, DSThreading::JobSystem::GetGrainSize(chunkCount), ParseChunks, &data);
+
+	//Where each chunk's positions and texture coordinates start
+	unsigned long long positionCount = 0;
+	unsigned long long texCoordCount = 0;
+	unsigned long long cornerCount = 0;
+	unsigned int badLineCount = 0;
+	for(size_t i = 0; i < chunks.size(); ++i)
+	{
+		chunks[i].mPositionBase = static_cast<unsigned int>(positionCount);
+		chunks[i].mTexCoordBase = static_cast<unsigned int>(texCoordCount);
+		positionCount += chunks[i].mPositions.size() / 3;
+		texCoordCount += chunks[i].mTexCoords.size() / 2;
+		cornerCount += chunks[i].mCorners.size();
+		badLineCount += chunks[i].mBadLineCount;
+	}
+	if(positionCount > INT_MAX || texCoordCount > INT_MAX || cornerCount > 0xFFFFFFFFull)
+	{
+		fprintf(stderr, "WARNING: \"%s\" is too large to import.\n", pPath);
+		return false;
+	}
+	if(positionCount == 0 && cornerCount > 0)
+	{
+		//Out of range indices are replaced with the first vertex, so there must be one
+		fprintf(stderr, "WARNING: \"%s\" has faces but no vertices.\n", pPath);
+		return false;
+	}
+	if(badLineCount > 0)
+	{
+		fprintf(stderr, "WARNING: Skipped %u malformed lines in \"%s\".\n", badLineCount, pPath);
+	}
+
+	data.mPositionCount = static_cast<unsigned int>(positionCount);
+	data.mTexCoordCount = static_cast<unsigned int>(texCoordCount);
+	DSThreading::JobSystem::ParallelFor("ObjImporter Resolve", 0, chunkCount, DSThreading::JobSystem::GetGrainSize(chunkCount), ResolveChunks, &data);
+
+	unsigned int badIndexCount = 0;
+	for(size_t i = 0; i < chunks.size(); ++i)
+	{
+		badIndexCount += chunks[i].mBadIndexCount;
+	}
+	if(badIndexCount > 0)
+	{
+		fprintf(stderr, "WARNING: \"%s\" has %u face indices that are out of range. They were replaced with the first vertex.\n", pPath, badIndexCount);
+	}
+
+	//Gather the vertex data into single arrays, so resolved indices can index them directly
+	std::vector<GLfloat> positions;
+	std::vector<GLfloat> colors;
+	std::vector<GLfloat> texCoords;
+	{
+		DS_PROFILE_SCOPE("ObjImporter Gather");
+		positions.reserve(static_cast<size_t>(positionCount) * 3);
+		colors.reserve(static_cast<size_t>(positionCount) * 4);
+		texCoords.reserve(static_cast<size_t>(texCoordCount) * 2);
+		for(size_t i = 0; i < chunks.size(); ++i)
+		{
+			positions.insert(positions.end(), chunks[i].mPositions.begin(), chunks[i].mPositions.end());
+			colors.insert(colors.end(), chunks[i].mColors.begin(), chunks[i].mColors.end());
+			texCoords.insert(texCoords.end(), chunks[i].mTexCoords.begin(), chunks[i].mTexCoords.end());
+			std::vector<GLfloat>().swap(chunks[i].mPositions);
+			std::vector<GLfloat>().swap(chunks[i].mColors);
+			std::vector<GLfloat>().swap(chunks[i].mTexCoords);
+		}
+	}
+
+	//Weld
+	DS_PROFILE_SCOPE("ObjImporter Weld");
+	mesh.mHasTexCoords = texCoordCount > 0;
+	mesh.mSourceVertexCount = static_cast<unsigned int>(cornerCount);
+	mesh.mIndices.clear();
+	mesh.mIndices.reserve(static_cast<size_t>(cornerCount));
+
+	unsigned int floatsPerVertex = DSMeshImporter::MeshImporter::GetFloatsPerVertex(mesh.mHasTexCoords);
+	DSMeshImporter::VertexWelder welder(floatsPerVertex, static_cast<size_t>(cornerCount));
+	GLfloat vertex[9];
+	for(size_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex)
+	{
+		const std::vector<ObjCorner>& corners = chunks[chunkIndex].mCorners;
+		for(size_t i = 0; i < corners.size(); ++i)
+		{
+			const GLfloat* pPosition = &positions[static_cast<size_t>(corners[i].mPosition) * 3];
+			const GLfloat* pColor = &colors[static_cast<size_t>(corners[i].mPosition) * 4];
+
+			unsigned int f = 0;
+			vertex[f++] = pPosition[0] * options.mScale;
+			vertex[f++] = pPosition[1] * options.mScale;
+			vertex[f++] = pPosition[2] * options.mScale;
+			if(mesh.mHasTexCoords == true)
+			{
+				if(corners[i].mTexCoord != kNoTexCoord)
+				{
+					vertex[f++] = texCoords[static_cast<size_t>(corners[i].mTexCoord) * 2];
+					vertex[f++] = texCoords[static_cast<size_t>(corners[i].mTexCoord) * 2 + 1];
+				}
+				else
+				{
+					vertex[f++] = 0.0f;
+					vertex[f++] = 0.0f;
+				}
+			}
+			vertex[f++] = pColor[0];
+			vertex[f++] = pColor[1];
+			vertex[f++] = pColor[2];
+			vertex[f++] = pColor[3];
+
+			mesh.mIndices.push_back(welder.Add(vertex));
+		}
+	}
+	welder.TakeVertices(mesh.mVertices);
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+//=============================================================================
+// File:		ObjImporter.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	ObjImporter. Reads Wavefront OBJ files with a chunked, multithreaded tokenizer.
+//=============================================================================
+
+#ifndef OBJIMPORTER_H
+#define OBJIMPORTER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Daniel Schenker
+#include "MeshImporter.h"
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMeshImporter
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		The file is mapped and cut into chunks at line boundaries, and every chunk is tokenized by its own job into chunk local arrays.
+		Negative (relative) indices are resolved afterwards, once each chunk knows how many positions and texture coordinates came before it,
+		and finally the triangle corners are welded into an indexed mesh.
+	Notes:
+		Reads v (with the common "v x y z r g b [a]" vertex color extension), vt and f. Polygons are triangulated as fans.
+		Everything else (vn, o, g, s, usemtl, mtllib, ...) is skipped; normals are not part of ModelAsset's layout.
+		All objects and groups are merged into one mesh.
+	*/
+	class ObjImporter
+	{
+	private:
+		//Constructors
+		ObjImporter();
+
+		//Member Functions
+	public:
+		// General
+		static bool Import(const char* pPath, const DSMeshImporter::ImportOptions& options, DSMeshImporter::ImportedMesh& mesh);
+	};
+
+}//namespace DSMeshImporter
+
+#endif //#ifndef OBJIMPORTER_H
\ No newline at end of file
@@ -0,0 +1,172 @@
+//=============================================================================
+// File:		VertexWelder.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	VertexWelder
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+// Daniel Schenker
+#include "VertexWelder.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	const GLuint kEmpty = 0xFFFFFFFF;//an unused slot in the table
+	const unsigned int kMaxFloatsPerVertex = 16;
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+/*
+Variables:
+	expectedVertexCount = an upper bound on the number of unique vertices (eg. the corner count) sizes the table so it never has to grow.
+*/
+DSMeshImporter::VertexWelder::VertexWelder(unsigned int floatsPerVertex, size_t expectedVertexCount)
+:	mkFloatsPerVertex(floatsPerVertex)
+,	mMask(0)
+{
+	if(mkFloatsPerVertex == 0 || mkFloatsPerVertex > kMaxFloatsPerVertex)
+	{
+		throw std::runtime_error("ERROR: VertexWelder supports 1 to 16 floats per vertex.");
+	}
+
+	//At most half full
+	size_t tableSize = 64;
+	while(tableSize < expectedVertexCount * 2)
+	{
+		tableSize *= 2;
+	}
+	mTable.assign(tableSize, kEmpty);
+	mMask = tableSize - 1;
+
+	mVertices.reserve(expectedVertexCount * mkFloatsPerVertex);
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Returns the index of the vertex equal to pVertex, adding it first if there is none.
+*/
+GLuint DSMeshImporter::VertexWelder::Add(const GLfloat* pVertex)
+{
+	//-0 and 0 compare equal but differ in their bits, so make them the same vertex
+	GLfloat vertex[kMaxFloatsPerVertex];
+	for(unsigned int i = 0; i < mkFloatsPerVertex; ++i)
+	{
+		vertex[i] = pVertex[i] == 0.0f ? 0.0f : pVertex[i];
+	}
+
+	size_t slot = Hash(vertex, mkFloatsPerVertex) & mMask;
+	while(mTable[slot] != kEmpty)
+	{
+		if(memcmp(&mVertices[static_cast<size_t>(mTable[slot]) * mkFloatsPerVertex], vertex, mkFloatsPerVertex * sizeof(GLfloat)) == 0)
+		{
+			return mTable[slot];
+		}
+		slot = (slot + 1) & mMask;
+	}
+
+	GLuint index = static_cast<GLuint>(GetVertexCount());
+	if(index == kEmpty)
+	{
+		throw std::runtime_error("ERROR: VertexWelder ran out of 32 bit indices.");
+	}
+	mVertices.insert(mVertices.end(), vertex, vertex + mkFloatsPerVertex);
+	mTable[slot] = index;
+
+	if(GetVertexCount() * 2 > mTable.size())
+	{
+		Grow();
+	}
+
+	return index;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Moves the welded vertices into vertices. The welder is empty afterwards.
+*/
+void DSMeshImporter::VertexWelder::TakeVertices(std::vector<GLfloat>& vertices)
+{
+	vertices.swap(mVertices);
+	mVertices.clear();
+	mTable.assign(mTable.size(), kEmpty);
+}
+
+//-----------------------------------------------------------------------------
+// Getters
+//-----------------------------------------------------------------------------
+
+size_t DSMeshImporter::VertexWelder::GetVertexCount() const
+{
+	return mVertices.size() / mkFloatsPerVertex;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+//  Helpers
+
+/*
+Notes:
+	FNV-1a over the float bits, 32 bits at a time, then mixed so that the low bits used for the slot depend on every input bit.
+*/
+unsigned int DSMeshImporter::VertexWelder::Hash(const GLfloat* pVertex, unsigned int floatCount)
+{
+	uint32_t hash = 2166136261u;
+	for(unsigned int i = 0; i < floatCount; ++i)
+	{
+		uint32_t bits;
+		memcpy(&bits, &pVertex[i], sizeof(bits));
+		hash = (hash ^ bits) * 16777619u;
+	}
+
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6Bu;
+	hash ^= hash >> 13;
+	return hash;
+}
+
+//-----------------------------------------------------------------------------
+
+void DSMeshImporter::VertexWelder::Grow()
+{
+	mTable.assign(mTable.size() * 2, kEmpty);
+	mMask = mTable.size() - 1;
+
+	GLuint vertexCount = static_cast<GLuint>(GetVertexCount());
+	for(GLuint index = 0; index < vertexCount; ++index)
+	{
+		size_t slot = Hash(&mVertices[static_cast<size_t>(index) * mkFloatsPerVertex], mkFloatsPerVertex) & mMask;
+		while(mTable[slot] != kEmpty)
+		{
+			slot = (slot + 1) & mMask;
+		}
+		mTable[slot] = index;
+	}
+}
\ No newline at end of file
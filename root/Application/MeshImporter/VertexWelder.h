@@ -0,0 +1,81 @@
+//=============================================================================
+// File:		VertexWelder.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	VertexWelder. Deduplicates vertices with identical contents, building an indexed mesh from triangle corners.
+//=============================================================================
+
+#ifndef VERTEXWELDER_H
+#define VERTEXWELDER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  GLEW
+#include <GL/glew.h>
+
+// Standard C++ Libraries
+#include <vector>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSMeshImporter
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		An open addressing hash table (linear probing) of indices into the welded vertex array, hashed on the vertex's bits.
+		Nothing is stored per entry besides the index, so the table stays small and probing stays in cache far longer than a node based map would.
+	Usage:
+		DSMeshImporter::VertexWelder welder(9, cornerCount);
+		indices.push_back(welder.Add(pCorner));
+		...
+		welder.TakeVertices(mesh.mVertices);
+	Notes:
+		Vertices are equal only if every float is bitwise equal (with -0 treated as 0), so nearly equal vertices are kept apart.
+	*/
+	class VertexWelder
+	{
+	public:
+		//Constructors
+		VertexWelder(unsigned int floatsPerVertex, size_t expectedVertexCount);
+
+	private:
+		//Disable Copy Constructor
+		VertexWelder(const VertexWelder&);
+		const VertexWelder& operator=(const VertexWelder&);
+
+		//Member Functions
+	public:
+		// General
+		GLuint Add(const GLfloat* pVertex);
+		void TakeVertices(std::vector<GLfloat>& vertices);
+
+		// Getters
+		size_t GetVertexCount() const;
+
+	private:
+		// Helpers
+		static unsigned int Hash(const GLfloat* pVertex, unsigned int floatCount);
+		void Grow();
+
+		//Member Variables
+	private:
+		const unsigned int mkFloatsPerVertex;
+		std::vector<GLfloat> mVertices;
+		std::vector<GLuint> mTable;
+		size_t mMask;//mTable.size() - 1
+	};
+
+}//namespace DSMeshImporter
+
+#endif //#ifndef VERTEXWELDER_H
\ No newline at end of file
@@ -0,0 +1,134 @@
+//=============================================================================
+// File:		Main.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	Packer entry point.
+//				Usage: Packer.exe output.dspack (directory|archive.zip) [--level 1-9] [--threads count]
+//				       Packer.exe --list pack.dspack
+//				eg. Packer.exe ../../Resources/Resources.dspack ../../Resources
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <cstdlib>
+#include <cstring>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "PackSources.h"
+#include "PackWriter.h"
+#include "../Main/DSProfiling/Profiler.h"
+#include "../Main/DSSystem/PackFile.h"
+#include "../Main/DSThreading/JobSystem.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	bool GetIsZip(const char* pPath)
+	{
+		size_t length = strlen(pPath);
+		return length >= 4 && (strcmp(pPath + length - 4, ".zip") == 0 || strcmp(pPath + length - 4, ".ZIP") == 0);
+	}
+
+	int List(const char* pPath)
+	{
+		DSSystem::PackFile pack(pPath);
+		if(pack.GetIsLoaded() == false)
+		{
+			return 1;
+		}
+
+		for(unsigned int i = 0; i < pack.GetEntryCount(); ++i)
+		{
+			const DSSystem::PackEntry& entry = pack.GetEntry(i);
+			unsigned long long storedSize = entry.mSize;
+			if(entry.mChunkCount > 0)
+			{
+				storedSize = 0;
+				for(unsigned int j = 0; j < entry.mChunkCount; ++j)
+				{
+					storedSize += pack.GetChunk(entry.mFirstChunk + j).mStoredSize;
+				}
+			}
+			printf("%10u %10llu  %-10s %s\n", entry.mSize, storedSize, entry.mChunkCount > 0 ? "compressed" : "stored", pack.GetName(entry));
+		}
+		printf("%u entries\n", pack.GetEntryCount());
+		return 0;
+	}
+}
+
+//=============================================================================
+//Main
+//=============================================================================
+
+int main(int argc, char* argv[])
+{
+	if(argc == 3 && strcmp(argv[1], "--list") == 0)
+	{
+		return List(argv[2]);
+	}
+	if(argc < 3)
+	{
+		fprintf(stderr, "Usage: Packer.exe output.dspack (directory|archive.zip) [--level 1-9] [--threads count]\n");
+		fprintf(stderr, "       Packer.exe --list pack.dspack\n");
+		return 1;
+	}
+
+	const char* pOutput = argv[1];
+	const char* pInput = argv[2];
+	int level = 9;
+	unsigned int workerCount = 0;
+
+	//Arguments
+	for(int i = 3; i + 1 < argc; i += 2)
+	{
+		if(strcmp(argv[i], "--level") == 0)
+		{
+			level = atoi(argv[i + 1]);
+		}
+		else if(strcmp(argv[i], "--threads") == 0)
+		{
+			workerCount = static_cast<unsigned int>(atoi(argv[i + 1]));
+		}
+		else
+		{
+			fprintf(stderr, "WARNING: Unknown argument \"%s\".\n", argv[i]);
+		}
+	}
+	if(level < 1 || level > 9)
+	{
+		level = 9;
+	}
+
+	//The profiler provides the timer; its zones stay disabled as there is no viewer to send them to
+	DSProfiling::Profiler::Initialize();
+	DSProfiling::Profiler::SetIsEnabled(false);
+	DSThreading::JobSystem::Initialize(workerCount);
+
+	unsigned long long start = DSProfiling::Profiler::GetTicks();
+	DSPacker::PackWriter writer(level);
+	bool isRead = GetIsZip(pInput) == true ? DSPacker::PackSources::AddZip(pInput, writer) : DSPacker::PackSources::AddDirectory(pInput, writer);
+	DSPacker::PackWriterStats stats;
+	bool isWritten = isRead == true && writer.Write(pOutput, stats);
+	unsigned long long end = DSProfiling::Profiler::GetTicks();
+
+	if(isWritten == true)
+	{
+		printf("%s -> %s\n", pInput, pOutput);
+		printf("  Entries:    %u (%u stored uncompressed)\n", stats.mEntryCount, stats.mStoredCount);
+		printf("  Size:       %.1f KB -> %.1f KB\n", stats.mInputBytes / 1024.0, stats.mFileBytes / 1024.0);
+		printf("  Time:       %.1f ms\n", DSProfiling::Profiler::TicksToMs(end - start));
+	}
+
+	DSThreading::JobSystem::Terminate();
+	DSProfiling::Profiler::Terminate();
+
+	return isWritten == true ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,205 @@
+//=============================================================================
+// File:		PackSources.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	PackSources
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Platform
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <dirent.h>
+	#include <sys/stat.h>
+#endif
+
+// Third-Party Libraries
+//  minizip
+#include <unzip.h>
+
+// Standard C++ Libraries
+#include <cstring>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+// Daniel Schenker
+#include "PackSources.h"
+#include "PackWriter.h"
+#include "../Main/DSSystem/MappedFile.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	bool GetIsPack(const std::string& name)
+	{
+		return name.size() >= 7 && name.compare(name.size() - 7, 7, ".dspack") == 0;
+	}
+
+	bool AddFile(const std::string& path, const std::string& name, DSPacker::PackWriter& writer)
+	{
+		if(GetIsPack(name) == true)
+		{
+			return true;
+		}
+
+		DSSystem::MappedFile file(path.c_str());
+		if(file.GetIsMapped() == false)
+		{
+			return false;
+		}
+		return writer.Add(name.c_str(), file.GetData(), file.GetSize());
+	}
+
+	//Adds the files below pDirectory/name, recursively. name is "" or ends in '/'.
+	bool AddFiles(const std::string& directory, const std::string& name, DSPacker::PackWriter& writer)
+	{
+		bool isAdded = true;
+
+#if defined(_WIN32)
+		WIN32_FIND_DATAA found;
+		HANDLE search = FindFirstFileA((directory + name + "*").c_str(), &found);
+		if(search == INVALID_HANDLE_VALUE)
+		{
+			fprintf(stderr, "WARNING: Could not list \"%s%s\".\n", directory.c_str(), name.c_str());
+			return false;
+		}
+		do
+		{
+			std::string child(found.cFileName);
+			if(child == "." || child == "..")
+			{
+				continue;
+			}
+			if((found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+			{
+				isAdded = AddFiles(directory, name + child + "/", writer) && isAdded;
+			}
+			else
+			{
+				isAdded = AddFile(directory + name + child, name + child, writer) && isAdded;
+			}
+		}
+		while(FindNextFileA(search, &found) != FALSE);
+		FindClose(search);
+#else
+		DIR* pDirectory = opendir((directory + name).c_str());
+		if(pDirectory == nullptr)
+		{
+			fprintf(stderr, "WARNING: Could not list \"%s%s\".\n", directory.c_str(), name.c_str());
+			return false;
+		}
+		for(dirent* pEntry = readdir(pDirectory); pEntry != nullptr; pEntry = readdir(pDirectory))
+		{
+			std::string child(pEntry->d_name);
+			struct stat status;
+			if(child == "." || child == ".." || stat((directory + name + child).c_str(), &status) != 0)
+			{
+				continue;
+			}
+			if(S_ISDIR(status.st_mode))
+			{
+				isAdded = AddFiles(directory, name + child + "/", writer) && isAdded;
+			}
+			else
+			{
+				isAdded = AddFile(directory + name + child, name + child, writer) && isAdded;
+			}
+		}
+		closedir(pDirectory);
+#endif
+
+		return isAdded;
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Adds every file below pDirectory. Returns false if any of them could not be read; the rest are still added.
+*/
+bool DSPacker::PackSources::AddDirectory(const char* pDirectory, DSPacker::PackWriter& writer)
+{
+	std::string directory(pDirectory);
+	if(directory.empty() == false && directory[directory.size() - 1] != '/' && directory[directory.size() - 1] != '\\')
+	{
+		directory += '/';
+	}
+	return AddFiles(directory, "", writer);
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Adds every file in a zip archive, which is how content usually arrives from outside tools.
+Notes:
+	Read with minizip, so stored, deflated and zip64 archives all work; encrypted entries do not.
+*/
+bool DSPacker::PackSources::AddZip(const char* pZipPath, DSPacker::PackWriter& writer)
+{
+	unzFile zip = unzOpen64(pZipPath);
+	if(zip == nullptr)
+	{
+		fprintf(stderr, "WARNING: Could not open the zip archive \"%s\".\n", pZipPath);
+		return false;
+	}
+
+	bool isAdded = true;
+	std::vector<unsigned char> data;
+	for(int result = unzGoToFirstFile(zip); result == UNZ_OK; result = unzGoToNextFile(zip))
+	{
+		char name[1024];
+		unz_file_info64 info;
+		if(unzGetCurrentFileInfo64(zip, &info, name, sizeof(name), nullptr, 0, nullptr, 0) != UNZ_OK)
+		{
+			isAdded = false;
+			continue;
+		}
+		size_t nameLength = strlen(name);
+		if(nameLength == 0 || name[nameLength - 1] == '/' || GetIsPack(name) == true)
+		{
+			continue;//directories
+		}
+
+		data.resize(static_cast<size_t>(info.uncompressed_size));
+		int read = -1;
+		if(unzOpenCurrentFile(zip) == UNZ_OK)
+		{
+			read = data.empty() == false ? unzReadCurrentFile(zip, &data[0], static_cast<unsigned int>(data.size())) : 0;
+			if(unzCloseCurrentFile(zip) != UNZ_OK)//checks the CRC
+			{
+				read = -1;
+			}
+		}
+		if(read < 0 || static_cast<size_t>(read) != data.size())
+		{
+			fprintf(stderr, "WARNING: Could not read \"%s\" from \"%s\".\n", name, pZipPath);
+			isAdded = false;
+			continue;
+		}
+
+		isAdded = writer.Add(name, data.empty() == false ? &data[0] : nullptr, data.size()) && isAdded;
+	}
+
+	unzClose(zip);
+	return isAdded;
+}
\ No newline at end of file
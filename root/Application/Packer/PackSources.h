@@ -0,0 +1,52 @@
+//=============================================================================
+// File:		PackSources.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	PackSources. Adds the files of a directory or a zip archive to a PackWriter.
+//=============================================================================
+
+#ifndef PACKSOURCES_H
+#define PACKSOURCES_H
+
+//=============================================================================
+//Forward Declarations
+//=============================================================================
+
+namespace DSPacker
+{
+	class PackWriter;
+}
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSPacker
+{
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Notes:
+		Entries are named by their path relative to the directory (or within the zip), with '/' separators.
+		Existing .dspack files are skipped, so a pack can be rebuilt into the directory it was built from.
+	*/
+	class PackSources
+	{
+	private:
+		//Constructors
+		PackSources();
+
+		//Member Functions
+	public:
+		// General
+		static bool AddDirectory(const char* pDirectory, DSPacker::PackWriter& writer);
+		static bool AddZip(const char* pZipPath, DSPacker::PackWriter& writer);
+	};
+
+}//namespace DSPacker
+
+#endif //#ifndef PACKSOURCES_H
\ No newline at end of file
@@ -0,0 +1,358 @@
+//=============================================================================
+// File:		PackWriter.cpp
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	PackWriter
+//=============================================================================
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Third-Party Libraries
+//  zlib
+#include <zlib.h>
+
+// Standard C++ Libraries
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <stdio.h>
+
+// Daniel Schenker
+#include "PackWriter.h"
+#include "../Main/DSProfiling/Profiler.h"
+#include "../Main/DSSystem/PackFile.h"
+#include "../Main/DSThreading/JobSystem.h"
+
+//=============================================================================
+//Statics
+//=============================================================================
+
+namespace
+{
+	const unsigned int kMaxBucketBits = 24;
+
+	struct ChunkWork
+	{
+		const unsigned char* mpSource;
+		unsigned int mSize;
+		bool mIsRaw;//did not compress
+		std::vector<unsigned char> mOutput;
+	};
+
+	struct CompressData
+	{
+		std::vector<ChunkWork>* mpChunks;
+		int mLevel;
+	};
+
+	//Where each file goes in the pack
+	struct Placement
+	{
+		unsigned int mFile;
+		uint64_t mHash;
+		unsigned int mFirstWork;//into the ChunkWork array
+		unsigned int mChunkCount;
+		bool mIsCompressed;
+	};
+
+	bool ComparePlacements(const Placement& a, const Placement& b)
+	{
+		return a.mHash < b.mHash;
+	}
+
+	//The same file to PackFile::Find, which ignores case and treats both slashes alike
+	bool GetIsSameName(const std::string& a, const std::string& b)
+	{
+		if(a.size() != b.size())
+		{
+			return false;
+		}
+		for(size_t i = 0; i < a.size(); ++i)
+		{
+			char ca = a[i] == '\\' ? '/' : static_cast<char>(tolower(static_cast<unsigned char>(a[i])));
+			char cb = b[i] == '\\' ? '/' : static_cast<char>(tolower(static_cast<unsigned char>(b[i])));
+			if(ca != cb)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	unsigned long long AlignUp(unsigned long long value, unsigned long long alignment)
+	{
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	void CompressChunks(unsigned int begin, unsigned int end, void* pUserData)
+	{
+		CompressData& data = *static_cast<CompressData*>(pUserData);
+		for(unsigned int i = begin; i < end; ++i)
+		{
+			ChunkWork& work = (*data.mpChunks)[i];
+			work.mOutput.resize(compressBound(work.mSize));
+			uLongf size = static_cast<uLongf>(work.mOutput.size());
+			work.mIsRaw = compress2(&work.mOutput[0], &size, work.mpSource, work.mSize, data.mLevel) != Z_OK || size >= work.mSize;
+			work.mOutput.resize(work.mIsRaw == true ? 0 : size);
+		}
+	}
+
+	bool WriteBytes(FILE* pFile, const void* pData, size_t bytes, unsigned long long& written)
+	{
+		written += bytes;
+		return bytes == 0 || fwrite(pData, 1, bytes, pFile) == bytes;
+	}
+
+	bool WritePadding(FILE* pFile, unsigned long long alignment, unsigned long long& written)
+	{
+		static const unsigned char kZeros[DSSystem::PackFile::kStoredAlignment] = {};
+		size_t padding = static_cast<size_t>(AlignUp(written, alignment) - written);
+		return WriteBytes(pFile, kZeros, padding, written);
+	}
+}
+
+//=============================================================================
+//Class Definitions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constuctors
+//-----------------------------------------------------------------------------
+
+/*
+Notes:
+	compressionLevel is zlib's, 1 (fastest) to 9 (smallest). Inflating is about as fast whichever was used.
+*/
+DSPacker::PackWriter::PackWriter(int compressionLevel)
+:	mCompressionLevel(compressionLevel)
+{
+}
+
+//-----------------------------------------------------------------------------
+// Public Member Functions
+//-----------------------------------------------------------------------------
+//  General
+
+/*
+Description:
+	Copies a file into the pack, as pName. Names are relative to the packed directory, eg. "Textures/stripes.png".
+*/
+bool DSPacker::PackWriter::Add(const char* pName, const unsigned char* pData, size_t size)
+{
+	if(size > 0xFFFFFFFFu)
+	{
+		fprintf(stderr, "WARNING: \"%s\" is too large to pack.\n", pName);
+		return false;
+	}
+
+	mFiles.push_back(File());
+	mFiles.back().mName = pName;
+	mFiles.back().mData.assign(pData, pData + size);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+
+/*
+Description:
+	Compresses everything added and writes the pack to pPath.
+Notes:
+	If two files have the same name (ignoring case and slashes), the first added is kept.
+*/
+bool DSPacker::PackWriter::Write(const char* pPath, DSPacker::PackWriterStats& stats)
+{
+	const unsigned int kChunkSize = DSSystem::PackFile::kChunkSize;
+	memset(&stats, 0, sizeof(stats));
+
+	//Index order, dropping duplicates
+	std::vector<Placement> placements;
+	for(unsigned int i = 0; i < mFiles.size(); ++i)
+	{
+		Placement placement;
+		placement.mFile = i;
+		placement.mHash = DSSystem::PackFile::Hash(mFiles[i].mName.c_str());
+		placement.mFirstWork = 0;
+		placement.mChunkCount = 0;
+		placement.mIsCompressed = false;
+		placements.push_back(placement);
+	}
+	std::stable_sort(placements.begin(), placements.end(), ComparePlacements);
+	for(size_t i = 1; i < placements.size(); ++i)
+	{
+		for(size_t j = i; j-- > 0 && placements[j].mHash == placements[i].mHash;)
+		{
+			if(GetIsSameName(mFiles[placements[j].mFile].mName, mFiles[placements[i].mFile].mName) == true)
+			{
+				fprintf(stderr, "WARNING: \"%s\" is in the pack twice; keeping the first.\n", mFiles[placements[i].mFile].mName.c_str());
+				placements.erase(placements.begin() + i);
+				--i;
+				break;
+			}
+		}
+	}
+
+	//Compress every chunk of every file in parallel
+	std::vector<ChunkWork> chunks;
+	for(size_t i = 0; i < placements.size(); ++i)
+	{
+		const File& file = mFiles[placements[i].mFile];
+		size_t size = file.mData.size();
+		placements[i].mFirstWork = static_cast<unsigned int>(chunks.size());
+		placements[i].mChunkCount = static_cast<unsigned int>((size + kChunkSize - 1) / kChunkSize);
+		for(size_t offset = 0; offset < size; offset += kChunkSize)
+		{
+			ChunkWork work;
+			work.mpSource = &file.mData[offset];
+			work.mSize = static_cast<unsigned int>(std::min<size_t>(kChunkSize, size - offset));
+			work.mIsRaw = true;
+			chunks.push_back(work);
+		}
+	}
+	{
+		CompressData data;
+		data.mpChunks = &chunks;
+		data.mLevel = mCompressionLevel;
+		unsigned int workCount = static_cast<unsigned int>(chunks.size());
+		DSThreading::JobSystem::ParallelFor("PackWriter Compress", 0, workCount, DSThreading::JobSystem::GetGrainSize(workCount), CompressChunks, &data);
+	}
+
+	//Keep a file compressed only if that is worth inflating it for
+	unsigned int chunkCount = 0;
+	for(size_t i = 0; i < placements.size(); ++i)
+	{
+		Placement& placement = placements[i];
+		unsigned long long size = mFiles[placement.mFile].mData.size();
+		unsigned long long compressedSize = placement.mChunkCount * sizeof(DSSystem::PackChunk);
+		for(unsigned int j = 0; j < placement.mChunkCount; ++j)
+		{
+			const ChunkWork& work = chunks[placement.mFirstWork + j];
+			compressedSize += work.mIsRaw == true ? work.mSize : work.mOutput.size();
+		}
+		placement.mIsCompressed = size > 0 && compressedSize <= size - size / 8;
+		chunkCount += placement.mIsCompressed == true ? placement.mChunkCount : 0;
+	}
+
+	//Layout
+	DSSystem::PackHeader header;
+	memset(&header, 0, sizeof(header));
+	header.mMagic = DSSystem::PackFile::kMagic;
+	header.mVersion = DSSystem::PackFile::kVersion;
+	header.mEntryCount = static_cast<uint32_t>(placements.size());
+	while(header.mBucketBits < kMaxBucketBits && (1u << header.mBucketBits) < header.mEntryCount)
+	{
+		++header.mBucketBits;
+	}
+	header.mChunkCount = chunkCount;
+	unsigned int bucketCount = 1u << header.mBucketBits;
+
+	std::vector<uint32_t> buckets(bucketCount + 1, 0);
+	std::vector<DSSystem::PackEntry> entries(placements.size());
+	std::vector<DSSystem::PackChunk> packChunks;
+	std::vector<char> names;
+	for(size_t i = 0; i < placements.size(); ++i)
+	{
+		const std::string& name = mFiles[placements[i].mFile].mName;
+		entries[i].mHash = placements[i].mHash;
+		entries[i].mNameOffset = static_cast<uint32_t>(names.size());
+		names.insert(names.end(), name.c_str(), name.c_str() + name.size() + 1);
+
+		unsigned int bucket = header.mBucketBits == 0 ? 0 : static_cast<unsigned int>(placements[i].mHash >> (64 - header.mBucketBits));
+		++buckets[bucket + 1];
+	}
+	for(unsigned int i = 0; i < bucketCount; ++i)
+	{
+		buckets[i + 1] += buckets[i];//counts to first entries
+	}
+
+	header.mBucketOffset = AlignUp(sizeof(header), 8);
+	header.mEntryOffset = AlignUp(header.mBucketOffset + buckets.size() * sizeof(uint32_t), 8);
+	header.mChunkOffset = header.mEntryOffset + entries.size() * sizeof(DSSystem::PackEntry);
+	header.mNamesOffset = header.mChunkOffset + static_cast<unsigned long long>(chunkCount) * sizeof(DSSystem::PackChunk);
+	header.mNamesSize = static_cast<uint32_t>(names.size());
+
+	unsigned long long offset = header.mNamesOffset + names.size();
+	for(size_t i = 0; i < placements.size(); ++i)
+	{
+		const Placement& placement = placements[i];
+		DSSystem::PackEntry& entry = entries[i];
+		entry.mSize = static_cast<uint32_t>(mFiles[placement.mFile].mData.size());
+		if(placement.mIsCompressed == false)
+		{
+			offset = AlignUp(offset, DSSystem::PackFile::kStoredAlignment);
+			entry.mOffset = offset;
+			entry.mFirstChunk = 0;
+			entry.mChunkCount = 0;
+			offset += entry.mSize;
+			++stats.mStoredCount;
+			continue;
+		}
+
+		entry.mOffset = 0;
+		entry.mFirstChunk = static_cast<uint32_t>(packChunks.size());
+		entry.mChunkCount = placement.mChunkCount;
+		for(unsigned int j = 0; j < placement.mChunkCount; ++j)
+		{
+			const ChunkWork& work = chunks[placement.mFirstWork + j];
+			DSSystem::PackChunk chunk;
+			chunk.mOffset = offset;
+			chunk.mSize = work.mSize;
+			chunk.mStoredSize = work.mIsRaw == true ? work.mSize : static_cast<uint32_t>(work.mOutput.size());
+			packChunks.push_back(chunk);
+			offset += chunk.mStoredSize;
+		}
+	}
+	header.mFileSize = offset;
+
+	//Write
+	FILE* pFile = nullptr;
+	if(fopen_s(&pFile, pPath, "wb") != 0 || pFile == nullptr)
+	{
+		fprintf(stderr, "WARNING: Could not open \"%s\" for writing.\n", pPath);
+		return false;
+	}
+
+	unsigned long long written = 0;
+	bool isWritten = WriteBytes(pFile, &header, sizeof(header), written)
+		&& WritePadding(pFile, 8, written)
+		&& WriteBytes(pFile, &buckets[0], buckets.size() * sizeof(uint32_t), written)
+		&& WritePadding(pFile, 8, written)
+		&& WriteBytes(pFile, entries.empty() == false ? &entries[0] : nullptr, entries.size() * sizeof(DSSystem::PackEntry), written)
+		&& WriteBytes(pFile, packChunks.empty() == false ? &packChunks[0] : nullptr, packChunks.size() * sizeof(DSSystem::PackChunk), written)
+		&& WriteBytes(pFile, names.empty() == false ? &names[0] : nullptr, names.size(), written);
+
+	for(size_t i = 0; isWritten == true && i < placements.size(); ++i)
+	{
+		const Placement& placement = placements[i];
+		const std::vector<unsigned char>& data = mFiles[placement.mFile].mData;
+		if(placement.mIsCompressed == false)
+		{
+			isWritten = WritePadding(pFile, DSSystem::PackFile::kStoredAlignment, written)
+				&& WriteBytes(pFile, data.empty() == false ? &data[0] : nullptr, data.size(), written);
+			continue;
+		}
+
+		for(unsigned int j = 0; isWritten == true && j < placement.mChunkCount; ++j)
+		{
+			const ChunkWork& work = chunks[placement.mFirstWork + j];
+			isWritten = work.mIsRaw == true ? WriteBytes(pFile, work.mpSource, work.mSize, written) : WriteBytes(pFile, &work.mOutput[0], work.mOutput.size(), written);
+		}
+	}
+
+	isWritten = fclose(pFile) == 0 && isWritten == true && written == header.mFileSize;
+	if(isWritten == false)
+	{
+		fprintf(stderr, "WARNING: Could not write \"%s\".\n", pPath);
+		return false;
+	}
+
+	stats.mEntryCount = header.mEntryCount;
+	for(size_t i = 0; i < placements.size(); ++i)
+	{
+		stats.mInputBytes += mFiles[placements[i].mFile].mData.size();
+	}
+	stats.mFileBytes = header.mFileSize;
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+//=============================================================================
+// File:		PackWriter.h
+// Created:		2026/10/19
+// Last Edited:	2026/10/19
+// Copyright:	Daniel Schenker
+// Description:	PackWriter. Builds a resource pack (.dspack) for DSSystem::PackFile.
+//=============================================================================
+
+#ifndef PACKWRITER_H
+#define PACKWRITER_H
+
+//=============================================================================
+//Includes
+//=============================================================================
+
+// Standard C++ Libraries
+#include <string>
+#include <vector>
+
+//=============================================================================
+//Namespace
+//=============================================================================
+
+namespace DSPacker
+{
+
+	//=============================================================================
+	//Structs
+	//=============================================================================
+
+	struct PackWriterStats
+	{
+		unsigned int mEntryCount;
+		unsigned int mStoredCount;//entries kept uncompressed
+		unsigned long long mInputBytes;
+		unsigned long long mFileBytes;
+	};
+
+	//=============================================================================
+	//Class Declarations
+	//=============================================================================
+
+	/*
+	Description:
+		Collects named files, then writes them as one pack. Every kChunkSize chunk of every file is compressed by its own job,
+		and a file is only kept compressed if that saves at least an eighth of its size; anything else (PNGs, mostly) is stored
+		uncompressed on a page boundary, so the game can use it straight from the mapping.
+	Notes:
+		Files are held in memory until Write.
+	*/
+	class PackWriter
+	{
+	public:
+		//Constructors
+		explicit PackWriter(int compressionLevel);
+
+	private:
+		//Disable Copy Constructor
+		PackWriter(const PackWriter&);
+		const PackWriter& operator=(const PackWriter&);
+
+		//Member Functions
+	public:
+		// General
+		bool Add(const char* pName, const unsigned char* pData, size_t size);
+		bool Write(const char* pPath, DSPacker::PackWriterStats& stats);
+
+		//Member Variables
+	private:
+		struct File
+		{
+			std::string mName;
+			std::vector<unsigned char> mData;
+		};
+
+		int mCompressionLevel;
+		std::vector<File> mFiles;
+	};
+
+}//namespace DSPacker
+
+#endif //#ifndef PACKWRITER_H
\ No newline at end of file